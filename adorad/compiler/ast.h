@@ -29,6 +29,11 @@ typedef struct AstNodeDecl AstNodeDecl;
 typedef struct AstNodeTypeDecl AstNodeTypeDecl;
 typedef struct AstNodeIdentifier AstNodeIdentifier;
 
+// Short child lists (arguments, parameters, statements, match branches) are very common, and most of them hold only 
+// a handful of nodes. These are stored inline, and only spill to the heap when they overflow.
+#define AST_NODE_LIST_INLINE_CAP    4
+typedef SMALLVEC(AstNode*, AST_NODE_LIST_INLINE_CAP) AstNodeList;
+
 enum AstNodeKind {
     AstNodeKindIdentifier = 0,
     AstNodeKindBlock,        // `{ ... }
@@ -81,6 +86,8 @@ enum AstNodeKind {
     AstNodeKindUnreachable,
     AstNodeKindMatchBranch,
     AstNodeKindMatchRange,
+
+    AstNodeKindCount
 };
 
 typedef enum VisibilityMode {
@@ -239,18 +246,18 @@ typedef enum FuncCallModifier {
 
 typedef struct AstNodeFuncCallExpr {
     AstNode* func_call_expr;
-    Vec* params;
+    AstNodeList params;
     FuncCallModifier modifier;
 } AstNodeFuncCallExpr;
 
 typedef struct AstNodeMatchExpr {
     AstNode* expr;
-    Vec* branches;
+    AstNodeList branches;
 } AstNodeMatchExpr;
 
 typedef struct AstNodeMatchBranchExpr {
     AstNode* expr;
-    Vec* branches;
+    AstNodeList branches;
     bool any_branches_are_ranges; // if any branch is a range-based match
 } AstNodeMatchBranchExpr;
 
@@ -487,7 +494,7 @@ typedef struct AstNodeAssignmentStatement {
 // `{ ... }`
 typedef struct AstNodeBlock {
     Buff* name; // for labeled block statements
-    Vec* statements;
+    AstNodeList statements;
 } AstNodeBlock;
 
 // break/continue
@@ -516,7 +523,7 @@ typedef enum FuncInline {
 
 typedef struct AstNodeFuncPrototype {
     Buff* name;
-    Vec* params;  // Vec<AstNode*>
+    AstNodeList params;
     AstNode* return_type;
     AstNode* func_def;
 
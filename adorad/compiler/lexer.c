@@ -90,38 +90,57 @@ static const char* tokenHash[] = {
          'b': case 'o': case 'x': case 'B': case 'O': case 'X': case ALPHA_EXCEPT_B_O_X
 
 
-Lexer* lexer_init(char* buffer, const char* fname) {
-    Lexer* lexer = cast(Lexer*)calloc(1, sizeof(Lexer));
+void lexer_register_stats() {
+    stats_register(StatsLexFiles, "lex.files");
+    stats_register(StatsLexBytes, "lex.bytes");
+    stats_register(StatsLexTokens, "lex.tokens");
+
+    char name[MAX_TOKEN_LENGTH + 16];
+    for(UInt32 kind = 0; kind < TOK_COUNT; kind++) {
+        snprintf(name, sizeof(name), "lex.tokens.%s", token_to_str(cast(TokenKind)kind));
+        stats_register(StatsLexTokensByKind + kind, name);
+    }
+}
+
+Lexer* lexer_init(cstlAllocator* allocator, char* buffer, const char* fname) {
+    CORETEN_ENFORCE_NN(allocator, "Expected not null");
+    Lexer* lexer = cstl_new_obj(allocator, Lexer);
 
+    lexer->allocator = allocator;
     lexer->offset = 0;
-    lexer->buffer = buff_new(buffer);
-    lexer->toklist = vec_new(Token, TOKENLIST_ALLOC_CAPACITY);
-    lexer->loc = loc_new(fname);
+    lexer->buffer = buff_new_in(allocator, buffer);
+    lexer->toklist = cstl_new_obj(allocator, TokenList);
+    segvec_init_in(lexer->toklist, allocator);
+    segvec_reserve(lexer->toklist, TOKENLIST_ESTIMATE_CAPACITY(buff_len(lexer->buffer)));
+    lexer->loc = loc_new(allocator, fname);
+    lexer->empty_value = buff_new_in(allocator, null);
 
     return lexer;
 }
 
-static void lexer_toklist_push(Lexer* lexer, Token* token) {
-    vec_push(lexer->toklist, token);
-}
-
+// Release the token list. Everything else the Lexer allocated is expected to be released in bulk, along with 
+// `lexer->allocator` (typically an arena)
 static void lexer_free(Lexer* lexer) {
-    if(lexer) {
-        vec_free(lexer->toklist);
-        buff_free(lexer->buffer);
-        loc_free(lexer->loc);
-        free(lexer);
-    }
+    if(lexer)
+        segvec_free(lexer->toklist);
 }
 
 // Report an error and exit
 void lexer_error(Lexer* lexer, Error err, const char* format, ...) {
+    // Assembled in one buffer and written in one go (stderr is unbuffered)
+    char buffer[1024];
+    cstlWriter writer;
+    writer_init_file(&writer, stderr, buffer, sizeof(buffer));
+
     va_list vl;
     va_start(vl, format);
-    fprintf(stderr, "%s%s: ", "\033[1;31m", error_str(err));
-    vfprintf(stderr, format, vl);
-    fprintf(stderr, " at %s:%d:%d%s\n", lexer->loc->fname->data, lexer->loc->line,lexer->loc->col, "\033[0m");
+    writer_str(&writer, "\033[1;31m");
+    writer_str(&writer, error_str(err));
+    writer_str(&writer, ": ");
+    writer_vprintf(&writer, format, vl);
+    writer_printf(&writer, " at %s:%d:%d%s\n", lexer->loc->fname->data, lexer->loc->line,lexer->loc->col, "\033[0m");
     va_end(vl);
+    writer_flush(&writer);
     exit(1);
 }
 
@@ -179,25 +198,20 @@ static inline char lexer_peekn(Lexer* lexer, UInt32 n) {
     return (char)lexer->buffer->data[lexer->offset + n];
 }
 
+// `value` is kept as is (it's expected to come from `lexer->allocator`). Tokens without a value of their own (a 
+// null `value`) share `lexer->empty_value`
 static void lexer_maketoken(Lexer* lexer, TokenKind kind, Buff* value, UInt32 offset, UInt32 line, UInt32 col) {  
-    Token* token = token_init();
-    CORETEN_ENFORCE_NN(token, "Could not allocate memory. Memory full.");
-
-    if(!value->data) {
-        value = token_to_buff(kind);
-
+    if(!value) {
         if(kind == STRING || kind == IDENTIFIER || kind == INTEGER || kind == HEX_INT || kind == BIN_INT ||
            kind == OCT_INT)
             WARN("Expected a token value. Got `null`\n");
+        value = lexer->empty_value;
     }
 
-    token->kind = kind;
-    token->offset = offset;
-    token->loc->col = col;
-    token->loc->line = line;
-    buff_set(token->value, value->data);
-    buff_set(token->loc->fname, lexer->loc->fname->data);
-    lexer_toklist_push(lexer, token);
+    STATS_INC(StatsLexTokens);
+    STATS_INC(StatsLexTokensByKind + kind);
+    Token token = {kind, offset, value, 0, {line, col, lexer->loc->fname}};
+    segvec_push(lexer->toklist, token);
 }
 
 // Scan a comment (single line)
@@ -210,7 +224,16 @@ static inline void lexer_lex_sl_comment(Lexer* lexer) {
     UInt32 line = lexer->loc->line;
     UInt32 col = lexer->loc->col;
 
-    while(ch && ch != '\n') {
+    if(ch && ch != '\n') {
+        // Jump straight to the end of the line; `lexer_advance()` then consumes the newline (or hits the end)
+        const char* start = lexer->buffer->data + lexer->offset;
+        UInt64 remaining = buff_len(lexer->buffer) - lexer->offset;
+        const char* newline = simd_memchr(start, '\n', remaining);
+        UInt32 skipped = cast(UInt32)(newline ? cast(UInt64)(newline - start) : remaining);
+        lexer->offset += skipped;
+        lexer->loc->col += skipped;
+        comment_length += cast(int)skipped;
+
         ch = lexer_advance(lexer);
         ++comment_length;
     }
@@ -221,7 +244,7 @@ static inline void lexer_lex_sl_comment(Lexer* lexer) {
     if(comment_length == 0) 
         return;
 
-    Buff* comment_value = buff_slice(lexer->buffer, prev_offset, comment_length - 1);
+    Buff* comment_value = buff_slice_in(lexer->allocator, lexer->buffer, prev_offset, comment_length - 1);
     CORETEN_ENFORCE_NN(comment_value, "`comment_value` must not be null");
     lexer_maketoken(lexer, COMMENT, comment_value, prev_offset, line, col);
 
@@ -282,7 +305,7 @@ static inline void lexer_lex_macro(Lexer* lexer) {
 
     UInt32 offset_diff = lexer->offset - prev_offset;
 
-    Buff* macro_value = buff_slice(lexer->buffer, prev_offset - 1, offset_diff);
+    Buff* macro_value = buff_slice_in(lexer->allocator, lexer->buffer, prev_offset - 1, offset_diff);
     CORETEN_ENFORCE_NN(macro_value, "`macro_value` must not be null");
     lexer_maketoken(lexer, MACRO, macro_value, prev_offset - 1, line, col - 1);
 
@@ -316,7 +339,7 @@ static inline void lexer_lex_string(Lexer* lexer) {
     UInt32 offset_diff = lexer->offset - prev_offset;
 
     // `offset_diff - 1` so as to ignore the closing quote `"`
-    Buff* str_value = buff_slice(lexer->buffer, prev_offset, offset_diff - 1);
+    Buff* str_value = buff_slice_in(lexer->allocator, lexer->buffer, prev_offset, offset_diff - 1);
     CORETEN_ENFORCE_NN(str_value, "`str_value` must not be null");
     lexer_maketoken(lexer, STRING, str_value, prev_offset - 1, line, col - 1);
 }
@@ -357,7 +380,7 @@ static inline void lexer_lex_identifier(Lexer* lexer) {
         WARN(An identifier can never have more than 256 characters);
 
     UInt32 offset_diff = lexer->offset - prev_offset;
-    Buff* ident_value = buff_slice(lexer->buffer, prev_offset - 1, offset_diff);
+    Buff* ident_value = buff_slice_in(lexer->allocator, lexer->buffer, prev_offset - 1, offset_diff);
     CORETEN_ENFORCE_NN(ident_value, "`ident_value` must not be null");
 
     // Determine if a keyword or just a regular identifier
@@ -495,7 +518,7 @@ static inline void lexer_lex_digit(Lexer* lexer) {
     // This function is guaranteed to be called when there's at least one "number-like". We simply check if
     // there are more digits to lex.
     // If digit_length = 0, this means that there's only one digit in the number (eg. 0, 2, 9)
-    Buff* digit_value = buff_slice(lexer->buffer, prev_offset, offset_diff - 1);
+    Buff* digit_value = buff_slice_in(lexer->allocator, lexer->buffer, prev_offset, offset_diff - 1);
     CORETEN_ENFORCE_NN(digit_value, "`digit_value` must not be null");
     if(!digit_value)
         printf("digit_value = null\n");
@@ -506,6 +529,10 @@ static inline void lexer_lex_digit(Lexer* lexer) {
 
 // Lex the Source files
 static void lexer_lex(Lexer* lexer) {
+    profile_begin("lex", lexer->loc->fname->data);
+    STATS_INC(StatsLexFiles);
+    STATS_ADD(StatsLexBytes, buff_len(lexer->buffer));
+
     // Some UTF8 text may start with a 3-byte 'BOM' marker sequence. If it exists, skip over them because they 
     // are useless bytes. Generally, it is not recommended to add BOM markers to UTF8 texts, but it's not 
     // uncommon (especially on Windows).
@@ -542,7 +569,7 @@ static void lexer_lex(Lexer* lexer) {
             case '"':
                 switch(next) {
                     // Empty String literal 
-                    case '"': LEXER_INCREMENT_OFFSET; lexer_maketoken(lexer, STRING, buff_new("\"\""), lexer->offset - 1, 
+                    case '"': LEXER_INCREMENT_OFFSET; lexer_maketoken(lexer, STRING, buff_new_in(lexer->allocator, "\"\""), lexer->offset - 1, 
                                                                       lexer->loc->line, lexer->loc->col - 1); 
                               break;
                     default: tokenkind = TOK_NULL; lexer_lex_string(lexer); break;
@@ -716,10 +743,11 @@ static void lexer_lex(Lexer* lexer) {
         } // switch(ch)
 
         if(tokenkind == TOK_NULL) continue;
-        lexer_maketoken(lexer, tokenkind, buff_new(null), lexer->offset - 1, lexer->loc->line, lexer->loc->col - 1);
+        lexer_maketoken(lexer, tokenkind, null, lexer->offset - 1, lexer->loc->line, lexer->loc->col - 1);
     } // while
 
 lex_eof:;
 
-    lexer_maketoken(lexer, TOK_EOF, buff_new(null), lexer->offset - 1, lexer->loc->line, lexer->loc->col - 1);
+    lexer_maketoken(lexer, TOK_EOF, null, lexer->offset - 1, lexer->loc->line, lexer->loc->col - 1);
+    profile_end();
 }
@@ -19,6 +19,10 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #include <adorad/core/vector.h>
 #include <adorad/core/buffer.h>
 #include <adorad/core/debug.h>
+#include <adorad/core/io.h>
+#include <adorad/core/profile.h>
+#include <adorad/core/stats.h>
+#include <adorad/core/simd.h>
 
 #include <adorad/compiler/tokens.h>
 #include <adorad/compiler/location.h>
@@ -36,30 +40,51 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
         1. ASCII Table: http://www.theasciicode.com.ar 
 */
 
-// This macro defines how many tokens we initially expect in lexer->toklist. 
-// When this limit is reached, we realloc using this same constant (TOKENLIST_ALLOC_CAPACITY * sizeof(Token)) bytes 
-// at a time (which works out to around 0.26MB) per (re)allocation
-#define TOKENLIST_ALLOC_CAPACITY    8192
+// `lexer->toklist` is presized from the size of the input, so that lexing a file usually needs a single allocation.
+// On average, a token (along with the whitespace around it) takes up about `TOKENLIST_BYTES_PER_TOKEN` bytes of 
+// source. If this estimate turns out to be too low, the list simply grows.
+#define TOKENLIST_BYTES_PER_TOKEN   4
+#define TOKENLIST_MIN_CAPACITY      64
+#define TOKENLIST_ESTIMATE_CAPACITY(nbytes)    \
+    ((nbytes) / TOKENLIST_BYTES_PER_TOKEN + TOKENLIST_MIN_CAPACITY)
 // Maximum length of an individual token
 #define MAX_TOKEN_LENGTH            256
 
+// The lexer's list of tokens (tokens are stored by value)
+typedef SEGVEC(Token) TokenList;
+
 typedef struct Lexer {
+    cstlAllocator* allocator;   // token values are allocated here
     Buff* buffer;       // the Lexical buffer
     UInt32 offset;      // current buffer offset (in Bytes) 
                         // offset of the curr char (no. of chars b/w the beginning of the Lexical Buffer
                         // and the curr char)
 
-    Vec* toklist;       // list of tokens
-    Location* loc;      // location of the token in the source code
+    TokenList* toklist; // list of tokens
+    Location* loc;      // location of the token in the source code (every token shares `loc->fname`)
+    Buff* empty_value;  // shared (empty) value of the tokens that don't carry one of their own (operators, EOF, ...)
 
     bool is_inside_str; // set to true inside a string
     int nest_level;     // used to infer if we're inside many `{}`s
 } Lexer;
 
-Lexer* lexer_init(char* buffer, const char* fname);
+// Create a new Lexer. All of its allocations come from `allocator`, which is expected to live for as long as the 
+// tokens are in use (typically, an arena for the whole compilation unit)
+Lexer* lexer_init(cstlAllocator* allocator, char* buffer, const char* fname);
 static void lexer_free(Lexer* lexer);
 void lexer_error(Lexer* lexer, Error e, const char* format, ...);
 // Lex the source files
 static void lexer_lex(Lexer* lexer);
 
+// Lexer counters (see <adorad/core/stats.h>)
+enum {
+    StatsLexFiles = StatsCoreCount,
+    StatsLexBytes,
+    StatsLexTokens,
+    StatsLexTokensByKind,   // one counter per `TokenKind`
+    StatsLexCount = StatsLexTokensByKind + TOK_COUNT
+};
+// Name the lexer's counters
+void lexer_register_stats();
+
 #endif // ADORAD_LEXER_H
\ No newline at end of file
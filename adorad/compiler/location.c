@@ -14,11 +14,11 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #include <stdlib.h>
 #include <adorad/compiler/location.h>
 
-Location* loc_new(const char* fname) {
-    Location* loc = cast(Location*)calloc(1, sizeof(Location));
+Location* loc_new(cstlAllocator* allocator, const char* fname) {
+    Location* loc = cstl_new_obj(allocator, Location);
     loc->line = 1;
     loc->col = 1;
-    loc->fname = buff_new(fname);
+    loc->fname = buff_new_in(allocator, cast(char*)fname);
     
     return loc;
 }
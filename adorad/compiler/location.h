@@ -24,8 +24,10 @@ struct Location {
     Buff* fname;
 };
 
-Location* loc_new(const char* fname);
+// Create a new Location from `allocator` (or on the heap, if `allocator` is null)
+Location* loc_new(cstlAllocator* allocator, const char* fname);
 void loc_reset(Location* loc);
+// Free a Location created on the heap (with a null allocator)
 void loc_free(Location* loc);
 
 #endif // ADORAD_LOCATION_H
\ No newline at end of file
@@ -24,59 +24,128 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 
 // Initialize a new Parser
 Parser* parser_init(Lexer* lexer) {
-    Parser* parser = cast(Parser*)calloc(1, sizeof(Parser));
+    profile_begin("parse", lexer->loc->fname->data);
+    Parser* parser = cstl_new_obj(lexer->allocator, Parser);
     parser->lexer = lexer;
+    parser->allocator = lexer->allocator;
     parser->toklist = lexer->toklist;
-    parser->curr_tok = cast(Token*)vec_at(parser->toklist, 0);
-    parser->num_tokens = vec_size(parser->toklist);
+    parser->num_tokens = segvec_size(parser->toklist);
+    parser->tok_index = 0;
+    parser->curr_tok = segvec_at(parser->toklist, 0);
     parser->num_lines = 0;
     parser->mod_name = null;
+    profile_end();
     return parser;
 }
 
-inline Token* parser_peek_token(Parser* parser) {
+static inline Token* parser_peek_token(Parser* parser) {
     return parser->curr_tok;
 }
 
+// Move to the token at `index`. 
+// Tokens are stored in chunks, so stepping across tokens has to go through `segvec_at()`, but the pointers 
+// themselves stay valid while the token list grows.
+static inline void parser_seek(Parser* parser, UInt64 index) {
+    // Never step past the final `TOK_EOF`
+    if(index >= parser->num_tokens)
+        index = parser->num_tokens - 1;
+    parser->tok_index = index;
+    parser->curr_tok = segvec_at(parser->toklist, index);
+}
+
 // Consumes a token and moves on to the next token
-inline Token* parser_chomp(Parser* parser) {
+static inline Token* parser_chomp(Parser* parser) {
     Token* tok = parser_peek_token(parser);
-    parser->curr_tok += 1;
+    parser_seek(parser, parser->tok_index + 1);
     return tok;
 }
 
 // Consumes a token and moves on to the next, if the current token matches the expected token.
-inline Token* chomp_if(Parser* parser, TokenKind tokenkind) {
+static inline Token* chomp_if(Parser* parser, TokenKind tokenkind) {
     if(parser->curr_tok->kind == tokenkind)
         return parser_chomp(parser);
 
     return null;
 }
 
-inline void parser_put_back(Parser* parser) {
-    parser->curr_tok -= 1;
+static inline void parser_put_back(Parser* parser) {
+    CORETEN_ENFORCE(parser->tok_index > 0, "Cannot put back a token before the first token");
+    parser_seek(parser, parser->tok_index - 1);
 }
 
-inline Token* expect_token(Parser* parser, TokenKind tokenkind) {
+static inline Token* expect_token(Parser* parser, TokenKind tokenkind) {
     if(parser->curr_tok->kind == tokenkind)
         return parser_chomp(parser);
         
     panic(ErrorUnexpectedToken, "Expected `%s`; got `%s`", 
-                                        token_to_buff(tokenkind)->data,
-                                        token_to_buff(parser->curr_tok->kind)->data);
+                                        token_to_str(tokenkind),
+                                        token_to_str(parser->curr_tok->kind));
     abort();
 }
 
-AstNode* ast_create_node(AstNodeKind kind) {
-    AstNode* node = cast(AstNode*)calloc(1, sizeof(AstNode));
+// Create a new AstNode from `allocator`
+AstNode* ast_create_node(cstlAllocator* allocator, AstNodeKind kind) {
+    AstNode* node = cstl_new_obj(allocator, AstNode);
     node->kind = kind;
+    STATS_INC(StatsAstNodes);
+    STATS_INC(StatsAstNodesByKind + kind);
     return node;
 }
+void ast_free_node(cstlAllocator* allocator, AstNode* node) {
+    cstl_free_obj(allocator, node);
+}
+
+void ast_register_stats() {
+    static const char* names[AstNodeKindCount] = {
+        [AstNodeKindIdentifier]        = "ast.nodes.identifier",
+        [AstNodeKindBlock]             = "ast.nodes.block",
+        [AstNodeKindFuncPrototype]     = "ast.nodes.func_prototype",
+        [AstNodeKindFuncDef]           = "ast.nodes.func_def",
+        [AstNodeKindIntLiteral]        = "ast.nodes.int_literal",
+        [AstNodeKindFloatLiteral]      = "ast.nodes.float_literal",
+        [AstNodeKindCharLiteral]       = "ast.nodes.char_literal",
+        [AstNodeKindStringLiteral]     = "ast.nodes.string_literal",
+        [AstNodeKindBoolLiteral]       = "ast.nodes.bool_literal",
+        [AstNodeKindNilLiteral]        = "ast.nodes.nil_literal",
+        [AstNodeKindEnumDecl]          = "ast.nodes.enum_decl",
+        [AstNodeKindUnionDecl]         = "ast.nodes.union_decl",
+        [AstNodeKindVarDecl]           = "ast.nodes.var_decl",
+        [AstNodeKindFuncCallExpr]      = "ast.nodes.func_call_expr",
+        [AstNodeKindIfExpr]            = "ast.nodes.if_expr",
+        [AstNodeKindLoopWhileExpr]     = "ast.nodes.loop_while_expr",
+        [AstNodeKindLoopCExpr]         = "ast.nodes.loop_c_expr",
+        [AstNodeKindLoopInExpr]        = "ast.nodes.loop_in_expr",
+        [AstNodeKindMatchExpr]         = "ast.nodes.match_expr",
+        [AstNodeKindCatchExpr]         = "ast.nodes.catch_expr",
+        [AstNodeKindBinaryOpExpr]      = "ast.nodes.binary_op_expr",
+        [AstNodeKindPrefixOpExpr]      = "ast.nodes.prefix_op_expr",
+        [AstNodeKindFieldAccessExpr]   = "ast.nodes.field_access_expr",
+        [AstNodeKindInitExpr]          = "ast.nodes.init_expr",
+        [AstNodeKindSliceExpr]         = "ast.nodes.slice_expr",
+        [AstNodeKindArrayAccessExpr]   = "ast.nodes.array_access_expr",
+        [AstNodeKindArrayType]         = "ast.nodes.array_type",
+        [AstNodeKindInferredArrayType] = "ast.nodes.inferred_array_type",
+        [AstNodeKindTypeDecl]          = "ast.nodes.type_decl",
+        [AstNodeKindBreak]             = "ast.nodes.break",
+        [AstNodeKindContinue]          = "ast.nodes.continue",
+        [AstNodeKindParamDecl]         = "ast.nodes.param_decl",
+        [AstNodeKindDefer]             = "ast.nodes.defer",
+        [AstNodeKindReturn]            = "ast.nodes.return",
+        [AstNodeKindUnreachable]       = "ast.nodes.unreachable",
+        [AstNodeKindMatchBranch]       = "ast.nodes.match_branch",
+        [AstNodeKindMatchRange]        = "ast.nodes.match_range",
+    };
+    stats_register(StatsAstNodes, "ast.nodes");
+    for(UInt32 kind = 0; kind < AstNodeKindCount; kind++) {
+        if(names[kind])
+            stats_register(StatsAstNodesByKind + kind, names[kind]);
+    }
+}
 
-AstNode* ast_clone_node(AstNode* node) {
+AstNode* ast_clone_node(cstlAllocator* allocator, AstNode* node) {
     if(!node)
         panic(ErrorUnexpectedNull, "Trying to clone a null AstNode?");
-    AstNode* new = ast_create_node(node->kind);
+    AstNode* new = ast_create_node(allocator, node->kind);
     // TODO(jasmcaus): Add more struct members
     return new;
 }
@@ -147,18 +216,18 @@ static AstNode* ast_parse_statement(Parser* parser);
 static AstNode* ast_parse_var_decl(Parser* parser);
 static AstNode* ast_parse_func_prototype(Parser* parser);
 
-static Vec* ast_parse_param_list(Parser* parser, AstNode* (*param_parser)(Parser* parser)) {
-    Vec* out = vec_new(AstNode, 1);
+static AstNodeList ast_parse_param_list(Parser* parser, AstNode* (*param_parser)(Parser* parser)) {
+    AstNodeList out;
+    svec_init_in(&out, parser->allocator);
     while(true) {
         AstNode* curr = param_parser(parser);
         if(curr == null)
             break;
-        vec_push(out, curr);
+        svec_push(&out, curr);
 
         Token* sep = parser_chomp_if(COMMA);
         if(sep == null)
             break;
-        free(sep);
     }
     return out;
 }
@@ -171,35 +240,33 @@ static AstNode* ast_parse_func_prototype(Parser* parser) {
         return null;
     
     Token* identifier = parser_chomp_if(IDENTIFIER);
-    Token* lparen = parser_expect_token(LPAREN);
-    Vec* params = ast_parse_param_list(parser, ast_parse_match_branch);
-    Token* rparen = parser_expect_token(RPAREN);
-    free(lparen);
-    free(rparen);
+    parser_expect_token(LPAREN);
+    AstNodeList params = ast_parse_param_list(parser, ast_parse_match_branch);
+    parser_expect_token(RPAREN);
 
     AstNode* return_type = ast_parse_type_expr(parser);
     if(return_type == null) {
         Token* next = parser_peek_token(parser);
         ast_error(
             "expected return type; found`%s`",
-            token_to_buff(next->kind)->data
+            token_to_str(next->kind)
         );
     }
 
-    AstNode* out = ast_create_node(AstNodeKindFuncPrototype);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindFuncPrototype);
     out->data.stmt->func_proto_decl->name = identifier->value;
     out->data.stmt->func_proto_decl->params = params;
     out->data.stmt->func_proto_decl->return_type = return_type;
 
-    for(UInt64 i = 0; i < vec_size(params); i++) {
-        AstNode* param_decl = vec_at(params, i);
+    for(UInt64 i = 0; i < svec_size(&params); i++) {
+        AstNode* param_decl = *svec_at(&params, i);
         CORETEN_ENFORCE(param_decl->kind == AstNodeKindParamDecl);
         if(param_decl->data.param_decl->is_var_args)
             out->data.stmt->func_proto_decl->is_var_args = true;
         
         // Check for multiple variadic arguments in prototype
         // Adorad supports only 1
-        if(i != vec_size(params) - 1 && out->data.stmt->func_proto_decl->is_var_args)
+        if(i != svec_size(&params) - 1 && out->data.stmt->func_proto_decl->is_var_args)
             ast_error(
                 "Cannot have multiple variadic arguments in function prototype"
             );
@@ -226,7 +293,7 @@ static AstNode* ast_parse_var_decl(Parser* parser) {
     
     parser_expect_token(SEMICOLON); // TODO: Remove this need
 
-    AstNode* out = ast_create_node(AstNodeKindVarDecl);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindVarDecl);
     out->data.stmt->var_decl->name = identifier->value;
     out->data.stmt->var_decl->is_export = export_kwd != null;
     out->data.stmt->var_decl->is_mutable = mutable_kwd != null;
@@ -242,59 +309,49 @@ static AstNode* ast_parse_statement(Parser* parser) {
         CORETEN_ENFORCE(var_decl->kind == AstNodeKindVarDecl);
         return var_decl;
     }
-    free(var_decl);
 
     // Defer
     Token* defer_stmt = parser_chomp_if(DEFER);
     if(defer_stmt != null) {
         AstNode* statement = ast_parse_block_expr_statement(parser);
-        AstNode* out = ast_create_node(AstNodeKindDefer);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindDefer);
         
         out->data.stmt->defer_stmt->expr = statement;
         return out;
     }
-    free(defer_stmt);
 
     // If statement
     AstNode* if_statement = ast_parse_if_expr(parser);
     if(if_statement != null)
         return if_statement;
-    free(if_statement);
     
     // Labeled Statements
     AstNode* labeled_statement = ast_parse_labeled_statements(parser);
     if(labeled_statement != null)
         return labeled_statement;
-    free(labeled_statement);
 
     // Match statements
     AstNode* match_expr = ast_parse_match_expr(parser);
     if(match_expr != null)
         return match_expr;
-    free(match_expr);
 
     // Assignment statements
     AstNode* assignment_expr = ast_parse_assignment_expr(parser);
     if(assignment_expr != null)
         return assignment_expr;
-    free(assignment_expr);
 
     return null;
 }
 
 static AstNode* ast_parse_if_prefix(Parser* parser) {
     Token* if_kwd = parser_chomp_if(IF);
-    if(if_kwd == null) {
-        free(if_kwd);
+    if(if_kwd == null)
         return null;
-    }
-    Token* lparen = parser_expect_token(LPAREN);
+    parser_expect_token(LPAREN);
     AstNode* condition = ast_parse_expr(parser);
-    Token* rparen = parser_expect_token(RPAREN);
-    free(lparen);
-    free(rparen);
+    parser_expect_token(RPAREN);
 
-    AstNode* out = ast_create_node(AstNodeKindIfExpr);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindIfExpr);
     out->data.expr->if_expr->condition = condition;
 
     return out;
@@ -302,10 +359,8 @@ static AstNode* ast_parse_if_prefix(Parser* parser) {
 
 static AstNode* ast_parse_if_expr(Parser* parser) {
     AstNode* out = ast_parse_if_prefix(parser);
-    if(out == null) {
-        free(out);
+    if(out == null)
         return null;
-    }
     
     AstNode* body = ast_parse_block_expr(parser);
     if(body == null)
@@ -315,7 +370,7 @@ static AstNode* ast_parse_if_expr(Parser* parser) {
         Token* token = parser_chomp(parser);
         ast_error(
             "expected `if` body; found `%s`",
-            token_to_buff(token->kind)->data
+            token_to_str(token->kind)
         );
     }
 
@@ -323,7 +378,6 @@ static AstNode* ast_parse_if_expr(Parser* parser) {
     Token* else_kwd = parser_chomp_if(ELSE);
     if(else_kwd != null)
         else_body = ast_parse_statement(parser);
-    free(else_kwd);
 
     out->data.expr->if_expr->then_block = body;
     out->data.expr->if_expr->has_else = else_body != null;
@@ -340,7 +394,6 @@ static AstNode* ast_parse_labeled_statements(Parser* parser) {
         block->data.stmt->block_stmt->name = label->value;
         return block;
     }
-    free(block);
 
     AstNode* loop = ast_parse_loop_statement(parser);
     if(loop != null) {
@@ -410,8 +463,7 @@ static AstNode* ast_parse_block_expr_statement(Parser* parser) {
     
     AstNode* assignment_expr = ast_parse_assignment_expr(parser);
     if(assignment_expr != null) {
-        Token* semi = parser_expect_token(SEMICOLON);
-        free(semi);
+        parser_expect_token(SEMICOLON);
         return assignment_expr;
     }
     
@@ -462,16 +514,15 @@ static AstNode* ast_parse_block(Parser* parser) {
     if(lbrace == null)
         return null;
 
-    Vec* statements = vec_new(AstNode, 1);
+    AstNodeList statements;
+    svec_init_in(&statements, parser->allocator);
     AstNode* statement = null;
     while((statement = ast_parse_statement(parser)) != null)
-        vec_push(statements, statement);
+        svec_push(&statements, statement);
 
-    Token* rbrace = parser_expect_token(RBRACE);
-    free(lbrace);
-    free(rbrace);
+    parser_expect_token(RBRACE);
 
-    AstNode* out = ast_create_node(AstNodeKindBlock);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindBlock);
     out->data.stmt->block_stmt->statements = statements;
     return out;
 }
@@ -592,7 +643,7 @@ static AstNode* ast_parse_binary_op_expr(
 static AstNode* ast_parse_try_expr(Parser* parser) {
     Token* try_kwd = parser_chomp_if(TRY);
     if(try_kwd != null) {
-        AstNode* out = ast_create_node(AstNodeKindReturn);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindReturn);
         out->data.stmt->return_stmt->kind = ReturnKindError;
         return out;
     }
@@ -715,11 +766,10 @@ static AstNode* ast_parse_primary_expr(Parser* parser) {
 
     Token* break_token = parser_chomp_if(BREAK);
     if(break_token != null) {
-        free(break_token);
         Token* label = ast_parse_break_label(parser);
         AstNode* expr = ast_parse_expr(parser);
         
-        AstNode* out = ast_create_node(AstNodeKindBreak);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindBreak);
         out->data.stmt->branch_stmt->name = label->value;
         out->data.stmt->branch_stmt->type = AstNodeBranchStatementBreak;
         out->data.stmt->branch_stmt->expr = expr;
@@ -729,7 +779,7 @@ static AstNode* ast_parse_primary_expr(Parser* parser) {
     Token* continue_token = parser_chomp_if(CONTINUE);
     if(continue_token != null) {
         Token* label = ast_parse_break_label(parser);
-        AstNode* out = ast_create_node(AstNodeKindContinue);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindContinue);
         out->data.stmt->branch_stmt->name = label == null ? label->value : null;
         out->data.stmt->branch_stmt->type = AstNodeBranchStatementContinue;
     }
@@ -737,16 +787,15 @@ static AstNode* ast_parse_primary_expr(Parser* parser) {
     // Token* attribute = parser_chomp_if(ATTRIBUTE);
     // if (attribute != 0) {
     //     AstNode* expr = ast_parse_expr();
-    //     AstNode* out = ast_create_node(AstNodeKindAttribute);
+    //     AstNode* out = ast_create_node(parser->allocator, AstNodeKindAttribute);
     //     out->data.attribute_expr.expr = expr;
     //     return out;
     // }
 
     Token* return_token = parser_chomp_if(RETURN);
     if(return_token != null) {
-        free(return_token);
         AstNode* expr = ast_parse_expr(parser);
-        AstNode* out = ast_create_node(AstNodeKindReturn);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindReturn);
         out->data.stmt->return_stmt->expr = expr;
         return out;
     }
@@ -763,7 +812,7 @@ static AstNode* ast_parse_boolean_and_op(Parser* parser) {
     if(op_token == null)
         return null;
     
-    AstNode* out = ast_create_node(AstNodeKindBinaryOpExpr);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindBinaryOpExpr);
     out->data.expr->binary_op_expr->op = BinaryOpKindBoolAnd;
     return out;
 }
@@ -773,7 +822,7 @@ static AstNode* ast_parse_boolean_or_op(Parser* parser) {
     if(op_token == null)
         return null;
     
-    AstNode* out = ast_create_node(AstNodeKindBinaryOpExpr);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindBinaryOpExpr);
     out->data.expr->binary_op_expr->op = BinaryOpKindBoolOr;
     return out;
 }
@@ -795,9 +844,8 @@ static AstNode* ast_parse_init_list(Parser* parser) {
     Token* lbrace = parser_chomp_if(LBRACE);
     if(lbrace == null)
         return null;
-    free(lbrace);
 
-    AstNode* out = ast_create_node(AstNodeKindInitExpr);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindInitExpr);
     out->data.expr->init_expr->kind = InitExprKindArray;
     out->data.expr->init_expr->entries = vec_new(AstNode, 1);
 
@@ -807,19 +855,16 @@ static AstNode* ast_parse_init_list(Parser* parser) {
 
         Token* comma;
         while((comma = parser_chomp_if(COMMA)) != null) {
-            free(comma);
             AstNode* expr = ast_parse_expr(parser);
             if(expr == null)
                 break;
             vec_push(out->data.expr->init_expr->entries, expr);
         }
 
-        Token* rbrace = parser_expect_token(RBRACE);
-        free(rbrace);
+        parser_expect_token(RBRACE);
         return out;
     }
-    Token* rbrace = parser_expect_token(RBRACE);
-    free(rbrace);
+    parser_expect_token(RBRACE);
     return out;
 }
 
@@ -888,27 +933,20 @@ static AstNode* ast_parse_suffix_expr(Parser* parser) {
 //      | MatchExpr
 static AstNode* ast_parse_primary_type_expr(Parser* parser) {
     Token* char_lit = parser_chomp_if(CHAR_LIT);
-    if(char_lit != null) {
-        free(char_lit);
-        return ast_create_node(AstNodeKindCharLiteral);
-    }
+    if(char_lit != null)
+        return ast_create_node(parser->allocator, AstNodeKindCharLiteral);
 
     Token* float_lit = parser_chomp_if(FLOAT_LIT);
-    if(float_lit != null) {
-        free(float_lit);
-        return ast_create_node(AstNodeKindFloatLiteral);
-    }
+    if(float_lit != null)
+        return ast_create_node(parser->allocator, AstNodeKindFloatLiteral);
 
     AstNode* func_prototype = ast_parse_func_prototype(parser);
     if(func_prototype != null)
         return func_prototype;
-    free(func_prototype);
 
     Token* identifier = parser_chomp_if(IDENTIFIER);
-    if(identifier != null) {
-        free(identifier);
-        return ast_create_node(AstNodeKindIdentifier);
-    }
+    if(identifier != null)
+        return ast_create_node(parser->allocator, AstNodeKindIdentifier);
 
     // Token* if_type_expr = ast_parse_if_type_expr(parser);
     // if(if_type_expr != null)
@@ -916,38 +954,30 @@ static AstNode* ast_parse_primary_type_expr(Parser* parser) {
     // free(if_type_expr);
 
     Token* int_lit = parser_chomp_if(INTEGER);
-    if(int_lit != null) {
-        free(int_lit);
-        return ast_create_node(AstNodeKindIntLiteral);
-    }
+    if(int_lit != null)
+        return ast_create_node(parser->allocator, AstNodeKindIntLiteral);
     
     Token* true_token = parser_chomp_if(TOK_TRUE);
     if(true_token != null) {
-        free(true_token);
-        AstNode* out = ast_create_node(AstNodeKindBoolLiteral);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindBoolLiteral);
         out->data.comptime_value->bool_value->value = true;
         return out;
     }
 
     Token* false_token = parser_chomp_if(TOK_TRUE);
     if(false_token != null) {
-        free(false_token);
-        AstNode* out = ast_create_node(AstNodeKindBoolLiteral);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindBoolLiteral);
         out->data.comptime_value->bool_value->value = false;
         return out;
     }
 
     Token* unreachable_token = parser_chomp_if(UNREACHABLE);
-    if(unreachable_token != null) {
-        free(unreachable_token);
-        return ast_create_node(AstNodeKindUnreachable);
-    }
+    if(unreachable_token != null)
+        return ast_create_node(parser->allocator, AstNodeKindUnreachable);
 
     Token* string_lit = parser_chomp_if(STRING);
-    if(string_lit != null) {
-        free(string_lit);
-        return ast_create_node(AstNodeKindStringLiteral);
-    }
+    if(string_lit != null)
+        return ast_create_node(parser->allocator, AstNodeKindStringLiteral);
 
     AstNode* match_token = ast_parse_match_expr(parser);
     if(match_token != null)
@@ -956,18 +986,18 @@ static AstNode* ast_parse_primary_type_expr(Parser* parser) {
     return null;
 }
 
-static Vec* ast_parse_branch_list(Parser* parser, AstNode* (*list_parser)(Parser* parser)) {
-    Vec* out = vec_new(AstNode, 1);
+static AstNodeList ast_parse_branch_list(Parser* parser, AstNode* (*list_parser)(Parser* parser)) {
+    AstNodeList out;
+    svec_init_in(&out, parser->allocator);
     while(true) {
         AstNode* curr = list_parser(parser);
         if(curr == null)
             break;
         
-        vec_push(out, curr);
+        svec_push(&out, curr);
         Token* sep = parser_chomp_if(COMMA);
         if(sep == null)
             break;
-        free(sep);
     }
     return out;
 }
@@ -978,21 +1008,18 @@ static AstNode* ast_parse_match_expr(Parser* parser) {
     Token* match_token = parser_chomp_if(MATCH);
     if(match_token == null)
         return null;
-    free(match_token);
 
     // Left and Right Parenthesis' here are optional
-    Token* lparen = parser_chomp_if(LPAREN);
+    parser_chomp_if(LPAREN);
     AstNode* expr = ast_parse_expr(parser);
-    Token* rparen = parser_chomp_if(RPAREN);
-    free(lparen);
-    free(rparen);
+    parser_chomp_if(RPAREN);
 
     // These *aren't* optional
-    Token* lbrace = parser_expect_token(LBRACE);
-    Vec* branches = ast_parse_branch_list(parser,ast_parse_match_branch);
-    Token* rbrace = parser_expect_token(RBRACE);
+    parser_expect_token(LBRACE);
+    AstNodeList branches = ast_parse_branch_list(parser,ast_parse_match_branch);
+    parser_expect_token(RBRACE);
 
-    AstNode* out = ast_create_node(AstNodeKindMatchExpr);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindMatchExpr);
     out->data.expr->match_expr->expr = expr;
     out->data.expr->match_expr->branches = branches;
     return out;
@@ -1005,7 +1032,6 @@ static Token* ast_parse_break_label(Parser* parser) {
     if(colon == null) {
         return null;
     }
-    free(colon);
     Token* ident = parser_expect_token(IDENTIFIER);
     return ident;
 }
@@ -1018,11 +1044,8 @@ static Token* ast_parse_block_label(Parser* parser) {
         return null;
     
     Token* colon = parser_chomp_if(COLON);
-    if(colon == null) {
-        free(ident);
+    if(colon == null)
         return colon;
-    }
-    free(colon);
 
     return ident;
 }
@@ -1041,8 +1064,6 @@ static AstNode* ast_parse_match_branch(Parser* parser) {
         ast_error(
             "Missing token after `case`. Either `:` or `=>`"
         );
-    free(colon);
-    free(equals_arrow);
 
     AstNode* expr = ast_parse_assignment_expr(parser);
     out->data.expr->match_branch_expr->expr = expr;
@@ -1056,17 +1077,16 @@ static AstNode* ast_parse_match_branch(Parser* parser) {
 static AstNode* ast_parse_match_case_kwd(Parser* parser) {
     AstNode* match_item = ast_parse_match_item(parser);
     if(match_item != null) {
-        AstNode* out = ast_create_node(AstNodeKindMatchBranch);
-        vec_push(out->data.expr->match_branch_expr->branches, match_item);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindMatchBranch);
+        svec_push(&out->data.expr->match_branch_expr->branches, match_item);
 
         Token* comma;
         while((comma = parser_chomp_if(COMMA)) != null) {
-            free(comma);
             AstNode* item = ast_parse_match_item(parser);
             if(item == null)
                 break;
             
-            vec_push(out->data.expr->match_branch_expr->branches, item);
+            svec_push(&out->data.expr->match_branch_expr->branches, item);
             out->data.expr->match_branch_expr->any_branches_are_ranges = cast(bool)(item->kind == AstNodeKindMatchRange);
         }
 
@@ -1075,8 +1095,7 @@ static AstNode* ast_parse_match_case_kwd(Parser* parser) {
 
     Token* else_kwd = parser_chomp_if(ELSE);
     if(else_kwd != null) {
-        free(else_kwd);
-        AstNode* out = ast_create_node(AstNodeKindMatchBranch);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindMatchBranch);
         return out;
     }
 
@@ -1093,7 +1112,7 @@ static AstNode* ast_parse_match_item(Parser* parser) {
     Token* ellipsis = parser_chomp_if(ELLIPSIS);
     if(ellipsis != null) {
         AstNode* expr2 = ast_parse_expr(parser);
-        AstNode* out = ast_create_node(AstNodeKindMatchRange);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindMatchRange);
         out->data.expr->match_range_expr->begin = expr;
         out->data.expr->match_range_expr->end = expr2;
         return out;
@@ -1106,9 +1125,8 @@ static AstNode* ast_parse_op(Parser* parser) {
     BinaryOpKind op = tokenkind_to_binaryopkind( parser->curr_tok->kind);
 
     if(op != BinaryOpKindInvalid) {
-        Token* op_token = parser_chomp(parser);
-        free(op_token);
-        AstNode* out = ast_create_node(AstNodeKindBinaryOpExpr);
+        parser_chomp(parser);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindBinaryOpExpr);
         out->data.expr->binary_op_expr->op = op;
         return out;
     }
@@ -1188,9 +1206,8 @@ static AstNode* ast_parse_prefix_op(Parser* parser) {
     }
 
     if(op != PrefixOpKindInvalid) {
-        Token* op_token = parser_chomp(parser);
-        free(op_token);
-        AstNode* out = ast_create_node(AstNodeKindPrefixOpExpr);
+        parser_chomp(parser);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindPrefixOpExpr);
         out->data.prefix_op_expr->op = op;
         return out;
     }
@@ -1204,16 +1221,14 @@ static AstNode* ast_parse_prefix_op(Parser* parser) {
 static AstNode* ast_parse_prefix_type_op(Parser* parser) {
     Token* question_mark = parser_chomp_if(QUESTION);
     if(question_mark != null) {
-        free(question_mark);
-        AstNode* out = ast_create_node(AstNodeKindPrefixOpExpr);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindPrefixOpExpr);
         out->data.prefix_op_expr->op = PrefixOpKindOptional;
         return out;
     }
 
     Token* arr_init_lbrace = parser_chomp_if(LBRACE);
-    Buff* underscore_value = buff_new("_");
+    Buff* underscore_value = buff_new_in(parser->allocator, "_");
     if(arr_init_lbrace != null) {
-        free(arr_init_lbrace);
         Token* underscore = parser_chomp_if(IDENTIFIER);
         if(underscore == null) {
             parser_put_back(parser);
@@ -1226,14 +1241,12 @@ static AstNode* ast_parse_prefix_type_op(Parser* parser) {
             if(colon != null)
                 sentinel = ast_parse_expr(parser);
             
-            Token* rbrace = parser_expect_token(RBRACE);
-            free(rbrace);
-            AstNode* out = ast_create_node(AstNodeKindArrayType);
+            parser_expect_token(RBRACE);
+            AstNode* out = ast_create_node(parser->allocator, AstNodeKindArrayType);
             out->data.inferred_array_type->sentinel = sentinel;
             return out;
         }
     }
-    free(underscore_value);
 
     return null;
 }
@@ -1244,42 +1257,35 @@ static AstNode* ast_parse_prefix_type_op(Parser* parser) {
 static AstNode* ast_parse_suffix_op(Parser* parser) {
     Token* lbrace = parser_chomp_if(LBRACE);
     if(lbrace != null) {
-        free(lbrace);
         AstNode* lower = ast_parse_expr(parser);
         AstNode* upper = null;
         Token* ellipsis = parser_chomp_if(ELLIPSIS);
         if(ellipsis != null) {
-            free(ellipsis);
             AstNode* sentinel = null;
             upper = ast_parse_expr(parser);
             Token* colon = parser_chomp_if(COLON);
-            if(colon != null) {
-                free(colon);
+            if(colon != null)
                 sentinel = ast_parse_expr(parser);
-            }
-            Token* rbrace = parser_expect_token(RBRACE);
-            free(rbrace);
+            parser_expect_token(RBRACE);
 
-            AstNode* out = ast_create_node(AstNodeKindSliceExpr);
+            AstNode* out = ast_create_node(parser->allocator, AstNodeKindSliceExpr);
             out->data.expr->slice_expr->lower = lower;
             out->data.expr->slice_expr->upper = upper;
             out->data.expr->slice_expr->sentinel = sentinel;
             return out;
         }
 
-        Token* rbrace = parser_expect_token(RBRACE);
-        free(rbrace);
+        parser_expect_token(RBRACE);
 
-        AstNode* out = ast_create_node(AstNodeKindArrayAccessExpr);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindArrayAccessExpr);
         out->data.array_access_expr->subscript = lower;
         return out;
     }
 
     Token* dot = parser_chomp_if(DOT);
     if(dot != null) {
-        free(dot);
         Token* identifier = parser_expect_token(IDENTIFIER);
-        AstNode* out = ast_create_node(AstNodeKindFieldAccessExpr);
+        AstNode* out = ast_create_node(parser->allocator, AstNodeKindFieldAccessExpr);
         out->data.field_access_expr->field_name = identifier->value;
         return out;
     }
@@ -1338,11 +1344,10 @@ static AstNode* ast_parse_func_call_args(Parser* parser) {
     if(lparen == null)
         return null;
     
-    Vec* params = ast_parse_param_list(parser, ast_parse_expr);
-    Token* rparen = parser_expect_token(RPAREN);
-    free(rparen);
+    AstNodeList params = ast_parse_param_list(parser, ast_parse_expr);
+    parser_expect_token(RPAREN);
 
-    AstNode* out = ast_create_node(AstNodeKindFuncCallExpr);
+    AstNode* out = ast_create_node(parser->allocator, AstNodeKindFuncCallExpr);
     out->data.expr->func_call_expr->params = params;
     return out;
 }
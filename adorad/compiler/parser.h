@@ -25,8 +25,10 @@ typedef struct Parser {
     Buff* fullpath;     // path/to/file.ad
     Buff* basename;     // file.ad
     Lexer* lexer;
-    Vec* toklist;       // shortcut to `lexer->toklist`
+    cstlAllocator* allocator;   // AST nodes are allocated here (shared with `lexer->allocator`)
+    TokenList* toklist; // shortcut to `lexer->toklist`
     Token* curr_tok;
+    UInt64 tok_index;   // index of `curr_tok` in `toklist`
     UInt64 num_tokens;
     UInt64 num_lines;
 
@@ -36,6 +38,18 @@ typedef struct Parser {
 } Parser;
 
 Parser* parser_init(Lexer* lexer);
-AstNode* ast_create_node(AstNodeKind type);
+AstNode* ast_create_node(cstlAllocator* allocator, AstNodeKind type);
+
+// Parser counters (see <adorad/core/stats.h>)
+enum {
+    StatsAstNodes = StatsLexCount,
+    StatsAstNodesByKind,    // one counter per `AstNodeKind`
+    StatsParseCount = StatsAstNodesByKind + AstNodeKindCount
+};
+// Name the parser's counters
+void ast_register_stats();
+// Release `node` back to `allocator` (a no-op for arenas, unless it is the latest allocation).
+// Used when re-parsing replaces nodes, e.g. with `slab_allocator()`
+void ast_free_node(cstlAllocator* allocator, AstNode* node);
 
 #endif // ADORAD_PARSER_H
\ No newline at end of file
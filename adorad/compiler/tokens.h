@@ -23,7 +23,7 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
     on tokens (printing, predicates).
 
     NOTE: 
-    Any changes made to this function _MUST_ be reflect in the token_to_buff() (in <adorad/compiler/tokens.c>)
+    Any changes made to this function _MUST_ be reflect in the token_to_str() (in <adorad/compiler/tokens.c>)
     as well as in Syntax.toml (adorad/compiler/syntax/syntax.toml)
 */
 #define ALLTOKENS \
@@ -224,16 +224,16 @@ typedef enum TokenKind {
 typedef struct Token {
     TokenKind kind;     // Token Kind
     UInt32 offset;      // Offset of the first character of the Token
-    Buff* value;        // Token value
+    Buff* value;        // Token value (tokens without a value of their own share an empty one)
     UInt32 start;       // Starting offset of the token (used in substring-ing tokens of length >1)
-    Location* loc;      // location of the token in the source code
+    Location loc;       // location of the token in the source code (`loc.fname` is shared by the whole file)
 } Token;
 
-// Create a basic (ILLEGAL) token
-Token* token_init();
-// Reset a Token instance
+// Create a basic (ILLEGAL) token from `allocator` (or on the heap, if `allocator` is null)
+Token* token_init(cstlAllocator* allocator);
+// Reset a Token instance. Its value is dropped rather than cleared, since it may be shared
 void token_reset_token(Token* token);
-// Convert a Token to its respective String representation
-Buff* token_to_buff(TokenKind kind);
+// Convert a TokenKind to its respective String representation
+const char* token_to_str(TokenKind kind);
 
 #endif // ADORAD_TOKEN_H
\ No newline at end of file
@@ -61,20 +61,26 @@ CREDITS
 #include <adorad/core/clock.h>
 #include <adorad/core/debug.h>
 #include <adorad/core/misc.h>
-#include <adorad/core/io.h>
 #include <adorad/core/memory.h>
+#include <adorad/core/io.h>
 #include <adorad/core/math.h>
 #include <adorad/core/os.h>
 #include <adorad/core/buffer.h>
 #include <adorad/core/char.h>
+#include <adorad/core/simd.h>
 #include <adorad/core/utf8.h>
 #include <adorad/core/vector.h>
+#include <adorad/core/hash.h>
+#include <adorad/core/hashmap.h>
+#include <adorad/core/vfs.h>
+#include <adorad/core/profile.h>
+#include <adorad/core/stats.h>
+#include <adorad/core/atomic.h>
+#include <adorad/core/thread.h>
+#include <adorad/core/perf.h>
+#include <adorad/core/bench.h>
 #include <adorad/core/warnings.h>
 
-#ifdef CORETEN_INCLUDE_HASH_H
-    #include <adorad/core/hash.h>
-#endif // CORETEN_INCLUDE_HASH_H
-
 #ifdef CORETEN_INCLUDE_WINDOWS_H
     // #include <adorad/core/windows.h>
 #endif // CORETEN_INCLUDE_WINDOWS_H
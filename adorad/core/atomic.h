@@ -0,0 +1,120 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_ATOMIC_H
+#define CORETEN_ATOMIC_H
+
+#include <stdatomic.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/cpu.h>
+
+#if defined(CORETEN_CPU_X86)
+    // For `_mm_pause()`
+    #include <emmintrin.h>
+#endif // CORETEN_CPU_X86
+
+/*
+    Atomics
+
+    Thin wrappers over C11 `<stdatomic.h>`: a 32-bit, a 64-bit and a pointer cell, with every operation taking an 
+    explicit memory order.
+
+        cstlAtomic64 pending = {0};
+        atomic64_fetch_add(&pending, 1, MemoryOrderRelaxed);
+        ...
+        if(atomic64_fetch_sub(&pending, 1, MemoryOrderAcqRel) == 1)
+            // the last one out
+
+    The cells are structs so they can't be read or written by accident without an explicit order. A zeroed cell 
+    holds 0 (or null). `cas` is a strong compare-and-swap: on failure, `*expected` is updated to the current value.
+*/
+
+typedef enum cstlMemoryOrder {
+    MemoryOrderRelaxed = memory_order_relaxed,
+    MemoryOrderAcquire = memory_order_acquire,
+    MemoryOrderRelease = memory_order_release,
+    MemoryOrderAcqRel = memory_order_acq_rel,
+    MemoryOrderSeqCst = memory_order_seq_cst
+} cstlMemoryOrder;
+
+typedef struct cstlAtomic32 {
+    _Atomic(Int32) value;
+} cstlAtomic32;
+
+typedef struct cstlAtomic64 {
+    _Atomic(Int64) value;
+} cstlAtomic64;
+
+typedef struct cstlAtomicPtr {
+    _Atomic(void*) value;
+} cstlAtomicPtr;
+
+// The loads only accept relaxed, acquire and seq_cst; the stores only relaxed, release and seq_cst
+#define __ATOMIC_DEFINE(prefix, Cell, T)                                                                            \
+    static inline T prefix##_load(Cell* cell, cstlMemoryOrder order) {                                              \
+        return atomic_load_explicit(&cell->value, cast(memory_order)order);                                        \
+    }                                                                                                               \
+    static inline void prefix##_store(Cell* cell, T value, cstlMemoryOrder order) {                                 \
+        atomic_store_explicit(&cell->value, value, cast(memory_order)order);                                       \
+    }                                                                                                               \
+    static inline T prefix##_exchange(Cell* cell, T value, cstlMemoryOrder order) {                                 \
+        return atomic_exchange_explicit(&cell->value, value, cast(memory_order)order);                             \
+    }                                                                                                               \
+    /* `failure` can't be stronger than `success`, or a release order */                                           \
+    static inline bool prefix##_cas(Cell* cell, T* expected, T desired, cstlMemoryOrder success,                    \
+                                    cstlMemoryOrder failure) {                                                      \
+        return atomic_compare_exchange_strong_explicit(&cell->value, expected, desired, cast(memory_order)success,  \
+                                                       cast(memory_order)failure);                                  \
+    }
+
+#define __ATOMIC_DEFINE_ARITHMETIC(prefix, Cell, T)                                                                 \
+    /* These return the previous value */                                                                          \
+    static inline T prefix##_fetch_add(Cell* cell, T value, cstlMemoryOrder order) {                                \
+        return atomic_fetch_add_explicit(&cell->value, value, cast(memory_order)order);                            \
+    }                                                                                                               \
+    static inline T prefix##_fetch_sub(Cell* cell, T value, cstlMemoryOrder order) {                                \
+        return atomic_fetch_sub_explicit(&cell->value, value, cast(memory_order)order);                            \
+    }                                                                                                               \
+    static inline T prefix##_fetch_or(Cell* cell, T value, cstlMemoryOrder order) {                                 \
+        return atomic_fetch_or_explicit(&cell->value, value, cast(memory_order)order);                             \
+    }                                                                                                               \
+    static inline T prefix##_fetch_and(Cell* cell, T value, cstlMemoryOrder order) {                                \
+        return atomic_fetch_and_explicit(&cell->value, value, cast(memory_order)order);                            \
+    }
+
+__ATOMIC_DEFINE(atomic32, cstlAtomic32, Int32)
+__ATOMIC_DEFINE_ARITHMETIC(atomic32, cstlAtomic32, Int32)
+__ATOMIC_DEFINE(atomic64, cstlAtomic64, Int64)
+__ATOMIC_DEFINE_ARITHMETIC(atomic64, cstlAtomic64, Int64)
+__ATOMIC_DEFINE(atomicptr, cstlAtomicPtr, void*)
+
+#undef __ATOMIC_DEFINE
+#undef __ATOMIC_DEFINE_ARITHMETIC
+
+// A memory fence between threads
+static inline void cstl_fence(cstlMemoryOrder order) {
+    atomic_thread_fence(cast(memory_order)order);
+}
+
+// Tell the CPU we are in a spin-wait loop (saves power, and frees resources for the other hyperthread)
+static inline void cstl_cpu_relax() {
+#if defined(CORETEN_CPU_X86)
+    _mm_pause();
+#elif defined(CORETEN_CPU_ARM) && (defined(__GNUC__) || defined(__clang__))
+    __asm__ __volatile__("yield");
+#endif // CORETEN_CPU_X86
+}
+
+#endif // CORETEN_ATOMIC_H
@@ -0,0 +1,86 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_BENCH_H
+#define CORETEN_BENCH_H
+
+#include <stdio.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/perf.h>
+
+/*
+    Benchmark Harness
+
+    Measures named regions over repeated runs - the wall time, and (when they are available) the hardware 
+    counters from perf.h:
+
+        cstlBench* bench = bench_new(true);
+        bench_set_unit(bench, "tok");
+        for(int run = 0; run < 10; run++) {
+            ...
+            BENCH_SCOPE(bench, "lex", buff_len(lexer->buffer), segvec_size(lexer->toklist)) {
+                lexer_lex(lexer);
+            }
+        }
+        bench_write_report(bench, stdout);
+
+    Every run of a region adds the bytes and items (tokens, nodes, ...) it processed, so the report can give 
+    throughput and per-byte/per-item costs (ns, cycles and instructions per token, IPC, ...) alongside the means per 
+    run. The bytes and items of `BENCH_SCOPE()` are evaluated after the block, so they can depend on its results.
+
+    Regions must not nest, and a bench must stay on the thread that created it (the counters are per-thread).
+    Region names must be string literals (or otherwise outlive the bench).
+*/
+
+typedef struct cstlBenchResult {
+    const char* name;
+    UInt64 runs;
+    UInt64 min_ns;          // fastest run
+    UInt64 bytes;           // summed over all runs
+    UInt64 items;
+    cstlPerfSample total;   // summed over all runs (`total.valid` only has the events counted on every run)
+} cstlBenchResult;
+
+typedef struct cstlBench {
+    cstlPerfCounters* counters;
+    const char* unit;               // what the items are ("item" by default)
+    cstlBenchResult* results;
+    UInt64 nresults;
+    UInt64 capacity;
+    cstlBenchResult* current;       // the open region
+} cstlBench;
+
+// `counters` opens the hardware counters (which fall back to wall time alone if they aren't available)
+cstlBench* bench_new(bool counters);
+void bench_free(cstlBench* bench);
+// Name the items in the report ("tok" gives "ns/tok", ...). `unit` must outlive the bench
+void bench_set_unit(cstlBench* bench, const char* unit);
+
+void bench_begin(cstlBench* bench, const char* name);
+// Close the open region. `bytes` and `items` are what this run processed (0 if they don't apply)
+void bench_end(cstlBench* bench, UInt64 bytes, UInt64 items);
+
+// Measure the statement (or block) that follows as one run of `name`. Leaving it early leaves the region open
+#define __BENCH_SCOPE_VAR                   CORETEN_CONCATENATE(__bench_scope_, __LINE__)
+#define BENCH_SCOPE(bench, name, bytes, items)                                                      \
+    for(int __BENCH_SCOPE_VAR = (bench_begin((bench), (name)), 0); !__BENCH_SCOPE_VAR;             \
+        __BENCH_SCOPE_VAR = 1, bench_end((bench), (bytes), (items)))
+
+// The results for `name` (null if it never ran)
+const cstlBenchResult* bench_result(cstlBench* bench, const char* name);
+// Write a table of every region (in the order they first ran): times and counts are means per run
+void bench_write_report(cstlBench* bench, FILE* out);
+
+#endif // CORETEN_BENCH_H
@@ -18,6 +18,7 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #include <adorad/core/types.h>
 #include <adorad/core/char.h>
 #include <adorad/core/misc.h>
+#include <adorad/core/memory.h>
 
 /*
     A `cstlBuffer` is a Fixed-Size Buffer.
@@ -31,9 +32,12 @@ struct cstlBuffer {
     char* data;    // buffer data
     UInt64 len;    // buffer size
     bool is_utf8;  // UTF-8 Strings
+    cstlAllocator* allocator;   // the buffer (and any data it creates) is allocated from here (null for the heap)
 };
 
 cstlBuffer* buff_new(char* buff_data);
+// Like `buff_new()`, but allocated from `allocator` (or the heap if `allocator` is null)
+cstlBuffer* buff_new_in(cstlAllocator* allocator, char* buff_data);
 char buff_at(cstlBuffer* buffer, UInt64 n);
 char* buff_begin(cstlBuffer* buffer);
 char* buff_end(cstlBuffer* buffer);
@@ -48,6 +52,8 @@ cstlBuffer* buff_rev(cstlBuffer* buffer);
 bool buff_cmp(cstlBuffer* buff1, cstlBuffer* buff2);
 bool buff_cmp_nocase(cstlBuffer* buff1, cstlBuffer* buff2);
 cstlBuffer* buff_slice(cstlBuffer* buffer, int begin, int bytes);
+// Like `buff_slice()`, but allocated from `allocator` (or the heap if `allocator` is null)
+cstlBuffer* buff_slice_in(cstlAllocator* allocator, cstlBuffer* buffer, int begin, int bytes);
 void buff_free(cstlBuffer* buffer);
 cstlBuffer* buff_toupper(cstlBuffer* buffer);
 cstlBuffer* buff_tolower(cstlBuffer* buffer);
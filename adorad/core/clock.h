@@ -14,9 +14,65 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #ifndef CORETEN_CLOCK_H
 #define CORETEN_CLOCK_H
 
+#include <stdio.h>
 #include <time.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
 
+/*
+    Timers
+
+    `clock_now_ns()` reads a monotonic wall clock (`clock_gettime(CLOCK_MONOTONIC)`, `QueryPerformanceCounter()` on 
+    Windows) with nanosecond resolution. Unlike `clock()`, it measures elapsed time, not CPU time - so it gives 
+    sensible numbers for phases that block or run on several threads.
+
+    `clock_cycles()` is a cheaper, finer counter for very short regions: the TSC on x86 and the virtual counter on 
+    AArch64 (elsewhere it's just `clock_now_ns()`). Its rate is calibrated against the monotonic clock on first use, 
+    which takes a few milliseconds.
+
+    `TIME_BLOCK()` times the statement (or block) that follows it and prints the result to stderr:
+
+        TIME_BLOCK("lex") {
+            lexer_lex(lexer);
+        }
+
+    `TIME_BLOCK_ACCUM(total_ns)` adds the elapsed nanoseconds to `total_ns` instead. Leaving either block early (with
+    `break`, `return` or `goto`) skips the measurement.
+*/
+// Monotonic time in nanoseconds (from an arbitrary starting point)
+UInt64 clock_now_ns();
+// Seconds between two `clock_now_ns()` readings
+double clock_seconds(UInt64 start_ns, UInt64 end_ns);
+
+// Raw cycle counter (see above)
+UInt64 clock_cycles();
+// Counter ticks per nanosecond (calibrated once)
+double clock_cycles_per_ns();
+UInt64 clock_cycles_to_ns(UInt64 cycles);
+// Is `clock_cycles()` a real hardware counter running at a constant rate?
+bool clock_has_cycle_counter();
+
+// Monotonic time in seconds
 double now();
-double duration(clock_t start, clock_t end);
+// Seconds between two `now()` readings
+double duration(double start, double end);
+
+typedef struct cstlTimeBlock {
+    const char* name;
+    UInt64* total;          // for `TIME_BLOCK_ACCUM()`
+    UInt64 start;
+    bool done;
+} cstlTimeBlock;
+
+cstlTimeBlock __time_block_begin(const char* name, UInt64* total);
+void __time_block_end(cstlTimeBlock* block);
+
+#define __TIME_BLOCK_VAR            CORETEN_CONCATENATE(__time_block_, __LINE__)
+#define TIME_BLOCK(name)            \
+    for(cstlTimeBlock __TIME_BLOCK_VAR = __time_block_begin((name), null); !__TIME_BLOCK_VAR.done;  \
+        __time_block_end(&__TIME_BLOCK_VAR))
+#define TIME_BLOCK_ACCUM(total_ns)  \
+    for(cstlTimeBlock __TIME_BLOCK_VAR = __time_block_begin(null, &(total_ns)); !__TIME_BLOCK_VAR.done; \
+        __time_block_end(&__TIME_BLOCK_VAR))
 
 #endif // CORETEN_CLOCK_H
\ No newline at end of file
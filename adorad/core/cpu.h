@@ -64,4 +64,71 @@ defined(__ia64__) || defined(__x86_64__)
     #define CORETEN_64BIT    0
 #endif
 
+/*
+    Runtime CPU features
+
+    The macros above (and `CORETEN_SIMD_*` in simd.h) only describe what the compiler was told to target. A 
+    portable build runs on machines with very different vector units, so the SIMD kernels (in simd.c and hash.c) 
+    are compiled for several instruction sets and the best one is picked at runtime, from the features reported 
+    by `cpuid`/`xgetbv` on x86 and `getauxval(AT_HWCAP)` on ARM Linux.
+
+    Detection runs once, the first time the features are needed. Each module's kernel table starts out empty; the 
+    first call picks an implementation for every kernel of the module, so later calls go straight through a 
+    function pointer.
+
+    `cpu_set_features_mask()` hides features from the dispatchers (and re-runs them), so the slower paths can be 
+    tested or benchmarked on a machine that supports the faster ones. It's safe to call while other threads use 
+    the kernels: each one is swapped atomically, and they see either the old or the new one.
+*/
+#include <adorad/core/types.h>
+#include <adorad/core/compilers.h>
+
+// x86 builds carry kernels for instruction sets beyond the compiler's baseline, selected at runtime
+#if defined(CORETEN_CPU_X86) && (defined(CORETEN_COMPILER_MSVC) || defined(CORETEN_COMPILER_GCC) || \
+    defined(CORETEN_COMPILER_CLANG))
+    #define CORETEN_CPU_DISPATCH_X86    1
+#endif // CORETEN_CPU_X86
+
+// Compile a function for instruction set(s) `isa` ("avx2", "sse4.2", ...), whatever the compiler's baseline is. 
+// MSVC accepts any intrinsic anywhere, so it needs no annotation
+#if defined(CORETEN_COMPILER_GCC) || defined(CORETEN_COMPILER_CLANG)
+    #define CORETEN_TARGET(isa)     __attribute__((target(isa)))
+#else
+    #define CORETEN_TARGET(isa)
+#endif // CORETEN_COMPILER_GCC
+
+typedef enum cstlCpuFeature {
+    // x86
+    CpuFeatureSSE2          = 1 << 0,
+    CpuFeatureSSSE3         = 1 << 1,
+    CpuFeatureSSE42         = 1 << 2,
+    CpuFeaturePOPCNT        = 1 << 3,
+    CpuFeatureAVX           = 1 << 4,   // also requires the OS to save the YMM registers
+    CpuFeatureAVX2          = 1 << 5,
+    CpuFeatureBMI1          = 1 << 6,
+    CpuFeatureBMI2          = 1 << 7,
+    CpuFeatureAVX512F       = 1 << 8,   // also requires the OS to save the ZMM and mask registers
+    CpuFeatureAVX512BW      = 1 << 9,
+    CpuFeatureAVX512VL      = 1 << 10,
+    CpuFeatureInvariantTSC  = 1 << 11,
+    // ARM
+    CpuFeatureNEON          = 1 << 16,
+    CpuFeatureCRC32         = 1 << 17,
+    CpuFeatureSVE           = 1 << 18,
+
+    CpuFeatureAll           = 0x7FFFFFFF
+} cstlCpuFeature;
+
+// The features of the running CPU (a bitmask of `cstlCpuFeature`), minus the ones hidden by 
+// `cpu_set_features_mask()`
+UInt32 cpu_features();
+// Are all of `features` available?
+static inline bool cpu_has(UInt32 features) {
+    return (cpu_features() & features) == features;
+}
+// Hide every feature not in `mask` (`CpuFeatureAll` shows them all again), and re-select the SIMD kernels
+void cpu_set_features_mask(UInt32 mask);
+// Name of a single feature ("avx2", "neon", ...)
+const char* cpu_feature_name(cstlCpuFeature feature);
+
 #endif // CORETEN_CPU_H
\ No newline at end of file
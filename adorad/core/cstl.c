@@ -18,6 +18,10 @@ CREDITS
     Written by Jason Dsouza <@jasmcaus>
 */
 
+// headers.h requests the POSIX/GNU extensions (`pread()`, `O_CLOEXEC`, ...), which only works before the first 
+// system header
+#include <adorad/core/headers.h>
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -25,15 +29,179 @@ CREDITS
 
 #include <adorad/core/adcore.h>
 
+// -------------------------------------------------------------------------
+// bench.c
+// -------------------------------------------------------------------------
+
+cstlBench* bench_new(bool counters) {
+    cstlBench* bench = cstl_new_obj(null, cstlBench);
+    bench->counters = perf_counters_new(counters);
+    bench->unit = "item";
+    return bench;
+}
+
+void bench_free(cstlBench* bench) {
+    if(bench == null)
+        return;
+    perf_counters_free(bench->counters);
+    cstl_free(null, bench->results, bench->capacity * sizeof(cstlBenchResult));
+    cstl_free_obj(null, bench);
+}
+
+void bench_set_unit(cstlBench* bench, const char* unit) {
+    bench->unit = unit;
+}
+
+static cstlBenchResult* __bench_find(cstlBench* bench, const char* name) {
+    for(UInt64 i = 0; i < bench->nresults; i++) {
+        if(strcmp(bench->results[i].name, name) == 0)
+            return &bench->results[i];
+    }
+    return null;
+}
+
+void bench_begin(cstlBench* bench, const char* name) {
+    CORETEN_ENFORCE(bench->current == null, "Benchmark regions cannot nest");
+    cstlBenchResult* result = __bench_find(bench, name);
+    if(result == null) {
+        if(bench->nresults == bench->capacity) {
+            UInt64 capacity = bench->capacity ? bench->capacity * 2 : 8;
+            bench->results = cast(cstlBenchResult*)cstl_realloc(null, bench->results, 
+                                                                bench->capacity * sizeof(cstlBenchResult), 
+                                                                capacity * sizeof(cstlBenchResult));
+            bench->capacity = capacity;
+        }
+        result = &bench->results[bench->nresults++];
+        memset(result, 0, sizeof(*result));
+        result->name = name;
+        result->min_ns = cast(UInt64)-1;
+    }
+    bench->current = result;
+    // Started last, so the bookkeeping above isn't counted
+    perf_counters_start(bench->counters);
+}
+
+void bench_end(cstlBench* bench, UInt64 bytes, UInt64 items) {
+    cstlPerfSample sample;
+    perf_counters_stop(bench->counters, &sample);
+    cstlBenchResult* result = bench->current;
+    CORETEN_ENFORCE(result != null, "`bench_end()` without a matching `bench_begin()`");
+    bench->current = null;
+
+    result->total.valid = result->runs == 0 ? sample.valid : result->total.valid & sample.valid;
+    result->runs++;
+    result->bytes += bytes;
+    result->items += items;
+    result->total.wall_ns += sample.wall_ns;
+    if(sample.wall_ns < result->min_ns)
+        result->min_ns = sample.wall_ns;
+    for(int i = 0; i < PerfEventCount; i++)
+        result->total.values[i] += sample.values[i];
+}
+
+const cstlBenchResult* bench_result(cstlBench* bench, const char* name) {
+    return __bench_find(bench, name);
+}
+
+// `value` with a k/M/G suffix, right-aligned in `width` columns. "-" for missing values
+static void __bench_write_count(cstlWriter* writer, int width, bool valid, double value) {
+    if(!valid) {
+        writer_printf(writer, " %*s", width, "-");
+        return;
+    }
+    const char* suffix = "";
+    if(value >= 1e9)        { value /= 1e9; suffix = "G"; }
+    else if(value >= 1e6)   { value /= 1e6; suffix = "M"; }
+    else if(value >= 1e3)   { value /= 1e3; suffix = "k"; }
+    writer_printf(writer, " %*.*f%s", width - (*suffix ? 1 : 0), *suffix || value < 100 ? 2 : 0, value, suffix);
+}
+
+// `numerator / denominator`, or "-" if either is missing
+static void __bench_write_ratio(cstlWriter* writer, int width, bool valid, double numerator, double denominator) {
+    if(!valid || denominator == 0)
+        writer_printf(writer, " %*s", width, "-");
+    else
+        writer_printf(writer, " %*.2f", width, numerator / denominator);
+}
+
+void bench_write_report(cstlBench* bench, FILE* out) {
+    cstlWriter* writer = writer_new_file(null, out, 0);
+    bool counters = perf_counters_available(bench->counters);
+    if(counters) {
+        writer_str(writer, "Benchmark (means per run; counters:");
+        for(int i = 0; i < PerfEventCount; i++) {
+            if(bench->counters->opened & PERF_EVENT_BIT(i))
+                writer_printf(writer, " %s", perf_event_name(cast(cstlPerfEvent)i));
+        }
+        writer_str(writer, "):\n");
+    } else {
+        writer_str(writer, "Benchmark (means per run; no hardware counters");
+        if(*perf_counters_error(bench->counters))
+            writer_printf(writer, ": %s", perf_counters_error(bench->counters));
+        writer_str(writer, "):\n");
+    }
+    
+    char per_unit[32];
+    snprintf(per_unit, sizeof(per_unit), "ns/%s", bench->unit);
+    writer_printf(writer, "    %-20s %6s %10s %10s %9s %9s", "region", "runs", "min (ms)", "mean (ms)", "MB/s", per_unit);
+    if(counters) {
+        char cycles_per_unit[32];
+        char instr_per_unit[32];
+        snprintf(cycles_per_unit, sizeof(cycles_per_unit), "cyc/%s", bench->unit);
+        snprintf(instr_per_unit, sizeof(instr_per_unit), "ins/%s", bench->unit);
+        writer_printf(writer, " %9s %9s %6s %9s %9s %9s %7s %9s %9s", "cycles", "instr", "IPC", "br-miss", 
+                      "L1d-miss", "LLC-miss", "cyc/B", cycles_per_unit, instr_per_unit);
+    }
+    writer_char(writer, '\n');
+
+    for(UInt64 i = 0; i < bench->nresults; i++) {
+        cstlBenchResult* result = &bench->results[i];
+        double runs = cast(double)result->runs;
+        double bytes = cast(double)result->bytes;
+        double items = cast(double)result->items;
+        double wall_ns = cast(double)result->total.wall_ns;
+        writer_printf(writer, "    %-20s %6llu %10.3f %10.3f", result->name, cast(unsigned long long)result->runs, 
+                      cast(double)result->min_ns / 1e6, wall_ns / runs / 1e6);
+        // bytes/ns is GB/s
+        __bench_write_ratio(writer, 9, result->bytes > 0, bytes * 1e3, wall_ns);
+        __bench_write_ratio(writer, 9, result->items > 0, wall_ns, items);
+        if(counters) {
+            UInt32 valid = result->total.valid;
+            double values[PerfEventCount];
+            for(int e = 0; e < PerfEventCount; e++)
+                values[e] = cast(double)result->total.values[e];
+            for(int e = PerfCycles; e <= PerfInstructions; e++)
+                __bench_write_count(writer, 9, valid & PERF_EVENT_BIT(e), values[e] / runs);
+            bool ipc = (valid & PERF_EVENT_BIT(PerfCycles)) && (valid & PERF_EVENT_BIT(PerfInstructions));
+            __bench_write_ratio(writer, 6, ipc, values[PerfInstructions], values[PerfCycles]);
+            for(int e = PerfBranchMisses; e <= PerfLLCMisses; e++)
+                __bench_write_count(writer, 9, valid & PERF_EVENT_BIT(e), values[e] / runs);
+            __bench_write_ratio(writer, 7, (valid & PERF_EVENT_BIT(PerfCycles)) && result->bytes > 0, 
+                                values[PerfCycles], bytes);
+            __bench_write_ratio(writer, 9, (valid & PERF_EVENT_BIT(PerfCycles)) && result->items > 0, 
+                                values[PerfCycles], items);
+            __bench_write_ratio(writer, 9, (valid & PERF_EVENT_BIT(PerfInstructions)) && result->items > 0, 
+                                values[PerfInstructions], items);
+        }
+        writer_char(writer, '\n');
+    }
+    writer_free(writer);
+}
+
 // -------------------------------------------------------------------------
 // buffer.c
 // -------------------------------------------------------------------------
 
 // Create a new `cstlBuffer`
 cstlBuffer* buff_new(char* buff_data) {
-    cstlBuffer* buffer = cast(cstlBuffer*)calloc(1, sizeof(cstlBuffer));
-    CORETEN_ENFORCE_NN(buffer, "Could not allocate memory. Memory full.");
+    return buff_new_in(null, buff_data);
+}
 
+// Create a new `cstlBuffer` from `allocator` (null for the heap). Data created by the buffer functions (`buff_append()`,
+// `buff_slice()`, etc.) comes from the same allocator.
+cstlBuffer* buff_new_in(cstlAllocator* allocator, char* buff_data) {
+    cstlBuffer* buffer = cstl_new_obj(allocator, cstlBuffer);
+    buffer->allocator = allocator;
     buffer->is_utf8 = false;
     buff_set(buffer, buff_data);
 
@@ -76,91 +244,14 @@ bool buff_is_empty(cstlBuffer* buffer) {
 }
 
 // Returns the length of the buffer
-// Note: The implementation for this was taken from:
-// https://github.com/lattera/glibc/blob/master/string/strlen.c
-// All due credit for this goes to the rightful author.
-UInt32 __internal_strlength(const char* str, bool is_utf8) {
-    if(!is_utf8) {
-        const char* char_ptr;
-        const unsigned long int* longword_ptr;
-        unsigned long int longword, himagic, lomagic;
-
-        // Handle the first few characters by reading one character at a time.
-        // Do this until CHAR_PTR is aligned on a longword boundary.
-        for(char_ptr = str; (cast(unsigned long int)char_ptr & (sizeof(longword) - 1)) != 0; ++char_ptr) {
-            if (*char_ptr == nullchar)
-                return char_ptr - str;
-        }
-
-        // All these elucidatory comments refer to 4-byte longwords, but the theory applies equally 
-        // well to 8-byte longwords
-        longword_ptr = cast(unsigned long int*)char_ptr;
-
-        // Bits 31, 24, 16, and 8 of this number are zero. Call these bits the "holes".
-        // Note that there is a hole just to the left of each byte, with an extra at the end:
-        //     bits:  01111110 11111110 11111110 11111111
-        //     bytes: AAAAAAAA BBBBBBBB CCCCCCCC DDDDDDDD
-        // The 1-bits make sure that carries propagate to the next 0-bit.
-        // The 0-bits provide holes forcarries to fall into.
-        himagic = 0x80808080L;
-        lomagic = 0x01010101L;
-
-        if(sizeof(longword) > 4) {
-            // 64-bit version of the magic.
-            // Do the shift in two steps to avoid a warning if long has 32 bits.
-            himagic = ((himagic << 16) << 16) | himagic;
-            lomagic = ((lomagic << 16) << 16) | lomagic;
-        }
-        if(sizeof(longword) > 8)
-            abort();
-
-        // Instead of the traditional loop which tests each character, we will test a longword at a time.
-        // The tricky part is testing if *any of the four* bytes in the longword in question are zero.
-        for(;;) {
-            longword = *longword_ptr++;
-
-            if (((longword - lomagic) & ~longword & himagic) != 0) {
-                // Which of the bytes was the zero?  If none of them were, it was a misfire; continue the search.
-                const char* cp = cast(const char* )(longword_ptr - 1);
-
-                if (cp[0] == 0)
-                    return cp - str;
-                if (cp[1] == 0)
-                    return cp - str + 1;
-                if (cp[2] == 0)
-                    return cp - str + 2;
-                if (cp[3] == 0)
-                    return cp - str + 3;
-
-                if (sizeof(longword) > 4) {
-                    if (cp[4] == 0)
-                        return cp - str + 4;
-                    if (cp[5] == 0)
-                        return cp - str + 5;
-                    if (cp[6] == 0)
-                        return cp - str + 6;
-                    if (cp[7] == 0)
-                        return cp - str + 7;
-                }
-            }
-        }
-    } 
-    // UTF-8
-    else {
-        UInt32 count = 0;
-        for(; *str; count++) {
-            UInt8 c = *str;
-            UInt32 increment = 0;
-                 if(c < 0x80)               increment = 1;
-            else if((c & 0xe0) == 0xc0)     increment = 2;
-            else if((c & 0xf0) == 0xe0)     increment = 3;
-            else if((c & 0xf8) == 0xf0)     increment = 4;
-            else return -1;
-            
-            str += increment;
-        }
-        return count;
-    }
+// For UTF-8 buffers, this is the number of codepoints
+UInt64 __internal_strlength(const char* str, bool is_utf8) {
+    UInt64 nbytes = simd_strlen(str);
+    if(!is_utf8)
+        return nbytes;
+
+    CORETEN_ENFORCE(simd_utf8_validate(str, nbytes), "Invalid UTF-8 data");
+    return simd_utf8_count(str, nbytes);
 }
 
 // Append `buff2` to the buffer data
@@ -172,7 +263,7 @@ void buff_append(cstlBuffer* buffer, cstlBuffer* buff2) {
     CORETEN_ENFORCE_NN(buff2->data, "Expected not null");
 
     UInt64 new_len = buffer->len + buff2->len + 1;
-    char* newstr = cast(char*)calloc(1, new_len);
+    char* newstr = cast(char*)cstl_alloc_aligned(buffer->allocator, new_len, 1);
     strcpy(newstr, buffer->data);
     strcat(newstr, buff2->data);
     buff_set(buffer, newstr);
@@ -184,7 +275,7 @@ void buff_append_char(cstlBuffer* buffer, char ch) {
     CORETEN_ENFORCE_NN(buffer->data, "Expected not null");
 
     UInt64 len = buffer->len;
-    char* newstr = cast(char*)calloc(1, len + 1);
+    char* newstr = cast(char*)cstl_alloc_aligned(buffer->allocator, len + 2, 1);
     strcpy(newstr, buffer->data);
     newstr[len] = ch;
     newstr[len + 1] = nullchar;
@@ -201,7 +292,7 @@ void buff_set(cstlBuffer* buffer, char* new_buff) {
         len = 0;
         new_buff = "";
     } else {
-        len = (UInt64)__internal_strlength(new_buff, buffer->is_utf8);
+        len = __internal_strlength(new_buff, buffer->is_utf8);
     }
 
     buffer->data = new_buff;
@@ -224,12 +315,12 @@ void buff_reset(cstlBuffer* buffer) {
 
 // Reverse a buffer (non-destructive)
 cstlBuffer* buff_rev(cstlBuffer* buffer) {
-    cstlBuffer* rev = buff_new(null);
+    cstlBuffer* rev = buff_new_in(buffer->allocator, null);
     UInt64 length = buffer->len;
     if(!length)
         return rev;
     
-    char* temp = cast(char*)calloc(1, length + 1);
+    char* temp = cast(char*)cstl_alloc_aligned(buffer->allocator, length + 1, 1);
     for(UInt64 i=0; i<length; i++)
         *(temp + i) = *(buffer->data + length - i - 1);
     
@@ -237,24 +328,23 @@ cstlBuffer* buff_rev(cstlBuffer* buffer) {
     return rev;
 }
 
+// Returns the number of bytes used by the buffer data
+// For UTF-8 buffers, `buffer->len` holds the number of codepoints instead
+static inline UInt64 __buff_nbytes(cstlBuffer* buffer) {
+    return buffer->is_utf8 ? simd_strlen(buffer->data) : buffer->len;
+}
+
 // Compare two buffers (case-sensitive)
 // Returns true if `buff1` is lexicographically equal to `buff2`
 bool buff_cmp(cstlBuffer* buff1, cstlBuffer* buff2) {
     if(buff1->len != buff2->len)
         return false;
     
-    const unsigned char* s1 = cast(const unsigned char*) buff1->data;
-    const unsigned char* s2 = cast(const unsigned char*) buff2->data;
-    unsigned char ch1, ch2;
-
-    do {
-        ch1 = cast(unsigned char) *s1++;
-        ch2 = cast(unsigned char) *s2++;
-        if(ch1 == nullchar)
-            return (ch1 - ch2) == 0 ? true : false;
-    } while(ch1 == ch2);
-
-    return (ch1 - ch2) == 0 ? true : false;
+    UInt64 nbytes = __buff_nbytes(buff1);
+    if(nbytes != __buff_nbytes(buff2))
+        return false;
+    
+    return simd_memeq(buff1->data, buff2->data, nbytes);
 }
 
 // Compare two buffers (ignoring case)
@@ -262,30 +352,32 @@ bool buff_cmp(cstlBuffer* buff1, cstlBuffer* buff2) {
 bool buff_cmp_nocase(cstlBuffer* buff1, cstlBuffer* buff2) {
     if(buff1->len != buff2->len)
         return false;
-    
-    const unsigned char* s1 = cast(const unsigned char*) buff1->data;
-    const unsigned char* s2 = cast(const unsigned char*) buff2->data;
-    int result;
 
-    if(s1 == s2)
+    if(buff1->data == buff2->data)
         return true;
     
-    while((result = char_to_lower(*s1) - char_to_lower(*s2++)) == 0) {
-        if(*s1++ == nullchar)
-            break;
-    }
-    return result == 0 ? true : false;
+    UInt64 nbytes = __buff_nbytes(buff1);
+    if(nbytes != __buff_nbytes(buff2))
+        return false;
+    
+    return simd_memcmp_nocase(buff1->data, buff2->data, nbytes) == 0;
 }
 
 // Get a slice of a buffer
 cstlBuffer* buff_slice(cstlBuffer* buffer, int begin, int bytes) {
+    return buff_slice_in(buffer->allocator, buffer, begin, bytes);
+}
+
+// Slice a buffer, allocating the slice (and its data) from `allocator` (or the heap if `allocator` is null)
+cstlBuffer* buff_slice_in(cstlAllocator* allocator, cstlBuffer* buffer, int begin, int bytes) {
     CORETEN_ENFORCE_NN(buffer, "`buffer` cannot be null");
     CORETEN_ENFORCE(begin >= 0);
     CORETEN_ENFORCE(bytes >  0);
 
-    cstlBuffer* slice = buff_new(null);
+    cstlBuffer* slice = buff_new_in(allocator, null);
     CORETEN_ENFORCE_NN(slice, "`slice` cannot be null");
-    char* temp = cast(char*)calloc(1, bytes);
+    // One extra (zeroed) byte for the null terminator
+    char* temp = cast(char*)cstl_alloc_aligned(allocator, bytes + 1, 1);
     strncpy(temp, &(buffer->data[begin]), bytes);
     buff_set(slice, temp);
     CORETEN_ENFORCE_NN(slice, "`slice source` cannot be null");
@@ -295,8 +387,8 @@ cstlBuffer* buff_slice(cstlBuffer* buffer, int begin, int bytes) {
 // Clone a buffer
 cstlBuffer* buff_clone(cstlBuffer* buffer) {
     CORETEN_ENFORCE_NN(buffer, "Cannot clone a null buffer :(");
-    cstlBuffer* clone = buff_new(null);
-    char* dest = cast(char*)calloc(1, buff_len(buffer));
+    cstlBuffer* clone = buff_new_in(buffer->allocator, null);
+    char* dest = cast(char*)cstl_alloc_aligned(buffer->allocator, buff_len(buffer), 1);
     char* source = buffer->data;
 
     if(source) {
@@ -313,8 +405,8 @@ cstlBuffer* buff_clone_n(cstlBuffer* buffer, int n) {
     CORETEN_ENFORCE_NN(buffer, "Cannot clone a null buffer :(");
     CORETEN_ENFORCE(n > 0);
     CORETEN_ENFORCE(n > buffer->len);
-    cstlBuffer* clone = buff_new(null);
-    char* dest = cast(char*)calloc(1, buff_len(buffer));
+    cstlBuffer* clone = buff_new_in(buffer->allocator, null);
+    char* dest = cast(char*)cstl_alloc_aligned(buffer->allocator, buff_len(buffer), 1);
     char* source = buffer->data;
 
     if(source) {
@@ -332,45 +424,35 @@ cstlBuffer* buff_clone_n(cstlBuffer* buffer, int n) {
 // Free the buffer from its associated memory
 void buff_free(cstlBuffer* buffer) {
     if(buffer)
-        free(buffer);
+        cstl_free(buffer->allocator, buffer, sizeof(cstlBuffer));
 }
 
 // Convert a buffer to lowercase
 cstlBuffer* buff_tolower(cstlBuffer* buffer) {
-    cstlBuffer* lower = buff_new(null);
+    cstlBuffer* lower = buff_new_in(buffer->allocator, null);
     if(!buffer->data) 
         return lower;
 
-    char* temp = cast(char*)calloc(1, buffer->len);    
-    strcpy(temp, buffer->data);
-    int i = 0;
-    while(*temp) {
-        *temp = char_to_lower(*temp);
-        temp++;
-        i++;
-    }
-    // Backtrack `i` times
-    temp -= i;
+    UInt64 nbytes = __buff_nbytes(buffer);
+    char* temp = cast(char*)cstl_alloc_aligned(buffer->allocator, nbytes + 1, 1);
+    CORETEN_ENFORCE_NN(temp, "Could not allocate memory. Memory full.");
+    simd_tolower(temp, buffer->data, nbytes);
+    lower->is_utf8 = buffer->is_utf8;
     buff_set(lower, temp);
     return lower;
 }
 
 // Convert a buffer to uppercase
 cstlBuffer* buff_toupper(cstlBuffer* buffer) {
-    cstlBuffer* upper = buff_new(null);
+    cstlBuffer* upper = buff_new_in(buffer->allocator, null);
     if(!buffer->data) 
         return upper;
 
-    char* temp = cast(char*)calloc(1, buffer->len);    
-    strcpy(temp, buffer->data);
-    int i = 0;
-    while(*temp) {
-        *temp = char_to_upper(*temp);
-        temp++;
-        i++;
-    }
-    // Backtrack `i` times
-    temp -= i;
+    UInt64 nbytes = __buff_nbytes(buffer);
+    char* temp = cast(char*)cstl_alloc_aligned(buffer->allocator, nbytes + 1, 1);
+    CORETEN_ENFORCE_NN(temp, "Could not allocate memory. Memory full.");
+    simd_toupper(temp, buffer->data, nbytes);
+    upper->is_utf8 = buffer->is_utf8;
     buff_set(upper, temp);
     return upper;
 }
@@ -475,14 +557,262 @@ char* char_last_occurence(char* str, char ch) {
 // clock.c
 // -------------------------------------------------------------------------
 
-// Returns the current time (in clock_t)
+#if defined(CORETEN_OS_WINDOWS)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif // CORETEN_OS_WINDOWS
+
+UInt64 clock_now_ns() {
+#if defined(CORETEN_OS_WINDOWS)
+    static LARGE_INTEGER frequency;
+    if(frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    // Split the conversion, so it doesn't overflow
+    UInt64 seconds = cast(UInt64)(counter.QuadPart / frequency.QuadPart);
+    UInt64 rest = cast(UInt64)(counter.QuadPart % frequency.QuadPart);
+    return seconds * 1000000000ULL + rest * 1000000000ULL / cast(UInt64)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return cast(UInt64)ts.tv_sec * 1000000000ULL + cast(UInt64)ts.tv_nsec;
+#endif // CORETEN_OS_WINDOWS
+}
+
+double clock_seconds(UInt64 start_ns, UInt64 end_ns) {
+    return cast(double)(end_ns - start_ns) / 1e9;
+}
+
+UInt64 clock_cycles() {
+#if defined(CORETEN_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    UInt64 ticks;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return clock_now_ns();
+#endif // CORETEN_COMPILER_MSVC
+}
+
+bool clock_has_cycle_counter() {
+#if defined(CORETEN_CPU_X86)
+    return cpu_has(CpuFeatureInvariantTSC);
+#elif defined(__aarch64__)
+    // The generic timer always runs at a fixed frequency
+    return true;
+#else
+    return false;
+#endif // CORETEN_CPU_X86
+}
+
+static cstlOnce __clock_calibrate_once = CSTL_ONCE_INIT;
+static double __clock_cycles_per_ns = 0;
+
+static void __clock_calibrate(void* arg) {
+    // Count ticks over ~5ms of wall time. Reading both clocks back to back keeps the error at either end small
+    UInt64 start_ns = clock_now_ns();
+    UInt64 start_cycles = clock_cycles();
+    UInt64 end_ns;
+    do {
+        end_ns = clock_now_ns();
+    } while(end_ns - start_ns < 5000000);
+    UInt64 end_cycles = clock_cycles();
+
+    double measured = cast(double)(end_cycles - start_cycles) / cast(double)(end_ns - start_ns);
+    __clock_cycles_per_ns = measured > 0 ? measured : 1;
+}
+
+double clock_cycles_per_ns() {
+    // Calibrated once; other callers wait for it
+    once_call(&__clock_calibrate_once, __clock_calibrate, null);
+    return __clock_cycles_per_ns;
+}
+
+UInt64 clock_cycles_to_ns(UInt64 cycles) {
+    return cast(UInt64)(cast(double)cycles / clock_cycles_per_ns());
+}
+
 double now() {
-    return clock();
+    return cast(double)clock_now_ns() / 1e9;
+}
+
+double duration(double start, double end) {
+    return end - start;
+}
+
+cstlTimeBlock __time_block_begin(const char* name, UInt64* total) {
+    cstlTimeBlock block = {name, total, clock_now_ns(), false};
+    return block;
+}
+
+void __time_block_end(cstlTimeBlock* block) {
+    UInt64 elapsed = clock_now_ns() - block->start;
+    if(block->total)
+        *block->total += elapsed;
+    else
+        fprintf(stderr, "%s: %.3f ms\n", block->name, cast(double)elapsed / 1e6);
+    block->done = true;
+}
+
+// -------------------------------------------------------------------------
+// cpu.c
+// -------------------------------------------------------------------------
+
+#if defined(CORETEN_CPU_X86) && defined(CORETEN_COMPILER_MSVC)
+    #include <intrin.h>
+#elif defined(CORETEN_CPU_ARM) && defined(CORETEN_OS_LINUX)
+    #include <sys/auxv.h>
+#endif // CORETEN_CPU_X86
+
+// The dispatchers of the modules with SIMD kernels (they re-run when the features change)
+static void __simd_dispatch();
+static void __hash_dispatch();
+
+static cstlOnce __cpu_detect_once = CSTL_ONCE_INIT;
+static UInt32 __cpu_detected = 0;
+// Set by `cpu_set_features_mask()` while other threads may be reading it
+static cstlAtomic32 __cpu_features_mask = {CpuFeatureAll};
+
+#if defined(CORETEN_CPU_X86)
+static void __cpu_cpuid(UInt32 leaf, UInt32 subleaf, UInt32 regs[4]) {
+#if defined(CORETEN_COMPILER_MSVC)
+    int info[4];
+    __cpuidex(info, cast(int)leaf, cast(int)subleaf);
+    for(int i = 0; i < 4; i++)
+        regs[i] = cast(UInt32)info[i];
+#else
+    __asm__ volatile("cpuid" : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3]) 
+                             : "a"(leaf), "c"(subleaf));
+#endif // CORETEN_COMPILER_MSVC
+}
+
+// The register state the OS saves on a context switch (XCR0)
+static UInt64 __cpu_xgetbv() {
+#if defined(CORETEN_COMPILER_MSVC)
+    return cast(UInt64)_xgetbv(0);
+#else
+    UInt32 eax, edx;
+    // `xgetbv` spelled out, so this doesn't need -mxsave
+    __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (cast(UInt64)edx << 32) | eax;
+#endif // CORETEN_COMPILER_MSVC
 }
 
-// Get duration between `start` and `end` in seconds.
-double duration(clock_t start, clock_t end) {
-    return (double)(end - start)/CLOCKS_PER_SEC;
+static UInt32 __cpu_detect() {
+    UInt32 features = 0;
+    UInt32 regs[4];
+    __cpu_cpuid(0, 0, regs);
+    UInt32 max_leaf = regs[0];
+    if(max_leaf < 1)
+        return 0;
+
+    __cpu_cpuid(1, 0, regs);
+    UInt32 ecx1 = regs[2], edx1 = regs[3];
+    if(edx1 & (1u << 26))   features |= CpuFeatureSSE2;
+    if(ecx1 & (1u << 9))    features |= CpuFeatureSSSE3;
+    if(ecx1 & (1u << 20))   features |= CpuFeatureSSE42;
+    if(ecx1 & (1u << 23))   features |= CpuFeaturePOPCNT;
+
+    // AVX (and everything built on it) is only usable if the OS saves the XMM and YMM state (OSXSAVE, XCR0[2:1]),
+    // and AVX-512 additionally needs the opmask and ZMM state (XCR0[7:5])
+    UInt64 xcr0 = (ecx1 & (1u << 27)) ? __cpu_xgetbv() : 0;
+    bool os_avx = (xcr0 & 0x6) == 0x6;
+    bool os_avx512 = os_avx && (xcr0 & 0xE0) == 0xE0;
+    if(os_avx && (ecx1 & (1u << 28)))
+        features |= CpuFeatureAVX;
+
+    if(max_leaf >= 7) {
+        __cpu_cpuid(7, 0, regs);
+        UInt32 ebx7 = regs[1];
+        if(ebx7 & (1u << 3))                                        features |= CpuFeatureBMI1;
+        if(ebx7 & (1u << 8))                                        features |= CpuFeatureBMI2;
+        if((features & CpuFeatureAVX) && (ebx7 & (1u << 5)))        features |= CpuFeatureAVX2;
+        if(os_avx512 && (ebx7 & (1u << 16))) {
+            features |= CpuFeatureAVX512F;
+            if(ebx7 & (1u << 30))   features |= CpuFeatureAVX512BW;
+            if(ebx7 & (1u << 31))   features |= CpuFeatureAVX512VL;
+        }
+    }
+
+    // Invariant TSC: CPUID.80000007H:EDX[8]
+    __cpu_cpuid(0x80000000, 0, regs);
+    if(regs[0] >= 0x80000007) {
+        __cpu_cpuid(0x80000007, 0, regs);
+        if(regs[3] & (1u << 8))
+            features |= CpuFeatureInvariantTSC;
+    }
+    return features;
+}
+#elif defined(CORETEN_CPU_ARM)
+static UInt32 __cpu_detect() {
+    UInt32 features = 0;
+#if defined(__aarch64__) || defined(_M_ARM64)
+    // Advanced SIMD is part of the AArch64 baseline
+    features |= CpuFeatureNEON;
+    #if defined(CORETEN_OS_LINUX)
+        unsigned long hwcap = getauxval(AT_HWCAP);
+        if(hwcap & (1ul << 7))      features |= CpuFeatureCRC32;    // HWCAP_CRC32
+        if(hwcap & (1ul << 22))     features |= CpuFeatureSVE;      // HWCAP_SVE
+    #elif defined(CORETEN_OS_OSX)
+        // Every Apple Silicon core has the CRC32 instructions (and none have SVE)
+        features |= CpuFeatureCRC32;
+    #elif defined(__ARM_FEATURE_CRC32)
+        features |= CpuFeatureCRC32;
+    #endif // CORETEN_OS_LINUX
+#elif defined(CORETEN_OS_LINUX)
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    if(hwcap & (1ul << 12))                         features |= CpuFeatureNEON;     // HWCAP_NEON
+    if(getauxval(AT_HWCAP2) & (1ul << 4))           features |= CpuFeatureCRC32;    // HWCAP2_CRC32
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    features |= CpuFeatureNEON;
+#endif // __aarch64__
+    return features;
+}
+#else
+static UInt32 __cpu_detect() {
+    return 0;
+}
+#endif // CORETEN_CPU_X86
+
+static void __cpu_detect_init(void* arg) {
+    __cpu_detected = __cpu_detect();
+}
+
+UInt32 cpu_features() {
+    once_call(&__cpu_detect_once, __cpu_detect_init, null);
+    return __cpu_detected & cast(UInt32)atomic32_load(&__cpu_features_mask, MemoryOrderRelaxed);
+}
+
+void cpu_set_features_mask(UInt32 mask) {
+    atomic32_store(&__cpu_features_mask, cast(Int32)mask, MemoryOrderRelaxed);
+    __simd_dispatch();
+    __hash_dispatch();
+}
+
+const char* cpu_feature_name(cstlCpuFeature feature) {
+    switch(feature) {
+        case CpuFeatureSSE2:            return "sse2";
+        case CpuFeatureSSSE3:           return "ssse3";
+        case CpuFeatureSSE42:           return "sse4.2";
+        case CpuFeaturePOPCNT:          return "popcnt";
+        case CpuFeatureAVX:             return "avx";
+        case CpuFeatureAVX2:            return "avx2";
+        case CpuFeatureBMI1:            return "bmi1";
+        case CpuFeatureBMI2:            return "bmi2";
+        case CpuFeatureAVX512F:         return "avx512f";
+        case CpuFeatureAVX512BW:        return "avx512bw";
+        case CpuFeatureAVX512VL:        return "avx512vl";
+        case CpuFeatureInvariantTSC:    return "invariant_tsc";
+        case CpuFeatureNEON:            return "neon";
+        case CpuFeatureCRC32:           return "crc32";
+        case CpuFeatureSVE:             return "sve";
+        default:                        return "unknown";
+    }
 }
 
 // -------------------------------------------------------------------------
@@ -512,10 +842,11 @@ cstlColouredPrintf(int colour, const char* fmt, ...) {
             case CORETEN_COLOUR_BOLD:     str = "\033[1m"; break;
             default:                      str = "\033[0m"; break;
         }
-        printf("%s", str);
-        n = printf("%s", buffer);
-        printf("\033[0m"); // Reset the colour
-        return n;
+        // One write for the colour, the message and the reset
+        char out[sizeof(buffer) + 16];
+        n = snprintf(out, sizeof(out), "%s%s\033[0m", str, buffer);
+        fwrite(out, 1, strlen(out), stdout);
+        return n - cast(int)strlen(str) - 4;
     }
 #elif defined(CORETEN_OS_WINDOWS)
     {
@@ -547,6 +878,15 @@ cstlColouredPrintf(int colour, const char* fmt, ...) {
 #endif // CORETEN_UNIX_
 }
 
+void __coreten_enforce_failed(const char* file, unsigned line, const char* cond, const char* msg) {
+    printf("%s:%u: ", file, line);
+    cstlColouredPrintf(CORETEN_COLOUR_ERROR, "%s", *msg ? msg : "FAILED");
+    printf("\nThe following assertion failed: \n");
+    cstlColouredPrintf(CORETEN_COLOUR_CYAN, "    CORETEN_ENFORCE( %s )\n", cond);
+    fflush(stdout);
+    abort();
+}
+
 void coreten_panic(PanicLevel pl, const char* format, ...) {
     va_list args;
     char buffer[256];
@@ -589,7 +929,44 @@ inline UInt64 endian_swap64(UInt64 i) {
 // hash.c
 // -------------------------------------------------------------------------
 
-#if defined(CORETEN_INCLUDE_HASH_H)
+#if defined(CORETEN_CPU_DISPATCH_X86)
+    #include <immintrin.h>
+#endif // CORETEN_CPU_DISPATCH_X86
+
+typedef UInt32 (*__HashCrc32cKernel)(UInt32 crc, void const* data, Ll len);
+typedef UInt64 (*__HashFast64LongKernel)(UInt8 const* p, UInt64 len, UInt64 seed);
+typedef void (*__HashAccumulateKernel)(UInt64* acc, UInt8 const* p, UInt64 const* key);
+typedef void (*__HashScrambleKernel)(UInt64* acc, UInt64 const* key);
+
+typedef struct __HashKernelSet {
+    __HashCrc32cKernel crc32c_update;
+    __HashFast64LongKernel fast64_long;
+    __HashAccumulateKernel accumulate;
+    __HashScrambleKernel scramble;
+} __HashKernelSet;
+
+// The kernels picked for this CPU by `__hash_dispatch()` (defined at the end of this section), null until the first 
+// use. `cpu_set_features_mask()` re-picks them while other threads may be calling them, so each one is stored 
+// atomically. Relaxed is enough: any kernel that has been stored works
+typedef struct __HashKernels {
+    cstlAtomicPtr crc32c_update;
+    cstlAtomicPtr fast64_long;
+    cstlAtomicPtr accumulate;
+    cstlAtomicPtr scramble;
+} __HashKernels;
+
+static __HashKernels __hash_kernels = {0};
+
+static void* __hash_kernel(cstlAtomicPtr* entry) {
+    void* kernel = atomicptr_load(entry, MemoryOrderRelaxed);
+    if(CORETEN_UNLIKELY(kernel == null)) {
+        __hash_dispatch();
+        kernel = atomicptr_load(entry, MemoryOrderRelaxed);
+    }
+    return kernel;
+}
+
+#define __HASH_KERNEL(name, Kernel)     (cast(Kernel)__hash_kernel(&__hash_kernels.name))
 
 UInt32 hash_adler32(void const* data, Ll len) {
     UInt32 const MOD_ALDER = 65521;
@@ -623,156 +1000,154 @@ UInt32 hash_adler32(void const* data, Ll len) {
     return (b << 16) | a;
 }
 
-static UInt32 const CORETEN__CRC32_TABLE[256] = {
-    0x00000000, 0x77073096, 0xee0e612c, 0x990951ba,
-    0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
-    0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
-    0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
-    0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de,
-    0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
-    0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec,
-    0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
-    0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
-    0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
-    0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940,
-    0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
-    0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116,
-    0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
-    0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
-    0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
-    0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a,
-    0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
-    0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818,
-    0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
-    0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
-    0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
-    0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c,
-    0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
-    0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2,
-    0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
-    0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
-    0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
-    0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086,
-    0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
-    0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4,
-    0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
-    0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
-    0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
-    0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8,
-    0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
-    0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe,
-    0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
-    0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
-    0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
-    0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252,
-    0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
-    0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60,
-    0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
-    0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
-    0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
-    0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04,
-    0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
-    0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a,
-    0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
-    0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
-    0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
-    0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e,
-    0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
-    0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c,
-    0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
-    0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
-    0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
-    0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0,
-    0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
-    0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6,
-    0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
-    0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
-    0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
-};
+#include <adorad/core/hash_tables.h>
 
-static UInt64 const CORETEN__CRC64_TABLE[256] = {
-    0x0000000000000000ull, 0x42f0e1eba9ea3693ull, 0x85e1c3d753d46d26ull, 0xc711223cfa3e5bb5ull,
-    0x493366450e42ecdfull, 0x0bc387aea7a8da4cull, 0xccd2a5925d9681f9ull, 0x8e224479f47cb76aull,
-    0x9266cc8a1c85d9beull, 0xd0962d61b56fef2dull, 0x17870f5d4f51b498ull, 0x5577eeb6e6bb820bull,
-    0xdb55aacf12c73561ull, 0x99a54b24bb2d03f2ull, 0x5eb4691841135847ull, 0x1c4488f3e8f96ed4ull,
-    0x663d78ff90e185efull, 0x24cd9914390bb37cull, 0xe3dcbb28c335e8c9ull, 0xa12c5ac36adfde5aull,
-    0x2f0e1eba9ea36930ull, 0x6dfeff5137495fa3ull, 0xaaefdd6dcd770416ull, 0xe81f3c86649d3285ull,
-    0xf45bb4758c645c51ull, 0xb6ab559e258e6ac2ull, 0x71ba77a2dfb03177ull, 0x334a9649765a07e4ull,
-    0xbd68d2308226b08eull, 0xff9833db2bcc861dull, 0x388911e7d1f2dda8ull, 0x7a79f00c7818eb3bull,
-    0xcc7af1ff21c30bdeull, 0x8e8a101488293d4dull, 0x499b3228721766f8ull, 0x0b6bd3c3dbfd506bull,
-    0x854997ba2f81e701ull, 0xc7b97651866bd192ull, 0x00a8546d7c558a27ull, 0x4258b586d5bfbcb4ull,
-    0x5e1c3d753d46d260ull, 0x1cecdc9e94ace4f3ull, 0xdbfdfea26e92bf46ull, 0x990d1f49c77889d5ull,
-    0x172f5b3033043ebfull, 0x55dfbadb9aee082cull, 0x92ce98e760d05399ull, 0xd03e790cc93a650aull,
-    0xaa478900b1228e31ull, 0xe8b768eb18c8b8a2ull, 0x2fa64ad7e2f6e317ull, 0x6d56ab3c4b1cd584ull,
-    0xe374ef45bf6062eeull, 0xa1840eae168a547dull, 0x66952c92ecb40fc8ull, 0x2465cd79455e395bull,
-    0x3821458aada7578full, 0x7ad1a461044d611cull, 0xbdc0865dfe733aa9ull, 0xff3067b657990c3aull,
-    0x711223cfa3e5bb50ull, 0x33e2c2240a0f8dc3ull, 0xf4f3e018f031d676ull, 0xb60301f359dbe0e5ull,
-    0xda050215ea6c212full, 0x98f5e3fe438617bcull, 0x5fe4c1c2b9b84c09ull, 0x1d14202910527a9aull,
-    0x93366450e42ecdf0ull, 0xd1c685bb4dc4fb63ull, 0x16d7a787b7faa0d6ull, 0x5427466c1e109645ull,
-    0x4863ce9ff6e9f891ull, 0x0a932f745f03ce02ull, 0xcd820d48a53d95b7ull, 0x8f72eca30cd7a324ull,
-    0x0150a8daf8ab144eull, 0x43a04931514122ddull, 0x84b16b0dab7f7968ull, 0xc6418ae602954ffbull,
-    0xbc387aea7a8da4c0ull, 0xfec89b01d3679253ull, 0x39d9b93d2959c9e6ull, 0x7b2958d680b3ff75ull,
-    0xf50b1caf74cf481full, 0xb7fbfd44dd257e8cull, 0x70eadf78271b2539ull, 0x321a3e938ef113aaull,
-    0x2e5eb66066087d7eull, 0x6cae578bcfe24bedull, 0xabbf75b735dc1058ull, 0xe94f945c9c3626cbull,
-    0x676dd025684a91a1ull, 0x259d31cec1a0a732ull, 0xe28c13f23b9efc87ull, 0xa07cf2199274ca14ull,
-    0x167ff3eacbaf2af1ull, 0x548f120162451c62ull, 0x939e303d987b47d7ull, 0xd16ed1d631917144ull,
-    0x5f4c95afc5edc62eull, 0x1dbc74446c07f0bdull, 0xdaad56789639ab08ull, 0x985db7933fd39d9bull,
-    0x84193f60d72af34full, 0xc6e9de8b7ec0c5dcull, 0x01f8fcb784fe9e69ull, 0x43081d5c2d14a8faull,
-    0xcd2a5925d9681f90ull, 0x8fdab8ce70822903ull, 0x48cb9af28abc72b6ull, 0x0a3b7b1923564425ull,
-    0x70428b155b4eaf1eull, 0x32b26afef2a4998dull, 0xf5a348c2089ac238ull, 0xb753a929a170f4abull,
-    0x3971ed50550c43c1ull, 0x7b810cbbfce67552ull, 0xbc902e8706d82ee7ull, 0xfe60cf6caf321874ull,
-    0xe224479f47cb76a0ull, 0xa0d4a674ee214033ull, 0x67c58448141f1b86ull, 0x253565a3bdf52d15ull,
-    0xab1721da49899a7full, 0xe9e7c031e063acecull, 0x2ef6e20d1a5df759ull, 0x6c0603e6b3b7c1caull,
-    0xf6fae5c07d3274cdull, 0xb40a042bd4d8425eull, 0x731b26172ee619ebull, 0x31ebc7fc870c2f78ull,
-    0xbfc9838573709812ull, 0xfd39626eda9aae81ull, 0x3a28405220a4f534ull, 0x78d8a1b9894ec3a7ull,
-    0x649c294a61b7ad73ull, 0x266cc8a1c85d9be0ull, 0xe17dea9d3263c055ull, 0xa38d0b769b89f6c6ull,
-    0x2daf4f0f6ff541acull, 0x6f5faee4c61f773full, 0xa84e8cd83c212c8aull, 0xeabe6d3395cb1a19ull,
-    0x90c79d3fedd3f122ull, 0xd2377cd44439c7b1ull, 0x15265ee8be079c04ull, 0x57d6bf0317edaa97ull,
-    0xd9f4fb7ae3911dfdull, 0x9b041a914a7b2b6eull, 0x5c1538adb04570dbull, 0x1ee5d94619af4648ull,
-    0x02a151b5f156289cull, 0x4051b05e58bc1e0full, 0x87409262a28245baull, 0xc5b073890b687329ull,
-    0x4b9237f0ff14c443ull, 0x0962d61b56fef2d0ull, 0xce73f427acc0a965ull, 0x8c8315cc052a9ff6ull,
-    0x3a80143f5cf17f13ull, 0x7870f5d4f51b4980ull, 0xbf61d7e80f251235ull, 0xfd913603a6cf24a6ull,
-    0x73b3727a52b393ccull, 0x31439391fb59a55full, 0xf652b1ad0167feeaull, 0xb4a25046a88dc879ull,
-    0xa8e6d8b54074a6adull, 0xea16395ee99e903eull, 0x2d071b6213a0cb8bull, 0x6ff7fa89ba4afd18ull,
-    0xe1d5bef04e364a72ull, 0xa3255f1be7dc7ce1ull, 0x64347d271de22754ull, 0x26c49cccb40811c7ull,
-    0x5cbd6cc0cc10fafcull, 0x1e4d8d2b65facc6full, 0xd95caf179fc497daull, 0x9bac4efc362ea149ull,
-    0x158e0a85c2521623ull, 0x577eeb6e6bb820b0ull, 0x906fc95291867b05ull, 0xd29f28b9386c4d96ull,
-    0xcedba04ad0952342ull, 0x8c2b41a1797f15d1ull, 0x4b3a639d83414e64ull, 0x09ca82762aab78f7ull,
-    0x87e8c60fded7cf9dull, 0xc51827e4773df90eull, 0x020905d88d03a2bbull, 0x40f9e43324e99428ull,
-    0x2cffe7d5975e55e2ull, 0x6e0f063e3eb46371ull, 0xa91e2402c48a38c4ull, 0xebeec5e96d600e57ull,
-    0x65cc8190991cb93dull, 0x273c607b30f68faeull, 0xe02d4247cac8d41bull, 0xa2dda3ac6322e288ull,
-    0xbe992b5f8bdb8c5cull, 0xfc69cab42231bacfull, 0x3b78e888d80fe17aull, 0x7988096371e5d7e9ull,
-    0xf7aa4d1a85996083ull, 0xb55aacf12c735610ull, 0x724b8ecdd64d0da5ull, 0x30bb6f267fa73b36ull,
-    0x4ac29f2a07bfd00dull, 0x08327ec1ae55e69eull, 0xcf235cfd546bbd2bull, 0x8dd3bd16fd818bb8ull,
-    0x03f1f96f09fd3cd2ull, 0x41011884a0170a41ull, 0x86103ab85a2951f4ull, 0xc4e0db53f3c36767ull,
-    0xd8a453a01b3a09b3ull, 0x9a54b24bb2d03f20ull, 0x5d45907748ee6495ull, 0x1fb5719ce1045206ull,
-    0x919735e51578e56cull, 0xd367d40ebc92d3ffull, 0x1476f63246ac884aull, 0x568617d9ef46bed9ull,
-    0xe085162ab69d5e3cull, 0xa275f7c11f7768afull, 0x6564d5fde549331aull, 0x279434164ca30589ull,
-    0xa9b6706fb8dfb2e3ull, 0xeb46918411358470ull, 0x2c57b3b8eb0bdfc5ull, 0x6ea7525342e1e956ull,
-    0x72e3daa0aa188782ull, 0x30133b4b03f2b111ull, 0xf7021977f9cceaa4ull, 0xb5f2f89c5026dc37ull,
-    0x3bd0bce5a45a6b5dull, 0x79205d0e0db05dceull, 0xbe317f32f78e067bull, 0xfcc19ed95e6430e8ull,
-    0x86b86ed5267cdbd3ull, 0xc4488f3e8f96ed40ull, 0x0359ad0275a8b6f5ull, 0x41a94ce9dc428066ull,
-    0xcf8b0890283e370cull, 0x8d7be97b81d4019full, 0x4a6acb477bea5a2aull, 0x089a2aacd2006cb9ull,
-    0x14dea25f3af9026dull, 0x562e43b4931334feull, 0x913f6188692d6f4bull, 0xd3cf8063c0c759d8ull,
-    0x5dedc41a34bbeeb2ull, 0x1f1d25f19d51d821ull, 0xd80c07cd676f8394ull, 0x9afce626ce85b507ull,
-};
+#if defined(CORETEN_CPU_DISPATCH_X86)
+    #define __HASH_CRC32C_SSE42     1
+#elif defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+    #define __HASH_CRC32C_ARM       1
+#endif // CORETEN_CPU_X86
+
+static inline UInt32 __hash_read32le(UInt8 const* p) {
+    return cast(UInt32)p[0] | (cast(UInt32)p[1] << 8) | (cast(UInt32)p[2] << 16) | (cast(UInt32)p[3] << 24);
+}
+
+static inline UInt64 __hash_read64le(UInt8 const* p) {
+    return cast(UInt64)__hash_read32le(p) | (cast(UInt64)__hash_read32le(p + 4) << 32);
+}
+
+// Slicing-by-8: fold 8 bytes into `crc` with 8 independent table lookups (see tools/scripts/generate_crc_tables.py)
+static UInt32 __hash_crc32_slice8(UInt32 const table[8][256], UInt32 crc, UInt8 const* bytes, Ll len) {
+    while(len >= 8) {
+        UInt32 lo = __hash_read32le(bytes) ^ crc;
+        UInt32 hi = __hash_read32le(bytes + 4);
+        crc = table[7][lo & 0xff] ^ table[6][(lo >> 8) & 0xff] ^ table[5][(lo >> 16) & 0xff] ^ table[4][lo >> 24] ^
+              table[3][hi & 0xff] ^ table[2][(hi >> 8) & 0xff] ^ table[1][(hi >> 16) & 0xff] ^ table[0][hi >> 24];
+        bytes += 8;
+        len -= 8;
+    }
+    while(len-- > 0)
+        crc = (crc >> 8) ^ table[0][(crc ^ *bytes++) & 0xff];
+    return crc;
+}
 
 UInt32 hash_crc32(void const* data, Ll len) {
-    Ll remaining;
-    UInt32 result = ~(cast(UInt32)0);
-    UInt8 const* c = cast(UInt8 const* )data;
-    for(remaining = len; remaining--; c++)
-        result = (result >> 8) ^ (CORETEN__CRC32_TABLE[(result ^ *c) & 0xff]);
-    return ~result;
+    return ~__hash_crc32_slice8(CORETEN__CRC32_TABLE, ~(cast(UInt32)0), cast(UInt8 const*)data, len);
+}
+
+UInt32 __hash_crc32c_scalar(void const* data, Ll len) {
+    return ~__hash_crc32_slice8(CORETEN__CRC32C_TABLE, ~(cast(UInt32)0), cast(UInt8 const*)data, len);
+}
+
+#if defined(__HASH_CRC32C_SSE42)
+// The raw CRC register is passed in and returned (no initial/final inversion), so this also serves streaming
+static CORETEN_TARGET("sse4.2") UInt32 __hash_crc32c_sse42(UInt32 crc32, void const* data, Ll len) {
+    UInt8 const* bytes = cast(UInt8 const*)data;
+#if defined(CORETEN_ARCH_64BIT)
+    UInt64 crc = crc32;
+    while(len >= 8) {
+        UInt64 v;
+        memcpy(&v, bytes, sizeof(v));
+        crc = _mm_crc32_u64(crc, v);
+        bytes += 8;
+        len -= 8;
+    }
+    crc32 = cast(UInt32)crc;
+#endif // CORETEN_ARCH_64BIT
+    while(len >= 4) {
+        UInt32 v;
+        memcpy(&v, bytes, sizeof(v));
+        crc32 = _mm_crc32_u32(crc32, v);
+        bytes += 4;
+        len -= 4;
+    }
+    while(len-- > 0)
+        crc32 = _mm_crc32_u8(crc32, *bytes++);
+    return crc32;
+}
+#elif defined(__HASH_CRC32C_ARM)
+static UInt32 __hash_crc32c_arm(UInt32 crc, void const* data, Ll len) {
+    UInt8 const* bytes = cast(UInt8 const*)data;
+    while(len >= 8) {
+        UInt64 v;
+        memcpy(&v, bytes, sizeof(v));
+        crc = __crc32cd(crc, v);
+        bytes += 8;
+        len -= 8;
+    }
+    while(len-- > 0)
+        crc = __crc32cb(crc, *bytes++);
+    return crc;
+}
+#endif // __HASH_CRC32C_SSE42
+
+static UInt32 __hash_crc32c_update_scalar(UInt32 crc, void const* data, Ll len) {
+    return __hash_crc32_slice8(CORETEN__CRC32C_TABLE, crc, cast(UInt8 const*)data, len);
+}
+
+static inline UInt32 __hash_crc32c_update(UInt32 crc, void const* data, Ll len) {
+    return __HASH_KERNEL(crc32c_update, __HashCrc32cKernel)(crc, data, len);
+}
+
+UInt32 hash_crc32c(void const* data, Ll len) {
+    return ~__hash_crc32c_update(~(cast(UInt32)0), data, len);
+}
+
+static UInt64 __hash_crc64_update(UInt64 crc, void const* data, Ll len) {
+    UInt8 const* bytes = cast(UInt8 const*)data;
+    while(len >= 8) {
+        UInt64 v = __hash_read64le(bytes) ^ crc;
+        crc = CORETEN__CRC64_TABLE[7][v & 0xff]         ^ CORETEN__CRC64_TABLE[6][(v >> 8) & 0xff]  ^ 
+              CORETEN__CRC64_TABLE[5][(v >> 16) & 0xff] ^ CORETEN__CRC64_TABLE[4][(v >> 24) & 0xff] ^ 
+              CORETEN__CRC64_TABLE[3][(v >> 32) & 0xff] ^ CORETEN__CRC64_TABLE[2][(v >> 40) & 0xff] ^ 
+              CORETEN__CRC64_TABLE[1][(v >> 48) & 0xff] ^ CORETEN__CRC64_TABLE[0][v >> 56];
+        bytes += 8;
+        len -= 8;
+    }
+    while(len-- > 0)
+        crc = (crc >> 8) ^ CORETEN__CRC64_TABLE[0][(crc ^ *bytes++) & 0xff];
+    return crc;
 }
 
 UInt64 hash_crc64(void const* data, Ll len) {
-    Ll remaining;
-    UInt64 result = ~(cast(UInt64)0);
-    UInt8 const* c = cast(UInt8 const* )data;
-    for(remaining = len; remaining--; c++)
-        result = (result >> 8) ^ (CORETEN__CRC64_TABLE[(result ^ *c) & 0xff]);
-    return ~result;
+    return ~__hash_crc64_update(~(cast(UInt64)0), data, len);
+}
+
+void hash_crc32_init(cstlHashCrc32State* state) {
+    state->crc = ~(cast(UInt32)0);
+}
+
+void hash_crc32_update(cstlHashCrc32State* state, void const* data, Ll len) {
+    state->crc = __hash_crc32_slice8(CORETEN__CRC32_TABLE, state->crc, cast(UInt8 const*)data, len);
+}
+
+UInt32 hash_crc32_final(cstlHashCrc32State* state) {
+    return ~state->crc;
+}
+
+void hash_crc32c_init(cstlHashCrc32State* state) {
+    state->crc = ~(cast(UInt32)0);
+}
+
+void hash_crc32c_update(cstlHashCrc32State* state, void const* data, Ll len) {
+    state->crc = __hash_crc32c_update(state->crc, data, len);
+}
+
+UInt32 hash_crc32c_final(cstlHashCrc32State* state) {
+    return ~state->crc;
+}
+
+void hash_crc64_init(cstlHashCrc64State* state) {
+    state->crc = ~(cast(UInt64)0);
+}
+
+void hash_crc64_update(cstlHashCrc64State* state, void const* data, Ll len) {
+    state->crc = __hash_crc64_update(state->crc, data, len);
+}
+
+UInt64 hash_crc64_final(cstlHashCrc64State* state) {
+    return ~state->crc;
 }
 
 UInt32 hash_fnv32(void const* data, Ll len) {
@@ -893,8 +1268,9 @@ UInt64 hash_murmur64_seed(void const* data__, Ll len, UInt64 seed) {
     UInt64 h = seed ^ (len * m);
 
     UInt64 const* data = cast(UInt64 const* )data__;
-    UInt8  const* data2 = cast(UInt8 const* )data__;
     UInt64 const* end = data + (len / 8);
+    // The tail starts after the last whole block
+    UInt8  const* data2 = cast(UInt8 const* )end;
 
     while(data != end) {
         UInt64 k = *data++;
@@ -996,324 +1372,4462 @@ UInt64 hash_murmur64_seed(void const* data__, Ll len, UInt64 seed) {
 #endif // CORETEN_ARCH_64BIT
 }
 
-#endif // CORETEN_INCLUDE_HASH_H
+/*
+    hash_fast64
 
-// -------------------------------------------------------------------------
-// io.h
-// -------------------------------------------------------------------------
+    Inputs up to `__HASH_LONG_THRESHOLD` bytes are hashed with wyhash (final version 4). Longer inputs are split 
+    into 64-byte stripes that are folded into 8 independent 64-bit accumulators, the same way XXH3 does: each lane 
+    adds its input word to its neighbour and the 32x32->64 product of the word's halves (after mixing in a key) to 
+    itself. The lanes don't depend on each other, so the loop runs 2 (SSE2) or 4 (AVX2) lanes per instruction and 
+    keeps up with memory bandwidth. Every 16 stripes the accumulators are scrambled, and at the end they're merged 
+    with wyhash's multiply-mix.
 
-char* readFile(const char* fname) {
-    FILE* file = fopen(fname, "rb"); 
-    
-    if(!file) {
-        cstlColouredPrintf(CORETEN_COLOUR_ERROR, "Could not open file: <%s>\n", fname);
-        cstlColouredPrintf(CORETEN_COLOUR_ERROR, "%s\n", !file_exists(fname) ?  
-                            "FileNotFoundError: File does not exist." : "");
-        exit(1);
-    }
+    The SIMD and scalar paths give identical results.
+*/
+#define __HASH_LONG_THRESHOLD       HASH_FAST64_BUFFER_SIZE
+#define __HASH_STRIPE_LEN           64
+#define __HASH_STRIPES_PER_BLOCK    16
+
+#define __HASH_FILE_CHUNK_SIZE      65536
+
+#define __HASH_MURMUR64_M   0xc6a4a7935bd1e995ULL
+#define __HASH_MURMUR64_R   47
+
+#define __HASH_PRIME32_1    0x9E3779B1U
+#define __HASH_PRIME32_2    0x85EBCA77U
+#define __HASH_PRIME32_3    0xC2B2AE3DU
+#define __HASH_PRIME64_1    0x9E3779B185EBCA87ULL
+#define __HASH_PRIME64_2    0xC2B2AE3D27D4EB4FULL
+#define __HASH_PRIME64_3    0x165667B19E3779F9ULL
+#define __HASH_PRIME64_4    0x85EBCA77C2B2AE63ULL
+#define __HASH_PRIME64_5    0x27D4EB2F165667C5ULL
+
+// wyhash's default secret
+static UInt64 const __HASH_WY_SECRET[4] = {
+    0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+};
 
-    // Get the length of the input buffer
-    fseek(file, 0, SEEK_END); 
-    long buff_length = ftell(file); 
-    fseek(file, 0, SEEK_SET);
+// Keys of the long-input path. Stripe `s` of a block uses `[s, s + 8)`, the scramble uses `[16, 24)`
+static UInt64 const __HASH_LONG_SECRET[24] = {
+    0x0bd2db2e48789d20ull, 0x7c621bc543b550a8ull, 0xb27410639e13de46ull, 0xd3c4eb1714b569e5ull,
+    0x9fc8be2266edda39ull, 0x491e4aceebe4be30ull, 0x180afb1a9570beb0ull, 0xca454537878d2950ull,
+    0xa96a98c828045478ull, 0xa4a4b920c8e15bf5ull, 0xae09d92fba683111ull, 0x1defe04876a32064ull,
+    0x1b830cede5f3a95full, 0x5d45a31f3dd3297full, 0x1b37fd03b9ada18eull, 0xa9cad3754033f149ull,
+    0x2bbe59b3c2df09d1ull, 0xc01f604b97fba984ull, 0xdad0325410c910f5ull, 0x0677e5dd8bdbadf9ull,
+    0x2bc9abfd44bc3b36ull, 0x08cf102312742cefull, 0x495cf4650c95833dull, 0x288961efe041bc37ull,
+};
 
-    char* buffer = cast(char*)malloc(sizeof(char) * (buff_length + 1) );
-    if(!buffer) {
-        fprintf(stderr, "Could not allocate memory for buffer for file at %s\n", fname);
-        exit(1);
-    }
+// 64x64 -> 128-bit multiply: `*a` gets the low half, `*b` the high half
+static inline void __hash_mum(UInt64* a, UInt64* b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = cast(__uint128_t)*a * *b;
+    *a = cast(UInt64)r;
+    *b = cast(UInt64)(r >> 64);
+#elif defined(CORETEN_COMPILER_MSVC) && defined(_M_X64)
+    *a = _umul128(*a, *b, b);
+#else
+    UInt64 ha = *a >> 32, hb = *b >> 32, la = cast(UInt32)*a, lb = cast(UInt32)*b;
+    UInt64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    UInt64 t = rl + (rm0 << 32);
+    UInt64 carry = t < rl;
+    UInt64 lo = t + (rm1 << 32);
+    carry += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif // __SIZEOF_INT128__
+}
 
-    fread(buffer, 1, buff_length, file); 
-    buffer[buff_length] = nullchar;
-    fclose(file); 
+static inline UInt64 __hash_mix(UInt64 a, UInt64 b) {
+    __hash_mum(&a, &b);
+    return a ^ b;
+}
 
-    return buffer;
+static UInt64 __hash_wyhash(UInt8 const* p, UInt64 len, UInt64 seed) {
+    UInt64 const* s = __HASH_WY_SECRET;
+    UInt64 a, b;
+    seed ^= __hash_mix(seed ^ s[0], s[1]);
+    if(CORETEN_LIKELY(len <= 16)) {
+        if(CORETEN_LIKELY(len >= 4)) {
+            a = (cast(UInt64)__hash_read32le(p) << 32) | __hash_read32le(p + ((len >> 3) << 2));
+            b = (cast(UInt64)__hash_read32le(p + len - 4) << 32) | __hash_read32le(p + len - 4 - ((len >> 3) << 2));
+        } else if(CORETEN_LIKELY(len > 0)) {
+            a = (cast(UInt64)p[0] << 16) | (cast(UInt64)p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        UInt64 i = len;
+        if(CORETEN_UNLIKELY(i > 48)) {
+            UInt64 see1 = seed, see2 = seed;
+            do {
+                seed = __hash_mix(__hash_read64le(p) ^ s[1], __hash_read64le(p + 8) ^ seed);
+                see1 = __hash_mix(__hash_read64le(p + 16) ^ s[2], __hash_read64le(p + 24) ^ see1);
+                see2 = __hash_mix(__hash_read64le(p + 32) ^ s[3], __hash_read64le(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while(CORETEN_LIKELY(i > 48));
+            seed ^= see1 ^ see2;
+        }
+        while(CORETEN_UNLIKELY(i > 16)) {
+            seed = __hash_mix(__hash_read64le(p) ^ s[1], __hash_read64le(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = __hash_read64le(p + i - 16);
+        b = __hash_read64le(p + i - 8);
+    }
+    a ^= s[1];
+    b ^= seed;
+    __hash_mum(&a, &b);
+    return __hash_mix(a ^ s[0] ^ len, b ^ s[1]);
 }
 
-bool file_exists(const char* path) {
-#ifdef WIN32
-    if (GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES) return true;
-#else
-    // if(access(path, 0) == 0) return true;
-    struct stat st;
-    return !stat(path, &st);
-#endif // WIN32
-    return false;
+static inline void __hash_accumulate_scalar(UInt64* acc, UInt8 const* p, UInt64 const* key) {
+    for(int i = 0; i < 8; i++) {
+        UInt64 data = __hash_read64le(p + 8 * i);
+        UInt64 data_key = data ^ key[i];
+        acc[i ^ 1] += data;
+        acc[i] += cast(UInt64)cast(UInt32)data_key * (data_key >> 32);
+    }
 }
 
-// -------------------------------------------------------------------------
-// math.h
-// -------------------------------------------------------------------------
+static inline void __hash_scramble_scalar(UInt64* acc, UInt64 const* key) {
+    for(int i = 0; i < 8; i++) {
+        UInt64 a = acc[i];
+        a ^= a >> 47;
+        a ^= key[i];
+        acc[i] = a * __HASH_PRIME32_1;
+    }
+}
 
-Float32 coreten_toRadians(Float32 degrees) { 
-    return degrees * CORETEN_MATH_TAU / 360.0f;
+#if defined(CORETEN_CPU_DISPATCH_X86)
+static CORETEN_TARGET("avx2") void __hash_accumulate_avx2(UInt64* acc, UInt8 const* p, UInt64 const* key) {
+    __m256i* xacc = cast(__m256i*)acc;
+    for(int i = 0; i < 2; i++) {
+        __m256i data = _mm256_loadu_si256(cast(__m256i const*)(p + 32 * i));
+        __m256i data_key = _mm256_xor_si256(data, _mm256_loadu_si256(cast(__m256i const*)(key + 4 * i)));
+        __m256i product = _mm256_mul_epu32(data_key, _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        __m256i sum = _mm256_add_epi64(_mm256_loadu_si256(xacc + i), swapped);
+        _mm256_storeu_si256(xacc + i, _mm256_add_epi64(product, sum));
+    }
 }
 
-Float32 coreten_toDegrees(Float32 radians) { 
-    return radians * 360.0f / CORETEN_MATH_TAU;
+static CORETEN_TARGET("avx2") void __hash_scramble_avx2(UInt64* acc, UInt64 const* key) {
+    __m256i* xacc = cast(__m256i*)acc;
+    __m256i prime = _mm256_set1_epi32(cast(int)__HASH_PRIME32_1);
+    for(int i = 0; i < 2; i++) {
+        __m256i a = _mm256_loadu_si256(xacc + i);
+        a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+        a = _mm256_xor_si256(a, _mm256_loadu_si256(cast(__m256i const*)(key + 4 * i)));
+        __m256i lo = _mm256_mul_epu32(a, prime);
+        __m256i hi = _mm256_mul_epu32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm256_storeu_si256(xacc + i, _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32)));
+    }
 }
 
-Float32 coreten_sin(Float32 x) {
-    Float32 x0 = +1.91059300966915117e-31f;
-    Float32 x1 = +1.00086760103908896f;
-    Float32 x2 = -1.21276126894734565e-2f;
-    Float32 x3 = -1.38078780785773762e-1f;
-    Float32 x4 = -2.67353392911981221e-2f;
-    Float32 x5 = +2.08026600266304389e-2f;
-    Float32 x6 = -3.03996055049204407e-3f;
-    Float32 x7 = +1.38235642404333740e-4f;
-    return x0 + x*(x1 + x*(x2 + x*(x3 + x*(x4 + x*(x5 + x*(x6 + x*x7))))));
+static CORETEN_TARGET("sse2") void __hash_accumulate_sse2(UInt64* acc, UInt8 const* p, UInt64 const* key) {
+    __m128i* xacc = cast(__m128i*)acc;
+    for(int i = 0; i < 4; i++) {
+        __m128i data = _mm_loadu_si128(cast(__m128i const*)(p + 16 * i));
+        __m128i data_key = _mm_xor_si128(data, _mm_loadu_si128(cast(__m128i const*)(key + 2 * i)));
+        __m128i product = _mm_mul_epu32(data_key, _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128i sum = _mm_add_epi64(_mm_loadu_si128(xacc + i), swapped);
+        _mm_storeu_si128(xacc + i, _mm_add_epi64(product, sum));
+    }
 }
 
-Float32 coreten_cos(Float32 x) {
-    Float32 x0 = +1.00238601909309722f;
-    Float32 x1 = -3.81919947353040024e-2f;
-    Float32 x2 = -3.94382342128062756e-1f;
-    Float32 x3 = -1.18134036025221444e-1f;
-    Float32 x4 = +1.07123798512170878e-1f;
-    Float32 x5 = -1.86637164165180873e-2f;
-    Float32 x6 = +9.90140908664079833e-4f;
-    Float32 x7 = -5.23022132118824778e-14f;
-    return x0 + x*(x1 + x*(x2 + x*(x3 + x*(x4 + x*(x5 + x*(x6 + x*x7))))));
+static CORETEN_TARGET("sse2") void __hash_scramble_sse2(UInt64* acc, UInt64 const* key) {
+    __m128i* xacc = cast(__m128i*)acc;
+    __m128i prime = _mm_set1_epi32(cast(int)__HASH_PRIME32_1);
+    for(int i = 0; i < 4; i++) {
+        __m128i a = _mm_loadu_si128(xacc + i);
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128(cast(__m128i const*)(key + 2 * i)));
+        __m128i lo = _mm_mul_epu32(a, prime);
+        __m128i hi = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm_storeu_si128(xacc + i, _mm_add_epi64(lo, _mm_slli_epi64(hi, 32)));
+    }
 }
+#endif // CORETEN_CPU_DISPATCH_X86
 
-Float32 coreten_tan(Float32 radians) {
-    Float32 rr = radians * radians;
-    Float32 x = 9.5168091e-03f;
-    x *= rr;
-    x += 2.900525e-03f;
-    x *= rr;
-    x += 2.45650893e-02f;
-    x *= rr;
-    x += 5.33740603e-02f;
-    x *= rr;
-    x += 1.333923995e-01f;
-    x *= rr;
-    x += 3.333314036e-01f;
-    x *= rr;
-    x += 1.0f;
-    x *= radians;
-    return x;
+static inline void __hash_long_init(UInt64* acc, UInt64* key, UInt64 seed) {
+    static UInt64 const init[8] = {
+        __HASH_PRIME32_3, __HASH_PRIME64_1, __HASH_PRIME64_2, __HASH_PRIME64_3,
+        __HASH_PRIME64_4, __HASH_PRIME32_2, __HASH_PRIME64_5, __HASH_PRIME32_1
+    };
+    memcpy(acc, init, sizeof(init));
+    for(int i = 0; i < 24; i++)
+        key[i] = __HASH_LONG_SECRET[i] + ((i & 1) ? (0 - seed) : seed);
 }
 
-Float32 coreten_arctan(Float32 x) {
-    Float32 u  = x*x;
-    Float32 u2 = u*u;
-    Float32 u3 = u2*u;
-    Float32 u4 = u3*u;
-    Float32 f  = 1.0f+0.33288950512027f*u-0.08467922817644f*u2+0.03252232640125f*u3-0.00749305860992f*u4;
-    return x/f;
+static inline UInt64 __hash_long_merge(UInt64 const* acc, UInt64 const* key, UInt64 len) {
+    UInt64 h = len * __HASH_PRIME64_1;
+    for(int i = 0; i < 4; i++)
+        h += __hash_mix(acc[2 * i] ^ key[2 * i + 3], acc[2 * i + 1] ^ key[2 * i + 4]);
+    h ^= h >> 37;
+    h *= __HASH_PRIME64_3;
+    return h ^ (h >> 32);
 }
 
-Float32 coreten_arctan2(Float32 x, Float32 y) {
-    if (CORETEN_ABS(y) > CORETEN_ABS(x)) {
-        Float32 a = coreten_arctan(x/y);
-        if (y > 0.0f)
-            return a;
-        else
-            return x > 0.0f ? a + CORETEN_MATH_TAU_BY_2 : a - CORETEN_MATH_TAU_BY_2;
-    } else {
-        Float32 a = coreten_arctan(y/x);
-        if (y > 0.0f)
-            return x > 0.0f ? CORETEN_MATH_TAU_BY_4 - a : -CORETEN_MATH_TAU_BY_4 - a;
-        else
-            return x > 0.0f ? CORETEN_MATH_TAU_BY_4 + a : -CORETEN_MATH_TAU_BY_4 + a;
+// The long-input path, instantiated once per instruction set so the kernels inline into the stripe loop
+#define __HASH_DEFINE_LONG(name, target, accumulate, scramble)                                                      \
+    static target UInt64 name(UInt8 const* p, UInt64 len, UInt64 seed) {                                                   \
+        _Alignas(32) UInt64 acc[8];                                                                                 \
+        UInt64 key[24];                                                                                             \
+        __hash_long_init(acc, key, seed);                                                                           \
+                                                                                                                    \
+        UInt64 const block_len = __HASH_STRIPE_LEN * __HASH_STRIPES_PER_BLOCK;                                      \
+        UInt64 nblocks = (len - 1) / block_len;                                                                     \
+        for(UInt64 b = 0; b < nblocks; b++) {                                                                       \
+            for(int s = 0; s < __HASH_STRIPES_PER_BLOCK; s++)                                                       \
+                accumulate(acc, p + b * block_len + s * __HASH_STRIPE_LEN, key + s);                                \
+            scramble(acc, key + 16);                                                                                \
+        }                                                                                                           \
+        UInt64 nstripes = ((len - 1) - nblocks * block_len) / __HASH_STRIPE_LEN;                                    \
+        for(UInt64 s = 0; s < nstripes; s++)                                                                        \
+            accumulate(acc, p + nblocks * block_len + s * __HASH_STRIPE_LEN, key + s);                              \
+        /* The last stripe (which may overlap the previous one) */                                                  \
+        accumulate(acc, p + len - __HASH_STRIPE_LEN, key + 15);                                                     \
+        return __hash_long_merge(acc, key, len);                                                                    \
     }
+
+__HASH_DEFINE_LONG(__hash_fast64_long_scalar, , __hash_accumulate_scalar, __hash_scramble_scalar)
+#if defined(CORETEN_CPU_DISPATCH_X86)
+__HASH_DEFINE_LONG(__hash_fast64_long_sse2, CORETEN_TARGET("sse2"), __hash_accumulate_sse2, __hash_scramble_sse2)
+__HASH_DEFINE_LONG(__hash_fast64_long_avx2, CORETEN_TARGET("avx2"), __hash_accumulate_avx2, __hash_scramble_avx2)
+#endif // CORETEN_CPU_DISPATCH_X86
+
+UInt64 hash_fast64_seed(void const* data, Ll len, UInt64 seed) {
+    UInt8 const* p = cast(UInt8 const*)data;
+    if(len <= __HASH_LONG_THRESHOLD)
+        return __hash_wyhash(p, cast(UInt64)len, seed);
+    return __HASH_KERNEL(fast64_long, __HashFast64LongKernel)(p, cast(UInt64)len, seed);
 }
 
-Float32 coreten_exp(Float32 x) {
-    union { Float32 f; int i; } u, v;
-    u.i = (int)(6051102 * x + 1056478197);
-    v.i = (int)(1056478197 - 6051102 * x);
-    return u.f / v.f;
+UInt64 hash_fast64(void const* data, Ll len) {
+    return hash_fast64_seed(data, len, 0);
 }
 
-Float32 coreten_log(Float32 x) {
-    union { Float32 f; int i; } u = {x};
-    return (u.i - 1064866805) * 8.262958405176314e-8f; // 1 / 12102203.0;
+UInt64 __hash_fast64_scalar(void const* data, Ll len, UInt64 seed) {
+    UInt8 const* p = cast(UInt8 const*)data;
+    if(len <= __HASH_LONG_THRESHOLD)
+        return __hash_wyhash(p, cast(UInt64)len, seed);
+    return __hash_fast64_long_scalar(p, cast(UInt64)len, seed);
 }
 
-Float32 coreten_pow(Float32 x, Float32 y) {
-    int flipped = 0, e;
-    Float32 f, r = 1.0f;
-    if (y < 0) {
-        flipped = 1;
-        y = -y;
+UInt64 hash_combine64(UInt64 a, UInt64 b) {
+    return __hash_mix(a ^ __HASH_WY_SECRET[0], b ^ __HASH_WY_SECRET[1]);
+}
+
+/*
+    Streaming
+
+    The murmur64 state must be told the total length up front, since the one-shot hash mixes it in first.
+
+    The fast64 state buffers up to `HASH_FAST64_BUFFER_SIZE` bytes. Inputs that never outgrow the buffer are 
+    hashed with wyhash in `hash_fast64_final()`. Otherwise, stripes are accumulated as soon as at least one more 
+    byte follows them, exactly as the one-shot loop does, and the final (overlapping) stripe is rebuilt from the 
+    buffer and a copy of the last stripe consumed.
+*/
+void hash_murmur64_init(cstlHashMurmur64State* state, UInt64 seed, UInt64 total_len) {
+    state->h = seed ^ (total_len * __HASH_MURMUR64_M);
+    state->len = 0;
+    state->total_len = total_len;
+    state->ntail = 0;
+}
+
+static inline void __hash_murmur64_block(cstlHashMurmur64State* state, UInt64 k) {
+    k *= __HASH_MURMUR64_M;
+    k ^= k >> __HASH_MURMUR64_R;
+    k *= __HASH_MURMUR64_M;
+    state->h ^= k;
+    state->h *= __HASH_MURMUR64_M;
+}
+
+void hash_murmur64_update(cstlHashMurmur64State* state, void const* data, Ll len) {
+    UInt8 const* p = cast(UInt8 const*)data;
+    UInt64 n = cast(UInt64)len;
+    state->len += n;
+
+    if(state->ntail > 0) {
+        UInt64 fill = 8 - state->ntail;
+        if(n < fill) {
+            memcpy(state->tail + state->ntail, p, n);
+            state->ntail += cast(UInt32)n;
+            return;
+        }
+        memcpy(state->tail + state->ntail, p, fill);
+        UInt64 k;
+        memcpy(&k, state->tail, sizeof(k));
+        __hash_murmur64_block(state, k);
+        p += fill;
+        n -= fill;
+        state->ntail = 0;
     }
-    e = (int)y;
-    f = coreten_exp(y - e);
-    while (e) {
-        if (e & 1) r *= x;
-        x *= x;
-        e >>= 1;
+    for(; n >= 8; p += 8, n -= 8) {
+        UInt64 k;
+        memcpy(&k, p, sizeof(k));
+        __hash_murmur64_block(state, k);
     }
-    r *= f;
-    return flipped ? 1.0f/r : r;
+    memcpy(state->tail, p, n);
+    state->ntail = cast(UInt32)n;
 }
 
-Float32 coreten_square(Float32 x){
-    return coreten_exp(CORETEN_MATH_LOG_TWO * x);
+UInt64 hash_murmur64_final(cstlHashMurmur64State* state) {
+    CORETEN_ENFORCE(state->len == state->total_len, "hash_murmur64_final: input length differs from `total_len`");
+    UInt64 h = state->h;
+    if(state->ntail > 0) {
+        for(UInt32 i = 0; i < state->ntail; i++)
+            h ^= cast(UInt64)state->tail[i] << (8 * i);
+        h *= __HASH_MURMUR64_M;
+    }
+    h ^= h >> __HASH_MURMUR64_R;
+    h *= __HASH_MURMUR64_M;
+    h ^= h >> __HASH_MURMUR64_R;
+    return h;
 }
 
-Float32 coreten_log2(Float32 x){
-    return coreten_log(x) / CORETEN_MATH_LOG_TWO;
+static void __hash_fast64_consume(cstlHashFast64State* state, UInt8 const* p, UInt64 nstripes) {
+    __HashAccumulateKernel accumulate = __HASH_KERNEL(accumulate, __HashAccumulateKernel);
+    __HashScrambleKernel scramble = __HASH_KERNEL(scramble, __HashScrambleKernel);
+    for(UInt64 i = 0; i < nstripes; i++) {
+        accumulate(state->acc, p + i * __HASH_STRIPE_LEN, state->key + state->nstripes);
+        if(++state->nstripes == __HASH_STRIPES_PER_BLOCK) {
+            scramble(state->acc, state->key + 16);
+            state->nstripes = 0;
+        }
+    }
 }
 
-// -------------------------------------------------------------------------
-// os.h
-// -------------------------------------------------------------------------
+void hash_fast64_init(cstlHashFast64State* state, UInt64 seed) {
+    __hash_long_init(state->acc, state->key, seed);
+    state->seed = seed;
+    state->len = 0;
+    state->nstripes = 0;
+    state->buffered = 0;
+}
 
-cstlBuffer* os_get_cwd() {
-#if defined(CORETEN_OS_WINDOWS)
-    // This (or its equivalent) is not defined in any include in Windows as far as I've come across
-    #define PATH_MAX 4096
-    char result[PATH_MAX];
-    _getcwd(result, PATH_MAX);
-    if(!*result) {
-        fprintf(stderr, "Unable to `os_get_cwd()`. 'getcwd()' failed");
-        exit(1);
+void hash_fast64_update(cstlHashFast64State* state, void const* data, Ll len) {
+    UInt8 const* p = cast(UInt8 const*)data;
+    UInt64 n = cast(UInt64)len;
+    state->len += n;
+
+    if(state->buffered + n <= HASH_FAST64_BUFFER_SIZE) {
+        memcpy(state->buffer + state->buffered, p, n);
+        state->buffered += cast(UInt32)n;
+        return;
     }
-    cstlBuffer* buff = buff_new(result);
-    return buff;
-#elif defined(CORETEN_OS_POSIX)
-    long n;
-    char *buf;
 
-    n = pathconf(".", _PC_PATH_MAX);
-    CORETEN_ENFORCE(n != -1);
-    buf = cast(char*)calloc(n, sizeof(*buf));
-    CORETEN_ENFORCE_NN(buf, "calloc failed. Out of memory");
-    char* result = getcwd(buf, n);
-    if(!result) {
-        fprintf(stderr, "Unable to `os_get_cwd()`. 'getcwd()' failed");
-        exit(1);
+    // More input follows the buffer, so every stripe in it can be accumulated
+    if(state->buffered > 0) {
+        UInt64 fill = HASH_FAST64_BUFFER_SIZE - state->buffered;
+        memcpy(state->buffer + state->buffered, p, fill);
+        p += fill;
+        n -= fill;
+        __hash_fast64_consume(state, state->buffer, HASH_FAST64_BUFFER_SIZE / __HASH_STRIPE_LEN);
+        memcpy(state->last_stripe, state->buffer + HASH_FAST64_BUFFER_SIZE - __HASH_STRIPE_LEN, __HASH_STRIPE_LEN);
+        state->buffered = 0;
     }
-    cstlBuffer* buff = buff_new(buf);
-    return buff;
+
+    // Accumulate straight from the input, leaving 1 to `HASH_FAST64_BUFFER_SIZE` bytes for the buffer
+    if(n > HASH_FAST64_BUFFER_SIZE) {
+        UInt64 consumed = ((n - 1) / HASH_FAST64_BUFFER_SIZE) * HASH_FAST64_BUFFER_SIZE;
+        __hash_fast64_consume(state, p, consumed / __HASH_STRIPE_LEN);
+        p += consumed;
+        n -= consumed;
+        memcpy(state->last_stripe, p - __HASH_STRIPE_LEN, __HASH_STRIPE_LEN);
+    }
+    memcpy(state->buffer, p, n);
+    state->buffered = cast(UInt32)n;
+}
+
+UInt64 hash_fast64_final(cstlHashFast64State* state) {
+    if(state->len <= HASH_FAST64_BUFFER_SIZE)
+        return __hash_wyhash(state->buffer, state->len, state->seed);
+
+    // Work on a copy, so `state` can still be updated afterwards
+    cstlHashFast64State tail = *state;
+    __hash_fast64_consume(&tail, tail.buffer, (tail.buffered - 1) / __HASH_STRIPE_LEN);
+
+    UInt8 last[__HASH_STRIPE_LEN];
+    if(tail.buffered >= __HASH_STRIPE_LEN) {
+        memcpy(last, tail.buffer + tail.buffered - __HASH_STRIPE_LEN, __HASH_STRIPE_LEN);
+    } else {
+        UInt64 from_prev = __HASH_STRIPE_LEN - tail.buffered;
+        memcpy(last, tail.last_stripe + __HASH_STRIPE_LEN - from_prev, from_prev);
+        memcpy(last + from_prev, tail.buffer, tail.buffered);
+    }
+    __HASH_KERNEL(accumulate, __HashAccumulateKernel)(tail.acc, last, tail.key + 15);
+    return __hash_long_merge(tail.acc, tail.key, tail.len);
+}
+
+bool hash_fast64_file(const char* fname, UInt64 seed, UInt64* hash) {
+    FILE* file = fopen(fname, "rb");
+    if(!file)
+        return false;
+
+    cstlHashFast64State state;
+    hash_fast64_init(&state, seed);
+    UInt8 chunk[__HASH_FILE_CHUNK_SIZE];
+    size_t nread;
+    while((nread = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        hash_fast64_update(&state, chunk, cast(Ll)nread);
+
+    bool ok = !ferror(file);
+    fclose(file);
+    if(ok)
+        *hash = hash_fast64_final(&state);
+    return ok;
+}
+
+// Point `__hash_kernels` at the best implementations for `cpu_features()`.
+// Run on first use, and re-run by `cpu_set_features_mask()`
+static void __hash_dispatch() {
+    __HashKernelSet kernels = {
+        __hash_crc32c_update_scalar, __hash_fast64_long_scalar, __hash_accumulate_scalar, __hash_scramble_scalar
+    };
+#if defined(CORETEN_CPU_DISPATCH_X86)
+    if(cpu_has(CpuFeatureSSE2)) {
+        kernels.fast64_long = __hash_fast64_long_sse2;
+        kernels.accumulate = __hash_accumulate_sse2;
+        kernels.scramble = __hash_scramble_sse2;
+    }
+    if(cpu_has(CpuFeatureAVX2)) {
+        kernels.fast64_long = __hash_fast64_long_avx2;
+        kernels.accumulate = __hash_accumulate_avx2;
+        kernels.scramble = __hash_scramble_avx2;
+    }
+    if(cpu_has(CpuFeatureSSE42))
+        kernels.crc32c_update = __hash_crc32c_sse42;
+#elif defined(__HASH_CRC32C_ARM)
+    if(cpu_has(CpuFeatureCRC32))
+        kernels.crc32c_update = __hash_crc32c_arm;
+#endif // CORETEN_CPU_DISPATCH_X86
+    atomicptr_store(&__hash_kernels.crc32c_update, cast(void*)kernels.crc32c_update, MemoryOrderRelaxed);
+    atomicptr_store(&__hash_kernels.fast64_long, cast(void*)kernels.fast64_long, MemoryOrderRelaxed);
+    atomicptr_store(&__hash_kernels.accumulate, cast(void*)kernels.accumulate, MemoryOrderRelaxed);
+    atomicptr_store(&__hash_kernels.scramble, cast(void*)kernels.scramble, MemoryOrderRelaxed);
+}
+
+// -------------------------------------------------------------------------
+// hashmap.c
+// -------------------------------------------------------------------------
+
+UInt64 hashmap_hash_bytes(const void* key, UInt64 key_size) {
+    return hash_fast64(key, cast(Ll)key_size);
+}
+
+UInt64 hashmap_str_hash(const void* key, UInt64 key_size) {
+    const char* str = *cast(const char* const*)key;
+    return hashmap_hash_bytes(str, strlen(str));
+}
+
+bool hashmap_str_eq(const void* a, const void* b, UInt64 key_size) {
+    return strcmp(*cast(const char* const*)a, *cast(const char* const*)b) == 0;
+}
+
+static bool __hashmap_bytes_eq(const void* a, const void* b, UInt64 key_size) {
+    return memcmp(a, b, key_size) == 0;
+}
+
+// Bitmask of the bytes in `group` equal to `h2`
+static inline UInt32 __hashmap_match(const Int8* group, Int8 h2) {
+#if defined(CORETEN_SIMD_SSE2)
+    __m128i ctrl = _mm_loadu_si128(cast(const __m128i*)group);
+    return cast(UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2)));
 #else
-    #error "No `os_get_cwd()` implementation supported for your platform."
-    return null;
-#endif // CORETEN_OS_WINDOWS
+    UInt32 mask = 0;
+    for(UInt32 i = 0; i < HASHMAP_GROUP_WIDTH; i++)
+        mask |= cast(UInt32)(group[i] == h2) << i;
+    return mask;
+#endif // CORETEN_SIMD_SSE2
 }
 
-cstlBuffer* __os_dirname_basename(cstlBuffer* path, bool is_basename) {
-    UInt64 length = path->len;
-    if(!length)
-        return path;
+// Bitmask of the empty bytes in `group`
+static inline UInt32 __hashmap_match_empty(const Int8* group) {
+#if defined(CORETEN_SIMD_SSE2)
+    // `HASHMAP_CTRL_EMPTY` is the only control byte with the top bit set
+    return cast(UInt32)_mm_movemask_epi8(_mm_loadu_si128(cast(const __m128i*)group));
+#else
+    UInt32 mask = 0;
+    for(UInt32 i = 0; i < HASHMAP_GROUP_WIDTH; i++)
+        mask |= cast(UInt32)(group[i] < 0) << i;
+    return mask;
+#endif // CORETEN_SIMD_SSE2
+}
 
-    cstlBuffer* result = buff_new(null);
-    char* end = buff_end(path);
+#define __HASHMAP_H1(hash)  ((hash) >> 7)
+#define __HASHMAP_H2(hash)  cast(Int8)((hash) & 0x7F)
 
-    // dirname
-    if(!is_basename) {
-        cstlBuffer* rev = buff_rev(path);
+// Largest power of two (up to 16) dividing `size`, used as the alignment of keys and values in a slot
+static inline UInt64 __hashmap_align(UInt64 size) {
+    UInt64 align = 1;
+    while(align < 16 && size % (align * 2) == 0)
+        align *= 2;
+    return size == 0 ? 1 : align;
+}
 
-        // The `/` or `\\` is not so important in getting the dirname, but it does interfere with `strchr`, so
-        // we skip over it (if present)
-        if(*rev->data == CORETEN_OS_SEP_CHAR)
-            rev->data++;
-        char* rev_dir = strchr(rev->data, CORETEN_OS_SEP_CHAR);
-        buff_set(result, rev_dir);
-        result = buff_rev(result);
-        buff_free(rev);
-    } 
+// Smallest valid capacity that holds `n` entries
+static UInt64 __hashmap_capacity_for(UInt64 n) {
+    UInt64 capacity = HASHMAP_MIN_CAPACITY;
+    while(capacity - capacity / 8 < n)
+        capacity *= 2;
+    return capacity;
+}
 
-    // basename
-    else {
-        // If the last character is a `sep`, `basename` is empty
-        if(os_is_sep(*end))
-            return buff_new(null);
-        
-        // If there is no `sep` in `path`, `path` is the basename
-        if(!(strstr(path->data, "/") || strstr(path->data, "\\")))
-            return path;
-        
-        cstlBuffer* rev = buff_rev(path);
-        for(UInt64 i = 0; i<length; i++) {
-            if(os_is_sep(*(rev->data + i))) {
-                *(rev->data + i) = nullchar;
-                break;
-            }
+static inline void __hashmap_set_ctrl(cstlHashMap* map, UInt64 index, Int8 ctrl) {
+    map->ctrl[index] = ctrl;
+    // Keep the mirror of the first group up to date, so a group load near the end wraps around
+    if(index < HASHMAP_GROUP_WIDTH)
+        map->ctrl[map->capacity + index] = ctrl;
+}
+
+static void __hashmap_alloc_table(cstlHashMap* map, UInt64 capacity) {
+    map->capacity = capacity;
+    map->ctrl = cast(Int8*)cstl_alloc_aligned(map->allocator, capacity + HASHMAP_GROUP_WIDTH, HASHMAP_GROUP_WIDTH);
+    memset(map->ctrl, HASHMAP_CTRL_EMPTY, capacity + HASHMAP_GROUP_WIDTH);
+    map->slots = cast(Byte*)cstl_alloc_aligned(map->allocator, capacity * map->slot_size, CORETEN_DEFAULT_ALIGN);
+    map->growth_left = capacity - capacity / 8 - map->size;
+}
+
+static void __hashmap_free_table(cstlHashMap* map) {
+    cstl_free(map->allocator, map->ctrl, map->capacity + HASHMAP_GROUP_WIDTH);
+    cstl_free(map->allocator, map->slots, map->capacity * map->slot_size);
+}
+
+// Index of the first empty slot on the probe sequence of `hash`
+static UInt64 __hashmap_find_empty(cstlHashMap* map, UInt64 hash) {
+    UInt64 mask = map->capacity - 1;
+    UInt64 pos = __HASHMAP_H1(hash) & mask;
+    for(;;) {
+        UInt32 empty = __hashmap_match_empty(map->ctrl + pos);
+        if(empty)
+            return (pos + __simd_ctz32(empty)) & mask;
+        pos = (pos + HASHMAP_GROUP_WIDTH) & mask;
+    }
+}
+
+// Index of the slot holding `key` (-1 if not found)
+static Int64 __hashmap_find(cstlHashMap* map, const void* key, UInt64 hash) {
+    UInt64 mask = map->capacity - 1;
+    UInt64 pos = __HASHMAP_H1(hash) & mask;
+    Int8 h2 = __HASHMAP_H2(hash);
+    STATS_INC(StatsHashMapLookups);
+    for(;;) {
+        const Int8* group = map->ctrl + pos;
+        UInt32 matches = __hashmap_match(group, h2);
+        STATS_INC(StatsHashMapProbes);
+        while(matches) {
+            UInt64 index = (pos + __simd_ctz32(matches)) & mask;
+            if(CORETEN_LIKELY(map->eq(key, hashmap_key_at(map, index), map->key_size)))
+                return cast(Int64)index;
+            matches &= matches - 1;
         }
-        buff_set(result, rev->data);
-        result = buff_rev(result);
-        buff_free(rev);
+        // Linear probing never skips an empty slot, so the key can't be further along
+        if(__hashmap_match_empty(group))
+            return -1;
+        pos = (pos + HASHMAP_GROUP_WIDTH) & mask;
     }
-    
-    return result;
 }
 
-cstlBuffer* os_path_dirname(cstlBuffer* path) {
-    return __os_dirname_basename(path, false);
+static void __hashmap_resize(cstlHashMap* map, UInt64 capacity) {
+    STATS_INC(StatsHashMapResizes);
+    Int8* old_ctrl = map->ctrl;
+    Byte* old_slots = map->slots;
+    UInt64 old_capacity = map->capacity;
+
+    __hashmap_alloc_table(map, capacity);
+    for(UInt64 i = 0; i < old_capacity; i++) {
+        if(old_ctrl[i] < 0)
+            continue;
+        Byte* slot = old_slots + i * map->slot_size;
+        UInt64 index = __hashmap_find_empty(map, map->hash(slot, map->key_size));
+        __hashmap_set_ctrl(map, index, old_ctrl[i]);
+        memcpy(hashmap_key_at(map, index), slot, map->slot_size);
+    }
+
+    cstl_free(map->allocator, old_ctrl, old_capacity + HASHMAP_GROUP_WIDTH);
+    cstl_free(map->allocator, old_slots, old_capacity * map->slot_size);
 }
 
-cstlBuffer* os_path_basename(cstlBuffer* path) {
-    return __os_dirname_basename(path, true);
+cstlHashMap* _hashmap_new_in(cstlAllocator* allocator, UInt64 key_size, UInt64 value_size, UInt64 capacity, 
+                             cstlHashFn hash, cstlHashEqFn eq) {
+    CORETEN_ENFORCE(key_size > 0, "Hash map keys cannot be empty");
+    cstlHashMap* map = cstl_new_obj(allocator, cstlHashMap);
+    map->allocator = allocator;
+    map->key_size = key_size;
+    map->value_size = value_size;
+    map->hash = hash ? hash : hashmap_hash_bytes;
+    map->eq = eq ? eq : __hashmap_bytes_eq;
+
+    UInt64 key_align = __hashmap_align(key_size);
+    UInt64 value_align = __hashmap_align(value_size);
+    UInt64 slot_align = key_align > value_align ? key_align : value_align;
+    map->value_offset = (key_size + value_align - 1) & ~(value_align - 1);
+    map->slot_size = (map->value_offset + value_size + slot_align - 1) & ~(slot_align - 1);
+
+    __hashmap_alloc_table(map, __hashmap_capacity_for(capacity));
+    return map;
 }
 
-cstlBuffer* os_path_extname(cstlBuffer* path) {
-    cstlBuffer* basename = os_path_basename(path);
-    if(!strcmp(basename->data, ""))
-        return basename;
-    
-    char* ext = strchr(basename->data, '.');
-    if(!ext) {
-       free(basename);
-       return buff_new(null);
-    }
+void hashmap_free(cstlHashMap* map) {
+    if(map == null)
+        return;
+    __hashmap_free_table(map);
+    cstl_free_obj(map->allocator, map);
+}
 
-    buff_set(basename, ext);
-    return basename;
+void hashmap_clear(cstlHashMap* map) {
+    memset(map->ctrl, HASHMAP_CTRL_EMPTY, map->capacity + HASHMAP_GROUP_WIDTH);
+    map->size = 0;
+    map->growth_left = map->capacity - map->capacity / 8;
 }
 
-cstlBuffer* os_path_join(cstlBuffer* path1, cstlBuffer* path2) {
-    UInt64 length = path1->len;
-    if(!length)
-        return path1;
-        
-    char* end = buff_end(path1);
-    if(!os_is_sep(*end))
-        buff_append_char(path1, CORETEN_OS_SEP_CHAR);
-    buff_append(path1, path2);
-    return path1;
+void hashmap_reserve(cstlHashMap* map, UInt64 n) {
+    UInt64 capacity = __hashmap_capacity_for(n);
+    if(capacity > map->capacity)
+        __hashmap_resize(map, capacity);
 }
 
-bool os_is_sep(char ch) {
-#ifdef CORETEN_OS_WINDOWS
-    return ch == '\\' || ch == '/';
-#else
-    return ch == '/';
-#endif // CORETEN_OS_WINDOWS
+UInt64 hashmap_size(cstlHashMap* map) {
+    return map->size;
 }
 
-bool os_path_is_abs(cstlBuffer* path) {
-    bool result = false;
-    CORETEN_ENFORCE_NN(path, "Cannot do anything useful on a null path :(");
-#ifdef CORETEN_OS_WINDOWS
-    // The 'C:\...`
-    result = path->len > 2 &&
-             char_is_alpha(path->data[0]) &&
-             (path->data[1] == ':' && path->data[2] == CORETEN_OS_SEP_CHAR);
-#else
-    result = path->len > 2 &&
-             path->data[0] == CORETEN_OS_SEP_CHAR;
-#endif // CORETEN_OS_WINDOWS
-    return cast(bool)result;
+void* hashmap_get(cstlHashMap* map, const void* key) {
+    Int64 index = __hashmap_find(map, key, map->hash(key, map->key_size));
+    return index < 0 ? null : hashmap_value_at(map, index);
+}
+
+bool hashmap_contains(cstlHashMap* map, const void* key) {
+    return __hashmap_find(map, key, map->hash(key, map->key_size)) >= 0;
+}
+
+void* hashmap_get_or_insert(cstlHashMap* map, const void* key, bool* inserted) {
+    UInt64 hash = map->hash(key, map->key_size);
+    Int64 found = __hashmap_find(map, key, hash);
+    if(inserted)
+        *inserted = found < 0;
+    if(found >= 0)
+        return hashmap_value_at(map, found);
+
+    if(CORETEN_UNLIKELY(map->growth_left == 0))
+        __hashmap_resize(map, map->capacity * 2);
+
+    UInt64 index = __hashmap_find_empty(map, hash);
+    __hashmap_set_ctrl(map, index, __HASHMAP_H2(hash));
+    memcpy(hashmap_key_at(map, index), key, map->key_size);
+    memset(hashmap_value_at(map, index), 0, map->value_size);
+    map->size++;
+    map->growth_left--;
+    return hashmap_value_at(map, index);
+}
+
+void* hashmap_put(cstlHashMap* map, const void* key, const void* value) {
+    void* dest = hashmap_get_or_insert(map, key, null);
+    if(value)
+        memcpy(dest, value, map->value_size);
+    else
+        memset(dest, 0, map->value_size);
+    return dest;
+}
+
+bool hashmap_remove(cstlHashMap* map, const void* key) {
+    Int64 found = __hashmap_find(map, key, map->hash(key, map->key_size));
+    if(found < 0)
+        return false;
+
+    // Backward-shift deletion: move every following entry that may sit in the hole (i.e. whose home slot isn't 
+    // between the hole and its current slot) back into it, up to the next empty slot
+    UInt64 mask = map->capacity - 1;
+    UInt64 hole = cast(UInt64)found;
+    for(UInt64 i = (hole + 1) & mask; map->ctrl[i] != HASHMAP_CTRL_EMPTY; i = (i + 1) & mask) {
+        UInt64 home = __HASHMAP_H1(map->hash(hashmap_key_at(map, i), map->key_size)) & mask;
+        if(((i - home) & mask) >= ((i - hole) & mask)) {
+            __hashmap_set_ctrl(map, hole, map->ctrl[i]);
+            memcpy(hashmap_key_at(map, hole), hashmap_key_at(map, i), map->slot_size);
+            hole = i;
+        }
+    }
+    __hashmap_set_ctrl(map, hole, HASHMAP_CTRL_EMPTY);
+    map->size--;
+    map->growth_left++;
+    return true;
+}
+
+UInt64 hashmap_begin(cstlHashMap* map) {
+    return hashmap_next(map, cast(UInt64)-1);
+}
+
+UInt64 hashmap_next(cstlHashMap* map, UInt64 it) {
+    for(UInt64 i = it + 1; i < map->capacity; i++) {
+        if(map->ctrl[i] >= 0)
+            return i;
+    }
+    return map->capacity;
+}
+
+// -------------------------------------------------------------------------
+// io.h
+// -------------------------------------------------------------------------
+
+char* readFile(const char* fname) {
+    return readFile_in(null, fname, null);
+}
+
+char* readFile_in(cstlAllocator* allocator, const char* fname, UInt64* length) {
+    FILE* file = fopen(fname, "rb"); 
+    
+    if(!file) {
+        cstlColouredPrintf(CORETEN_COLOUR_ERROR, "Could not open file: <%s>\n", fname);
+        cstlColouredPrintf(CORETEN_COLOUR_ERROR, "%s\n", !file_exists(fname) ?  
+                            "FileNotFoundError: File does not exist." : "");
+        exit(1);
+    }
+
+    // Get the length of the input buffer
+    fseek(file, 0, SEEK_END); 
+    long buff_length = ftell(file); 
+    fseek(file, 0, SEEK_SET);
+
+    char* buffer = cast(char*)cstl_alloc_aligned(allocator, sizeof(char) * (buff_length + 1), 1);
+
+    fread(buffer, 1, buff_length, file); 
+    buffer[buff_length] = nullchar;
+    fclose(file); 
+
+    if(length)
+        *length = cast(UInt64)buff_length;
+
+    return buffer;
+}
+
+bool file_exists(const char* path) {
+#ifdef WIN32
+    if (GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES) return true;
+#else
+    // if(access(path, 0) == 0) return true;
+    struct stat st;
+    return !stat(path, &st);
+#endif // WIN32
+    return false;
+}
+
+#if (defined(CORETEN_OS_UNIX) || defined(CORETEN_OS_OSX)) && !defined(CORETEN_OS_WINDOWS)
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #define __FILE_LOADER_POSIX     1
+#endif // CORETEN_OS_UNIX
+
+#if defined(CORETEN_OS_LINUX) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+        #include <linux/io_uring.h>
+        #include <sys/mman.h>
+        #include <sys/syscall.h>
+        #include <sys/uio.h>
+        #define __FILE_LOADER_IO_URING  1
+    #endif // __has_include(<linux/io_uring.h>)
+#endif // CORETEN_OS_LINUX
+
+// A file being read
+typedef struct __FileLoaderJob {
+    cstlFileLoader* loader;
+    File* file;
+    UInt64 offset;          // bytes read so far
+    int error;
+#if defined(__FILE_LOADER_POSIX)
+    int fd;
+#endif // __FILE_LOADER_POSIX
+#if defined(__FILE_LOADER_IO_URING)
+    struct iovec iov;
+#endif // __FILE_LOADER_IO_URING
+} __FileLoaderJob;
+
+#if defined(__FILE_LOADER_IO_URING)
+typedef struct __FileLoaderRing {
+    int fd;
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    struct io_uring_sqe* sqes;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_cqe* cqes;
+    void* sq_ring;
+    UInt64 sq_ring_size;
+    void* cq_ring;
+    UInt64 cq_ring_size;
+    UInt64 sqes_size;
+    UInt32 to_submit;       // SQEs queued since the last `io_uring_enter()`
+} __FileLoaderRing;
+#endif // __FILE_LOADER_IO_URING
+
+typedef struct __FileLoaderImpl {
+    __FileLoaderJob* jobs;          // `depth` of them
+    __FileLoaderJob** free_jobs;
+    UInt32 nfree;
+    File** ready;                   // ring of loaded files, not returned yet
+    UInt32 ready_head;
+    UInt32 nready;
+#if defined(__FILE_LOADER_POSIX)
+    // Threads backend: each read is a task on the shared pool. `lock` guards `done`
+    cstlTaskGroup group;
+    cstlMutex lock;
+    cstlCondVar done_cond;
+    __FileLoaderJob** done;         // ring of jobs a task has finished reading
+    UInt32 done_head;
+    UInt32 ndone;
+#endif // __FILE_LOADER_POSIX
+#if defined(__FILE_LOADER_IO_URING)
+    __FileLoaderRing ring;
+#endif // __FILE_LOADER_IO_URING
+} __FileLoaderImpl;
+
+static void __file_loader_push_ready(cstlFileLoader* loader, File* file) {
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    impl->ready[(impl->ready_head + impl->nready) % loader->depth] = file;
+    impl->nready++;
+}
+
+static File* __file_loader_pop_ready(cstlFileLoader* loader) {
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    File* file = impl->ready[impl->ready_head];
+    impl->ready_head = (impl->ready_head + 1) % loader->depth;
+    impl->nready--;
+    return file;
+}
+
+#if defined(__FILE_LOADER_IO_URING)
+static int __io_uring_setup(unsigned entries, struct io_uring_params* params) {
+    return cast(int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int __io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return cast(int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, null, 0);
+}
+
+static bool __file_loader_ring_init(__FileLoaderRing* ring, UInt32 depth) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring->fd = __io_uring_setup(depth, &params);
+    if(ring->fd < 0)
+        return false;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    ring->sq_ring = mmap(null, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, 
+                         IORING_OFF_SQ_RING);
+    ring->cq_ring = mmap(null, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, 
+                         IORING_OFF_CQ_RING);
+    ring->sqes = cast(struct io_uring_sqe*)mmap(null, ring->sqes_size, PROT_READ | PROT_WRITE, 
+                                                MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if(ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+        if(ring->sq_ring != MAP_FAILED) munmap(ring->sq_ring, ring->sq_ring_size);
+        if(ring->cq_ring != MAP_FAILED) munmap(ring->cq_ring, ring->cq_ring_size);
+        if(ring->sqes != MAP_FAILED) munmap(ring->sqes, ring->sqes_size);
+        close(ring->fd);
+        return false;
+    }
+
+    Byte* sq = cast(Byte*)ring->sq_ring;
+    Byte* cq = cast(Byte*)ring->cq_ring;
+    ring->sq_head = cast(unsigned*)(sq + params.sq_off.head);
+    ring->sq_tail = cast(unsigned*)(sq + params.sq_off.tail);
+    ring->sq_mask = cast(unsigned*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = cast(unsigned*)(sq + params.sq_off.array);
+    ring->cq_head = cast(unsigned*)(cq + params.cq_off.head);
+    ring->cq_tail = cast(unsigned*)(cq + params.cq_off.tail);
+    ring->cq_mask = cast(unsigned*)(cq + params.cq_off.ring_mask);
+    ring->cqes = cast(struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    ring->to_submit = 0;
+    return true;
+}
+
+static void __file_loader_ring_free(__FileLoaderRing* ring) {
+    munmap(ring->sqes, ring->sqes_size);
+    munmap(ring->cq_ring, ring->cq_ring_size);
+    munmap(ring->sq_ring, ring->sq_ring_size);
+    close(ring->fd);
+}
+
+// Queue a read of the rest of `job`'s file (submitted by the next `io_uring_enter()`)
+static void __file_loader_ring_queue(__FileLoaderRing* ring, __FileLoaderJob* job) {
+    unsigned tail = *ring->sq_tail;
+    unsigned index = tail & *ring->sq_mask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+
+    job->iov.iov_base = job->file->contents + job->offset;
+    job->iov.iov_len = job->file->length - job->offset;
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = job->fd;
+    sqe->addr = cast(UInt64)cast(uintptr_t)&job->iov;
+    sqe->len = 1;
+    sqe->off = job->offset;
+    sqe->user_data = cast(UInt64)cast(uintptr_t)job;
+
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->to_submit++;
+}
+#endif // __FILE_LOADER_IO_URING
+
+static void __file_loader_finish(cstlFileLoader* loader, __FileLoaderJob* job, int error) {
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    File* file = job->file;
+#if defined(__FILE_LOADER_POSIX)
+    close(job->fd);
+#endif // __FILE_LOADER_POSIX
+    if(error) {
+        cstl_free(loader->allocator, file->contents, file->length + 1);
+        file->contents = null;
+        file->length = 0;
+        file->error = error;
+    } else {
+        // The file may have shrunk since it was opened. Shrink the buffer with it, so it's always `length + 1` bytes
+        if(job->offset < file->length) {
+            file->contents = cast(char*)cstl_realloc(loader->allocator, file->contents, file->length + 1, 
+                                                     job->offset + 1);
+            file->length = job->offset;
+        }
+        file->contents[file->length] = nullchar;
+        STATS_INC(StatsFileLoaderFiles);
+        STATS_ADD(StatsFileLoaderBytes, file->length);
+    }
+    impl->free_jobs[impl->nfree++] = job;
+}
+
+#if defined(__FILE_LOADER_POSIX)
+// Read the rest of `job`'s file. Returns 0 or an `errno`
+static int __file_loader_pread(__FileLoaderJob* job) {
+    File* file = job->file;
+    while(job->offset < file->length) {
+        ssize_t n = pread(job->fd, file->contents + job->offset, file->length - job->offset, cast(off_t)job->offset);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n < 0)
+            return errno;
+        if(n == 0)
+            break;
+        job->offset += cast(UInt64)n;
+    }
+    return 0;
+}
+
+static void __file_loader_read_task(void* arg) {
+    __FileLoaderJob* job = cast(__FileLoaderJob*)arg;
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)job->loader->impl;
+    // Only the file's buffer is touched here. Everything else (closing, freeing on error) happens on the loader's 
+    // thread
+    job->error = __file_loader_pread(job);
+
+    mutex_lock(&impl->lock);
+    impl->done[(impl->done_head + impl->ndone) % job->loader->depth] = job;
+    impl->ndone++;
+    condvar_signal(&impl->done_cond);
+    mutex_unlock(&impl->lock);
+}
+
+// False if there is no thread pool to read on
+static bool __file_loader_threads_init(cstlFileLoader* loader) {
+    cstlThreadPool* pool = thread_pool_shared();
+    if(pool == null)
+        return false;
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    task_group_init(&impl->group, pool);
+    impl->done = cast(__FileLoaderJob**)cstl_alloc(loader->allocator, loader->depth * sizeof(__FileLoaderJob*));
+    mutex_init(&impl->lock);
+    condvar_init(&impl->done_cond);
+    return true;
+}
+
+static void __file_loader_threads_free(cstlFileLoader* loader) {
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    // Every job has been returned by now, but the last tasks may still be on their way out of `impl->lock`
+    task_group_wait(&impl->group);
+    mutex_destroy(&impl->lock);
+    condvar_destroy(&impl->done_cond);
+    cstl_free(loader->allocator, impl->done, loader->depth * sizeof(__FileLoaderJob*));
+}
+#endif // __FILE_LOADER_POSIX
+
+// Open `file` and allocate its buffer. Returns null if there's nothing left to read (the file is then ready)
+static __FileLoaderJob* __file_loader_open(cstlFileLoader* loader, File* file) {
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    __FileLoaderJob* job = impl->free_jobs[--impl->nfree];
+    job->loader = loader;
+    job->file = file;
+    job->offset = 0;
+
+#if defined(__FILE_LOADER_POSIX)
+    job->fd = open(file->full_path, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if(job->fd < 0 || fstat(job->fd, &st) != 0) {
+        file->error = errno;
+        if(job->fd >= 0)
+            close(job->fd);
+        impl->free_jobs[impl->nfree++] = job;
+        __file_loader_push_ready(loader, file);
+        return null;
+    }
+    file->length = cast(UInt64)st.st_size;
+    file->contents = cast(char*)cstl_alloc_aligned(loader->allocator, file->length + 1, 1);
+    if(file->length == 0) {
+        __file_loader_finish(loader, job, 0);
+        __file_loader_push_ready(loader, file);
+        return null;
+    }
+#else
+    // Read synchronously through stdio
+    FILE* fp = fopen(file->full_path, "rb");
+    if(!fp) {
+        file->error = errno;
+        impl->free_jobs[impl->nfree++] = job;
+        __file_loader_push_ready(loader, file);
+        return null;
+    }
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    file->length = length > 0 ? cast(UInt64)length : 0;
+    file->contents = cast(char*)cstl_alloc_aligned(loader->allocator, file->length + 1, 1);
+    job->offset = fread(file->contents, 1, file->length, fp);
+    int error = ferror(fp) ? EIO : 0;
+    fclose(fp);
+    __file_loader_finish(loader, job, error);
+    __file_loader_push_ready(loader, file);
+    return null;
+#endif // __FILE_LOADER_POSIX
+    return job;
+}
+
+// Open files (and start reading them) until `depth` are in flight
+static void __file_loader_fill(cstlFileLoader* loader) {
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    while(loader->in_flight < loader->depth && loader->next_open < loader->nfiles) {
+        File* file = loader->files[loader->next_open++];
+        loader->in_flight++;
+
+#if defined(__FILE_LOADER_POSIX)
+        __FileLoaderJob* job = __file_loader_open(loader, file);
+        if(!job)
+            continue;
+
+        switch(loader->backend) {
+        #if defined(__FILE_LOADER_IO_URING)
+            case FileLoaderBackendIoUring:
+                __file_loader_ring_queue(&impl->ring, job);
+                break;
+        #endif // __FILE_LOADER_IO_URING
+            case FileLoaderBackendThreads:
+                task_group_submit(&impl->group, __file_loader_read_task, job);
+                break;
+            default:
+                __file_loader_finish(loader, job, __file_loader_pread(job));
+                __file_loader_push_ready(loader, file);
+                break;
+        }
+#else
+        __file_loader_open(loader, file);
+#endif // __FILE_LOADER_POSIX
+    }
+
+#if defined(__FILE_LOADER_IO_URING)
+    // Hand the new reads to the kernel right away, so they run while the caller works on earlier files
+    if(loader->backend == FileLoaderBackendIoUring && impl->ring.to_submit > 0) {
+        int ret = __io_uring_enter(impl->ring.fd, impl->ring.to_submit, 0, 0);
+        if(ret > 0)
+            impl->ring.to_submit -= cast(UInt32)ret;
+    }
+#endif // __FILE_LOADER_IO_URING
+}
+
+cstlFileLoader* file_loader_new(cstlAllocator* allocator, UInt32 depth, cstlFileLoaderBackend backend) {
+    cstlFileLoader* loader = cstl_new_obj(allocator, cstlFileLoader);
+    __FileLoaderImpl* impl = cstl_new_obj(allocator, __FileLoaderImpl);
+    loader->allocator = allocator;
+    loader->depth = depth > 0 ? depth : FILE_LOADER_DEFAULT_DEPTH;
+    loader->impl = impl;
+
+    impl->jobs = cast(__FileLoaderJob*)cstl_alloc(allocator, loader->depth * sizeof(__FileLoaderJob));
+    impl->free_jobs = cast(__FileLoaderJob**)cstl_alloc(allocator, loader->depth * sizeof(__FileLoaderJob*));
+    impl->ready = cast(File**)cstl_alloc(allocator, loader->depth * sizeof(File*));
+    for(UInt32 i = 0; i < loader->depth; i++)
+        impl->free_jobs[impl->nfree++] = &impl->jobs[i];
+
+    // Pick the first available backend, starting at `backend`
+    loader->backend = FileLoaderBackendSync;
+#if defined(__FILE_LOADER_IO_URING)
+    if((backend == FileLoaderBackendAuto || backend == FileLoaderBackendIoUring) && 
+       __file_loader_ring_init(&impl->ring, loader->depth)) {
+        loader->backend = FileLoaderBackendIoUring;
+        return loader;
+    }
+#endif // __FILE_LOADER_IO_URING
+#if defined(__FILE_LOADER_POSIX)
+    if(backend != FileLoaderBackendSync && __file_loader_threads_init(loader))
+        loader->backend = FileLoaderBackendThreads;
+#endif // __FILE_LOADER_POSIX
+    return loader;
+}
+
+int file_loader_add(cstlFileLoader* loader, const char* path) {
+    CORETEN_ENFORCE_NN(path, "Cannot load a null path");
+    if(loader->nfiles == loader->capacity) {
+        UInt64 capacity = loader->capacity ? loader->capacity * 2 : 64;
+        loader->files = cast(File**)cstl_realloc(loader->allocator, loader->files, 
+                                                 loader->capacity * sizeof(File*), capacity * sizeof(File*));
+        loader->capacity = capacity;
+    }
+
+    File* file = cstl_new_obj(loader->allocator, File);
+    UInt64 length = strlen(path);
+    file->full_path = cast(char*)cstl_alloc_aligned(loader->allocator, length + 1, 1);
+    memcpy(file->full_path, path, length);
+    char* sep = strrchr(file->full_path, CORETEN_OS_SEP_CHAR);
+    if(!sep)
+        sep = strrchr(file->full_path, '/');
+    file->basename = sep ? sep + 1 : file->full_path;
+    file->fileid = cast(int)loader->nfiles;
+    loader->files[loader->nfiles++] = file;
+    return file->fileid;
+}
+
+File* file_loader_next(cstlFileLoader* loader) {
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+    __file_loader_fill(loader);
+    if(loader->in_flight == 0)
+        return null;
+    loader->in_flight--;
+
+    // Files that failed to open (or had nothing to read) are returned first
+    if(impl->nready > 0)
+        return __file_loader_pop_ready(loader);
+
+    switch(loader->backend) {
+    #if defined(__FILE_LOADER_IO_URING)
+        case FileLoaderBackendIoUring: {
+            __FileLoaderRing* ring = &impl->ring;
+            while(impl->nready == 0) {
+                int ret = __io_uring_enter(ring->fd, ring->to_submit, 1, IORING_ENTER_GETEVENTS);
+                CORETEN_ENFORCE(ret >= 0 || errno == EINTR || errno == EAGAIN || errno == EBUSY, 
+                                "io_uring_enter() failed");
+                if(ret > 0)
+                    ring->to_submit -= cast(UInt32)ret;
+
+                unsigned head = *ring->cq_head;
+                while(head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+                    struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+                    __FileLoaderJob* job = cast(__FileLoaderJob*)cast(uintptr_t)cqe->user_data;
+                    int res = cqe->res;
+                    head++;
+                    if(res > 0)
+                        job->offset += cast(UInt64)res;
+
+                    if(res > 0 && job->offset < job->file->length) {
+                        // Short read: ask for the rest
+                        __file_loader_ring_queue(ring, job);
+                    } else {
+                        File* file = job->file;
+                        __file_loader_finish(loader, job, res < 0 ? -res : 0);
+                        __file_loader_push_ready(loader, file);
+                    }
+                }
+                __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+            }
+            return __file_loader_pop_ready(loader);
+        }
+    #endif // __FILE_LOADER_IO_URING
+    #if defined(__FILE_LOADER_POSIX)
+        case FileLoaderBackendThreads: {
+            mutex_lock(&impl->lock);
+            while(impl->ndone == 0) {
+                if(thread_pool_worker_index(impl->group.pool) < 0) {
+                    condvar_wait(&impl->done_cond, &impl->lock);
+                    continue;
+                }
+                // On one of the pool's own workers, blocking could starve the reads: run them here instead
+                mutex_unlock(&impl->lock);
+                task_group_wait(&impl->group);
+                mutex_lock(&impl->lock);
+            }
+            __FileLoaderJob* job = impl->done[impl->done_head];
+            impl->done_head = (impl->done_head + 1) % loader->depth;
+            impl->ndone--;
+            mutex_unlock(&impl->lock);
+
+            File* file = job->file;
+            __file_loader_finish(loader, job, job->error);
+            return file;
+        }
+    #endif // __FILE_LOADER_POSIX
+        default:
+            // The sync backend reads everything in `__file_loader_fill()`, so this is unreachable
+            CORETEN_ENFORCE(false, "File loader has nothing in flight");
+            return null;
+    }
+}
+
+void file_loader_free(cstlFileLoader* loader) {
+    if(loader == null)
+        return;
+    __FileLoaderImpl* impl = cast(__FileLoaderImpl*)loader->impl;
+
+    // Drain whatever is still being read, so no thread (or the kernel) writes into freed buffers
+    while(loader->in_flight > 0 || loader->next_open < loader->nfiles) {
+        loader->next_open = loader->nfiles;
+        if(loader->in_flight > 0)
+            file_loader_next(loader);
+    }
+
+#if defined(__FILE_LOADER_IO_URING)
+    if(loader->backend == FileLoaderBackendIoUring)
+        __file_loader_ring_free(&impl->ring);
+#endif // __FILE_LOADER_IO_URING
+#if defined(__FILE_LOADER_POSIX)
+    if(loader->backend == FileLoaderBackendThreads)
+        __file_loader_threads_free(loader);
+#endif // __FILE_LOADER_POSIX
+
+    for(UInt64 i = 0; i < loader->nfiles; i++) {
+        File* file = loader->files[i];
+        if(file->contents)
+            cstl_free(loader->allocator, file->contents, file->length + 1);
+        cstl_free(loader->allocator, file->full_path, strlen(file->full_path) + 1);
+        cstl_free_obj(loader->allocator, file);
+    }
+    cstl_free(loader->allocator, loader->files, loader->capacity * sizeof(File*));
+    cstl_free(loader->allocator, impl->jobs, loader->depth * sizeof(__FileLoaderJob));
+    cstl_free(loader->allocator, impl->free_jobs, loader->depth * sizeof(__FileLoaderJob*));
+    cstl_free(loader->allocator, impl->ready, loader->depth * sizeof(File*));
+    cstl_free_obj(loader->allocator, impl);
+    cstl_free_obj(loader->allocator, loader);
+}
+
+#if defined(CORETEN_OS_WINDOWS)
+    #include <io.h>
+#endif // CORETEN_OS_WINDOWS
+
+static cstlWriter* __writer_new(cstlAllocator* allocator, cstlWriterSink sink, UInt64 buffer_size) {
+    cstlWriter* writer = cstl_new_obj(allocator, cstlWriter);
+    writer->allocator = allocator;
+    writer->sink = sink;
+    writer->capacity = buffer_size > 0 ? buffer_size : WRITER_DEFAULT_BUFFER_SIZE;
+    writer->buffer = cast(char*)cstl_alloc_aligned(allocator, writer->capacity, 1);
+    writer->owns_buffer = true;
+    writer->fd = -1;
+    return writer;
+}
+
+cstlWriter* writer_new_file(cstlAllocator* allocator, FILE* file, UInt64 buffer_size) {
+    CORETEN_ENFORCE_NN(file, "Cannot write to a null file");
+    cstlWriter* writer = __writer_new(allocator, WriterSinkFile, buffer_size);
+    writer->file = file;
+    return writer;
+}
+
+cstlWriter* writer_new_fd(cstlAllocator* allocator, int fd, UInt64 buffer_size) {
+    cstlWriter* writer = __writer_new(allocator, WriterSinkFd, buffer_size);
+    writer->fd = fd;
+    return writer;
+}
+
+cstlWriter* writer_new_memory(cstlAllocator* allocator, UInt64 capacity) {
+    return __writer_new(allocator, WriterSinkMemory, capacity > 0 ? capacity : 256);
+}
+
+void writer_init_file(cstlWriter* writer, FILE* file, char* buffer, UInt64 size) {
+    CORETEN_ENFORCE(file != null && buffer != null && size > 0);
+    memset(writer, 0, sizeof(*writer));
+    writer->sink = WriterSinkFile;
+    writer->file = file;
+    writer->fd = -1;
+    writer->buffer = buffer;
+    writer->capacity = size;
+}
+
+void writer_free(cstlWriter* writer) {
+    if(writer == null)
+        return;
+    writer_flush(writer);
+    if(writer->owns_buffer)
+        cstl_free(writer->allocator, writer->buffer, writer->capacity);
+    cstl_free_obj(writer->allocator, writer);
+}
+
+// Write `n` bytes straight to the sink
+static void __writer_sink_write(cstlWriter* writer, const char* data, UInt64 n) {
+    if(writer->error || n == 0)
+        return;
+
+    if(writer->sink == WriterSinkFile) {
+        writer->error = fwrite(data, 1, n, writer->file) != n;
+        return;
+    }
+    while(n > 0) {
+    #if defined(CORETEN_OS_WINDOWS)
+        int chunk = n > 0x40000000 ? 0x40000000 : cast(int)n;
+        int written = _write(writer->fd, data, chunk);
+    #else
+        ssize_t written = write(writer->fd, data, n);
+        if(written < 0 && errno == EINTR)
+            continue;
+    #endif // CORETEN_OS_WINDOWS
+        if(written <= 0) {
+            writer->error = true;
+            return;
+        }
+        data += written;
+        n -= cast(UInt64)written;
+    }
+}
+
+bool writer_flush(cstlWriter* writer) {
+    if(writer->sink == WriterSinkMemory)
+        return !writer->error;
+    __writer_sink_write(writer, writer->buffer, writer->used);
+    writer->used = 0;
+    if(writer->sink == WriterSinkFile && !writer->error)
+        writer->error = fflush(writer->file) != 0;
+    return !writer->error;
+}
+
+void __writer_make_room(cstlWriter* writer, UInt64 n) {
+    if(writer->capacity - writer->used >= n)
+        return;
+    if(writer->sink != WriterSinkMemory) {
+        __writer_sink_write(writer, writer->buffer, writer->used);
+        writer->used = 0;
+        CORETEN_ENFORCE(n <= writer->capacity, "Writer buffer is too small");
+        return;
+    }
+
+    UInt64 capacity = writer->capacity * 2;
+    while(capacity - writer->used < n)
+        capacity *= 2;
+    writer->buffer = cast(char*)cstl_realloc(writer->allocator, writer->buffer, writer->capacity, capacity);
+    writer->capacity = capacity;
+}
+
+void writer_write(cstlWriter* writer, const char* data, UInt64 n) {
+    if(CORETEN_LIKELY(writer->capacity - writer->used >= n)) {
+        memcpy(writer->buffer + writer->used, data, n);
+        writer->used += n;
+        return;
+    }
+
+    // Too big to be worth copying into the buffer
+    if(writer->sink != WriterSinkMemory && n >= writer->capacity) {
+        __writer_sink_write(writer, writer->buffer, writer->used);
+        writer->used = 0;
+        __writer_sink_write(writer, data, n);
+        return;
+    }
+    __writer_make_room(writer, n);
+    memcpy(writer->buffer + writer->used, data, n);
+    writer->used += n;
+}
+
+void writer_str(cstlWriter* writer, const char* str) {
+    writer_write(writer, str, strlen(str));
+}
+
+void writer_repeat(cstlWriter* writer, char ch, UInt64 n) {
+    while(n > 0) {
+        if(writer->used == writer->capacity)
+            __writer_make_room(writer, 1);
+        UInt64 chunk = writer->capacity - writer->used;
+        if(chunk > n)
+            chunk = n;
+        memset(writer->buffer + writer->used, ch, chunk);
+        writer->used += chunk;
+        n -= chunk;
+    }
+}
+
+static const char __WRITER_DIGIT_PAIRS[201] = 
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+void writer_u64(cstlWriter* writer, UInt64 value) {
+    // Two digits at a time, from the end
+    char digits[20];
+    char* p = digits + sizeof(digits);
+    while(value >= 100) {
+        UInt64 pair = (value % 100) * 2;
+        value /= 100;
+        *--p = __WRITER_DIGIT_PAIRS[pair + 1];
+        *--p = __WRITER_DIGIT_PAIRS[pair];
+    }
+    if(value >= 10) {
+        *--p = __WRITER_DIGIT_PAIRS[value * 2 + 1];
+        *--p = __WRITER_DIGIT_PAIRS[value * 2];
+    } else {
+        *--p = cast(char)('0' + value);
+    }
+    writer_write(writer, p, cast(UInt64)(digits + sizeof(digits) - p));
+}
+
+void writer_i64(cstlWriter* writer, Int64 value) {
+    if(value < 0) {
+        writer_char(writer, '-');
+        // Negate as unsigned, so INT64_MIN works
+        writer_u64(writer, ~cast(UInt64)value + 1);
+    } else {
+        writer_u64(writer, cast(UInt64)value);
+    }
+}
+
+void writer_hex64(cstlWriter* writer, UInt64 value) {
+    char digits[16];
+    char* p = digits + sizeof(digits);
+    do {
+        *--p = "0123456789abcdef"[value & 0xF];
+        value >>= 4;
+    } while(value);
+    writer_write(writer, p, cast(UInt64)(digits + sizeof(digits) - p));
+}
+
+void writer_vprintf(cstlWriter* writer, const char* fmt, va_list args) {
+    va_list copy;
+    va_copy(copy, args);
+    UInt64 room = writer->capacity - writer->used;
+    int n = vsnprintf(writer->buffer + writer->used, room, fmt, copy);
+    va_end(copy);
+    if(n < 0) {
+        writer->error = true;
+        return;
+    }
+    // `vsnprintf()` also needs room for the null terminator
+    if(cast(UInt64)n < room) {
+        writer->used += cast(UInt64)n;
+        return;
+    }
+
+    if(writer->sink == WriterSinkMemory || cast(UInt64)n < writer->capacity) {
+        __writer_make_room(writer, cast(UInt64)n + 1);
+        vsnprintf(writer->buffer + writer->used, writer->capacity - writer->used, fmt, args);
+        writer->used += cast(UInt64)n;
+        return;
+    }
+
+    // Larger than the whole buffer
+    char* temp = cast(char*)cstl_alloc(writer->allocator, cast(UInt64)n + 1);
+    vsnprintf(temp, cast(UInt64)n + 1, fmt, args);
+    writer_write(writer, temp, cast(UInt64)n);
+    cstl_free(writer->allocator, temp, cast(UInt64)n + 1);
+}
+
+void writer_printf(cstlWriter* writer, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    writer_vprintf(writer, fmt, args);
+    va_end(args);
+}
+
+const char* writer_data(cstlWriter* writer) {
+    CORETEN_ENFORCE(writer->sink == WriterSinkMemory, "Only memory writers hold on to their data");
+    __writer_make_room(writer, 1);
+    writer->buffer[writer->used] = nullchar;
+    return writer->buffer;
+}
+
+// -------------------------------------------------------------------------
+// math.h
+// -------------------------------------------------------------------------
+
+Float32 coreten_toRadians(Float32 degrees) { 
+    return degrees * CORETEN_MATH_TAU / 360.0f;
+}
+
+Float32 coreten_toDegrees(Float32 radians) { 
+    return radians * 360.0f / CORETEN_MATH_TAU;
+}
+
+Float32 coreten_sin(Float32 x) {
+    Float32 x0 = +1.91059300966915117e-31f;
+    Float32 x1 = +1.00086760103908896f;
+    Float32 x2 = -1.21276126894734565e-2f;
+    Float32 x3 = -1.38078780785773762e-1f;
+    Float32 x4 = -2.67353392911981221e-2f;
+    Float32 x5 = +2.08026600266304389e-2f;
+    Float32 x6 = -3.03996055049204407e-3f;
+    Float32 x7 = +1.38235642404333740e-4f;
+    return x0 + x*(x1 + x*(x2 + x*(x3 + x*(x4 + x*(x5 + x*(x6 + x*x7))))));
+}
+
+Float32 coreten_cos(Float32 x) {
+    Float32 x0 = +1.00238601909309722f;
+    Float32 x1 = -3.81919947353040024e-2f;
+    Float32 x2 = -3.94382342128062756e-1f;
+    Float32 x3 = -1.18134036025221444e-1f;
+    Float32 x4 = +1.07123798512170878e-1f;
+    Float32 x5 = -1.86637164165180873e-2f;
+    Float32 x6 = +9.90140908664079833e-4f;
+    Float32 x7 = -5.23022132118824778e-14f;
+    return x0 + x*(x1 + x*(x2 + x*(x3 + x*(x4 + x*(x5 + x*(x6 + x*x7))))));
+}
+
+Float32 coreten_tan(Float32 radians) {
+    Float32 rr = radians * radians;
+    Float32 x = 9.5168091e-03f;
+    x *= rr;
+    x += 2.900525e-03f;
+    x *= rr;
+    x += 2.45650893e-02f;
+    x *= rr;
+    x += 5.33740603e-02f;
+    x *= rr;
+    x += 1.333923995e-01f;
+    x *= rr;
+    x += 3.333314036e-01f;
+    x *= rr;
+    x += 1.0f;
+    x *= radians;
+    return x;
+}
+
+Float32 coreten_arctan(Float32 x) {
+    Float32 u  = x*x;
+    Float32 u2 = u*u;
+    Float32 u3 = u2*u;
+    Float32 u4 = u3*u;
+    Float32 f  = 1.0f+0.33288950512027f*u-0.08467922817644f*u2+0.03252232640125f*u3-0.00749305860992f*u4;
+    return x/f;
+}
+
+Float32 coreten_arctan2(Float32 x, Float32 y) {
+    if (CORETEN_ABS(y) > CORETEN_ABS(x)) {
+        Float32 a = coreten_arctan(x/y);
+        if (y > 0.0f)
+            return a;
+        else
+            return x > 0.0f ? a + CORETEN_MATH_TAU_BY_2 : a - CORETEN_MATH_TAU_BY_2;
+    } else {
+        Float32 a = coreten_arctan(y/x);
+        if (y > 0.0f)
+            return x > 0.0f ? CORETEN_MATH_TAU_BY_4 - a : -CORETEN_MATH_TAU_BY_4 - a;
+        else
+            return x > 0.0f ? CORETEN_MATH_TAU_BY_4 + a : -CORETEN_MATH_TAU_BY_4 + a;
+    }
+}
+
+Float32 coreten_exp(Float32 x) {
+    union { Float32 f; int i; } u, v;
+    u.i = (int)(6051102 * x + 1056478197);
+    v.i = (int)(1056478197 - 6051102 * x);
+    return u.f / v.f;
+}
+
+Float32 coreten_log(Float32 x) {
+    union { Float32 f; int i; } u = {x};
+    return (u.i - 1064866805) * 8.262958405176314e-8f; // 1 / 12102203.0;
+}
+
+Float32 coreten_pow(Float32 x, Float32 y) {
+    int flipped = 0, e;
+    Float32 f, r = 1.0f;
+    if (y < 0) {
+        flipped = 1;
+        y = -y;
+    }
+    e = (int)y;
+    f = coreten_exp(y - e);
+    while (e) {
+        if (e & 1) r *= x;
+        x *= x;
+        e >>= 1;
+    }
+    r *= f;
+    return flipped ? 1.0f/r : r;
+}
+
+Float32 coreten_square(Float32 x){
+    return coreten_exp(CORETEN_MATH_LOG_TWO * x);
+}
+
+Float32 coreten_log2(Float32 x){
+    return coreten_log(x) / CORETEN_MATH_LOG_TWO;
+}
+
+// -------------------------------------------------------------------------
+// memory.h
+// -------------------------------------------------------------------------
+
+static void* __default_alloc(void* user_data, UInt64 size, UInt64 align) {
+    CORETEN_ENFORCE(align <= CORETEN_DEFAULT_ALIGN, "The default allocator cannot satisfy this alignment");
+    return calloc(1, size > 0 ? size : 1);
+}
+
+static void* __default_realloc(void* user_data, void* ptr, UInt64 old_size, UInt64 new_size, UInt64 align) {
+    CORETEN_ENFORCE(align <= CORETEN_DEFAULT_ALIGN, "The default allocator cannot satisfy this alignment");
+    return realloc(ptr, new_size > 0 ? new_size : 1);
+}
+
+static void __default_free(void* user_data, void* ptr, UInt64 size) {
+    free(ptr);
+}
+
+static cstlAllocator __cstl_default_allocator = { __default_alloc, __default_realloc, __default_free, null };
+
+cstlAllocator* cstl_default_allocator() {
+    return &__cstl_default_allocator;
+}
+
+void* cstl_alloc_aligned(cstlAllocator* allocator, UInt64 size, UInt64 align) {
+    if(!allocator)
+        allocator = &__cstl_default_allocator;
+    void* ptr = allocator->alloc(allocator->user_data, size, align);
+    CORETEN_ENFORCE_NN(ptr, "Could not allocate memory. Memory full.");
+    return ptr;
+}
+
+void* cstl_alloc(cstlAllocator* allocator, UInt64 size) {
+    return cstl_alloc_aligned(allocator, size, CORETEN_DEFAULT_ALIGN);
+}
+
+// Resize `ptr` to `new_size` bytes. A null `ptr` is a plain allocation
+void* cstl_realloc(cstlAllocator* allocator, void* ptr, UInt64 old_size, UInt64 new_size) {
+    if(!allocator)
+        allocator = &__cstl_default_allocator;
+    if(!ptr)
+        return cstl_alloc(allocator, new_size);
+
+    void* newptr = allocator->realloc(allocator->user_data, ptr, old_size, new_size, CORETEN_DEFAULT_ALIGN);
+    CORETEN_ENFORCE_NN(newptr, "Could not allocate memory. Memory full.");
+    return newptr;
+}
+
+void cstl_free(cstlAllocator* allocator, void* ptr, UInt64 size) {
+    if(!ptr)
+        return;
+    if(!allocator)
+        allocator = &__cstl_default_allocator;
+    allocator->free(allocator->user_data, ptr, size);
+}
+
+// Allocate a new arena chunk that can hold at least `size` bytes, and make it the head of `arena`
+static cstlArenaChunk* __arena_new_chunk(cstlArena* arena, UInt64 size) {
+    if(size < arena->chunk_size)
+        size = arena->chunk_size;
+
+    cstlArenaChunk* chunk = cast(cstlArenaChunk*)malloc(sizeof(cstlArenaChunk) + size);
+    CORETEN_ENFORCE_NN(chunk, "Could not allocate memory. Memory full.");
+    chunk->prev = arena->head;
+    chunk->size = size;
+    chunk->used = 0;
+
+    arena->head = chunk;
+    arena->total_reserved += size;
+    STATS_INC(StatsArenaChunks);
+    return chunk;
+}
+
+static void* __arena_allocator_alloc(void* user_data, UInt64 size, UInt64 align) {
+    return arena_alloc_aligned(cast(cstlArena*)user_data, size, align);
+}
+
+// Grow the latest allocation in place if there is room for it; otherwise, move it
+static void* __arena_allocator_realloc(void* user_data, void* ptr, UInt64 old_size, UInt64 new_size, UInt64 align) {
+    cstlArena* arena = cast(cstlArena*)user_data;
+    cstlArenaChunk* chunk = arena->head;
+
+    if(cast(Byte*)ptr + old_size == chunk->data + chunk->used) {
+        UInt64 start = cast(UInt64)(cast(Byte*)ptr - chunk->data);
+        if(start + new_size <= chunk->size) {
+            arena->total_used = arena->total_used - old_size + new_size;
+            chunk->used = start + new_size;
+            return ptr;
+        }
+    }
+
+    if(new_size <= old_size)
+        return ptr;
+
+    void* newptr = arena_alloc_aligned(arena, new_size, align);
+    memcpy(newptr, ptr, old_size);
+    return newptr;
+}
+
+// Only the latest allocation can be handed back to an arena
+static void __arena_allocator_free(void* user_data, void* ptr, UInt64 size) {
+    cstlArena* arena = cast(cstlArena*)user_data;
+    cstlArenaChunk* chunk = arena->head;
+
+    if(cast(Byte*)ptr + size == chunk->data + chunk->used) {
+        chunk->used -= size;
+        arena->total_used -= size;
+    }
+}
+
+cstlArena* arena_new(UInt64 chunk_size) {
+    cstlArena* arena = cast(cstlArena*)calloc(1, sizeof(cstlArena));
+    CORETEN_ENFORCE_NN(arena, "Could not allocate memory. Memory full.");
+
+    arena->allocator.alloc = __arena_allocator_alloc;
+    arena->allocator.realloc = __arena_allocator_realloc;
+    arena->allocator.free = __arena_allocator_free;
+    arena->allocator.user_data = arena;
+
+    arena->chunk_size = chunk_size > 0 ? chunk_size : CORETEN_ARENA_DEFAULT_CHUNK_SIZE;
+    __arena_new_chunk(arena, arena->chunk_size);
+    return arena;
+}
+
+void arena_free(cstlArena* arena) {
+    if(arena == null)
+        return;
+
+    cstlArenaChunk* chunk = arena->head;
+    while(chunk) {
+        cstlArenaChunk* prev = chunk->prev;
+        free(chunk);
+        chunk = prev;
+    }
+    free(arena);
+}
+
+void* arena_alloc_aligned(cstlArena* arena, UInt64 size, UInt64 align) {
+    CORETEN_ENFORCE_NN(arena, "Expected not null");
+    CORETEN_ENFORCE(align > 0 && (align & (align - 1)) == 0, "Alignment must be a power of 2");
+
+    cstlArenaChunk* chunk = arena->head;
+    UInt64 base = cast(UInt64)(uintptr_t)chunk->data;
+    UInt64 start = ((base + chunk->used + align - 1) & ~(align - 1)) - base;
+
+    if(CORETEN_UNLIKELY(start + size > chunk->size)) {
+        // `malloc()` only guarantees `CORETEN_ARENA_DEFAULT_ALIGN`-ish alignment, so leave room for the padding
+        chunk = __arena_new_chunk(arena, size + align);
+        base = cast(UInt64)(uintptr_t)chunk->data;
+        start = ((base + align - 1) & ~(align - 1)) - base;
+    }
+
+    void* ptr = chunk->data + start;
+    arena->total_used += start + size - chunk->used;
+    chunk->used = start + size;
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+void* arena_alloc(cstlArena* arena, UInt64 size) {
+    return arena_alloc_aligned(arena, size, CORETEN_ARENA_DEFAULT_ALIGN);
+}
+
+char* arena_strndup(cstlArena* arena, const char* str, UInt64 n) {
+    char* dup = cast(char*)arena_alloc_aligned(arena, n + 1, 1);
+    if(str && n > 0)
+        memcpy(dup, str, n);
+    return dup;
+}
+
+cstlArenaMark arena_mark(cstlArena* arena) {
+    CORETEN_ENFORCE_NN(arena, "Expected not null");
+    cstlArenaMark mark = { arena->head, arena->head->used, arena->total_used };
+    return mark;
+}
+
+void arena_reset_to(cstlArena* arena, cstlArenaMark mark) {
+    CORETEN_ENFORCE_NN(arena, "Expected not null");
+    CORETEN_ENFORCE_NN(mark.chunk, "Invalid arena mark");
+
+    // Release every chunk allocated after the mark was taken
+    while(arena->head != mark.chunk) {
+        cstlArenaChunk* chunk = arena->head;
+        CORETEN_ENFORCE_NN(chunk->prev, "Arena mark does not belong to this arena");
+        arena->head = chunk->prev;
+        arena->total_reserved -= chunk->size;
+        free(chunk);
+    }
+    arena->head->used = mark.used;
+    arena->total_used = mark.total_used;
+}
+
+void arena_reset(cstlArena* arena) {
+    CORETEN_ENFORCE_NN(arena, "Expected not null");
+
+    while(arena->head->prev) {
+        cstlArenaChunk* chunk = arena->head;
+        arena->head = chunk->prev;
+        arena->total_reserved -= chunk->size;
+        free(chunk);
+    }
+    arena->head->used = 0;
+    arena->total_used = 0;
+}
+
+static void* __pool_allocator_alloc(void* user_data, UInt64 size, UInt64 align) {
+    cstlPool* pool = cast(cstlPool*)user_data;
+    if(size <= pool->block_size && align <= CORETEN_DEFAULT_ALIGN)
+        return pool_alloc(pool);
+    return cstl_alloc_aligned(pool->parent, size, align);
+}
+
+static void* __pool_allocator_realloc(void* user_data, void* ptr, UInt64 old_size, UInt64 new_size, UInt64 align) {
+    cstlPool* pool = cast(cstlPool*)user_data;
+    bool was_block = old_size <= pool->block_size;
+    bool is_block = new_size <= pool->block_size;
+
+    if(was_block && is_block)
+        return ptr;
+    if(!was_block && !is_block)
+        return cstl_realloc(pool->parent, ptr, old_size, new_size);
+
+    // Moving between a pool block and the parent allocator
+    void* newptr = __pool_allocator_alloc(user_data, new_size, align);
+    memcpy(newptr, ptr, old_size < new_size ? old_size : new_size);
+    if(was_block)
+        pool_release(pool, ptr);
+    else
+        cstl_free(pool->parent, ptr, old_size);
+    return newptr;
+}
+
+static void __pool_allocator_free(void* user_data, void* ptr, UInt64 size) {
+    cstlPool* pool = cast(cstlPool*)user_data;
+    if(size <= pool->block_size)
+        pool_release(pool, ptr);
+    else
+        cstl_free(pool->parent, ptr, size);
+}
+
+cstlPool* pool_new(cstlAllocator* parent, UInt64 block_size, UInt64 blocks_per_chunk) {
+    cstlPool* pool = cstl_new_obj(parent, cstlPool);
+    pool->allocator.alloc = __pool_allocator_alloc;
+    pool->allocator.realloc = __pool_allocator_realloc;
+    pool->allocator.free = __pool_allocator_free;
+    pool->allocator.user_data = pool;
+
+    // Every block must be able to hold the free-list link, and keep the blocks after it aligned
+    if(block_size < sizeof(void*))
+        block_size = sizeof(void*);
+    block_size = (block_size + CORETEN_DEFAULT_ALIGN - 1) & ~cast(UInt64)(CORETEN_DEFAULT_ALIGN - 1);
+
+    pool->parent = parent;
+    pool->block_size = block_size;
+    pool->blocks_per_chunk = blocks_per_chunk > 0 ? blocks_per_chunk : 64;
+    return pool;
+}
+
+// Size of a pool chunk: a header (the link to the previous chunk) followed by the blocks
+#define __POOL_CHUNK_SIZE(pool)     (CORETEN_DEFAULT_ALIGN + (pool)->block_size * (pool)->blocks_per_chunk)
+
+void pool_free(cstlPool* pool) {
+    if(pool == null)
+        return;
+
+    void* chunk = pool->chunks;
+    while(chunk) {
+        void* prev = *cast(void**)chunk;
+        cstl_free(pool->parent, chunk, __POOL_CHUNK_SIZE(pool));
+        chunk = prev;
+    }
+    cstl_free(pool->parent, pool, sizeof(cstlPool));
+}
+
+void* pool_alloc(cstlPool* pool) {
+    CORETEN_ENFORCE_NN(pool, "Expected not null");
+
+    if(CORETEN_UNLIKELY(pool->free_list == null)) {
+        // Carve a new chunk into blocks, and thread them onto the free list (in address order)
+        Byte* chunk = cast(Byte*)cstl_alloc(pool->parent, __POOL_CHUNK_SIZE(pool));
+        *cast(void**)chunk = pool->chunks;
+        pool->chunks = chunk;
+
+        Byte* blocks = chunk + CORETEN_DEFAULT_ALIGN;
+        for(UInt64 i = 0; i < pool->blocks_per_chunk; i++) {
+            void* next = i + 1 < pool->blocks_per_chunk ? blocks + (i + 1) * pool->block_size : null;
+            *cast(void**)(blocks + i * pool->block_size) = next;
+        }
+        pool->free_list = blocks;
+    }
+
+    void* block = pool->free_list;
+    pool->free_list = *cast(void**)block;
+    pool->nblocks++;
+    memset(block, 0, pool->block_size);
+    return block;
+}
+
+void pool_release(cstlPool* pool, void* block) {
+    CORETEN_ENFORCE_NN(pool, "Expected not null");
+    if(block == null)
+        return;
+
+    *cast(void**)block = pool->free_list;
+    pool->free_list = block;
+    pool->nblocks--;
+}
+
+UInt32 tracking_size_bucket(UInt64 size) {
+    UInt32 bucket = 0;
+    while(size > (cast(UInt64)16 << bucket) && bucket < CORETEN_TRACKING_HISTOGRAM_BUCKETS - 1)
+        bucket++;
+    return bucket;
+}
+
+static void __tracking_add(cstlTrackingAllocator* tracker, UInt64 size) {
+    cstlTrackingPhase* phase = &tracker->phases[tracker->phase];
+    tracker->bytes_live += size;
+    tracker->bytes_total += size;
+    phase->bytes_total += size;
+    phase->histogram[tracking_size_bucket(size)]++;
+    if(tracker->limit > 0 && tracker->bytes_live > tracker->limit)
+        CORETEN_ENFORCE(false, "Memory limit exceeded");
+    if(tracker->bytes_live > tracker->bytes_peak)
+        tracker->bytes_peak = tracker->bytes_live;
+    if(tracker->bytes_live > phase->bytes_peak)
+        phase->bytes_peak = tracker->bytes_live;
+}
+
+static void* __tracking_allocator_alloc(void* user_data, UInt64 size, UInt64 align) {
+    cstlTrackingAllocator* tracker = cast(cstlTrackingAllocator*)user_data;
+    tracker->nallocs++;
+    tracker->phases[tracker->phase].nallocs++;
+    __tracking_add(tracker, size);
+    return cstl_alloc_aligned(tracker->parent, size, align);
+}
+
+static void* __tracking_allocator_realloc(void* user_data, void* ptr, UInt64 old_size, UInt64 new_size, 
+                                          UInt64 align) {
+    cstlTrackingAllocator* tracker = cast(cstlTrackingAllocator*)user_data;
+    tracker->nreallocs++;
+    tracker->phases[tracker->phase].nreallocs++;
+    tracker->bytes_live -= old_size;
+    __tracking_add(tracker, new_size);
+    return cstl_realloc(tracker->parent, ptr, old_size, new_size);
+}
+
+static void __tracking_allocator_free(void* user_data, void* ptr, UInt64 size) {
+    cstlTrackingAllocator* tracker = cast(cstlTrackingAllocator*)user_data;
+    tracker->nfrees++;
+    tracker->phases[tracker->phase].nfrees++;
+    tracker->bytes_live -= size;
+    cstl_free(tracker->parent, ptr, size);
+}
+
+cstlTrackingAllocator* tracking_allocator_new(cstlAllocator* parent, UInt64 limit) {
+    cstlTrackingAllocator* tracker = cast(cstlTrackingAllocator*)calloc(1, sizeof(cstlTrackingAllocator));
+    CORETEN_ENFORCE_NN(tracker, "Could not allocate memory. Memory full.");
+
+    tracker->allocator.alloc = __tracking_allocator_alloc;
+    tracker->allocator.realloc = __tracking_allocator_realloc;
+    tracker->allocator.free = __tracking_allocator_free;
+    tracker->allocator.user_data = tracker;
+    tracker->parent = parent;
+    tracker->limit = limit;
+    tracker->phases[0].name = "other";
+    tracker->nphases = 1;
+    return tracker;
+}
+
+void tracking_allocator_set_phase(cstlTrackingAllocator* tracker, const char* name) {
+    CORETEN_ENFORCE_NN(name, "Phase name cannot be null");
+    UInt32 index = 0;
+    while(index < tracker->nphases && strcmp(tracker->phases[index].name, name) != 0)
+        index++;
+
+    if(index == tracker->nphases) {
+        CORETEN_ENFORCE(index < CORETEN_TRACKING_MAX_PHASES, "Too many tracking phases");
+        tracker->phases[index].name = name;
+        tracker->nphases++;
+    }
+    tracker->phase = index;
+    if(tracker->bytes_live > tracker->phases[index].bytes_peak)
+        tracker->phases[index].bytes_peak = tracker->bytes_live;
+}
+
+void tracking_allocator_release_all(cstlTrackingAllocator* tracker) {
+    tracker->bytes_live = 0;
+}
+
+void tracking_allocator_report(cstlTrackingAllocator* tracker, FILE* out) {
+    fprintf(out, "Memory statistics:\n");
+    fprintf(out, "    %llu allocations, %llu reallocations, %llu frees\n", 
+            cast(unsigned long long)tracker->nallocs, cast(unsigned long long)tracker->nreallocs, 
+            cast(unsigned long long)tracker->nfrees);
+    fprintf(out, "    %llu bytes allocated, %llu bytes peak, %llu bytes live\n\n", 
+            cast(unsigned long long)tracker->bytes_total, cast(unsigned long long)tracker->bytes_peak, 
+            cast(unsigned long long)tracker->bytes_live);
+
+    UInt64 histogram[CORETEN_TRACKING_HISTOGRAM_BUCKETS] = {0};
+    fprintf(out, "    %-12s %10s %10s %10s %14s %14s\n", "phase", "allocs", "reallocs", "frees", "bytes", "peak");
+    for(UInt32 i = 0; i < tracker->nphases; i++) {
+        cstlTrackingPhase* phase = &tracker->phases[i];
+        for(UInt32 b = 0; b < CORETEN_TRACKING_HISTOGRAM_BUCKETS; b++)
+            histogram[b] += phase->histogram[b];
+        if(phase->nallocs == 0 && phase->nreallocs == 0 && phase->nfrees == 0)
+            continue;
+        fprintf(out, "    %-12s %10llu %10llu %10llu %14llu %14llu\n", phase->name, 
+                cast(unsigned long long)phase->nallocs, cast(unsigned long long)phase->nreallocs, 
+                cast(unsigned long long)phase->nfrees, cast(unsigned long long)phase->bytes_total, 
+                cast(unsigned long long)phase->bytes_peak);
+    }
+
+    fprintf(out, "\n    %-12s %10s\n", "size", "count");
+    for(UInt32 b = 0; b < CORETEN_TRACKING_HISTOGRAM_BUCKETS; b++) {
+        if(histogram[b] == 0)
+            continue;
+        char label[32];
+        if(b == CORETEN_TRACKING_HISTOGRAM_BUCKETS - 1)
+            snprintf(label, sizeof(label), "> %llu", cast(unsigned long long)(cast(UInt64)8 << b));
+        else
+            snprintf(label, sizeof(label), "<= %llu", cast(unsigned long long)(cast(UInt64)16 << b));
+        fprintf(out, "    %-12s %10llu\n", label, cast(unsigned long long)histogram[b]);
+    }
+}
+
+void tracking_allocator_free(cstlTrackingAllocator* tracker) {
+    free(tracker);
+}
+
+// Block sizes: multiples of 16 up to 128 bytes, then multiples of 64 up to `CORETEN_SLAB_MAX_SIZE`
+static const UInt16 __slab_class_sizes[CORETEN_SLAB_NUM_CLASSES] = {
+    16, 32, 48, 64, 80, 96, 112, 128, 192, 256, 320, 384, 448, 512
+};
+
+typedef struct __SlabClass {
+    cstlLock lock;      // only held for a few pointer swaps
+    void* free_list;    // each free block stores a pointer to the next one
+} __SlabClass;
+
+typedef struct __SlabCache {
+    void* head;
+    UInt32 count;
+} __SlabCache;
+
+static __SlabClass __slab_classes[CORETEN_SLAB_NUM_CLASSES];
+static CORETEN_THREAD_LOCAL __SlabCache __slab_caches[CORETEN_SLAB_NUM_CLASSES];
+static cstlLock __slab_pages_lock = CSTL_LOCK_INIT;
+static UInt64 __slab_npages;
+
+UInt32 slab_size_class(UInt64 size) {
+    CORETEN_ENFORCE(size <= CORETEN_SLAB_MAX_SIZE);
+    if(size <= 128)
+        return size == 0 ? 0 : cast(UInt32)((size + 15) / 16 - 1);
+    return cast(UInt32)(8 + (size - 128 + 63) / 64 - 1);
+}
+
+UInt64 slab_class_size(UInt32 cls) {
+    CORETEN_ENFORCE(cls < CORETEN_SLAB_NUM_CLASSES);
+    return __slab_class_sizes[cls];
+}
+
+UInt64 slab_reserved_bytes() {
+    lock_acquire(&__slab_pages_lock);
+    UInt64 bytes = __slab_npages * CORETEN_SLAB_PAGE_SIZE;
+    lock_release(&__slab_pages_lock);
+    return bytes;
+}
+
+// Fill the calling thread's cache for `cls` with a batch of blocks, from the shared free list or a new page
+static void __slab_refill(UInt32 cls) {
+    __SlabClass* sc = &__slab_classes[cls];
+    __SlabCache* cache = &__slab_caches[cls];
+    UInt64 block_size = __slab_class_sizes[cls];
+
+    lock_acquire(&sc->lock);
+    if(sc->free_list == null) {
+        Byte* page = cast(Byte*)malloc(CORETEN_SLAB_PAGE_SIZE);
+        CORETEN_ENFORCE_NN(page, "Could not allocate memory. Memory full.");
+
+        UInt64 nblocks = CORETEN_SLAB_PAGE_SIZE / block_size;
+        for(UInt64 i = 0; i < nblocks; i++)
+            *cast(void**)(page + i * block_size) = i + 1 < nblocks ? page + (i + 1) * block_size : null;
+        sc->free_list = page;
+
+        lock_acquire(&__slab_pages_lock);
+        __slab_npages++;
+        lock_release(&__slab_pages_lock);
+    }
+
+    // Move up to a batch of blocks over to the cache
+    void* last = sc->free_list;
+    UInt32 n = 1;
+    while(n < CORETEN_SLAB_BATCH && *cast(void**)last != null) {
+        last = *cast(void**)last;
+        n++;
+    }
+    void* batch = sc->free_list;
+    sc->free_list = *cast(void**)last;
+    lock_release(&sc->lock);
+
+    *cast(void**)last = cache->head;
+    cache->head = batch;
+    cache->count += n;
+}
+
+// Move `n` blocks from the calling thread's cache for `cls` back to the shared free list
+static void __slab_drain(UInt32 cls, UInt32 n) {
+    __SlabClass* sc = &__slab_classes[cls];
+    __SlabCache* cache = &__slab_caches[cls];
+    if(n == 0 || cache->head == null)
+        return;
+
+    void* first = cache->head;
+    void* last = first;
+    UInt32 moved = 1;
+    while(moved < n && *cast(void**)last != null) {
+        last = *cast(void**)last;
+        moved++;
+    }
+    cache->head = *cast(void**)last;
+    cache->count -= moved;
+
+    lock_acquire(&sc->lock);
+    *cast(void**)last = sc->free_list;
+    sc->free_list = first;
+    lock_release(&sc->lock);
+}
+
+void* slab_alloc(UInt64 size) {
+    if(CORETEN_UNLIKELY(size > CORETEN_SLAB_MAX_SIZE))
+        return cstl_alloc(null, size);
+
+    UInt32 cls = slab_size_class(size);
+    __SlabCache* cache = &__slab_caches[cls];
+    if(CORETEN_UNLIKELY(cache->head == null))
+        __slab_refill(cls);
+
+    void* block = cache->head;
+    cache->head = *cast(void**)block;
+    cache->count--;
+    memset(block, 0, size > sizeof(void*) ? size : sizeof(void*));
+    return block;
+}
+
+void slab_release(void* ptr, UInt64 size) {
+    if(ptr == null)
+        return;
+    if(CORETEN_UNLIKELY(size > CORETEN_SLAB_MAX_SIZE)) {
+        cstl_free(null, ptr, size);
+        return;
+    }
+
+    UInt32 cls = slab_size_class(size);
+    __SlabCache* cache = &__slab_caches[cls];
+    *cast(void**)ptr = cache->head;
+    cache->head = ptr;
+    cache->count++;
+
+    if(CORETEN_UNLIKELY(cache->count > CORETEN_SLAB_CACHE_SIZE))
+        __slab_drain(cls, CORETEN_SLAB_BATCH);
+}
+
+void slab_thread_flush() {
+    for(UInt32 cls = 0; cls < CORETEN_SLAB_NUM_CLASSES; cls++)
+        __slab_drain(cls, __slab_caches[cls].count);
+}
+
+static void* __slab_allocator_alloc(void* user_data, UInt64 size, UInt64 align) {
+    CORETEN_ENFORCE(align <= CORETEN_DEFAULT_ALIGN, "The slab allocator cannot satisfy this alignment");
+    return slab_alloc(size);
+}
+
+static void* __slab_allocator_realloc(void* user_data, void* ptr, UInt64 old_size, UInt64 new_size, UInt64 align) {
+    // Same block size: nothing to do
+    if(old_size <= CORETEN_SLAB_MAX_SIZE && new_size <= CORETEN_SLAB_MAX_SIZE && 
+       slab_size_class(old_size) == slab_size_class(new_size))
+        return ptr;
+    if(old_size > CORETEN_SLAB_MAX_SIZE && new_size > CORETEN_SLAB_MAX_SIZE)
+        return cstl_realloc(null, ptr, old_size, new_size);
+
+    void* newptr = slab_alloc(new_size);
+    memcpy(newptr, ptr, old_size < new_size ? old_size : new_size);
+    slab_release(ptr, old_size);
+    return newptr;
+}
+
+static void __slab_allocator_free(void* user_data, void* ptr, UInt64 size) {
+    slab_release(ptr, size);
+}
+
+static cstlAllocator __cstl_slab_allocator = { __slab_allocator_alloc, __slab_allocator_realloc, 
+                                                __slab_allocator_free, null };
+
+cstlAllocator* slab_allocator() {
+    return &__cstl_slab_allocator;
+}
+
+// -------------------------------------------------------------------------
+// os.h
+// -------------------------------------------------------------------------
+
+cstlBuffer* os_get_cwd() {
+#if defined(CORETEN_OS_WINDOWS)
+    // This (or its equivalent) is not defined in any include in Windows as far as I've come across
+    #define PATH_MAX 4096
+    char result[PATH_MAX];
+    _getcwd(result, PATH_MAX);
+    if(!*result) {
+        fprintf(stderr, "Unable to `os_get_cwd()`. 'getcwd()' failed");
+        exit(1);
+    }
+    cstlBuffer* buff = buff_new(result);
+    return buff;
+#elif defined(CORETEN_OS_POSIX)
+    long n;
+    char *buf;
+
+    n = pathconf(".", _PC_PATH_MAX);
+    CORETEN_ENFORCE(n != -1);
+    buf = cast(char*)calloc(n, sizeof(*buf));
+    CORETEN_ENFORCE_NN(buf, "calloc failed. Out of memory");
+    char* result = getcwd(buf, n);
+    if(!result) {
+        fprintf(stderr, "Unable to `os_get_cwd()`. 'getcwd()' failed");
+        exit(1);
+    }
+    cstlBuffer* buff = buff_new(buf);
+    return buff;
+#else
+    #error "No `os_get_cwd()` implementation supported for your platform."
+    return null;
+#endif // CORETEN_OS_WINDOWS
+}
+
+cstlBuffer* __os_dirname_basename(cstlBuffer* path, bool is_basename) {
+    UInt64 length = path->len;
+    if(!length)
+        return path;
+
+    cstlBuffer* result = buff_new(null);
+    char* end = buff_end(path);
+
+    // dirname
+    if(!is_basename) {
+        cstlBuffer* rev = buff_rev(path);
+
+        // The `/` or `\\` is not so important in getting the dirname, but it does interfere with `strchr`, so
+        // we skip over it (if present)
+        if(*rev->data == CORETEN_OS_SEP_CHAR)
+            rev->data++;
+        char* rev_dir = strchr(rev->data, CORETEN_OS_SEP_CHAR);
+        buff_set(result, rev_dir);
+        result = buff_rev(result);
+        buff_free(rev);
+    } 
+
+    // basename
+    else {
+        // If the last character is a `sep`, `basename` is empty
+        if(os_is_sep(*end))
+            return buff_new(null);
+        
+        // If there is no `sep` in `path`, `path` is the basename
+        if(!(strstr(path->data, "/") || strstr(path->data, "\\")))
+            return path;
+        
+        cstlBuffer* rev = buff_rev(path);
+        for(UInt64 i = 0; i<length; i++) {
+            if(os_is_sep(*(rev->data + i))) {
+                *(rev->data + i) = nullchar;
+                break;
+            }
+        }
+        buff_set(result, rev->data);
+        result = buff_rev(result);
+        buff_free(rev);
+    }
+    
+    return result;
+}
+
+cstlBuffer* os_path_dirname(cstlBuffer* path) {
+    return __os_dirname_basename(path, false);
+}
+
+cstlBuffer* os_path_basename(cstlBuffer* path) {
+    return __os_dirname_basename(path, true);
+}
+
+cstlBuffer* os_path_extname(cstlBuffer* path) {
+    cstlBuffer* basename = os_path_basename(path);
+    if(!strcmp(basename->data, ""))
+        return basename;
+    
+    char* ext = strchr(basename->data, '.');
+    if(!ext) {
+       free(basename);
+       return buff_new(null);
+    }
+
+    buff_set(basename, ext);
+    return basename;
+}
+
+cstlBuffer* os_path_join(cstlBuffer* path1, cstlBuffer* path2) {
+    UInt64 length = path1->len;
+    if(!length)
+        return path1;
+        
+    char* end = buff_end(path1);
+    if(!os_is_sep(*end))
+        buff_append_char(path1, CORETEN_OS_SEP_CHAR);
+    buff_append(path1, path2);
+    return path1;
+}
+
+bool os_is_sep(char ch) {
+#ifdef CORETEN_OS_WINDOWS
+    return ch == '\\' || ch == '/';
+#else
+    return ch == '/';
+#endif // CORETEN_OS_WINDOWS
+}
+
+bool os_path_is_abs(cstlBuffer* path) {
+    bool result = false;
+    CORETEN_ENFORCE_NN(path, "Cannot do anything useful on a null path :(");
+#ifdef CORETEN_OS_WINDOWS
+    // The 'C:\...`
+    result = path->len > 2 &&
+             char_is_alpha(path->data[0]) &&
+             (path->data[1] == ':' && path->data[2] == CORETEN_OS_SEP_CHAR);
+#else
+    result = path->len > 2 &&
+             path->data[0] == CORETEN_OS_SEP_CHAR;
+#endif // CORETEN_OS_WINDOWS
+    return cast(bool)result;
+}
+
+bool os_path_is_rel(cstlBuffer* path) {
+    return cast(bool) !os_path_is_abs(path);
+}
+
+bool os_path_is_root(cstlBuffer* path) {
+    bool result = false;
+    CORETEN_ENFORCE_NN(path, "Cannot do anything useful on a null path :(");
+#ifdef CORETEN_OS_WINDOWS
+    result = os_path_is_abs(path) && path->len == 3;
+#else
+    result = os_path_is_abs(path) && path->len == 1;
+#endif // CORETEN_OS_WINDOWS
+    return result;
+}
+
+bool os_is_dir(const char* path) {
+#ifdef CORETEN_OS_WINDOWS
+    DWORD attributes = GetFileAttributesA(path);
+    return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+    struct stat st;
+    return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+#endif // CORETEN_OS_WINDOWS
+}
+
+bool os_glob_match(const char* pattern, const char* name) {
+    // Iterative matching, backtracking to the last `*` on a mismatch
+    const char* star = null;
+    const char* star_name = null;
+    while(*name) {
+        bool matched = false;
+        const char* next = pattern + 1;
+        if(*pattern == '*') {
+            star = pattern++;
+            star_name = name;
+            continue;
+        } else if(*pattern == '?') {
+            matched = true;
+        } else if(*pattern == '[') {
+            const char* p = pattern + 1;
+            bool negate = *p == '!' || *p == '^';
+            if(negate)
+                p++;
+            bool in_class = false;
+            // A `]` right after the `[` is part of the class
+            const char* first = p;
+            while(*p && (*p != ']' || p == first)) {
+                if(p[1] == '-' && p[2] && p[2] != ']') {
+                    in_class |= *name >= p[0] && *name <= p[2];
+                    p += 3;
+                } else {
+                    in_class |= *name == *p;
+                    p++;
+                }
+            }
+            if(*p == ']') {
+                matched = in_class != negate;
+                next = p + 1;
+            } else {
+                // Unterminated: treat the `[` literally
+                matched = *name == '[';
+            }
+        } else {
+            matched = *pattern == *name;
+        }
+
+        if(matched && *pattern) {
+            pattern = next;
+            name++;
+        } else if(star) {
+            pattern = star + 1;
+            name = ++star_name;
+        } else {
+            return false;
+        }
+    }
+    while(*pattern == '*')
+        pattern++;
+    return *pattern == nullchar;
+}
+
+#if defined(CORETEN_OS_UNIX) || defined(CORETEN_OS_OSX)
+    #include <dirent.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #define __OS_WALK_POSIX     1
+    #if defined(CORETEN_OS_LINUX)
+        #include <sys/syscall.h>
+        #define __OS_WALK_GETDENTS  1
+    #endif // CORETEN_OS_LINUX
+#endif // CORETEN_OS_UNIX
+
+// A list of heap-allocated strings. The walker's tasks can't share the caller's allocator, so everything 
+// is on the default heap until the results are copied out
+typedef struct __OsWalkList {
+    char** items;
+    UInt64 n;
+    UInt64 capacity;
+} __OsWalkList;
+
+static void __os_walk_list_push(__OsWalkList* list, char* item) {
+    if(list->n == list->capacity) {
+        UInt64 capacity = list->capacity ? list->capacity * 2 : 16;
+        list->items = cast(char**)cstl_realloc(null, list->items, list->capacity * sizeof(char*), 
+                                               capacity * sizeof(char*));
+        list->capacity = capacity;
+    }
+    list->items[list->n++] = item;
+}
+
+static void __os_walk_list_free(__OsWalkList* list) {
+    cstl_free(null, list->items, list->capacity * sizeof(char*));
+}
+
+typedef struct __OsWalker {
+    const cstlDirWalkOptions* options;
+    __OsWalkList stack;         // directories waiting to be read (by a walk on the calling thread)
+    __OsWalkList files;
+    UInt64 ndirs;
+    cstlLock lock;              // guards `files` and `ndirs` during a parallel walk
+    cstlTaskGroup group;        // a parallel walk's tasks: one per directory
+} __OsWalker;
+
+typedef struct __OsWalkTask {
+    __OsWalker* walker;
+    char* dir;
+} __OsWalkTask;
+
+static char* __os_walk_join(const char* dir, UInt64 dirlen, const char* name) {
+    UInt64 namelen = strlen(name);
+    bool sep = dirlen > 0 && !os_is_sep(dir[dirlen - 1]);
+    char* path = cast(char*)cstl_alloc(null, dirlen + sep + namelen + 1);
+    memcpy(path, dir, dirlen);
+    if(sep)
+        path[dirlen] = CORETEN_OS_SEP_CHAR;
+    memcpy(path + dirlen + sep, name, namelen);
+    return path;
+}
+
+static bool __os_walk_any_match(const char* const* patterns, UInt32 n, const char* name) {
+    for(UInt32 i = 0; i < n; i++) {
+        if(os_glob_match(patterns[i], name))
+            return true;
+    }
+    return false;
+}
+
+// What a directory entry is. `__OsWalkUnknown` and `__OsWalkLink` need a `stat()` to find out
+enum { __OsWalkSkip, __OsWalkFile, __OsWalkDir, __OsWalkUnknown, __OsWalkLink };
+
+// Sort an entry into `dirs` or `files` (after filtering)
+static void __os_walk_entry(__OsWalker* walker, const char* dir, UInt64 dirlen, const char* name, int kind, 
+                            __OsWalkList* dirs, __OsWalkList* files) {
+    const cstlDirWalkOptions* options = walker->options;
+    if(name[0] == '.' && (name[1] == nullchar || (name[1] == '.' && name[2] == nullchar)))
+        return;
+    if(name[0] == '.' && !options->include_hidden)
+        return;
+    if(__os_walk_any_match(options->ignore, options->nignore, name))
+        return;
+
+    char* path = __os_walk_join(dir, dirlen, name);
+    if(kind == __OsWalkUnknown || kind == __OsWalkLink) {
+        // `d_type` isn't filled in by every filesystem. Symlinked directories aren't followed (they can form cycles)
+        struct stat st;
+        bool is_dir = false;
+        bool is_file = false;
+        if(stat(path, &st) == 0) {
+            is_dir = (st.st_mode & S_IFMT) == S_IFDIR;
+            is_file = (st.st_mode & S_IFMT) == S_IFREG;
+        }
+        kind = is_file ? __OsWalkFile : (is_dir && kind == __OsWalkUnknown) ? __OsWalkDir : __OsWalkSkip;
+    }
+
+    if(kind == __OsWalkDir) {
+        __os_walk_list_push(dirs, path);
+    } else if(kind == __OsWalkFile && (options->ninclude == 0 || 
+                                       __os_walk_any_match(options->include, options->ninclude, name))) {
+        __os_walk_list_push(files, path);
+    } else {
+        cstl_free(null, path, strlen(path) + 1);
+    }
+}
+
+// Read one directory. Returns 0 or an `errno`
+static int __os_walk_read_dir(__OsWalker* walker, const char* dir, __OsWalkList* dirs, __OsWalkList* files) {
+    UInt64 dirlen = strlen(dir);
+#if defined(__OS_WALK_GETDENTS)
+    int fd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(fd < 0)
+        return errno;
+
+    // Layout of the records returned by `getdents64()`
+    typedef struct {
+        UInt64 d_ino;
+        Int64 d_off;
+        unsigned short d_reclen;
+        unsigned char d_type;
+        char d_name[];
+    } __LinuxDirent64;
+
+    _Alignas(8) char buffer[KB_TO_BYTES(32)];
+    for(;;) {
+        long n = syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            break;
+        for(long offset = 0; offset < n;) {
+            __LinuxDirent64* entry = cast(__LinuxDirent64*)(buffer + offset);
+            offset += entry->d_reclen;
+            int kind = entry->d_type == DT_DIR ? __OsWalkDir : 
+                       entry->d_type == DT_REG ? __OsWalkFile : 
+                       entry->d_type == DT_LNK ? __OsWalkLink : 
+                       entry->d_type == DT_UNKNOWN ? __OsWalkUnknown : __OsWalkSkip;
+            __os_walk_entry(walker, dir, dirlen, entry->d_name, kind, dirs, files);
+        }
+    }
+    close(fd);
+    return 0;
+#elif defined(__OS_WALK_POSIX)
+    DIR* handle = opendir(dir);
+    if(!handle)
+        return errno;
+    struct dirent* entry;
+    while((entry = readdir(handle)) != null) {
+        int kind = __OsWalkUnknown;
+    #if defined(DT_DIR)
+        if(entry->d_type == DT_DIR)
+            kind = __OsWalkDir;
+        else if(entry->d_type == DT_REG)
+            kind = __OsWalkFile;
+        else if(entry->d_type == DT_LNK)
+            kind = __OsWalkLink;
+    #endif // DT_DIR
+        __os_walk_entry(walker, dir, dirlen, entry->d_name, kind, dirs, files);
+    }
+    closedir(handle);
+    return 0;
+#elif defined(CORETEN_OS_WINDOWS)
+    char* pattern = __os_walk_join(dir, dirlen, "*");
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA(pattern, &data);
+    cstl_free(null, pattern, strlen(pattern) + 1);
+    if(handle == INVALID_HANDLE_VALUE)
+        return ENOENT;
+    do {
+        int kind = (data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) ? __OsWalkSkip : 
+                   (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? __OsWalkDir : __OsWalkFile;
+        __os_walk_entry(walker, dir, dirlen, data.cFileName, kind, dirs, files);
+    } while(FindNextFileA(handle, &data));
+    FindClose(handle);
+    return 0;
+#else
+    #error "No `os_walk_dir()` implementation supported for your platform."
+#endif // __OS_WALK_GETDENTS
+}
+
+// Walk everything on `walker->stack`, on the calling thread
+static void __os_walk_serial(__OsWalker* walker) {
+    while(walker->stack.n > 0) {
+        char* dir = walker->stack.items[--walker->stack.n];
+        __os_walk_read_dir(walker, dir, &walker->stack, &walker->files);
+        cstl_free(null, dir, strlen(dir) + 1);
+        walker->ndirs++;
+    }
+}
+
+static void __os_walk_task(void* arg);
+
+static void __os_walk_submit(__OsWalker* walker, char* dir) {
+    __OsWalkTask* task = cstl_new_obj(null, __OsWalkTask);
+    task->walker = walker;
+    task->dir = dir;
+    task_group_submit(&walker->group, __os_walk_task, task);
+}
+
+// Read one directory, and submit a task for each of its subdirectories. From a worker, those go onto its own deque, 
+// so each worker walks its part of the tree depth-first while idle workers steal the shallower directories
+static void __os_walk_task(void* arg) {
+    __OsWalkTask* task = cast(__OsWalkTask*)arg;
+    __OsWalker* walker = task->walker;
+    char* dir = task->dir;
+    cstl_free_obj(null, task);
+
+    __OsWalkList dirs = {0};
+    __OsWalkList files = {0};
+    __os_walk_read_dir(walker, dir, &dirs, &files);
+    cstl_free(null, dir, strlen(dir) + 1);
+    for(UInt64 i = 0; i < dirs.n; i++)
+        __os_walk_submit(walker, dirs.items[i]);
+
+    lock_acquire(&walker->lock);
+    for(UInt64 i = 0; i < files.n; i++)
+        __os_walk_list_push(&walker->files, files.items[i]);
+    walker->ndirs++;
+    lock_release(&walker->lock);
+    __os_walk_list_free(&dirs);
+    __os_walk_list_free(&files);
+}
+
+static int __os_walk_compare(const void* a, const void* b) {
+    return strcmp(*cast(const char* const*)a, *cast(const char* const*)b);
+}
+
+cstlDirWalk* os_walk_dir(cstlAllocator* allocator, const char* root, const cstlDirWalkOptions* options) {
+    CORETEN_ENFORCE_NN(root, "Cannot walk a null path");
+    cstlDirWalkOptions defaults = {0};
+    __OsWalker walker = {0};
+    walker.options = options ? options : &defaults;
+
+    cstlDirWalk* walk = cstl_new_obj(allocator, cstlDirWalk);
+    walk->allocator = allocator;
+
+    // Read the root on this thread, to report errors and to give the other threads something to start on
+    __OsWalkList files = {0};
+    walk->error = __os_walk_read_dir(&walker, root, &walker.stack, &files);
+    walker.files = files;
+    walker.ndirs = walk->error ? 0 : 1;
+
+    // Without a thread pool (none of its workers could be started), the walk stays on this thread
+    cstlThreadPool* pool = walker.stack.n > 0 && walker.options->nthreads != 1 ? thread_pool_shared() : null;
+    if(walker.stack.n > 0 && pool == null) {
+        __os_walk_serial(&walker);
+    } else if(walker.stack.n > 0) {
+        // The calling thread helps out while it waits
+        task_group_init(&walker.group, pool);
+        for(UInt64 i = 0; i < walker.stack.n; i++)
+            __os_walk_submit(&walker, walker.stack.items[i]);
+        walker.stack.n = 0;
+        task_group_wait(&walker.group);
+    }
+
+    // Copy the results out (sorted) into `allocator`
+    if(walker.files.n > 0)
+        qsort(walker.files.items, walker.files.n, sizeof(char*), __os_walk_compare);
+    UInt64 size = 0;
+    for(UInt64 i = 0; i < walker.files.n; i++)
+        size += strlen(walker.files.items[i]) + 1;
+    walk->npaths = walker.files.n;
+    walk->ndirs = walker.ndirs;
+    walk->strings_size = size;
+    walk->strings = size ? cast(char*)cstl_alloc_aligned(allocator, size, 1) : null;
+    walk->paths = walk->npaths ? cast(char**)cstl_alloc(allocator, walk->npaths * sizeof(char*)) : null;
+    char* p = walk->strings;
+    for(UInt64 i = 0; i < walker.files.n; i++) {
+        UInt64 length = strlen(walker.files.items[i]) + 1;
+        memcpy(p, walker.files.items[i], length);
+        walk->paths[i] = p;
+        p += length;
+        cstl_free(null, walker.files.items[i], length);
+    }
+    __os_walk_list_free(&walker.files);
+    __os_walk_list_free(&walker.stack);
+    return walk;
+}
+
+void os_walk_free(cstlDirWalk* walk) {
+    if(walk == null)
+        return;
+    if(walk->strings)
+        cstl_free(walk->allocator, walk->strings, walk->strings_size);
+    if(walk->paths)
+        cstl_free(walk->allocator, walk->paths, walk->npaths * sizeof(char*));
+    cstl_free_obj(walk->allocator, walk);
+}
+
+// -------------------------------------------------------------------------
+// perf.c
+// -------------------------------------------------------------------------
+
+#if defined(CORETEN_OS_LINUX)
+    #include <errno.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <linux/perf_event.h>
+
+static long __perf_event_open(struct perf_event_attr* attr, int group_fd) {
+    // This thread, on any CPU
+    return syscall(SYS_perf_event_open, attr, 0, -1, group_fd, 0);
+}
+
+// The `perf_event_attr` type and config of every `cstlPerfEvent`
+static void __perf_event_config(cstlPerfEvent event, UInt32* type, UInt64* config) {
+    switch(event) {
+        case PerfCycles:
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PerfInstructions:
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PerfBranchMisses:
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case PerfL1DMisses:
+            *type = PERF_TYPE_HW_CACHE;
+            *config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | 
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        default:
+            // The generic "cache-misses" event is the last-level cache on most PMUs, and more widely supported than 
+            // the LL cache event
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+    }
+}
+
+static void __perf_counters_open(cstlPerfCounters* counters) {
+    int first_errno = 0;
+    cstlPerfEvent first_failed = PerfEventCount;
+    for(int i = 0; i < PerfEventCount; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        UInt32 type;
+        UInt64 config;
+        __perf_event_config(cast(cstlPerfEvent)i, &type, &config);
+        attr.type = type;
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // Only the leader is disabled: the whole group is enabled/disabled through it
+        attr.disabled = counters->leader < 0;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        long fd = __perf_event_open(&attr, counters->leader);
+        if(fd < 0) {
+            if(first_errno == 0) {
+                first_errno = errno;
+                first_failed = cast(cstlPerfEvent)i;
+            }
+            continue;
+        }
+        counters->fds[i] = cast(int)fd;
+        counters->opened |= PERF_EVENT_BIT(i);
+        if(counters->leader < 0)
+            counters->leader = cast(int)fd;
+    }
+    if(first_errno == 0)
+        return;
+
+    const char* event = perf_event_name(first_failed);
+    if(first_errno == EACCES || first_errno == EPERM) {
+        // Say what the sysctl is set to, since that is the usual culprit
+        int paranoid = 0;
+        FILE* file = fopen("/proc/sys/kernel/perf_event_paranoid", "r");
+        bool known = file && fscanf(file, "%d", &paranoid) == 1;
+        if(file)
+            fclose(file);
+        if(known)
+            snprintf(counters->error, sizeof(counters->error), 
+                     "%s: not permitted (kernel.perf_event_paranoid is %d; it must be 2 or lower, or grant "
+                     "CAP_PERFMON)", event, paranoid);
+        else
+            snprintf(counters->error, sizeof(counters->error), "%s: not permitted", event);
+    } else if(first_errno == ENOENT || first_errno == EOPNOTSUPP || first_errno == ENODEV) {
+        snprintf(counters->error, sizeof(counters->error), "%s: not supported on this machine", event);
+    } else if(first_errno == ENOSYS) {
+        snprintf(counters->error, sizeof(counters->error), "perf_event_open() is not available");
+    } else {
+        snprintf(counters->error, sizeof(counters->error), "%s: %s", event, strerror(first_errno));
+    }
+}
+#endif // CORETEN_OS_LINUX
+
+cstlPerfCounters* perf_counters_new(bool enable) {
+    cstlPerfCounters* counters = cstl_new_obj(null, cstlPerfCounters);
+    for(int i = 0; i < PerfEventCount; i++)
+        counters->fds[i] = -1;
+    counters->leader = -1;
+    if(!enable)
+        return counters;
+#if defined(CORETEN_OS_LINUX)
+    __perf_counters_open(counters);
+#else
+    snprintf(counters->error, sizeof(counters->error), "hardware counters are only supported on Linux");
+#endif // CORETEN_OS_LINUX
+    return counters;
+}
+
+void perf_counters_free(cstlPerfCounters* counters) {
+    if(counters == null)
+        return;
+#if defined(CORETEN_OS_LINUX)
+    // Members first, then the leader
+    for(int i = PerfEventCount - 1; i >= 0; i--) {
+        if(counters->fds[i] >= 0)
+            close(counters->fds[i]);
+    }
+#endif // CORETEN_OS_LINUX
+    cstl_free_obj(null, counters);
+}
+
+bool perf_counters_available(cstlPerfCounters* counters) {
+    return counters->opened != 0;
+}
+
+const char* perf_counters_error(cstlPerfCounters* counters) {
+    return counters->error;
+}
+
+void perf_counters_start(cstlPerfCounters* counters) {
+#if defined(CORETEN_OS_LINUX)
+    if(counters->leader >= 0) {
+        ioctl(counters->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(counters->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif // CORETEN_OS_LINUX
+    counters->start_ns = clock_now_ns();
+}
+
+void perf_counters_stop(cstlPerfCounters* counters, cstlPerfSample* sample) {
+    UInt64 end_ns = clock_now_ns();
+    memset(sample, 0, sizeof(*sample));
+    sample->wall_ns = end_ns - counters->start_ns;
+#if defined(CORETEN_OS_LINUX)
+    if(counters->leader < 0)
+        return;
+    ioctl(counters->leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // { nr, time_enabled, time_running, values[nr] }, with the values in the order the events were opened
+    UInt64 data[3 + PerfEventCount];
+    ssize_t size = read(counters->leader, data, sizeof(data));
+    if(size < cast(ssize_t)(3 * sizeof(UInt64)) || data[2] == 0)
+        // The group never got onto the PMU (too many other users), so there is nothing to report
+        return;
+    double scale = data[2] < data[1] ? cast(double)data[1] / cast(double)data[2] : 1.0;
+    UInt64 index = 0;
+    for(int i = 0; i < PerfEventCount && index < data[0]; i++) {
+        if(!(counters->opened & PERF_EVENT_BIT(i)))
+            continue;
+        sample->values[i] = cast(UInt64)(cast(double)data[3 + index] * scale);
+        sample->valid |= PERF_EVENT_BIT(i);
+        index++;
+    }
+#endif // CORETEN_OS_LINUX
+}
+
+const char* perf_event_name(cstlPerfEvent event) {
+    switch(event) {
+        case PerfCycles:        return "cycles";
+        case PerfInstructions:  return "instructions";
+        case PerfBranchMisses:  return "branch-misses";
+        case PerfL1DMisses:     return "L1d-misses";
+        case PerfLLCMisses:     return "LLC-misses";
+        default:                return "unknown";
+    }
+}
+
+// -------------------------------------------------------------------------
+// profile.c
+// -------------------------------------------------------------------------
+
+bool __profile_enabled = false;
+
+// The spans of one thread. Only that thread writes to it
+typedef struct __ProfileThread {
+    cstlProfileSpan* spans;
+    UInt64 nspans;
+    UInt64 capacity;
+    UInt64 open[PROFILE_MAX_DEPTH];     // indices (in `spans`) of the spans that haven't ended yet
+    UInt32 depth;
+    UInt32 tid;
+    cstlArena* details;
+    struct __ProfileThread* next;
+} __ProfileThread;
+
+static CORETEN_THREAD_LOCAL __ProfileThread* __profile_thread = null;
+// Every thread that has recorded anything. Threads are never removed (their spans are needed for the output)
+static __ProfileThread* __profile_threads = null;
+static UInt32 __profile_nthreads = 0;
+static cstlLock __profile_lock = CSTL_LOCK_INIT;
+
+static __ProfileThread* __profile_get_thread() {
+    if(CORETEN_LIKELY(__profile_thread != null))
+        return __profile_thread;
+
+    __ProfileThread* thread = cstl_new_obj(null, __ProfileThread);
+    thread->details = arena_new(0);
+    lock_acquire(&__profile_lock);
+    thread->tid = ++__profile_nthreads;
+    thread->next = __profile_threads;
+    __profile_threads = thread;
+    lock_release(&__profile_lock);
+    __profile_thread = thread;
+    return thread;
+}
+
+void profile_enable(bool enable) {
+    __profile_enabled = enable;
+}
+
+void profile_reset() {
+    lock_acquire(&__profile_lock);
+    for(__ProfileThread* thread = __profile_threads; thread; thread = thread->next) {
+        thread->nspans = 0;
+        thread->depth = 0;
+        arena_reset(thread->details);
+    }
+    lock_release(&__profile_lock);
+}
+
+void __profile_begin(const char* name, const char* detail) {
+    __ProfileThread* thread = __profile_get_thread();
+    CORETEN_ENFORCE(thread->depth < PROFILE_MAX_DEPTH, "Profile spans are nested too deeply");
+    if(thread->nspans == thread->capacity) {
+        UInt64 capacity = thread->capacity ? thread->capacity * 2 : 1024;
+        thread->spans = cast(cstlProfileSpan*)cstl_realloc(null, thread->spans, 
+                                                           thread->capacity * sizeof(cstlProfileSpan), 
+                                                           capacity * sizeof(cstlProfileSpan));
+        thread->capacity = capacity;
+    }
+
+    cstlProfileSpan* span = &thread->spans[thread->nspans];
+    span->name = name;
+    span->detail = detail ? arena_strndup(thread->details, detail, strlen(detail)) : null;
+    span->child_ns = 0;
+    span->depth = thread->depth;
+    span->end_ns = 0;
+    thread->open[thread->depth++] = thread->nspans++;
+    // Read the clock last, so the bookkeeping above isn't counted
+    span->start_ns = clock_now_ns();
+}
+
+void __profile_end() {
+    UInt64 end = clock_now_ns();
+    __ProfileThread* thread = __profile_thread;
+    // The profiler may have been enabled inside the span
+    if(thread == null || thread->depth == 0)
+        return;
+
+    cstlProfileSpan* span = &thread->spans[thread->open[--thread->depth]];
+    span->end_ns = end;
+    if(thread->depth > 0)
+        thread->spans[thread->open[thread->depth - 1]].child_ns += end - span->start_ns;
+}
+
+UInt64 profile_span_count() {
+    UInt64 count = 0;
+    for(__ProfileThread* thread = __profile_threads; thread; thread = thread->next)
+        count += thread->nspans;
+    return count;
+}
+
+// Write `str` as a JSON string
+static void __profile_write_json_str(cstlWriter* writer, const char* str) {
+    writer_char(writer, '"');
+    for(; *str; str++) {
+        unsigned char ch = cast(unsigned char)*str;
+        if(ch == '"' || ch == '\\') {
+            writer_char(writer, '\\');
+            writer_char(writer, cast(char)ch);
+        } else if(ch < 0x20) {
+            writer_printf(writer, "\\u%04x", ch);
+        } else {
+            writer_char(writer, cast(char)ch);
+        }
+    }
+    writer_char(writer, '"');
+}
+
+// Microseconds, with nanosecond precision
+static void __profile_write_us(cstlWriter* writer, UInt64 ns) {
+    writer_u64(writer, ns / 1000);
+    writer_char(writer, '.');
+    UInt64 frac = ns % 1000;
+    writer_char(writer, cast(char)('0' + frac / 100));
+    writer_char(writer, cast(char)('0' + frac / 10 % 10));
+    writer_char(writer, cast(char)('0' + frac % 10));
+}
+
+void profile_write_chrome_trace(FILE* out) {
+    // Timestamps are relative to the first span
+    UInt64 origin = cast(UInt64)-1;
+    for(__ProfileThread* thread = __profile_threads; thread; thread = thread->next) {
+        for(UInt64 i = 0; i < thread->nspans; i++)
+            origin = thread->spans[i].start_ns < origin ? thread->spans[i].start_ns : origin;
+    }
+
+    cstlWriter* writer = writer_new_file(null, out, 0);
+    UInt64 now_ns = clock_now_ns();
+    bool first = true;
+    writer_str(writer, "{\"traceEvents\":[\n");
+    for(__ProfileThread* thread = __profile_threads; thread; thread = thread->next) {
+        writer_str(writer, first ? "" : ",\n");
+        first = false;
+        writer_printf(writer, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                              "\"args\":{\"name\":\"thread %u\"}}", thread->tid, thread->tid);
+
+        for(UInt64 i = 0; i < thread->nspans; i++) {
+            cstlProfileSpan* span = &thread->spans[i];
+            // Spans still open are cut off at the time of writing
+            UInt64 end = span->end_ns ? span->end_ns : now_ns;
+            writer_str(writer, ",\n{\"name\":");
+            __profile_write_json_str(writer, span->name);
+            writer_str(writer, ",\"cat\":\"phase\",\"ph\":\"X\",\"ts\":");
+            __profile_write_us(writer, span->start_ns - origin);
+            writer_str(writer, ",\"dur\":");
+            __profile_write_us(writer, end - span->start_ns);
+            writer_str(writer, ",\"pid\":1,\"tid\":");
+            writer_u64(writer, thread->tid);
+            if(span->detail) {
+                writer_str(writer, ",\"args\":{\"detail\":");
+                __profile_write_json_str(writer, span->detail);
+                writer_char(writer, '}');
+            }
+            writer_char(writer, '}');
+        }
+    }
+    writer_str(writer, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    writer_free(writer);
+}
+
+typedef struct __ProfileTotal {
+    const char* name;
+    UInt64 count;
+    UInt64 total_ns;
+    UInt64 self_ns;
+} __ProfileTotal;
+
+static int __profile_compare_totals(const void* a, const void* b) {
+    UInt64 x = (cast(const __ProfileTotal*)a)->total_ns;
+    UInt64 y = (cast(const __ProfileTotal*)b)->total_ns;
+    return x < y ? 1 : (x > y ? -1 : 0);
+}
+
+void profile_write_summary(FILE* out) {
+    // Spans are grouped by name (not by pointer: the same literal may have several copies)
+    cstlHashMap* index = hashmap_new_str(UInt64, 0);
+    __ProfileTotal* totals = null;
+    UInt64 ntotals = 0;
+    UInt64 now_ns = clock_now_ns();
+    for(__ProfileThread* thread = __profile_threads; thread; thread = thread->next) {
+        for(UInt64 i = 0; i < thread->nspans; i++) {
+            cstlProfileSpan* span = &thread->spans[i];
+            bool inserted;
+            UInt64* slot = cast(UInt64*)hashmap_get_or_insert(index, &span->name, &inserted);
+            if(inserted) {
+                totals = cast(__ProfileTotal*)cstl_realloc(null, totals, ntotals * sizeof(__ProfileTotal), 
+                                                           (ntotals + 1) * sizeof(__ProfileTotal));
+                __ProfileTotal zero = {span->name, 0, 0, 0};
+                totals[ntotals] = zero;
+                *slot = ntotals++;
+            }
+            __ProfileTotal* total = &totals[*slot];
+            UInt64 duration = (span->end_ns ? span->end_ns : now_ns) - span->start_ns;
+            total->count++;
+            total->total_ns += duration;
+            total->self_ns += duration > span->child_ns ? duration - span->child_ns : 0;
+        }
+    }
+    if(ntotals > 0)
+        qsort(totals, ntotals, sizeof(__ProfileTotal), __profile_compare_totals);
+
+    cstlWriter* writer = writer_new_file(null, out, 0);
+    writer_printf(writer, "Time profile (%llu spans):\n", cast(unsigned long long)profile_span_count());
+    writer_printf(writer, "    %-24s %10s %14s %14s %14s\n", "span", "count", "total (ms)", "self (ms)", "avg (ms)");
+    for(UInt64 i = 0; i < ntotals; i++) {
+        __ProfileTotal* total = &totals[i];
+        writer_printf(writer, "    %-24s %10llu %14.3f %14.3f %14.3f\n", total->name, 
+                      cast(unsigned long long)total->count, cast(double)total->total_ns / 1e6, 
+                      cast(double)total->self_ns / 1e6, cast(double)total->total_ns / 1e6 / cast(double)total->count);
+    }
+    writer_free(writer);
+
+    cstl_free(null, totals, ntotals * sizeof(__ProfileTotal));
+    hashmap_free(index);
+}
+
+// -------------------------------------------------------------------------
+// simd.c
+// -------------------------------------------------------------------------
+
+#if defined(CORETEN_CPU_DISPATCH_X86)
+    #include <immintrin.h>
+#elif defined(CORETEN_SIMD_NEON)
+    #include <arm_neon.h>
+#endif // CORETEN_CPU_DISPATCH_X86
+
+// Returns the length of a null-terminated string, one machine word at a time
+// Note: The implementation for this was taken from:
+// https://github.com/lattera/glibc/blob/master/string/strlen.c
+// All due credit for this goes to the rightful author.
+UInt64 __simd_strlen_scalar(const char* str) {
+    const char* char_ptr;
+    const unsigned long int* longword_ptr;
+    unsigned long int longword, himagic, lomagic;
+
+    // Handle the first few characters by reading one character at a time.
+    // Do this until CHAR_PTR is aligned on a longword boundary.
+    for(char_ptr = str; (cast(UIntptr)char_ptr & (sizeof(longword) - 1)) != 0; ++char_ptr) {
+        if (*char_ptr == nullchar)
+            return char_ptr - str;
+    }
+
+    // All these elucidatory comments refer to 4-byte longwords, but the theory applies equally 
+    // well to 8-byte longwords
+    longword_ptr = cast(unsigned long int*)char_ptr;
+
+    // Bits 31, 24, 16, and 8 of this number are zero. Call these bits the "holes".
+    // Note that there is a hole just to the left of each byte, with an extra at the end:
+    //     bits:  01111110 11111110 11111110 11111111
+    //     bytes: AAAAAAAA BBBBBBBB CCCCCCCC DDDDDDDD
+    // The 1-bits make sure that carries propagate to the next 0-bit.
+    // The 0-bits provide holes forcarries to fall into.
+    himagic = 0x80808080L;
+    lomagic = 0x01010101L;
+
+    if(sizeof(longword) > 4) {
+        // 64-bit version of the magic.
+        // Do the shift in two steps to avoid a warning if long has 32 bits.
+        himagic = ((himagic << 16) << 16) | himagic;
+        lomagic = ((lomagic << 16) << 16) | lomagic;
+    }
+    if(sizeof(longword) > 8)
+        abort();
+
+    // Instead of the traditional loop which tests each character, we will test a longword at a time.
+    // The tricky part is testing if *any of the four* bytes in the longword in question are zero.
+    for(;;) {
+        longword = *longword_ptr++;
+
+        if (((longword - lomagic) & ~longword & himagic) != 0) {
+            // Which of the bytes was the zero?  If none of them were, it was a misfire; continue the search.
+            const char* cp = cast(const char* )(longword_ptr - 1);
+
+            if (cp[0] == 0)
+                return cp - str;
+            if (cp[1] == 0)
+                return cp - str + 1;
+            if (cp[2] == 0)
+                return cp - str + 2;
+            if (cp[3] == 0)
+                return cp - str + 3;
+
+            if (sizeof(longword) > 4) {
+                if (cp[4] == 0)
+                    return cp - str + 4;
+                if (cp[5] == 0)
+                    return cp - str + 5;
+                if (cp[6] == 0)
+                    return cp - str + 6;
+                if (cp[7] == 0)
+                    return cp - str + 7;
+            }
+        }
+    }
+}
+
+const char* __simd_memchr_scalar(const char* str, char ch, UInt64 n) {
+    for(UInt64 i = 0; i < n; i++) {
+        if(str[i] == ch)
+            return str + i;
+    }
+    return null;
+}
+
+bool __simd_memeq_scalar(const char* s1, const char* s2, UInt64 n) {
+    for(UInt64 i = 0; i < n; i++) {
+        if(s1[i] != s2[i])
+            return false;
+    }
+    return true;
+}
+
+int __simd_memcmp_scalar(const char* s1, const char* s2, UInt64 n) {
+    const unsigned char* p1 = cast(const unsigned char*)s1;
+    const unsigned char* p2 = cast(const unsigned char*)s2;
+    for(UInt64 i = 0; i < n; i++) {
+        if(p1[i] != p2[i])
+            return cast(int)p1[i] - cast(int)p2[i];
+    }
+    return 0;
+}
+
+int __simd_memcmp_nocase_scalar(const char* s1, const char* s2, UInt64 n) {
+    const unsigned char* p1 = cast(const unsigned char*)s1;
+    const unsigned char* p2 = cast(const unsigned char*)s2;
+    for(UInt64 i = 0; i < n; i++) {
+        int c1 = cast(unsigned char)char_to_lower(p1[i]);
+        int c2 = cast(unsigned char)char_to_lower(p2[i]);
+        if(c1 != c2)
+            return c1 - c2;
+    }
+    return 0;
+}
+
+void __simd_tolower_scalar(char* dest, const char* src, UInt64 n) {
+    for(UInt64 i = 0; i < n; i++)
+        dest[i] = char_to_lower(src[i]);
+}
+
+void __simd_toupper_scalar(char* dest, const char* src, UInt64 n) {
+    for(UInt64 i = 0; i < n; i++)
+        dest[i] = char_to_upper(src[i]);
+}
+
+// Checks `str` against the UTF-8 grammar (RFC 3629), one codepoint at a time
+bool __simd_utf8_validate_scalar(const char* str, UInt64 n) {
+    const UInt8* s = cast(const UInt8*)str;
+    UInt64 i = 0;
+    while(i < n) {
+        UInt8 c = s[i];
+        if(c < 0x80) {
+            i++;
+            continue;
+        }
+
+        // Number of continuation bytes, and the allowed range of the first one (this rules out overlong 
+        // encodings, surrogates and codepoints beyond U+10FFFF)
+        UInt64 nconts;
+        UInt8 lo = 0x80, hi = 0xBF;
+        if(c >= 0xC2 && c <= 0xDF)
+            nconts = 1;
+        else if(c >= 0xE0 && c <= 0xEF)
+            nconts = 2;
+        else if(c >= 0xF0 && c <= 0xF4)
+            nconts = 3;
+        else
+            return false;
+
+        if(c == 0xE0)
+            lo = 0xA0;
+        else if(c == 0xED)
+            hi = 0x9F;
+        else if(c == 0xF0)
+            lo = 0x90;
+        else if(c == 0xF4)
+            hi = 0x8F;
+
+        if(n - i <= nconts)
+            return false;
+        if(s[i + 1] < lo || s[i + 1] > hi)
+            return false;
+        for(UInt64 k = 2; k <= nconts; k++) {
+            if((s[i + k] & 0xC0) != 0x80)
+                return false;
+        }
+        i += nconts + 1;
+    }
+    return true;
+}
+
+// Every byte that is not a continuation byte (10xxxxxx) starts a new codepoint
+UInt64 __simd_utf8_count_scalar(const char* str, UInt64 n) {
+    UInt64 count = 0;
+    for(UInt64 i = 0; i < n; i++)
+        count += (cast(UInt8)str[i] & 0xC0) != 0x80;
+    return count;
+}
+
+
+#if defined(CORETEN_CPU_DISPATCH_X86) || \
+    (defined(CORETEN_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64)))
+/*
+    Lookup-table UTF-8 validation, from "Validating UTF-8 In Less Than One Instruction Per Byte" (John Keiser, 
+    Daniel Lemire). Each byte is classified by the high nibble of the previous byte, the low nibble of the previous 
+    byte and its own high nibble. ANDing the three table entries leaves a bit set only if that pair of bytes is an 
+    error. 3 and 4-byte sequences are then checked by requiring continuation bytes 2 and 3 positions after a lead.
+*/
+#define __UTF8_TOO_SHORT        (1 << 0)    // 11______ 0_______ or 11______ 11______
+#define __UTF8_TOO_LONG         (1 << 1)    // 0_______ 10______
+#define __UTF8_OVERLONG_3       (1 << 2)    // 11100000 100_____
+#define __UTF8_TOO_LARGE        (1 << 3)    // 11110100 1001____, 11110101+ 10______
+#define __UTF8_SURROGATE        (1 << 4)    // 11101101 101_____
+#define __UTF8_OVERLONG_2       (1 << 5)    // 1100000_ 10______
+#define __UTF8_TOO_LARGE_1000   (1 << 6)    // 11110101+ 1000____
+#define __UTF8_OVERLONG_4       (1 << 6)    // 11110000 1000____
+#define __UTF8_TWO_CONTS        (1 << 7)    // 10______ 10______
+#define __UTF8_CARRY            (__UTF8_TOO_SHORT | __UTF8_TOO_LONG | __UTF8_TWO_CONTS)
+
+static const UInt8 __utf8_byte1_high[16] = {
+    // 0_______ (ASCII)
+    __UTF8_TOO_LONG, __UTF8_TOO_LONG, __UTF8_TOO_LONG, __UTF8_TOO_LONG,
+    __UTF8_TOO_LONG, __UTF8_TOO_LONG, __UTF8_TOO_LONG, __UTF8_TOO_LONG,
+    // 10______ (continuation)
+    __UTF8_TWO_CONTS, __UTF8_TWO_CONTS, __UTF8_TWO_CONTS, __UTF8_TWO_CONTS,
+    // 1100____, 1101____ (2-byte lead)
+    __UTF8_TOO_SHORT | __UTF8_OVERLONG_2,
+    __UTF8_TOO_SHORT,
+    // 1110____ (3-byte lead)
+    __UTF8_TOO_SHORT | __UTF8_OVERLONG_3 | __UTF8_SURROGATE,
+    // 1111____ (4-byte lead)
+    __UTF8_TOO_SHORT | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000 | __UTF8_OVERLONG_4
+};
+
+static const UInt8 __utf8_byte1_low[16] = {
+    // ____0000
+    __UTF8_CARRY | __UTF8_OVERLONG_3 | __UTF8_OVERLONG_2 | __UTF8_OVERLONG_4,
+    // ____0001
+    __UTF8_CARRY | __UTF8_OVERLONG_2,
+    // ____001_
+    __UTF8_CARRY,
+    __UTF8_CARRY,
+    // ____0100
+    __UTF8_CARRY | __UTF8_TOO_LARGE,
+    // ____0101 - ____1100
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    // ____1101
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000 | __UTF8_SURROGATE,
+    // ____111_
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000,
+    __UTF8_CARRY | __UTF8_TOO_LARGE | __UTF8_TOO_LARGE_1000
+};
+
+static const UInt8 __utf8_byte2_high[16] = {
+    // 0_______ (ASCII)
+    __UTF8_TOO_SHORT, __UTF8_TOO_SHORT, __UTF8_TOO_SHORT, __UTF8_TOO_SHORT,
+    __UTF8_TOO_SHORT, __UTF8_TOO_SHORT, __UTF8_TOO_SHORT, __UTF8_TOO_SHORT,
+    // 1000____
+    __UTF8_TOO_LONG | __UTF8_OVERLONG_2 | __UTF8_TWO_CONTS | __UTF8_OVERLONG_3 | __UTF8_TOO_LARGE_1000 | __UTF8_OVERLONG_4,
+    // 1001____
+    __UTF8_TOO_LONG | __UTF8_OVERLONG_2 | __UTF8_TWO_CONTS | __UTF8_OVERLONG_3 | __UTF8_TOO_LARGE,
+    // 101_____
+    __UTF8_TOO_LONG | __UTF8_OVERLONG_2 | __UTF8_TWO_CONTS | __UTF8_SURROGATE | __UTF8_TOO_LARGE,
+    __UTF8_TOO_LONG | __UTF8_OVERLONG_2 | __UTF8_TWO_CONTS | __UTF8_SURROGATE | __UTF8_TOO_LARGE,
+    // 11______ (lead)
+    __UTF8_TOO_SHORT, __UTF8_TOO_SHORT, __UTF8_TOO_SHORT, __UTF8_TOO_SHORT
+};
+
+// A block that ends in a lead byte (in the last 1, 2 or 3 positions) needs continuation bytes from the next block
+static const UInt8 __utf8_incomplete_max[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+};
+
+#endif // CORETEN_CPU_DISPATCH_X86 || CORETEN_SIMD_NEON
+
+/*
+    The vectorized kernels are written once (in simd_kernels.h) and instantiated below for every instruction set 
+    the target could have: SSE2, SSSE3 (which adds the byte shuffle the UTF-8 validator needs), AVX2 and 
+    AVX-512BW on x86, and NEON on ARM when the compiler targets it. `__simd_dispatch()` then picks the fastest 
+    one the CPU supports, kernel by kernel.
+*/
+#if defined(CORETEN_CPU_DISPATCH_X86)
+    static inline CORETEN_TARGET("sse2") __m128i __simd_case_flip_sse2(__m128i v, char lo) {
+        // Shift the range [lo, lo+26) down to [-128, -102) so a single signed compare does the range check
+        __m128i t  = _mm_add_epi8(v, _mm_set1_epi8(cast(char)(128 - lo)));
+        __m128i in = _mm_cmplt_epi8(t, _mm_set1_epi8(-128 + 26));
+        return _mm_xor_si128(v, _mm_and_si128(in, _mm_set1_epi8(0x20)));
+    }
+
+    static inline CORETEN_TARGET("avx2") __m256i __simd_case_flip_avx2(__m256i v, char lo) {
+        __m256i t  = _mm256_add_epi8(v, _mm256_set1_epi8(cast(char)(128 - lo)));
+        __m256i in = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), t);
+        return _mm256_xor_si256(v, _mm256_and_si256(in, _mm256_set1_epi8(0x20)));
+    }
+
+    static inline CORETEN_TARGET("avx512f,avx512bw") __m512i __simd_case_flip_avx512(__m512i v, char lo) {
+        __m512i t = _mm512_add_epi8(v, _mm512_set1_epi8(cast(char)(128 - lo)));
+        __mmask64 in = _mm512_cmplt_epi8_mask(t, _mm512_set1_epi8(-128 + 26));
+        return _mm512_xor_si512(v, _mm512_maskz_mov_epi8(in, _mm512_set1_epi8(0x20)));
+    }
+
+    // SSE2
+    #define __SIMD_ISA                  sse2
+    #define __SIMD_TARGET               CORETEN_TARGET("sse2")
+    #define __SIMD_VEC                  __m128i
+    #define __SIMD_LOADU(p)             _mm_loadu_si128(cast(const __m128i*)(p))
+    #define __SIMD_LOADA(p)             _mm_load_si128(cast(const __m128i*)(p))
+    #define __SIMD_STOREU(p, v)         _mm_storeu_si128(cast(__m128i*)(p), v)
+    #define __SIMD_SPLAT(c)             _mm_set1_epi8(cast(char)(c))
+    #define __SIMD_EQMASK(a, b)         cast(UInt64)cast(UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))
+    #define __SIMD_LEADMASK(v)          \
+        cast(UInt64)cast(UInt32)_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8(-65)))
+    #define __SIMD_BPB                  1
+    #define __SIMD_FULLMASK             0xFFFFULL
+    #define __SIMD_CASE_FLIP            __simd_case_flip_sse2
+    #define __SIMD_ANY_HIGHBIT(v)       (_mm_movemask_epi8(v) != 0)
+    #include <adorad/core/simd_kernels.h>
+
+    // SSSE3: SSE2, plus the lookup-table UTF-8 validator
+    #define __SIMD_ISA                  ssse3
+    #define __SIMD_TARGET               CORETEN_TARGET("ssse3")
+    #define __SIMD_VEC                  __m128i
+    #define __SIMD_LOADU(p)             _mm_loadu_si128(cast(const __m128i*)(p))
+    #define __SIMD_LOADA(p)             _mm_load_si128(cast(const __m128i*)(p))
+    #define __SIMD_STOREU(p, v)         _mm_storeu_si128(cast(__m128i*)(p), v)
+    #define __SIMD_SPLAT(c)             _mm_set1_epi8(cast(char)(c))
+    #define __SIMD_EQMASK(a, b)         cast(UInt64)cast(UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))
+    #define __SIMD_LEADMASK(v)          \
+        cast(UInt64)cast(UInt32)_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8(-65)))
+    #define __SIMD_BPB                  1
+    #define __SIMD_FULLMASK             0xFFFFULL
+    #define __SIMD_CASE_FLIP            __simd_case_flip_sse2
+    #define __SIMD_ANY_HIGHBIT(v)       (_mm_movemask_epi8(v) != 0)
+    #define __SIMD_HAS_LOOKUP           1
+    #define __SIMD_AND(a, b)            _mm_and_si128(a, b)
+    #define __SIMD_OR(a, b)             _mm_or_si128(a, b)
+    #define __SIMD_XOR(a, b)            _mm_xor_si128(a, b)
+    #define __SIMD_SUBS_U8(a, b)        _mm_subs_epu8(a, b)
+    #define __SIMD_SHR4(v)              _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F))
+    #define __SIMD_TABLE16(p)           _mm_loadu_si128(cast(const __m128i*)(p))
+    #define __SIMD_LOOKUP16(t, idx)     _mm_shuffle_epi8(t, idx)
+    #define __SIMD_PREV(cur, prev, N)   _mm_alignr_epi8(cur, prev, 16 - (N))
+    #define __SIMD_ANY(v)               (_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0xFFFF)
+    #include <adorad/core/simd_kernels.h>
+
+    // AVX2
+    #define __SIMD_ISA                  avx2
+    #define __SIMD_TARGET               CORETEN_TARGET("avx2")
+    #define __SIMD_VEC                  __m256i
+    #define __SIMD_LOADU(p)             _mm256_loadu_si256(cast(const __m256i*)(p))
+    #define __SIMD_LOADA(p)             _mm256_load_si256(cast(const __m256i*)(p))
+    #define __SIMD_STOREU(p, v)         _mm256_storeu_si256(cast(__m256i*)(p), v)
+    #define __SIMD_SPLAT(c)             _mm256_set1_epi8(cast(char)(c))
+    #define __SIMD_EQMASK(a, b)         cast(UInt64)cast(UInt32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))
+    #define __SIMD_LEADMASK(v)          \
+        cast(UInt64)cast(UInt32)_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(-65)))
+    #define __SIMD_BPB                  1
+    #define __SIMD_FULLMASK             0xFFFFFFFFULL
+    #define __SIMD_CASE_FLIP            __simd_case_flip_avx2
+    #define __SIMD_ANY_HIGHBIT(v)       (_mm256_movemask_epi8(v) != 0)
+    #define __SIMD_HAS_LOOKUP           1
+    #define __SIMD_AND(a, b)            _mm256_and_si256(a, b)
+    #define __SIMD_OR(a, b)             _mm256_or_si256(a, b)
+    #define __SIMD_XOR(a, b)            _mm256_xor_si256(a, b)
+    #define __SIMD_SUBS_U8(a, b)        _mm256_subs_epu8(a, b)
+    #define __SIMD_SHR4(v)              _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F))
+    #define __SIMD_TABLE16(p)           _mm256_broadcastsi128_si256(_mm_loadu_si128(cast(const __m128i*)(p)))
+    #define __SIMD_LOOKUP16(t, idx)     _mm256_shuffle_epi8(t, idx)
+    // The last `N` bytes of `prev` followed by the first `32 - N` bytes of `cur`
+    #define __SIMD_PREV(cur, prev, N)   _mm256_alignr_epi8(cur, _mm256_permute2x128_si256(prev, cur, 0x21), 16 - (N))
+    #define __SIMD_ANY(v)               (!_mm256_testz_si256(v, v))
+    #include <adorad/core/simd_kernels.h>
+
+    // AVX-512BW. Compares produce bitmasks directly. Lanes can't be shifted across 128-bit boundaries cheaply, 
+    // so the UTF-8 validator is left to AVX2
+    #define __SIMD_ISA                  avx512
+    #define __SIMD_TARGET               CORETEN_TARGET("avx512f,avx512bw")
+    #define __SIMD_VEC                  __m512i
+    #define __SIMD_LOADU(p)             _mm512_loadu_si512(cast(const void*)(p))
+    #define __SIMD_LOADA(p)             _mm512_load_si512(cast(const void*)(p))
+    #define __SIMD_STOREU(p, v)         _mm512_storeu_si512(cast(void*)(p), v)
+    #define __SIMD_SPLAT(c)             _mm512_set1_epi8(cast(char)(c))
+    #define __SIMD_EQMASK(a, b)         cast(UInt64)_mm512_cmpeq_epi8_mask(a, b)
+    #define __SIMD_LEADMASK(v)          cast(UInt64)_mm512_cmpgt_epi8_mask(v, _mm512_set1_epi8(-65))
+    #define __SIMD_BPB                  1
+    #define __SIMD_FULLMASK             0xFFFFFFFFFFFFFFFFULL
+    #define __SIMD_CASE_FLIP            __simd_case_flip_avx512
+    #define __SIMD_ANY_HIGHBIT(v)       (_mm512_movepi8_mask(v) != 0)
+    #include <adorad/core/simd_kernels.h>
+#elif defined(CORETEN_SIMD_NEON)
+    // NEON has no movemask; narrowing each 16-bit lane by 4 packs every byte-compare into a nibble
+    static inline UInt64 __simd_movemask_neon(uint8x16_t m) {
+        uint8x8_t res = vshrn_n_u16(vreinterpretq_u16_u8(m), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(res), 0);
+    }
+
+    static inline uint8x16_t __simd_case_flip_neon(uint8x16_t v, char lo) {
+        uint8x16_t in = vcltq_u8(vsubq_u8(v, vdupq_n_u8(cast(UInt8)lo)), vdupq_n_u8(26));
+        return veorq_u8(v, vandq_u8(in, vdupq_n_u8(0x20)));
+    }
+
+    #define __SIMD_ISA                  neon
+    #define __SIMD_TARGET
+    #define __SIMD_VEC                  uint8x16_t
+    #define __SIMD_LOADU(p)             vld1q_u8(cast(const UInt8*)(p))
+    #define __SIMD_LOADA(p)             vld1q_u8(cast(const UInt8*)(p))
+    #define __SIMD_STOREU(p, v)         vst1q_u8(cast(UInt8*)(p), v)
+    #define __SIMD_SPLAT(c)             vdupq_n_u8(cast(UInt8)(c))
+    #define __SIMD_EQMASK(a, b)         __simd_movemask_neon(vceqq_u8(a, b))
+    #define __SIMD_LEADMASK(v)          __simd_movemask_neon(vcgtq_s8(vreinterpretq_s8_u8(v), vdupq_n_s8(-65)))
+    #define __SIMD_BPB                  4
+    #define __SIMD_FULLMASK             0xFFFFFFFFFFFFFFFFULL
+    #define __SIMD_CASE_FLIP            __simd_case_flip_neon
+    #if defined(__aarch64__) || defined(_M_ARM64)
+        #define __SIMD_ANY_HIGHBIT(v)       (vmaxvq_u8(v) >= 0x80)
+        #define __SIMD_HAS_LOOKUP           1
+        #define __SIMD_AND(a, b)            vandq_u8(a, b)
+        #define __SIMD_OR(a, b)             vorrq_u8(a, b)
+        #define __SIMD_XOR(a, b)            veorq_u8(a, b)
+        #define __SIMD_SUBS_U8(a, b)        vqsubq_u8(a, b)
+        #define __SIMD_SHR4(v)              vshrq_n_u8(v, 4)
+        #define __SIMD_TABLE16(p)           vld1q_u8(cast(const UInt8*)(p))
+        #define __SIMD_LOOKUP16(t, idx)     vqtbl1q_u8(t, idx)
+        #define __SIMD_PREV(cur, prev, N)   vextq_u8(prev, cur, 16 - (N))
+        #define __SIMD_ANY(v)               (vmaxvq_u8(v) != 0)
+    #else
+        #define __SIMD_ANY_HIGHBIT(v)       (__simd_movemask_neon(vcltq_s8(vreinterpretq_s8_u8(v), vdupq_n_s8(0))) != 0)
+    #endif // __aarch64__
+    #include <adorad/core/simd_kernels.h>
+#endif // CORETEN_CPU_DISPATCH_X86
+
+typedef UInt64 (*__SimdStrlenKernel)(const char* str);
+typedef const char* (*__SimdMemchrKernel)(const char* str, char ch, UInt64 n);
+typedef bool (*__SimdMemeqKernel)(const char* s1, const char* s2, UInt64 n);
+typedef int (*__SimdMemcmpKernel)(const char* s1, const char* s2, UInt64 n);
+typedef void (*__SimdCaseKernel)(char* dest, const char* src, UInt64 n);
+typedef bool (*__SimdUtf8ValidateKernel)(const char* str, UInt64 n);
+typedef UInt64 (*__SimdUtf8CountKernel)(const char* str, UInt64 n);
+
+typedef struct __SimdKernelSet {
+    __SimdStrlenKernel strlen;
+    __SimdMemchrKernel memchr;
+    __SimdMemeqKernel memeq;
+    __SimdMemcmpKernel memcmp;
+    __SimdMemcmpKernel memcmp_nocase;
+    __SimdCaseKernel tolower;
+    __SimdCaseKernel toupper;
+    __SimdUtf8ValidateKernel utf8_validate;
+    __SimdUtf8CountKernel utf8_count;
+} __SimdKernelSet;
+
+#define __SIMD_KERNEL_SET(isa)                                                                                  \
+    {                                                                                                           \
+        __simd_strlen_##isa, __simd_memchr_##isa, __simd_memeq_##isa, __simd_memcmp_##isa,                      \
+        __simd_memcmp_nocase_##isa, __simd_tolower_##isa, __simd_toupper_##isa, __simd_utf8_validate_##isa,     \
+        __simd_utf8_count_##isa                                                                                 \
+    }
+
+// The kernels picked by `__simd_dispatch()`, null until the first call. Like the hash kernels, each one is stored 
+// atomically (relaxed), since `cpu_set_features_mask()` may re-pick them while other threads are calling them
+typedef struct __SimdKernels {
+    cstlAtomicPtr strlen;
+    cstlAtomicPtr memchr;
+    cstlAtomicPtr memeq;
+    cstlAtomicPtr memcmp;
+    cstlAtomicPtr memcmp_nocase;
+    cstlAtomicPtr tolower;
+    cstlAtomicPtr toupper;
+    cstlAtomicPtr utf8_validate;
+    cstlAtomicPtr utf8_count;
+} __SimdKernels;
+
+static __SimdKernels __simd_kernels = {0};
+
+// Point `__simd_kernels` at the best implementations for `cpu_features()`.
+// Run on first use, and re-run by `cpu_set_features_mask()`
+static void __simd_dispatch() {
+    __SimdKernelSet kernels = __SIMD_KERNEL_SET(scalar);
+#if defined(CORETEN_CPU_DISPATCH_X86)
+    if(cpu_has(CpuFeatureSSE2)) {
+        __SimdKernelSet sse2 = __SIMD_KERNEL_SET(sse2);
+        kernels = sse2;
+    }
+    if(cpu_has(CpuFeatureSSSE3))
+        kernels.utf8_validate = __simd_utf8_validate_ssse3;
+    if(cpu_has(CpuFeatureAVX2)) {
+        __SimdKernelSet avx2 = __SIMD_KERNEL_SET(avx2);
+        kernels = avx2;
+    }
+    if(cpu_has(CpuFeatureAVX512F | CpuFeatureAVX512BW)) {
+        __SimdKernelSet avx512 = __SIMD_KERNEL_SET(avx512);
+        avx512.utf8_validate = kernels.utf8_validate;
+        kernels = avx512;
+    }
+#elif defined(CORETEN_SIMD_NEON)
+    if(cpu_has(CpuFeatureNEON)) {
+        __SimdKernelSet neon = __SIMD_KERNEL_SET(neon);
+        kernels = neon;
+    }
+#endif // CORETEN_CPU_DISPATCH_X86
+    atomicptr_store(&__simd_kernels.strlen, cast(void*)kernels.strlen, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.memchr, cast(void*)kernels.memchr, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.memeq, cast(void*)kernels.memeq, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.memcmp, cast(void*)kernels.memcmp, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.memcmp_nocase, cast(void*)kernels.memcmp_nocase, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.tolower, cast(void*)kernels.tolower, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.toupper, cast(void*)kernels.toupper, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.utf8_validate, cast(void*)kernels.utf8_validate, MemoryOrderRelaxed);
+    atomicptr_store(&__simd_kernels.utf8_count, cast(void*)kernels.utf8_count, MemoryOrderRelaxed);
+}
+
+static void* __simd_kernel(cstlAtomicPtr* entry) {
+    void* kernel = atomicptr_load(entry, MemoryOrderRelaxed);
+    if(CORETEN_UNLIKELY(kernel == null)) {
+        __simd_dispatch();
+        kernel = atomicptr_load(entry, MemoryOrderRelaxed);
+    }
+    return kernel;
+}
+
+#define __SIMD_KERNEL(name, Kernel)     (cast(Kernel)__simd_kernel(&__simd_kernels.name))
+
+UInt64 simd_strlen(const char* str) {
+    return __SIMD_KERNEL(strlen, __SimdStrlenKernel)(str);
+}
+
+const char* simd_memchr(const char* str, char ch, UInt64 n) {
+    return __SIMD_KERNEL(memchr, __SimdMemchrKernel)(str, ch, n);
+}
+
+bool simd_memeq(const char* s1, const char* s2, UInt64 n) {
+    return __SIMD_KERNEL(memeq, __SimdMemeqKernel)(s1, s2, n);
+}
+
+int simd_memcmp(const char* s1, const char* s2, UInt64 n) {
+    return __SIMD_KERNEL(memcmp, __SimdMemcmpKernel)(s1, s2, n);
+}
+
+int simd_memcmp_nocase(const char* s1, const char* s2, UInt64 n) {
+    return __SIMD_KERNEL(memcmp_nocase, __SimdMemcmpKernel)(s1, s2, n);
+}
+
+void simd_tolower(char* dest, const char* src, UInt64 n) {
+    __SIMD_KERNEL(tolower, __SimdCaseKernel)(dest, src, n);
+}
+
+void simd_toupper(char* dest, const char* src, UInt64 n) {
+    __SIMD_KERNEL(toupper, __SimdCaseKernel)(dest, src, n);
+}
+
+bool simd_utf8_validate(const char* str, UInt64 n) {
+    return __SIMD_KERNEL(utf8_validate, __SimdUtf8ValidateKernel)(str, n);
+}
+
+UInt64 simd_utf8_count(const char* str, UInt64 n) {
+    return __SIMD_KERNEL(utf8_count, __SimdUtf8CountKernel)(str, n);
+}
+
+// -------------------------------------------------------------------------
+// stats.c
+// -------------------------------------------------------------------------
+
+CORETEN_THREAD_LOCAL UInt64 __stats_local[STATS_MAX_COUNTERS];
+
+static UInt64 __stats_totals[STATS_MAX_COUNTERS];
+static char* __stats_names[STATS_MAX_COUNTERS];
+static bool __stats_core_registered = false;
+static cstlLock __stats_lock = CSTL_LOCK_INIT;
+
+static void __stats_register_core() {
+    if(__stats_core_registered)
+        return;
+    __stats_core_registered = true;
+    stats_register(StatsVectorRegrows, "vector.regrows");
+    stats_register(StatsSegVecChunks, "vector.segvec_chunks");
+    stats_register(StatsArenaChunks, "memory.arena_chunks");
+    stats_register(StatsHashMapLookups, "hashmap.lookups");
+    stats_register(StatsHashMapProbes, "hashmap.probes");
+    stats_register(StatsHashMapResizes, "hashmap.resizes");
+    stats_register(StatsVfsStatHits, "vfs.stat_hits");
+    stats_register(StatsVfsStatMisses, "vfs.stat_misses");
+    stats_register(StatsVfsReadHits, "vfs.read_hits");
+    stats_register(StatsVfsReadMisses, "vfs.read_misses");
+    stats_register(StatsFileLoaderFiles, "io.files_loaded");
+    stats_register(StatsFileLoaderBytes, "io.bytes_loaded");
+}
+
+void stats_register(UInt32 counter, const char* name) {
+    CORETEN_ENFORCE(counter < STATS_MAX_COUNTERS, "Counter id out of range");
+    UInt64 length = strlen(name);
+    char* copy = cast(char*)cstl_alloc(null, length + 1);
+    memcpy(copy, name, length + 1);
+
+    lock_acquire(&__stats_lock);
+    char* old = __stats_names[counter];
+    __stats_names[counter] = copy;
+    lock_release(&__stats_lock);
+    if(old)
+        cstl_free(null, old, strlen(old) + 1);
+}
+
+void stats_thread_flush() {
+    lock_acquire(&__stats_lock);
+    for(UInt32 i = 0; i < STATS_MAX_COUNTERS; i++) {
+        __stats_totals[i] += __stats_local[i];
+        __stats_local[i] = 0;
+    }
+    lock_release(&__stats_lock);
+}
+
+UInt64 stats_get(UInt32 counter) {
+    CORETEN_ENFORCE(counter < STATS_MAX_COUNTERS, "Counter id out of range");
+    lock_acquire(&__stats_lock);
+    UInt64 total = __stats_totals[counter] + __stats_local[counter];
+    lock_release(&__stats_lock);
+    return total;
+}
+
+void stats_reset() {
+    lock_acquire(&__stats_lock);
+    memset(__stats_totals, 0, sizeof(__stats_totals));
+    memset(__stats_local, 0, sizeof(__stats_local));
+    lock_release(&__stats_lock);
+}
+
+static int __stats_compare_names(const void* a, const void* b) {
+    return strcmp(__stats_names[*cast(const UInt32*)a], __stats_names[*cast(const UInt32*)b]);
+}
+
+// Flush the calling thread, and collect the ids of every named, non-zero counter (sorted by name).
+// Returns the number of ids written to `ids`
+static UInt32 __stats_collect(UInt32* ids) {
+    __stats_register_core();
+    stats_thread_flush();
+
+    UInt32 n = 0;
+    for(UInt32 i = 0; i < STATS_MAX_COUNTERS; i++) {
+        if(__stats_names[i] && __stats_totals[i])
+            ids[n++] = i;
+    }
+    if(n > 0)
+        qsort(ids, n, sizeof(UInt32), __stats_compare_names);
+    return n;
+}
+
+void stats_write_table(FILE* out) {
+    UInt32 ids[STATS_MAX_COUNTERS];
+    UInt32 n = __stats_collect(ids);
+    UInt64 width = 8;
+    for(UInt32 i = 0; i < n; i++) {
+        UInt64 length = strlen(__stats_names[ids[i]]);
+        width = length > width ? length : width;
+    }
+
+    cstlWriter* writer = writer_new_file(null, out, 0);
+    writer_str(writer, "Counters:\n");
+    for(UInt32 i = 0; i < n; i++) {
+        writer_printf(writer, "    %-*s %14llu\n", cast(int)width, __stats_names[ids[i]], 
+                      cast(unsigned long long)__stats_totals[ids[i]]);
+    }
+    writer_free(writer);
+}
+
+void stats_write_json(FILE* out) {
+    UInt32 ids[STATS_MAX_COUNTERS];
+    UInt32 n = __stats_collect(ids);
+
+    cstlWriter* writer = writer_new_file(null, out, 0);
+    writer_char(writer, '{');
+    for(UInt32 i = 0; i < n; i++) {
+        writer_str(writer, i ? ",\n " : "\n ");
+        __profile_write_json_str(writer, __stats_names[ids[i]]);
+        writer_str(writer, ": ");
+        writer_u64(writer, __stats_totals[ids[i]]);
+    }
+    writer_str(writer, n ? "\n}\n" : "}\n");
+    writer_free(writer);
+}
+
+// -------------------------------------------------------------------------
+// thread.c
+// -------------------------------------------------------------------------
+
+#if defined(CORETEN_OS_WINDOWS)
+    #if defined(CORETEN_COMPILER_MSVC)
+        // `WaitOnAddress()` and friends
+        #pragma comment(lib, "synchronization.lib")
+    #endif // CORETEN_COMPILER_MSVC
+#else
+    #include <errno.h>
+    #include <sched.h>
+    #include <time.h>
+    #include <unistd.h>
+    #if defined(CORETEN_OS_LINUX)
+        #include <linux/futex.h>
+        #include <sys/syscall.h>
+    #endif // CORETEN_OS_LINUX
+#endif // CORETEN_OS_WINDOWS
+
+// What a new thread starts with (freed by the thread)
+typedef struct __ThreadStart {
+    cstlThreadFunc func;
+    void* arg;
+} __ThreadStart;
+
+#if defined(CORETEN_OS_WINDOWS)
+static DWORD WINAPI __thread_trampoline(LPVOID data) {
+#else
+static void* __thread_trampoline(void* data) {
+#endif // CORETEN_OS_WINDOWS
+    __ThreadStart start = *cast(__ThreadStart*)data;
+    cstl_free_obj(null, cast(__ThreadStart*)data);
+    int result = start.func(start.arg);
+#if defined(CORETEN_OS_WINDOWS)
+    return cast(DWORD)result;
+#else
+    return cast(void*)cast(intptr_t)result;
+#endif // CORETEN_OS_WINDOWS
+}
+
+bool thread_create(cstlThread* thread, cstlThreadFunc func, void* arg) {
+    __ThreadStart* start = cstl_new_obj(null, __ThreadStart);
+    start->func = func;
+    start->arg = arg;
+#if defined(CORETEN_OS_WINDOWS)
+    thread->handle = CreateThread(null, 0, __thread_trampoline, start, 0, null);
+    bool ok = thread->handle != null;
+#else
+    bool ok = pthread_create(&thread->handle, null, __thread_trampoline, start) == 0;
+#endif // CORETEN_OS_WINDOWS
+    if(!ok)
+        cstl_free_obj(null, start);
+    return ok;
+}
+
+int thread_join(cstlThread* thread) {
+#if defined(CORETEN_OS_WINDOWS)
+    DWORD result = 0;
+    WaitForSingleObject(thread->handle, INFINITE);
+    GetExitCodeThread(thread->handle, &result);
+    CloseHandle(thread->handle);
+    return cast(int)result;
+#else
+    void* result = null;
+    pthread_join(thread->handle, &result);
+    return cast(int)cast(intptr_t)result;
+#endif // CORETEN_OS_WINDOWS
+}
+
+void thread_yield() {
+#if defined(CORETEN_OS_WINDOWS)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif // CORETEN_OS_WINDOWS
+}
+
+void thread_sleep_ns(UInt64 ns) {
+#if defined(CORETEN_OS_WINDOWS)
+    Sleep(cast(DWORD)((ns + 999999) / 1000000));
+#else
+    struct timespec ts;
+    ts.tv_sec = cast(time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = cast(long)(ns % 1000000000ULL);
+    while(nanosleep(&ts, &ts) != 0 && errno == EINTR) {}
+#endif // CORETEN_OS_WINDOWS
+}
+
+UInt64 thread_id() {
+#if defined(CORETEN_OS_WINDOWS)
+    return cast(UInt64)GetCurrentThreadId();
+#elif defined(CORETEN_OS_LINUX)
+    return cast(UInt64)syscall(SYS_gettid);
+#elif defined(CORETEN_OS_OSX)
+    uint64_t id = 0;
+    pthread_threadid_np(null, &id);
+    return cast(UInt64)id;
+#else
+    return cast(UInt64)cast(uintptr_t)pthread_self();
+#endif // CORETEN_OS_WINDOWS
+}
+
+UInt32 thread_hardware_concurrency() {
+#if defined(CORETEN_OS_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? cast(UInt32)info.dwNumberOfProcessors : 1;
+#else
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return ncpus > 0 ? cast(UInt32)ncpus : 1;
+#endif // CORETEN_OS_WINDOWS
+}
+
+bool tls_create(cstlTlsKey* key, void (*destructor)(void*)) {
+#if defined(CORETEN_OS_WINDOWS)
+    // Fiber-local storage is the only Win32 flavour with destructors (and works the same on plain threads)
+    key->index = cast(UInt32)FlsAlloc(cast(PFLS_CALLBACK_FUNCTION)destructor);
+    return key->index != FLS_OUT_OF_INDEXES;
+#else
+    return pthread_key_create(&key->key, destructor) == 0;
+#endif // CORETEN_OS_WINDOWS
+}
+
+void tls_delete(cstlTlsKey* key) {
+#if defined(CORETEN_OS_WINDOWS)
+    FlsFree(key->index);
+#else
+    pthread_key_delete(key->key);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void* tls_get(cstlTlsKey* key) {
+#if defined(CORETEN_OS_WINDOWS)
+    return FlsGetValue(key->index);
+#else
+    return pthread_getspecific(key->key);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void tls_set(cstlTlsKey* key, void* value) {
+#if defined(CORETEN_OS_WINDOWS)
+    FlsSetValue(key->index, value);
+#else
+    pthread_setspecific(key->key, value);
+#endif // CORETEN_OS_WINDOWS
+}
+
+// The Win32 lock and condition variable are one pointer each, and are stored in place of `srwlock`/`cond`
+void mutex_init(cstlMutex* mutex) {
+#if defined(CORETEN_OS_WINDOWS)
+    InitializeSRWLock(cast(PSRWLOCK)&mutex->srwlock);
+#else
+    pthread_mutex_init(&mutex->mutex, null);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void mutex_destroy(cstlMutex* mutex) {
+#if !defined(CORETEN_OS_WINDOWS)
+    pthread_mutex_destroy(&mutex->mutex);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void mutex_lock(cstlMutex* mutex) {
+#if defined(CORETEN_OS_WINDOWS)
+    AcquireSRWLockExclusive(cast(PSRWLOCK)&mutex->srwlock);
+#else
+    pthread_mutex_lock(&mutex->mutex);
+#endif // CORETEN_OS_WINDOWS
+}
+
+bool mutex_try_lock(cstlMutex* mutex) {
+#if defined(CORETEN_OS_WINDOWS)
+    return TryAcquireSRWLockExclusive(cast(PSRWLOCK)&mutex->srwlock) != 0;
+#else
+    return pthread_mutex_trylock(&mutex->mutex) == 0;
+#endif // CORETEN_OS_WINDOWS
+}
+
+void mutex_unlock(cstlMutex* mutex) {
+#if defined(CORETEN_OS_WINDOWS)
+    ReleaseSRWLockExclusive(cast(PSRWLOCK)&mutex->srwlock);
+#else
+    pthread_mutex_unlock(&mutex->mutex);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void condvar_init(cstlCondVar* cond) {
+#if defined(CORETEN_OS_WINDOWS)
+    InitializeConditionVariable(cast(PCONDITION_VARIABLE)&cond->cond);
+#elif defined(CORETEN_OS_LINUX)
+    // Timeouts are measured on the monotonic clock, so they don't jump with the wall clock
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&cond->cond, &attr);
+    pthread_condattr_destroy(&attr);
+#else
+    pthread_cond_init(&cond->cond, null);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void condvar_destroy(cstlCondVar* cond) {
+#if !defined(CORETEN_OS_WINDOWS)
+    pthread_cond_destroy(&cond->cond);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void condvar_wait(cstlCondVar* cond, cstlMutex* mutex) {
+#if defined(CORETEN_OS_WINDOWS)
+    SleepConditionVariableSRW(cast(PCONDITION_VARIABLE)&cond->cond, cast(PSRWLOCK)&mutex->srwlock, INFINITE, 0);
+#else
+    pthread_cond_wait(&cond->cond, &mutex->mutex);
+#endif // CORETEN_OS_WINDOWS
+}
+
+bool condvar_wait_for(cstlCondVar* cond, cstlMutex* mutex, UInt64 timeout_ns) {
+#if defined(CORETEN_OS_WINDOWS)
+    DWORD ms = cast(DWORD)((timeout_ns + 999999) / 1000000);
+    return SleepConditionVariableSRW(cast(PCONDITION_VARIABLE)&cond->cond, cast(PSRWLOCK)&mutex->srwlock, ms, 0) 
+           || GetLastError() != ERROR_TIMEOUT;
+#else
+    struct timespec deadline;
+    #if defined(CORETEN_OS_LINUX)
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+    #else
+        clock_gettime(CLOCK_REALTIME, &deadline);
+    #endif // CORETEN_OS_LINUX
+    UInt64 nsec = cast(UInt64)deadline.tv_nsec + timeout_ns;
+    deadline.tv_sec += cast(time_t)(nsec / 1000000000ULL);
+    deadline.tv_nsec = cast(long)(nsec % 1000000000ULL);
+    return pthread_cond_timedwait(&cond->cond, &mutex->mutex, &deadline) != ETIMEDOUT;
+#endif // CORETEN_OS_WINDOWS
+}
+
+void condvar_signal(cstlCondVar* cond) {
+#if defined(CORETEN_OS_WINDOWS)
+    WakeConditionVariable(cast(PCONDITION_VARIABLE)&cond->cond);
+#else
+    pthread_cond_signal(&cond->cond);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void condvar_broadcast(cstlCondVar* cond) {
+#if defined(CORETEN_OS_WINDOWS)
+    WakeAllConditionVariable(cast(PCONDITION_VARIABLE)&cond->cond);
+#else
+    pthread_cond_broadcast(&cond->cond);
+#endif // CORETEN_OS_WINDOWS
+}
+
+void futex_wait(cstlAtomic32* cell, Int32 expected) {
+#if defined(CORETEN_OS_LINUX)
+    syscall(SYS_futex, cast(Int32*)&cell->value, FUTEX_WAIT_PRIVATE, expected, null, null, 0);
+#elif defined(CORETEN_OS_WINDOWS)
+    WaitOnAddress(cast(volatile void*)&cell->value, &expected, sizeof(expected), INFINITE);
+#else
+    // No portable way to sleep on an address: yield, and let the caller re-check
+    (void)cell;
+    (void)expected;
+    thread_yield();
+#endif // CORETEN_OS_LINUX
+}
+
+void futex_wake_one(cstlAtomic32* cell) {
+#if defined(CORETEN_OS_LINUX)
+    syscall(SYS_futex, cast(Int32*)&cell->value, FUTEX_WAKE_PRIVATE, 1, null, null, 0);
+#elif defined(CORETEN_OS_WINDOWS)
+    WakeByAddressSingle(cast(void*)&cell->value);
+#else
+    (void)cell;
+#endif // CORETEN_OS_LINUX
+}
+
+void futex_wake_all(cstlAtomic32* cell) {
+#if defined(CORETEN_OS_LINUX)
+    syscall(SYS_futex, cast(Int32*)&cell->value, FUTEX_WAKE_PRIVATE, INT32_MAX, null, null, 0);
+#elif defined(CORETEN_OS_WINDOWS)
+    WakeByAddressAll(cast(void*)&cell->value);
+#else
+    (void)cell;
+#endif // CORETEN_OS_LINUX
+}
+
+void __lock_acquire_slow(cstlLock* lock) {
+    // Spin for a moment first: locks are usually held for a few instructions
+    for(int i = 0; i < 100; i++) {
+        cstl_cpu_relax();
+        if(atomic32_load(&lock->state, MemoryOrderRelaxed) == 0 && lock_try_acquire(lock))
+            return;
+    }
+    // Mark the lock as contended, so `lock_release()` wakes a sleeper, and sleep until it's free
+    while(atomic32_exchange(&lock->state, 2, MemoryOrderAcquire) != 0)
+        futex_wait(&lock->state, 2);
+}
+
+// `once->state`: 0 = not run, 1 = running, 2 = done
+void once_call(cstlOnce* once, void (*func)(void*), void* arg) {
+    if(atomic32_load(&once->state, MemoryOrderAcquire) == 2)
+        return;
+    Int32 state = 0;
+    if(atomic32_cas(&once->state, &state, 1, MemoryOrderAcquire, MemoryOrderAcquire)) {
+        func(arg);
+        atomic32_store(&once->state, 2, MemoryOrderRelease);
+        futex_wake_all(&once->state);
+        return;
+    }
+    while(state != 2) {
+        futex_wait(&once->state, state);
+        state = atomic32_load(&once->state, MemoryOrderAcquire);
+    }
+}
+
+/*
+    The deque follows "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê, Pop, Cohen & Zappa Nardelli, 
+    2013), which gives the C11 orderings for the Chase-Lev deque. `top` only ever grows; `bottom` is written by the 
+    owner alone. The owner and a thief can only race for the last item, which they settle with a CAS on `top`.
+*/
+typedef struct __WorkDequeBuffer {
+    Int64 mask;                             // capacity - 1
+    struct __WorkDequeBuffer* prev;         // the buffer this one replaced
+    cstlAtomicPtr items[];
+} __WorkDequeBuffer;
+
+#define __WORK_DEQUE_DEFAULT_CAPACITY   64
+
+static __WorkDequeBuffer* __work_deque_buffer_new(Int64 capacity, __WorkDequeBuffer* prev) {
+    __WorkDequeBuffer* buffer = cast(__WorkDequeBuffer*)cstl_alloc(null, sizeof(__WorkDequeBuffer) + 
+                                                                   cast(UInt64)capacity * sizeof(cstlAtomicPtr));
+    buffer->mask = capacity - 1;
+    buffer->prev = prev;
+    return buffer;
+}
+
+void work_deque_init(cstlWorkDeque* deque, UInt64 capacity) {
+    Int64 rounded = 2;
+    while(cast(UInt64)rounded < (capacity ? capacity : __WORK_DEQUE_DEFAULT_CAPACITY))
+        rounded *= 2;
+    atomic64_store(&deque->top, 0, MemoryOrderRelaxed);
+    atomic64_store(&deque->bottom, 0, MemoryOrderRelaxed);
+    atomicptr_store(&deque->buffer, __work_deque_buffer_new(rounded, null), MemoryOrderRelaxed);
+}
+
+void work_deque_free(cstlWorkDeque* deque) {
+    __WorkDequeBuffer* buffer = cast(__WorkDequeBuffer*)atomicptr_load(&deque->buffer, MemoryOrderRelaxed);
+    while(buffer) {
+        __WorkDequeBuffer* prev = buffer->prev;
+        cstl_free(null, buffer, sizeof(__WorkDequeBuffer) + cast(UInt64)(buffer->mask + 1) * sizeof(cstlAtomicPtr));
+        buffer = prev;
+    }
+    atomicptr_store(&deque->buffer, null, MemoryOrderRelaxed);
+}
+
+void work_deque_push(cstlWorkDeque* deque, void* item) {
+    Int64 bottom = atomic64_load(&deque->bottom, MemoryOrderRelaxed);
+    Int64 top = atomic64_load(&deque->top, MemoryOrderAcquire);
+    __WorkDequeBuffer* buffer = cast(__WorkDequeBuffer*)atomicptr_load(&deque->buffer, MemoryOrderRelaxed);
+    if(bottom - top > buffer->mask) {
+        // Full: copy the live items into a buffer twice the size. Thieves may still read the old one, so it is 
+        // only freed with the deque
+        __WorkDequeBuffer* bigger = __work_deque_buffer_new(2 * (buffer->mask + 1), buffer);
+        for(Int64 i = top; i < bottom; i++) {
+            void* live = atomicptr_load(&buffer->items[i & buffer->mask], MemoryOrderRelaxed);
+            atomicptr_store(&bigger->items[i & bigger->mask], live, MemoryOrderRelaxed);
+        }
+        atomicptr_store(&deque->buffer, bigger, MemoryOrderRelease);
+        buffer = bigger;
+    }
+    atomicptr_store(&buffer->items[bottom & buffer->mask], item, MemoryOrderRelaxed);
+    // Release store in place of the paper's release fence: same codegen on x86, and visible to ThreadSanitizer
+    atomic64_store(&deque->bottom, bottom + 1, MemoryOrderRelease);
+}
+
+void* work_deque_pop(cstlWorkDeque* deque) {
+    Int64 bottom = atomic64_load(&deque->bottom, MemoryOrderRelaxed) - 1;
+    __WorkDequeBuffer* buffer = cast(__WorkDequeBuffer*)atomicptr_load(&deque->buffer, MemoryOrderRelaxed);
+    atomic64_store(&deque->bottom, bottom, MemoryOrderRelaxed);
+    cstl_fence(MemoryOrderSeqCst);
+    Int64 top = atomic64_load(&deque->top, MemoryOrderRelaxed);
+    if(top > bottom) {
+        // Empty
+        atomic64_store(&deque->bottom, bottom + 1, MemoryOrderRelaxed);
+        return null;
+    }
+    void* item = atomicptr_load(&buffer->items[bottom & buffer->mask], MemoryOrderRelaxed);
+    if(top == bottom) {
+        // The last item: a thief may be after it too
+        if(!atomic64_cas(&deque->top, &top, top + 1, MemoryOrderSeqCst, MemoryOrderRelaxed))
+            item = null;
+        atomic64_store(&deque->bottom, bottom + 1, MemoryOrderRelaxed);
+    }
+    return item;
+}
+
+void* work_deque_steal(cstlWorkDeque* deque) {
+    Int64 top = atomic64_load(&deque->top, MemoryOrderAcquire);
+    cstl_fence(MemoryOrderSeqCst);
+    Int64 bottom = atomic64_load(&deque->bottom, MemoryOrderAcquire);
+    if(top >= bottom)
+        return null;
+    __WorkDequeBuffer* buffer = cast(__WorkDequeBuffer*)atomicptr_load(&deque->buffer, MemoryOrderAcquire);
+    void* item = atomicptr_load(&buffer->items[top & buffer->mask], MemoryOrderRelaxed);
+    if(!atomic64_cas(&deque->top, &top, top + 1, MemoryOrderSeqCst, MemoryOrderRelaxed))
+        return null;
+    return item;
+}
+
+UInt64 work_deque_size(cstlWorkDeque* deque) {
+    Int64 bottom = atomic64_load(&deque->bottom, MemoryOrderAcquire);
+    Int64 top = atomic64_load(&deque->top, MemoryOrderAcquire);
+    return bottom > top ? cast(UInt64)(bottom - top) : 0;
+}
+
+typedef struct __ThreadPoolTask {
+    cstlTaskFunc func;
+    void* arg;
+    cstlTaskGroup* group;   // null for plain `thread_pool_submit()`s
+} __ThreadPoolTask;
+
+typedef struct __ThreadPoolWorker {
+    cstlWorkDeque deque;
+    cstlThreadPool* pool;
+    cstlThread thread;
+    UInt32 index;
+    UInt32 seed;            // for picking victims to steal from
+} __ThreadPoolWorker;
+
+struct cstlThreadPool {
+    __ThreadPoolWorker* workers;
+    UInt32 nthreads;            // worker slots (thieves look through all of them)
+    UInt32 nstarted;            // workers whose thread is running: the first `nstarted` slots
+
+    // Tasks submitted from outside the pool. `inject_lock` guards the ring
+    cstlLock inject_lock;
+    __ThreadPoolTask** inject;
+    UInt64 inject_head;
+    UInt64 inject_count;
+    UInt64 inject_capacity;
+    cstlAtomic64 ninjected;     // `inject_count`, readable without the lock
+
+    cstlAtomic64 pending;       // submitted tasks that haven't finished
+    cstlAtomic32 work_epoch;    // bumped whenever there is new work (or the pool stops); idle workers sleep on it
+    cstlAtomic32 nsleeping;
+    cstlAtomic32 done_epoch;    // bumped whenever `pending` drops to 0; `thread_pool_wait()` sleeps on it
+    cstlAtomic32 stop;
+};
+
+// The worker running on this thread (null on threads outside any pool)
+static CORETEN_THREAD_LOCAL __ThreadPoolWorker* __thread_pool_worker = null;
+
+static __ThreadPoolTask* __thread_pool_pop_injected(cstlThreadPool* pool) {
+    if(atomic64_load(&pool->ninjected, MemoryOrderAcquire) == 0)
+        return null;
+    __ThreadPoolTask* task = null;
+    lock_acquire(&pool->inject_lock);
+    if(pool->inject_count > 0) {
+        task = pool->inject[pool->inject_head];
+        pool->inject_head = (pool->inject_head + 1) % pool->inject_capacity;
+        pool->inject_count--;
+        atomic64_store(&pool->ninjected, cast(Int64)pool->inject_count, MemoryOrderRelease);
+    }
+    lock_release(&pool->inject_lock);
+    return task;
+}
+
+static void __thread_pool_inject(cstlThreadPool* pool, __ThreadPoolTask* task) {
+    lock_acquire(&pool->inject_lock);
+    if(pool->inject_count == pool->inject_capacity) {
+        UInt64 capacity = pool->inject_capacity ? pool->inject_capacity * 2 : 64;
+        __ThreadPoolTask** ring = cast(__ThreadPoolTask**)cstl_alloc(null, capacity * sizeof(__ThreadPoolTask*));
+        for(UInt64 i = 0; i < pool->inject_count; i++)
+            ring[i] = pool->inject[(pool->inject_head + i) % pool->inject_capacity];
+        cstl_free(null, pool->inject, pool->inject_capacity * sizeof(__ThreadPoolTask*));
+        pool->inject = ring;
+        pool->inject_head = 0;
+        pool->inject_capacity = capacity;
+    }
+    pool->inject[(pool->inject_head + pool->inject_count) % pool->inject_capacity] = task;
+    pool->inject_count++;
+    atomic64_store(&pool->ninjected, cast(Int64)pool->inject_count, MemoryOrderRelease);
+    lock_release(&pool->inject_lock);
+}
+
+// The next task for `self` (null on threads outside the pool): its own deque first, then the shared queue, then 
+// the other workers' deques
+static __ThreadPoolTask* __thread_pool_find_task(cstlThreadPool* pool, __ThreadPoolWorker* self) {
+    __ThreadPoolTask* task = null;
+    if(self) {
+        task = cast(__ThreadPoolTask*)work_deque_pop(&self->deque);
+        if(task)
+            return task;
+    }
+    task = __thread_pool_pop_injected(pool);
+    if(task)
+        return task;
+
+    // Start at a random victim, so thieves spread out
+    UInt32 start = 0;
+    if(self) {
+        self->seed ^= self->seed << 13;
+        self->seed ^= self->seed >> 17;
+        self->seed ^= self->seed << 5;
+        start = self->seed % pool->nthreads;
+    }
+    for(UInt32 i = 0; i < pool->nthreads; i++) {
+        __ThreadPoolWorker* victim = &pool->workers[(start + i) % pool->nthreads];
+        if(victim == self)
+            continue;
+        task = cast(__ThreadPoolTask*)work_deque_steal(&victim->deque);
+        if(task)
+            return task;
+    }
+    return null;
+}
+
+static void __thread_pool_run(cstlThreadPool* pool, __ThreadPoolTask* task) {
+    task->func(task->arg);
+    cstlTaskGroup* group = task->group;
+    slab_release(task, sizeof(__ThreadPoolTask));
+    // Dropping `pending` to 0 is the last write to the group: its waiter may release it right after
+    if(group && atomic32_fetch_sub(&group->pending, 1, MemoryOrderAcqRel) == 1)
+        futex_wake_all(&group->pending);
+    if(atomic64_fetch_sub(&pool->pending, 1, MemoryOrderAcqRel) == 1) {
+        atomic32_fetch_add(&pool->done_epoch, 1, MemoryOrderRelease);
+        futex_wake_all(&pool->done_epoch);
+    }
+}
+
+static int __thread_pool_worker_main(void* arg) {
+    __ThreadPoolWorker* self = cast(__ThreadPoolWorker*)arg;
+    cstlThreadPool* pool = self->pool;
+    __thread_pool_worker = self;
+    for(;;) {
+        __ThreadPoolTask* task = __thread_pool_find_task(pool, self);
+        if(task) {
+            __thread_pool_run(pool, task);
+            continue;
+        }
+        // Announce that we're going to sleep, then look once more: a submitter either sees us sleeping and wakes 
+        // us, or its task is visible to this second look (or it bumped `work_epoch`, which cancels the wait)
+        Int32 epoch = atomic32_load(&pool->work_epoch, MemoryOrderAcquire);
+        atomic32_fetch_add(&pool->nsleeping, 1, MemoryOrderSeqCst);
+        task = __thread_pool_find_task(pool, self);
+        if(!task && !atomic32_load(&pool->stop, MemoryOrderAcquire))
+            futex_wait(&pool->work_epoch, epoch);
+        atomic32_fetch_sub(&pool->nsleeping, 1, MemoryOrderRelaxed);
+        if(task)
+            __thread_pool_run(pool, task);
+        else if(atomic32_load(&pool->stop, MemoryOrderAcquire))
+            break;
+    }
+    __thread_pool_worker = null;
+    // Hand back this thread's cached slab blocks and counters before it goes
+    slab_thread_flush();
+    stats_thread_flush();
+    return 0;
+}
+
+cstlThreadPool* thread_pool_new(UInt32 nthreads) {
+    cstlThreadPool* pool = cstl_new_obj(null, cstlThreadPool);
+    pool->nthreads = nthreads ? nthreads : thread_hardware_concurrency();
+    pool->workers = cast(__ThreadPoolWorker*)cstl_alloc_aligned(null, pool->nthreads * sizeof(__ThreadPoolWorker), 
+                                                                _Alignof(__ThreadPoolWorker));
+    for(UInt32 i = 0; i < pool->nthreads; i++) {
+        __ThreadPoolWorker* worker = &pool->workers[i];
+        work_deque_init(&worker->deque, 0);
+        worker->pool = pool;
+        worker->index = i;
+        worker->seed = 2654435761u * (i + 1);
+    }
+    // Make do with the workers that could be started. Slots without a thread keep an empty deque, which the others 
+    // are free to look through
+    UInt32 nstarted = 0;
+    while(nstarted < pool->nthreads && 
+          thread_create(&pool->workers[nstarted].thread, __thread_pool_worker_main, &pool->workers[nstarted]))
+        nstarted++;
+    pool->nstarted = nstarted;
+    if(nstarted == 0) {
+        thread_pool_free(pool);
+        return null;
+    }
+    return pool;
+}
+
+void thread_pool_free(cstlThreadPool* pool) {
+    if(pool == null)
+        return;
+    thread_pool_wait(pool);
+    atomic32_store(&pool->stop, 1, MemoryOrderRelease);
+    atomic32_fetch_add(&pool->work_epoch, 1, MemoryOrderSeqCst);
+    futex_wake_all(&pool->work_epoch);
+    for(UInt32 i = 0; i < pool->nstarted; i++)
+        thread_join(&pool->workers[i].thread);
+    for(UInt32 i = 0; i < pool->nthreads; i++)
+        work_deque_free(&pool->workers[i].deque);
+    cstl_free(null, pool->workers, pool->nthreads * sizeof(__ThreadPoolWorker));
+    cstl_free(null, pool->inject, pool->inject_capacity * sizeof(__ThreadPoolTask*));
+    cstl_free_obj(null, pool);
+}
+
+UInt32 thread_pool_size(cstlThreadPool* pool) {
+    return pool->nstarted;
+}
+
+Int32 thread_pool_worker_index(cstlThreadPool* pool) {
+    __ThreadPoolWorker* self = __thread_pool_worker;
+    return self && self->pool == pool ? cast(Int32)self->index : -1;
+}
+
+static void __thread_pool_submit(cstlThreadPool* pool, cstlTaskFunc func, void* arg, cstlTaskGroup* group) {
+    __ThreadPoolTask* task = cast(__ThreadPoolTask*)slab_alloc(sizeof(__ThreadPoolTask));
+    task->func = func;
+    task->arg = arg;
+    task->group = group;
+    atomic64_fetch_add(&pool->pending, 1, MemoryOrderRelaxed);
+
+    __ThreadPoolWorker* self = __thread_pool_worker;
+    if(self && self->pool == pool)
+        work_deque_push(&self->deque, task);
+    else
+        __thread_pool_inject(pool, task);
+
+    atomic32_fetch_add(&pool->work_epoch, 1, MemoryOrderSeqCst);
+    if(atomic32_load(&pool->nsleeping, MemoryOrderSeqCst) > 0)
+        futex_wake_one(&pool->work_epoch);
+}
+
+void thread_pool_submit(cstlThreadPool* pool, cstlTaskFunc func, void* arg) {
+    __thread_pool_submit(pool, func, arg, null);
+}
+
+void thread_pool_wait(cstlThreadPool* pool) {
+    __ThreadPoolWorker* self = __thread_pool_worker;
+    if(self && self->pool != pool)
+        self = null;
+    while(atomic64_load(&pool->pending, MemoryOrderAcquire) > 0) {
+        __ThreadPoolTask* task = __thread_pool_find_task(pool, self);
+        if(task) {
+            __thread_pool_run(pool, task);
+            continue;
+        }
+        // Nothing to take: the rest is running elsewhere. Sleep until the count drops to 0
+        Int32 epoch = atomic32_load(&pool->done_epoch, MemoryOrderAcquire);
+        if(atomic64_load(&pool->pending, MemoryOrderAcquire) == 0)
+            break;
+        futex_wait(&pool->done_epoch, epoch);
+    }
+}
+
+static cstlOnce __thread_pool_shared_once = CSTL_ONCE_INIT;
+static cstlThreadPool* __thread_pool_shared_pool = null;
+
+static void __thread_pool_shared_init(void* arg) {
+    __thread_pool_shared_pool = thread_pool_new(0);
 }
 
-bool os_path_is_rel(cstlBuffer* path) {
-    return cast(bool) !os_path_is_abs(path);
+cstlThreadPool* thread_pool_shared() {
+    once_call(&__thread_pool_shared_once, __thread_pool_shared_init, null);
+    return __thread_pool_shared_pool;
 }
 
-bool os_path_is_root(cstlBuffer* path) {
-    bool result = false;
-    CORETEN_ENFORCE_NN(path, "Cannot do anything useful on a null path :(");
-#ifdef CORETEN_OS_WINDOWS
-    result = os_path_is_abs(path) && path->len == 3;
-#else
-    result = os_path_is_abs(path) && path->len == 1;
-#endif // CORETEN_OS_WINDOWS
-    return result;
+void task_group_init(cstlTaskGroup* group, cstlThreadPool* pool) {
+    group->pool = pool;
+    atomic32_store(&group->pending, 0, MemoryOrderRelaxed);
+}
+
+void task_group_submit(cstlTaskGroup* group, cstlTaskFunc func, void* arg) {
+    atomic32_fetch_add(&group->pending, 1, MemoryOrderRelaxed);
+    __thread_pool_submit(group->pool, func, arg, group);
+}
+
+void task_group_wait(cstlTaskGroup* group) {
+    cstlThreadPool* pool = group->pool;
+    __ThreadPoolWorker* self = __thread_pool_worker;
+    if(self && self->pool != pool)
+        self = null;
+    Int32 pending;
+    while((pending = atomic32_load(&group->pending, MemoryOrderAcquire)) > 0) {
+        // Whatever we find may belong to another group, but running it still moves the pool along
+        __ThreadPoolTask* task = __thread_pool_find_task(pool, self);
+        if(task)
+            __thread_pool_run(pool, task);
+        else
+            futex_wait(&group->pending, pending);
+    }
 }
 
 // -------------------------------------------------------------------------
@@ -1406,7 +5920,7 @@ bool os_path_is_root(cstlBuffer* path) {
 #endif // UTF8_UINT16_MAX
 
 #include <adorad/core/utf8_data.h>
-// #include <adorad/core/utf8_properties.h>
+#include <adorad/core/utf8_tables.h>
 
 const Rune codepoint_decoded_length[256] = {
     // Basic Latin
@@ -1556,174 +6070,264 @@ static inline char* utf8_encode(Rune value) {
     return dst;
 }
 
-/*
-    WIP
-*/
+// Returns the packed (category | bidi_class << 5 | boundclass << 10) record for `ch`
+static inline UInt16 __utf8_properties(Rune ch) {
+    if(CORETEN_UNLIKELY(ch > UTF8_MAX_UNICODE))
+        return UTF8_CATEGORY_CN | (UTF8_BOUNDCLASS_OTHER << 10);
 
-static cstlUTF8Str* ubuff_new(Rune* data) {
-    cstlUTF8Str* ubuff = cast(cstlUTF8Str*)calloc(1, sizeof(ubuff));
-    CORETEN_ENFORCE_NN(ubuff, "Could not allocate memory. Memory full.");
+    UInt32 mid_block = utf8_trie_top[ch >> (UTF8_TRIE_LEAF_SHIFT + UTF8_TRIE_MID_SHIFT)];
+    UInt32 leaf_block = utf8_trie_mid[(mid_block << UTF8_TRIE_MID_SHIFT) + ((ch >> UTF8_TRIE_LEAF_SHIFT) & UTF8_TRIE_MID_MASK)];
+    return utf8_trie_records[utf8_trie_leaf[(leaf_block << UTF8_TRIE_LEAF_SHIFT) + (ch & UTF8_TRIE_LEAF_MASK)]];
+}
 
-    // ubuff_set(ubuff, data);
-    return ubuff;
+cstlUTF8Category utf8_category(Rune ch) {
+    return cast(cstlUTF8Category)(__utf8_properties(ch) & 0x1F);
 }
 
-void __grow_ubuff(cstlUTF8Str* ubuff, int grow_by) {
-    CORETEN_ENFORCE_NN(ubuff, "Expected not null");
-    CORETEN_ENFORCE(grow_by > 0);
+cstlUTF8BidiClass utf8_bidi_class(Rune ch) {
+    return cast(cstlUTF8BidiClass)((__utf8_properties(ch) >> 5) & 0x1F);
+}
 
-    ubuff->data = cast(Byte*)realloc(ubuff->data, grow_by);
-    memset(ubuff->data + ubuff->nbytes, 0, grow_by);
-    ubuff->nbytes += grow_by;
+cstlUTF8Boundclass utf8_boundclass(Rune ch) {
+    return cast(cstlUTF8Boundclass)((__utf8_properties(ch) >> 10) & 0x1F);
 }
 
-void ubuff_push_char(cstlUTF8Str* ubuff, Rune ch) {
-    CORETEN_ENFORCE(ubuff->data[ubuff->len] == 0); // ensure this is writeable (we shouldn't overwrite over a char)
+bool utf8_is_identifier_start(Rune ch) {
+    if(ch < 0x80)
+        return char_is_alpha(cast(char)ch) || ch == '_';
+
+    switch(utf8_category(ch)) {
+        case UTF8_CATEGORY_LU: case UTF8_CATEGORY_LL: case UTF8_CATEGORY_LT: case UTF8_CATEGORY_LM: 
+        case UTF8_CATEGORY_LO: case UTF8_CATEGORY_NL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool utf8_is_identifier_continue(Rune ch) {
+    if(ch < 0x80)
+        return char_is_alphanumeric(cast(char)ch) || ch == '_';
 
-    // 0b0xxxxxxx
-    if(ch <= 0x7f) {
-        __push_ascii_char(ubuff, ch);
+    switch(utf8_category(ch)) {
+        case UTF8_CATEGORY_LU: case UTF8_CATEGORY_LL: case UTF8_CATEGORY_LT: case UTF8_CATEGORY_LM: 
+        case UTF8_CATEGORY_LO: case UTF8_CATEGORY_NL: case UTF8_CATEGORY_MN: case UTF8_CATEGORY_MC: 
+        case UTF8_CATEGORY_ND: case UTF8_CATEGORY_PC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/*
+    WIP
+*/
+
+// Encodes the codepoint `ch` into `out` (which must have room for 4 bytes)
+// Returns the number of bytes written
+static inline UInt64 __utf8_encode_into(Rune ch, Byte* out) {
+    // 0xxxxxxx
+    if(ch <= 0x7F) {
+        out[0] = cast(Byte)ch;
+        return 1;
     }
     // 110xxxxx 10xxxxxx
-    else if(ch >= 0xC080 && ch <= 0xDFBF) {
-        // 2-byte character
-        __grow_ubuff(ubuff, 2);
-        UInt64 nbytes = ubuff->nbytes;
-        ubuff->data[nbytes    ] = cast(Byte)(ch >> 8);
-        ubuff->data[nbytes + 1] = cast(Byte)(ch);
-        ubuff->data[nbytes + 2] = 0;
-        ubuff->nbytes += 2;
-        ubuff->len += 1;
+    else if(ch <= 0x7FF) {
+        out[0] = cast(Byte)(0xC0 | (ch >> 6));
+        out[1] = cast(Byte)(0x80 | (ch & 0x3F));
+        return 2;
     }
     // 1110xxxx 10xxxxxx 10xxxxxx
-    else if(ch >= 0xE08080 && ch <= 0xEFBFBF) {
-        // 3-byte character
-        __grow_ubuff(ubuff, 3);
-        UInt64 nbytes = ubuff->nbytes;
-        ubuff->data[nbytes    ] = cast(Byte)(ch >> 16);
-        ubuff->data[nbytes + 1] = cast(Byte)(ch >> 8);
-        ubuff->data[nbytes + 2] = cast(Byte)(ch);
-        ubuff->data[nbytes + 3] = 0;
-        ubuff->nbytes += 3;
-        ubuff->len += 1;
+    else if(ch <= 0xFFFF) {
+        out[0] = cast(Byte)(0xE0 | (ch >> 12));
+        out[1] = cast(Byte)(0x80 | ((ch >> 6) & 0x3F));
+        out[2] = cast(Byte)(0x80 | (ch & 0x3F));
+        return 3;
     }
     // 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-    else if(ch >= 0xF0808080 && ch <= 0xF7BFBFBF) {
-        // 3-byte character
-        __grow_ubuff(ubuff, 3);
-        UInt64 nbytes = ubuff->nbytes;
-        ubuff->data[nbytes    ] = cast(Byte)(ch >> 24);
-        ubuff->data[nbytes + 1] = cast(Byte)(ch >> 16);
-        ubuff->data[nbytes + 2] = cast(Byte)(ch >> 8);
-        ubuff->data[nbytes + 3] = cast(Byte)(ch);
-        ubuff->data[nbytes + 4] = 0;
-        ubuff->nbytes += 4;
-        ubuff->len += 1;
+    out[0] = cast(Byte)(0xF0 | (ch >> 18));
+    out[1] = cast(Byte)(0x80 | ((ch >> 12) & 0x3F));
+    out[2] = cast(Byte)(0x80 | ((ch >> 6) & 0x3F));
+    out[3] = cast(Byte)(0x80 | (ch & 0x3F));
+    return 4;
+}
+
+// Decodes the codepoint starting at `s` (assumes valid UTF-8)
+static inline Rune __utf8_decode(const Byte* s) {
+    Byte c = s[0];
+    if(c < 0x80)
+        return c;
+    else if(c < 0xE0)
+        return (cast(Rune)(c & 0x1F) << 6) | (s[1] & 0x3F);
+    else if(c < 0xF0)
+        return (cast(Rune)(c & 0x0F) << 12) | (cast(Rune)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+    return (cast(Rune)(c & 0x07) << 18) | (cast(Rune)(s[1] & 0x3F) << 12) | (cast(Rune)(s[2] & 0x3F) << 6) | 
+           (s[3] & 0x3F);
+}
+
+// Make room for `grow_by` more bytes (and the null terminator) in `ubuff`
+void __grow_ubuff(cstlUTF8Str* ubuff, UInt64 grow_by) {
+    CORETEN_ENFORCE_NN(ubuff, "Expected not null");
+    if(ubuff->data && ubuff->nbytes + grow_by <= ubuff->cap)
+        return;
+
+    UInt64 cap = ubuff->cap ? ubuff->cap * 2 : 16;
+    while(cap < ubuff->nbytes + grow_by)
+        cap *= 2;
+
+    UInt64 old_size = ubuff->data ? ubuff->cap + 1 : 0;
+    ubuff->data = cast(Byte*)cstl_realloc(ubuff->allocator, ubuff->data, old_size, cap + 1);
+    ubuff->cap = cap;
+}
+
+// Record the breadcrumbs that are due, resuming from the last one
+// Each step walks exactly `CORETEN_UTF8_BREADCRUMB_STRIDE` codepoints, so this is amortized O(1) per codepoint
+static void __ubuff_update_crumbs(cstlUTF8Str* ubuff) {
+    if(!ubuff->crumbs) {
+        ubuff->crumbs_cap = 8;
+        ubuff->crumbs = cast(UInt64*)cstl_alloc(ubuff->allocator, ubuff->crumbs_cap * sizeof(UInt64));
+        ubuff->crumbs[0] = 0;
+        ubuff->ncrumbs = 1;
     }
-    else {
-        // TODO (jasmcaus): `panic()` here
-        fprintf(stderr, "Invalid UTF-8 character: %x", ch);
-        exit(1);
+
+    while(ubuff->ncrumbs * CORETEN_UTF8_BREADCRUMB_STRIDE < ubuff->len) {
+        UInt64 offset = ubuff->crumbs[ubuff->ncrumbs - 1];
+        for(UInt64 i = 0; i < CORETEN_UTF8_BREADCRUMB_STRIDE; i++)
+            offset += codepoint_decoded_length[ubuff->data[offset]];
+
+        if(ubuff->ncrumbs == ubuff->crumbs_cap) {
+            ubuff->crumbs = cast(UInt64*)cstl_realloc(ubuff->allocator, ubuff->crumbs, 
+                                                      ubuff->crumbs_cap * sizeof(UInt64), 
+                                                      ubuff->crumbs_cap * 2 * sizeof(UInt64));
+            ubuff->crumbs_cap *= 2;
+        }
+        ubuff->crumbs[ubuff->ncrumbs++] = offset;
+    }
+}
+
+// Append `n` bytes (holding `ncodepoints` codepoints of valid UTF-8) to `ubuff`
+static void __ubuff_append_bytes(cstlUTF8Str* ubuff, const Byte* bytes, UInt64 n, UInt64 ncodepoints) {
+    __grow_ubuff(ubuff, n);
+    memcpy(ubuff->data + ubuff->nbytes, bytes, n);
+    ubuff->nbytes += n;
+    ubuff->len += ncodepoints;
+    ubuff->data[ubuff->nbytes] = nullchar;
+
+    // Only keep the index up to date once someone has asked for it
+    if(ubuff->crumbs)
+        __ubuff_update_crumbs(ubuff);
+}
+
+// Create a new `cstlUTF8Str` from (null-terminated) UTF-8 data
+cstlUTF8Str* ubuff_new(const char* data) {
+    return ubuff_new_in(null, data);
+}
+
+// Create a new `cstlUTF8Str` from (null-terminated) UTF-8 data, allocated from `allocator` (null for the heap)
+cstlUTF8Str* ubuff_new_in(cstlAllocator* allocator, const char* data) {
+    cstlUTF8Str* ubuff = cstl_new_obj(allocator, cstlUTF8Str);
+    ubuff->allocator = allocator;
+
+    __grow_ubuff(ubuff, 0);
+    ubuff->data[0] = nullchar;
+    if(data)
+        ubuff_append(ubuff, data);
+    return ubuff;
+}
+
+// Free a `cstlUTF8Str` from its associated memory
+void ubuff_free(cstlUTF8Str* ubuff) {
+    if(ubuff) {
+        cstlAllocator* allocator = ubuff->allocator;
+        cstl_free(allocator, ubuff->data, ubuff->cap + 1);
+        cstl_free(allocator, ubuff->crumbs, ubuff->crumbs_cap * sizeof(UInt64));
+        cstl_free(allocator, ubuff, sizeof(cstlUTF8Str));
     }
 }
 
-void __push_byte(cstlUTF8Str* ubuff, Byte byte) {
-    CORETEN_ENFORCE(byte <= 0x7F);
-    __grow_ubuff(ubuff, 1);
-    ubuff->data[ubuff->nbytes++] = byte;
-    ubuff->data[ubuff->nbytes] = 0;
+// Assign `data` to the UTF-8 buffer
+void ubuff_set(cstlUTF8Str* ubuff, const char* data) {
+    CORETEN_ENFORCE_NN(ubuff, "Expected not null");
+
+    cstl_free(ubuff->allocator, ubuff->crumbs, ubuff->crumbs_cap * sizeof(UInt64));
+    ubuff->crumbs = null;
+    ubuff->ncrumbs = 0;
+    ubuff->crumbs_cap = 0;
+
+    ubuff->len = 0;
+    ubuff->nbytes = 0;
+    ubuff->data[0] = nullchar;
+    if(data)
+        ubuff_append(ubuff, data);
+}
+
+// Append (null-terminated) UTF-8 data to the buffer
+void ubuff_append(cstlUTF8Str* ubuff, const char* data) {
+    CORETEN_ENFORCE_NN(ubuff, "Expected not null");
+    CORETEN_ENFORCE_NN(data, "Expected not null");
+
+    UInt64 n = simd_strlen(data);
+    CORETEN_ENFORCE(simd_utf8_validate(data, n), "Invalid UTF-8 data");
+    __ubuff_append_bytes(ubuff, cast(const Byte*)data, n, simd_utf8_count(data, n));
 }
 
-void __push_ascii_char(cstlUTF8Str* ubuff, Byte byte) {
-    __push_byte(ubuff, byte);
-    ubuff->len += 1;
+// Append the codepoint `ch` to the buffer
+void ubuff_push_char(cstlUTF8Str* ubuff, Rune ch) {
+    CORETEN_ENFORCE_NN(ubuff, "Expected not null");
+    CORETEN_ENFORCE(ch != 0 && utf8_is_codepoint_valid(ch), "Invalid UTF-8 codepoint");
+
+    Byte bytes[4];
+    UInt64 n = __utf8_encode_into(ch, bytes);
+    __ubuff_append_bytes(ubuff, bytes, n, 1);
 }
 
 // Returns the number of UTF8 characters in the buffer
-static UInt64 ubuff_len(cstlUTF8Str* ubuff) {
+UInt64 ubuff_len(cstlUTF8Str* ubuff) {
     return ubuff->len;
 }
 
 // Returns the number of bytes used by the UTF8 buffer.
-static UInt64 ubuff_nbytes(cstlUTF8Str* ubuff) {
+UInt64 ubuff_nbytes(cstlUTF8Str* ubuff) {
     return ubuff->nbytes;
 }
 
-/*
-#define WRITE_OUT(val)	if(out)	*out = (val)
-// Return the byte at the `n`th byte offset
-// If `out` is null, we don't intend on knowing how many bytes the UTF8 character uses.
-static int __byte_offset_at(cstlUTF8Str* ubuff, Int64 n, int* out) {
+// Returns the byte offset of the `n`th character. `n == ubuff_len()` gives the offset of the end of the buffer
+// The first call builds the breadcrumb index, after which this is O(1)
+UInt64 ubuff_byte_offset(cstlUTF8Str* ubuff, UInt64 n) {
     CORETEN_ENFORCE_NN(ubuff, "Expected not null");
-    CORETEN_ENFORCE_NN(ubuff->data, "Expected not null");
-    // Fail-fast approach. If this changes, comment this, and uncomment the following (commented) snippet
-    CORETEN_ENFORCE(n < ubuff->nbytes);
-    CORETEN_ENFORCE(n > 0);
-    // if((n >= ubuff->nbytes) || (n < 0)) {
-    // 	return nullchar;
-    // }
+    CORETEN_ENFORCE(n <= ubuff->len, "Index out of bounds");
 
-    Byte byte = cast(Byte)(ubuff->data[n]);
-    if(byte == 0) {
-        return cast(Byte)0;
-    } 
-    // 1-byte UTF8
-    else if(byte <= 0x07F) {
-        WRITE_OUT(1);
-        return byte;
-    } 
-    // 2-byte UF8
-    else if(byte >= 0x80 && byte <= 0x07FF) {
-        WRITE_OUT(2);
-        byte = (byte << 8) + cast(Byte)(ubuff->data[n + 1]);
-        return byte;
-    } 
-    // 3-byte UTF8
-    else if(byte >= 0x0800 && byte <= 0xFFFF) {
-        WRITE_OUT(3);
-        byte = byte << 16;
-        byte = (byte) | (cast(Byte)(ubuff->data[n + 1]) << 8);
-        byte = (byte) | (cast(Byte)(ubuff->data[n + 2]) << 16);
-        return byte;
-    }
-    // 4-byte UTF8
-    else if(byte >= 0x00010000 && byte <= 0x0010FFFF) {
-        WRITE_OUT(4);
-        byte = byte << 24;
-        byte = (byte) | (cast(Byte)(ubuff->data[n + 1]) << 16);
-        byte = (byte) | (cast(Byte)(ubuff->data[n + 2]) << 8);
-        byte = (byte) | (cast(Byte)(ubuff->data[n + 3]));
-        return byte;
-    } else {
-        // TODO (jasmcaus): `panic()` here
-        fprintf(stderr, "Cannot decode UTF8 byte `%hx` at byte offset %d", byte, n);
-        exit(1);
-    }
-}
+    if(n == ubuff->len)
+        return ubuff->nbytes;
+    if(CORETEN_UNLIKELY(!ubuff->crumbs))
+        __ubuff_update_crumbs(ubuff);
 
-// Return the byte at the `n`th byte offset
-static Byte ubuff_byte_offset_at(cstlUTF8Str* ubuff, Int64 n) {
-    return __byte_offset_at(ubuff, n, null);
+    UInt64 offset = ubuff->crumbs[n / CORETEN_UTF8_BREADCRUMB_STRIDE];
+    for(UInt64 i = n % CORETEN_UTF8_BREADCRUMB_STRIDE; i > 0; i--)
+        offset += codepoint_decoded_length[ubuff->data[offset]];
+    return offset;
 }
 
+// Returns the codepoint at the `n`th character offset
+Rune ubuff_at(cstlUTF8Str* ubuff, UInt64 n) {
+    CORETEN_ENFORCE_NN(ubuff, "Expected not null");
+    CORETEN_ENFORCE(n < ubuff->len, "Index out of bounds");
+
+    return __utf8_decode(ubuff->data + ubuff_byte_offset(ubuff, n));
+}
 
-// Returns the byte at `n`th character offset
-static Byte ubuff_at(cstlUTF8Str* ubuff, Int64 n) {
+// Returns a new buffer holding the characters in [begin, end)
+cstlUTF8Str* ubuff_slice(cstlUTF8Str* ubuff, UInt64 begin, UInt64 end) {
     CORETEN_ENFORCE_NN(ubuff, "Expected not null");
-    CORETEN_ENFORCE_NN(ubuff->data, "Expected not null");
-    CORETEN_ENFORCE(n < ubuff->len);
-    CORETEN_ENFORCE(n > 0);
-    int a[1];
+    CORETEN_ENFORCE(begin <= end && end <= ubuff->len, "Invalid slice bounds");
 
-    UInt64 byte_offset = 0;
-    while(n != 0) {
-        Byte b = __byte_offset_at(ubuff, byte_offset, a); // we only care about `a`
-        byte_offset += cast(UInt64)a;
-        --n;
-    }
-    return ubuff_byte_offset_at(ubuff, byte_offset);
+    UInt64 begin_offset = ubuff_byte_offset(ubuff, begin);
+    UInt64 end_offset = ubuff_byte_offset(ubuff, end);
+
+    cstlUTF8Str* slice = ubuff_new_in(ubuff->allocator, null);
+    __ubuff_append_bytes(slice, ubuff->data + begin_offset, end_offset - begin_offset, end - begin);
+    return slice;
 }
-*/
 
 
 // -------------------------------------------------------------------------
@@ -1734,17 +6338,18 @@ static Byte ubuff_at(cstlUTF8Str* ubuff, Int64 n) {
 // size = size of each element (in bytes)
 // capacity = number of elements
 cstlVector* _vec_new(UInt64 objsize, UInt64 capacity) {
+    return _vec_new_in(null, objsize, capacity);
+}
+
+// Create a new `cstlVector`, allocated from `allocator` (null for the default allocator)
+cstlVector* _vec_new_in(cstlAllocator* allocator, UInt64 objsize, UInt64 capacity) {
     if(capacity == 0)
         capacity = VEC_INIT_ALLOC_CAP;
+    CORETEN_ENFORCE(capacity < cast(UInt64)-1 / objsize);
     
-    cstlVector* vec = cast(cstlVector*)calloc(1, sizeof(cstlVector));
-    CORETEN_ENFORCE_NN(vec, "Could not allocate memory. Memory full.");
-
-    vec->internal.data = cast(void*)calloc(objsize, capacity);
-    if(!vec->internal.data) {
-        free(vec);
-        CORETEN_ENFORCE_NN(vec->internal.data, "Could not allocate memory. Memory full.");
-    }
+    cstlVector* vec = cstl_new_obj(allocator, cstlVector);
+    vec->internal.allocator = allocator;
+    vec->internal.data = cast(void*)cstl_alloc(allocator, objsize * capacity);
 
     vec->internal.capacity = capacity;
     vec->internal.size = 0;
@@ -1756,9 +6361,9 @@ cstlVector* _vec_new(UInt64 objsize, UInt64 capacity) {
 // Free a cstlVector from it's associated memory
 void vec_free(cstlVector* vec) {
     if(vec) {
-        if(vec->internal.data)
-            free(vec->internal.data);
-        free(vec);
+        cstlAllocator* allocator = vec->internal.allocator;
+        cstl_free(allocator, vec->internal.data, vec->internal.capacity * vec->internal.objsize);
+        cstl_free(allocator, vec, sizeof(cstlVector));
     }
 }
 
@@ -1860,6 +6465,74 @@ bool vec_pop(cstlVector* vec) {
     return true;
 }
 
+// Make sure `vec` has room for at least `capacity` elements.
+// Unlike `__vec_grow()`, this allocates exactly `capacity` elements - use it when the final size is known (or can be
+// estimated) upfront.
+bool vec_reserve(cstlVector* vec, UInt64 capacity) {
+    CORETEN_ENFORCE_NN(vec, "Expected not null");
+    CORETEN_ENFORCE_NN(vec->internal.data, "Expected not null");
+    CORETEN_ENFORCE(vec->internal.objsize > 0);
+
+    if(capacity <= vec->internal.capacity)
+        return true;
+    CORETEN_ENFORCE(capacity < cast(UInt64)-1/vec->internal.objsize);
+
+    void* newdata = cstl_realloc(vec->internal.allocator, vec->internal.data, 
+                                 vec->internal.capacity * vec->internal.objsize, capacity * vec->internal.objsize);
+
+    vec->internal.data = newdata;
+    vec->internal.capacity = capacity;
+    return true;
+}
+
+// Push `n` elements (stored contiguously at `data`) into `vec` (at the end)
+// This grows `vec` at most once
+bool vec_push_n(cstlVector* vec, const void* data, UInt64 n) {
+    CORETEN_ENFORCE_NN(vec, "Expected not null");
+    CORETEN_ENFORCE_NN(vec->internal.data, "Expected not null");
+
+    if(n == 0)
+        return true;
+    CORETEN_ENFORCE_NN(data, "Expected not null");
+
+    if(vec->internal.size + n > vec->internal.capacity) {
+        bool result = __vec_grow(vec, vec->internal.size + n);
+        if(!result)
+            return false;
+    }
+
+    memcpy(VECTOR_AT_MACRO(vec, vec->internal.size), data, n * vec->internal.objsize);
+    vec->internal.size += n;
+    return true;
+}
+
+// Push all elements of `other` into `vec` (at the end)
+// Both vectors must hold elements of the same size
+bool vec_extend(cstlVector* vec, cstlVector* other) {
+    CORETEN_ENFORCE_NN(other, "Expected not null");
+    CORETEN_ENFORCE(vec->internal.objsize == other->internal.objsize, "Cannot extend a vector with elements of a different size");
+
+    return vec_push_n(vec, other->internal.data, other->internal.size);
+}
+
+// Release the unused capacity of `vec`
+bool vec_shrink_to_fit(cstlVector* vec) {
+    CORETEN_ENFORCE_NN(vec, "Expected not null");
+    CORETEN_ENFORCE_NN(vec->internal.data, "Expected not null");
+
+    // Keep at least one element allocated - `internal.data` is expected to never be null
+    UInt64 capacity = vec->internal.size > 0 ? vec->internal.size : 1;
+    if(capacity >= vec->internal.capacity)
+        return true;
+
+    void* newdata = cstl_realloc(vec->internal.allocator, vec->internal.data, 
+                                 vec->internal.capacity * vec->internal.objsize, capacity * vec->internal.objsize);
+
+    vec->internal.data = newdata;
+    vec->internal.capacity = capacity;
+    return true;
+}
+
 // Grow the capacity of `vec` to at least `capacity`.
 // If more space is needed, grow `vec` to `capacity`, but at least by a factor of 1.5.
 bool __vec_grow(cstlVector* vec, UInt64 capacity) {
@@ -1871,6 +6544,7 @@ bool __vec_grow(cstlVector* vec, UInt64 capacity) {
 
     if (capacity <= vec->internal.capacity)
         return true;
+    STATS_INC(StatsVectorRegrows);
 
     CORETEN_ENFORCE(vec->internal.objsize > 0);
     CORETEN_ENFORCE(capacity < cast(UInt64)-1/vec->internal.objsize);
@@ -1885,11 +6559,446 @@ bool __vec_grow(cstlVector* vec, UInt64 capacity) {
     if (capacity > newcapacity || newcapacity >= (size_t) -1 / vec->internal.objsize)
         newcapacity = capacity;
 
-    newdata = realloc(vec->internal.data, newcapacity * vec->internal.objsize);
-    CORETEN_ENFORCE_NN(newdata, "Expected not null");
+    newdata = cstl_realloc(vec->internal.allocator, vec->internal.data, 
+                           vec->internal.capacity * vec->internal.objsize, newcapacity * vec->internal.objsize);
 
     vec->internal.data = newdata;
     vec->internal.capacity = newcapacity;
 
     return true;
-}
\ No newline at end of file
+}
+
+// Reallocate `data` (of a typed vector) to hold exactly `capacity` elements
+void* __tvec_realloc(cstlAllocator* allocator, void* data, UInt64* cap, UInt64 objsize, UInt64 capacity) {
+    CORETEN_ENFORCE(objsize > 0);
+    CORETEN_ENFORCE(capacity < cast(UInt64)-1 / objsize);
+
+    if(capacity == 0) {
+        cstl_free(allocator, data, *cap * objsize);
+        *cap = 0;
+        return null;
+    }
+
+    void* newdata = cstl_realloc(allocator, data, *cap * objsize, capacity * objsize);
+    *cap = capacity;
+    return newdata;
+}
+
+// Reallocate `data` (of a typed vector) to hold at least `capacity` elements.
+// Small vectors grow by a factor of 2, and larger ones by 1.5 (like `__vec_grow()`)
+void* __tvec_grow(cstlAllocator* allocator, void* data, UInt64* cap, UInt64 objsize, UInt64 capacity) {
+    CORETEN_ENFORCE(objsize > 0);
+    if(capacity <= *cap)
+        return data;
+    STATS_INC(StatsVectorRegrows);
+
+    UInt64 newcapacity;
+    if(*cap < VEC_INIT_ALLOC_CAP / objsize)
+        newcapacity = *cap + *cap + 1;
+    else
+        newcapacity = *cap + *cap / 2 + 1;
+
+    if(capacity > newcapacity)
+        newcapacity = capacity;
+    return __tvec_realloc(allocator, data, cap, objsize, newcapacity);
+}
+
+// Grow a small vector to hold at least `capacity` elements, spilling the inline elements to the heap if required
+void* __svec_grow(cstlAllocator* allocator, void* heap, const void* inline_data, UInt64 size, UInt64* cap, 
+                  UInt64 objsize, UInt64 inline_cap, UInt64 capacity) {
+    if(heap != null)
+        return __tvec_grow(allocator, heap, cap, objsize, capacity);
+
+    if(capacity <= inline_cap) {
+        *cap = inline_cap;
+        return null;
+    }
+
+    UInt64 newcapacity = inline_cap * 2;
+    if(capacity > newcapacity)
+        newcapacity = capacity;
+    CORETEN_ENFORCE(newcapacity < cast(UInt64)-1 / objsize);
+
+    STATS_INC(StatsVectorRegrows);
+    void* newdata = cstl_alloc(allocator, newcapacity * objsize);
+    memcpy(newdata, inline_data, size * objsize);
+    *cap = newcapacity;
+    return newdata;
+}
+
+// Allocate new chunks for a segmented vector until it can hold at least `capacity` elements.
+// Existing chunks are never touched.
+void __segvec_reserve(cstlAllocator* allocator, void** chunks, UInt32* nchunks, UInt32* shift, UInt64* cap, 
+                      UInt64 objsize, UInt64 capacity) {
+    CORETEN_ENFORCE(objsize > 0);
+
+    // Nothing has been allocated yet, so the first chunk can be sized to fit `capacity` on its own
+    if(*nchunks == 0 && capacity > (cast(UInt64)1 << *shift)) {
+        UInt32 newshift = __segvec_log2(capacity - 1) + 1;
+        *shift = newshift < CORETEN_SEGVEC_MAX_SHIFT ? newshift : CORETEN_SEGVEC_MAX_SHIFT;
+    }
+
+    while(*cap < capacity) {
+        CORETEN_ENFORCE(*nchunks < CORETEN_SEGVEC_MAX_CHUNKS, "Segmented vector is full");
+        UInt64 len = cast(UInt64)1 << (*shift + *nchunks);
+        CORETEN_ENFORCE(len < cast(UInt64)-1 / objsize);
+
+        chunks[*nchunks] = cstl_alloc(allocator, len * objsize);
+        *nchunks += 1;
+        STATS_INC(StatsSegVecChunks);
+        *cap += len;
+    }
+}
+
+void __segvec_free(cstlAllocator* allocator, void** chunks, UInt32 nchunks, UInt32 shift, UInt64 objsize) {
+    for(UInt32 k = 0; k < nchunks; k++)
+        cstl_free(allocator, chunks[k], (cast(UInt64)1 << (shift + k)) * objsize);
+}
+
+// -------------------------------------------------------------------------
+// vfs.c
+// -------------------------------------------------------------------------
+
+#include <errno.h>
+
+// Length of the root ("/", "C:\") at the start of `path`. 0 for relative paths
+static UInt64 __vfs_root_length(const char* path, UInt64 length) {
+#if defined(CORETEN_OS_WINDOWS)
+    if(length >= 3 && char_is_alpha(path[0]) && path[1] == ':' && os_is_sep(path[2]))
+        return 3;
+#endif // CORETEN_OS_WINDOWS
+    return length >= 1 && os_is_sep(path[0]) ? 1 : 0;
+}
+
+static void __vfs_reserve_scratch(cstlVfs* vfs, UInt64 capacity) {
+    if(capacity <= vfs->scratch_capacity)
+        return;
+    UInt64 newcap = vfs->scratch_capacity ? vfs->scratch_capacity : 256;
+    while(newcap < capacity)
+        newcap *= 2;
+    vfs->scratch = cast(char*)cstl_realloc(vfs->allocator, vfs->scratch, vfs->scratch_capacity, newcap);
+    vfs->scratch_capacity = newcap;
+}
+
+// Canonicalize `path` (relative to the canonical directory `base`) into `vfs->scratch`. Returns its length
+static UInt64 __vfs_canonicalize(cstlVfs* vfs, const char* base, UInt64 base_length, const char* path, 
+                                 UInt64 length) {
+    __vfs_reserve_scratch(vfs, base_length + length + 4);
+    char* out = vfs->scratch;
+    UInt64 root = __vfs_root_length(path, length);
+    UInt64 outlen;
+    if(root > 0) {
+        memcpy(out, path, root);
+        out[root - 1] = CORETEN_OS_SEP_CHAR;
+        outlen = root;
+    } else {
+        memcpy(out, base, base_length);
+        outlen = base_length;
+        root = __vfs_root_length(base, base_length);
+    }
+
+    UInt64 i = __vfs_root_length(path, length);
+    while(i < length) {
+        UInt64 start = i;
+        while(i < length && !os_is_sep(path[i]))
+            i++;
+        UInt64 n = i - start;
+        i++;
+
+        if(n == 0 || (n == 1 && path[start] == '.'))
+            continue;
+        if(n == 2 && path[start] == '.' && path[start + 1] == '.') {
+            while(outlen > root && out[outlen - 1] != CORETEN_OS_SEP_CHAR)
+                outlen--;
+            if(outlen > root)
+                outlen--;
+            continue;
+        }
+        if(outlen > root)
+            out[outlen++] = CORETEN_OS_SEP_CHAR;
+        memcpy(out + outlen, path + start, n);
+        outlen += n;
+    }
+    out[outlen] = nullchar;
+    return outlen;
+}
+
+static cstlVfsEntry* __vfs_entry(cstlVfs* vfs, cstlVfsPath path) {
+    CORETEN_ENFORCE(path != VFS_INVALID_PATH && path < vfs->nentries, "Invalid VFS path");
+    return &vfs->entries[path];
+}
+
+// Intern the canonical path in `vfs->scratch`
+static cstlVfsPath __vfs_intern_scratch(cstlVfs* vfs, UInt64 length) {
+    char* key = vfs->scratch;
+    cstlVfsPath* found = cast(cstlVfsPath*)hashmap_get(vfs->ids, &key);
+    if(found)
+        return *found;
+
+    CORETEN_ENFORCE(length < cast(UInt32)-1, "Path is too long");
+    if(vfs->nentries == vfs->capacity) {
+        UInt32 capacity = vfs->capacity * 2;
+        vfs->entries = cast(cstlVfsEntry*)cstl_realloc(vfs->allocator, vfs->entries, 
+                                                       vfs->capacity * sizeof(cstlVfsEntry), 
+                                                       capacity * sizeof(cstlVfsEntry));
+        vfs->capacity = capacity;
+    }
+
+    cstlVfsPath id = vfs->nentries++;
+    cstlVfsEntry* entry = &vfs->entries[id];
+    memset(entry, 0, sizeof(*entry));
+    entry->path = arena_strndup(vfs->strings, vfs->scratch, length);
+    entry->length = cast(UInt32)length;
+    entry->generation = vfs->generation;
+
+    UInt64 root = __vfs_root_length(entry->path, length);
+    UInt64 basename = length;
+    while(basename > root && entry->path[basename - 1] != CORETEN_OS_SEP_CHAR)
+        basename--;
+    entry->basename = cast(UInt32)(length == root ? length : basename);
+
+    hashmap_put(vfs->ids, &entry->path, &id);
+    return id;
+}
+
+// Drop whatever was cached before the last `vfs_invalidate_all()`
+static void __vfs_refresh(cstlVfs* vfs, cstlVfsEntry* entry) {
+    if(entry->generation == vfs->generation)
+        return;
+    if(entry->contents) {
+        cstl_free(vfs->allocator, entry->contents, entry->contents_length + 1);
+        entry->contents = null;
+    }
+    entry->has_stat = false;
+    entry->generation = vfs->generation;
+}
+
+cstlVfs* vfs_new(cstlAllocator* allocator) {
+    cstlVfs* vfs = cstl_new_obj(allocator, cstlVfs);
+    vfs->allocator = allocator;
+    vfs->strings = arena_new(0);
+    vfs->ids = _hashmap_new_in(allocator, sizeof(char*), sizeof(cstlVfsPath), 0, hashmap_str_hash, hashmap_str_eq);
+    vfs->capacity = 64;
+    vfs->nentries = 1;
+    vfs->entries = cast(cstlVfsEntry*)cstl_alloc(allocator, vfs->capacity * sizeof(cstlVfsEntry));
+
+    // The working directory, which relative paths are resolved against
+    UInt64 size = 256;
+    char* cwd = cast(char*)cstl_alloc(allocator, size);
+    for(;;) {
+    #if defined(CORETEN_OS_WINDOWS)
+        bool ok = _getcwd(cwd, cast(int)size) != null;
+    #else
+        bool ok = getcwd(cwd, size) != null;
+    #endif // CORETEN_OS_WINDOWS
+        if(ok || errno != ERANGE) {
+            if(!ok)
+                strcpy(cwd, "/");
+            break;
+        }
+        cwd = cast(char*)cstl_realloc(allocator, cwd, size, size * 2);
+        size *= 2;
+    }
+    UInt64 length = __vfs_canonicalize(vfs, null, 0, cwd, strlen(cwd));
+    cstl_free(allocator, cwd, size);
+    vfs->cwd = cast(char*)cstl_alloc(allocator, length + 1);
+    memcpy(vfs->cwd, vfs->scratch, length);
+    vfs->cwd_length = length;
+    return vfs;
+}
+
+void vfs_free(cstlVfs* vfs) {
+    if(vfs == null)
+        return;
+    for(UInt32 i = 1; i < vfs->nentries; i++) {
+        cstlVfsEntry* entry = &vfs->entries[i];
+        if(entry->contents)
+            cstl_free(vfs->allocator, entry->contents, entry->contents_length + 1);
+        if(entry->overlay)
+            cstl_free(vfs->allocator, entry->overlay, entry->overlay_length + 1);
+    }
+    cstl_free(vfs->allocator, vfs->entries, vfs->capacity * sizeof(cstlVfsEntry));
+    cstl_free(vfs->allocator, vfs->scratch, vfs->scratch_capacity);
+    cstl_free(vfs->allocator, vfs->cwd, vfs->cwd_length + 1);
+    hashmap_free(vfs->ids);
+    arena_free(vfs->strings);
+    cstl_free_obj(vfs->allocator, vfs);
+}
+
+cstlVfsPath vfs_intern(cstlVfs* vfs, const char* path) {
+    CORETEN_ENFORCE_NN(path, "Cannot intern a null path");
+    return vfs_intern_n(vfs, path, strlen(path));
+}
+
+cstlVfsPath vfs_intern_n(cstlVfs* vfs, const char* path, UInt64 length) {
+    UInt64 n = __vfs_canonicalize(vfs, vfs->cwd, vfs->cwd_length, path, length);
+    return __vfs_intern_scratch(vfs, n);
+}
+
+cstlVfsPath vfs_join(cstlVfs* vfs, cstlVfsPath dir, const char* name) {
+    CORETEN_ENFORCE_NN(name, "Cannot join a null path");
+    cstlVfsEntry* entry = __vfs_entry(vfs, dir);
+    UInt64 n = __vfs_canonicalize(vfs, entry->path, entry->length, name, strlen(name));
+    return __vfs_intern_scratch(vfs, n);
+}
+
+cstlVfsPath vfs_dirname(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    if(entry->dirname != VFS_INVALID_PATH)
+        return entry->dirname;
+
+    UInt64 root = __vfs_root_length(entry->path, entry->length);
+    UInt64 length = entry->basename > root ? entry->basename - 1 : root;
+    __vfs_reserve_scratch(vfs, length + 1);
+    memcpy(vfs->scratch, entry->path, length);
+    vfs->scratch[length] = nullchar;
+    cstlVfsPath dirname = __vfs_intern_scratch(vfs, length);
+
+    // Interning may have moved the entries
+    vfs->entries[path].dirname = dirname;
+    return dirname;
+}
+
+const char* vfs_path(cstlVfs* vfs, cstlVfsPath path) {
+    return __vfs_entry(vfs, path)->path;
+}
+
+UInt64 vfs_path_length(cstlVfs* vfs, cstlVfsPath path) {
+    return __vfs_entry(vfs, path)->length;
+}
+
+const char* vfs_basename(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    return entry->path + entry->basename;
+}
+
+const char* vfs_extname(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    const char* ext = strrchr(entry->path + entry->basename, '.');
+    return ext ? ext : entry->path + entry->length;
+}
+
+cstlVfsStat vfs_stat(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    if(entry->overlay) {
+        cstlVfsStat stat = {true, false, entry->overlay_length, 0};
+        return stat;
+    }
+
+    __vfs_refresh(vfs, entry);
+    if(entry->has_stat) {
+        STATS_INC(StatsVfsStatHits);
+    } else {
+        struct stat st;
+        STATS_INC(StatsVfsStatMisses);
+        vfs->nsyscalls++;
+        memset(&entry->stat, 0, sizeof(entry->stat));
+        if(stat(entry->path, &st) == 0) {
+            entry->stat.exists = true;
+            entry->stat.is_dir = (st.st_mode & S_IFMT) == S_IFDIR;
+            entry->stat.size = cast(UInt64)st.st_size;
+            entry->stat.mtime = cast(Int64)st.st_mtime;
+        }
+        entry->has_stat = true;
+    }
+    return entry->stat;
+}
+
+bool vfs_exists(cstlVfs* vfs, cstlVfsPath path) {
+    return vfs_stat(vfs, path).exists;
+}
+
+bool vfs_is_file(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsStat stat = vfs_stat(vfs, path);
+    return stat.exists && !stat.is_dir;
+}
+
+bool vfs_is_dir(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsStat stat = vfs_stat(vfs, path);
+    return stat.exists && stat.is_dir;
+}
+
+void vfs_invalidate(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    __vfs_refresh(vfs, entry);
+    if(entry->contents) {
+        cstl_free(vfs->allocator, entry->contents, entry->contents_length + 1);
+        entry->contents = null;
+    }
+    entry->has_stat = false;
+}
+
+void vfs_invalidate_all(cstlVfs* vfs) {
+    vfs->generation++;
+}
+
+const char* vfs_read(cstlVfs* vfs, cstlVfsPath path, UInt64* length) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    if(entry->overlay) {
+        if(length)
+            *length = entry->overlay_length;
+        return entry->overlay;
+    }
+
+    __vfs_refresh(vfs, entry);
+    if(entry->contents) {
+        STATS_INC(StatsVfsReadHits);
+    } else {
+        STATS_INC(StatsVfsReadMisses);
+        vfs->nsyscalls++;
+        FILE* file = fopen(entry->path, "rb");
+        if(!file)
+            return null;
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        if(size < 0) {
+            fclose(file);
+            return null;
+        }
+
+        entry->contents_length = cast(UInt64)size;
+        entry->contents = cast(char*)cstl_alloc_aligned(vfs->allocator, entry->contents_length + 1, 1);
+        UInt64 nread = fread(entry->contents, 1, entry->contents_length, file);
+        bool failed = ferror(file) != 0;
+        fclose(file);
+        if(failed) {
+            cstl_free(vfs->allocator, entry->contents, entry->contents_length + 1);
+            entry->contents = null;
+            return null;
+        }
+        // The file may have shrunk in the meantime
+        if(nread < entry->contents_length) {
+            entry->contents = cast(char*)cstl_realloc(vfs->allocator, entry->contents, entry->contents_length + 1, 
+                                                      nread + 1);
+            entry->contents_length = nread;
+        }
+        entry->contents[nread] = nullchar;
+    }
+    if(length)
+        *length = entry->contents_length;
+    return entry->contents;
+}
+
+void vfs_set_overlay(cstlVfs* vfs, cstlVfsPath path, const char* contents, UInt64 length) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    if(entry->overlay)
+        cstl_free(vfs->allocator, entry->overlay, entry->overlay_length + 1);
+    entry->overlay = cast(char*)cstl_alloc_aligned(vfs->allocator, length + 1, 1);
+    if(length)
+        memcpy(entry->overlay, contents, length);
+    entry->overlay_length = length;
+}
+
+void vfs_remove_overlay(cstlVfs* vfs, cstlVfsPath path) {
+    cstlVfsEntry* entry = __vfs_entry(vfs, path);
+    if(entry->overlay) {
+        cstl_free(vfs->allocator, entry->overlay, entry->overlay_length + 1);
+        entry->overlay = null;
+        entry->overlay_length = 0;
+    }
+}
+
+bool vfs_has_overlay(cstlVfs* vfs, cstlVfsPath path) {
+    return __vfs_entry(vfs, path)->overlay != null;
+}
@@ -100,19 +100,15 @@ void coreten_panic(PanicLevel pl, const char* format, ...);
         "Please file an issue on Adorad's Github repository"                                       \
     )
 
+// Report a failed `CORETEN_ENFORCE()` and abort. Kept out of line, so every check costs a compare and a call
+ATTRIBUTE_COLD
+ATTRIBUTE_NORETURN
+void __coreten_enforce_failed(const char* file, unsigned line, const char* cond, const char* msg);
+
 #define __ENFORCE__(cond, ...)                                                              \
     do {                                                                                    \
-        if(!(cond)) {                                                                       \
-            printf("%s:%u: ", __FILE__, __LINE__);                                          \
-            if((sizeof(char[]){__VA_ARGS__}) <= 1)                                          \
-                cstlColouredPrintf(CORETEN_COLOUR_ERROR, "FAILED");                         \
-            else                                                                            \
-                cstlColouredPrintf(CORETEN_COLOUR_ERROR, __VA_ARGS__);                      \
-            printf("\n");                                                                   \
-            printf("The following assertion failed: \n");                                   \
-            cstlColouredPrintf(CORETEN_COLOUR_CYAN, "    CORETEN_ENFORCE( %s )\n", #cond);  \
-            abort();                                                                        \
-        }                                                                                   \
+        if(!(cond))                                                                         \
+            __coreten_enforce_failed(__FILE__, __LINE__, #cond, __VA_ARGS__);               \
     }                                                                                       \
     while(0)
 
@@ -14,13 +14,24 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #ifndef CORETEN_HASH_H
 #define CORETEN_HASH_H
 
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+
 /*
     Hashing & Checksum Functions
+
+    The CRCs use slicing-by-8 tables (8 bytes per step). `hash_crc32c()` uses the SSE4.2 `crc32` instruction when 
+    `cpu_features()` reports it, or the ARMv8 CRC instructions when compiled for them and the CPU has them.
+
+    `hash_fast64()` is the hash to reach for when hashing whole files or long keys: wyhash for short inputs, and an 
+    XXH3-style striped loop (vectorized with SSE2/AVX2, picked at runtime) for long ones.
 */
 
 UInt32 hash_adler32(void const* data, Ll len);
 
 UInt32 hash_crc32(void const* data, Ll len);
+// CRC-32C (Castagnoli), as used by iSCSI, ext4 and friends
+UInt32 hash_crc32c(void const* data, Ll len);
 UInt64 hash_crc64(void const* data, Ll len);
 
 UInt32 hash_fnv32 (void const* data, Ll len);
@@ -36,4 +47,83 @@ UInt64 hash_murmur64(void const* data, Ll len);
 UInt32 hash_murmur32_seed(void const* data, Ll len, UInt32 seed);
 UInt64 hash_murmur64_seed(void const* data__, Ll len, UInt64 seed);
 
+UInt64 hash_fast64(void const* data, Ll len);
+UInt64 hash_fast64_seed(void const* data, Ll len, UInt64 seed);
+
+// Mix two hashes into one (order matters)
+UInt64 hash_combine64(UInt64 a, UInt64 b);
+
+/*
+    Streaming hashes
+
+    Feeding an input through `*_update()` in any number of pieces gives the same result as the one-shot function, 
+    so files can be hashed while they're read, and several inputs (source, flags, dependencies...) can be hashed 
+    into one key without concatenating them:
+
+        cstlHashFast64State state;
+        hash_fast64_init(&state, 0);
+        hash_fast64_update(&state, source, source_len);
+        hash_fast64_update(&state, flags, flags_len);
+        UInt64 key = hash_fast64_final(&state);
+
+    `*_final()` doesn't modify the state.
+*/
+typedef struct cstlHashCrc32State {
+    UInt32 crc;
+} cstlHashCrc32State;
+
+typedef struct cstlHashCrc64State {
+    UInt64 crc;
+} cstlHashCrc64State;
+
+typedef struct cstlHashMurmur64State {
+    UInt64 h;
+    UInt64 len;             // bytes fed so far
+    UInt64 total_len;       // bytes expected (murmur64 hashes the length first)
+    UInt8 tail[8];          // a partial block
+    UInt32 ntail;
+} cstlHashMurmur64State;
+
+// Inputs up to this many bytes are buffered and hashed in `hash_fast64_final()`
+#define HASH_FAST64_BUFFER_SIZE     256
+
+typedef struct cstlHashFast64State {
+    UInt64 acc[8];
+    UInt64 key[24];
+    UInt64 seed;
+    UInt64 len;             // bytes fed so far
+    UInt32 nstripes;        // stripes accumulated in the current block
+    UInt32 buffered;        // bytes in `buffer`
+    UInt8 buffer[HASH_FAST64_BUFFER_SIZE];
+    UInt8 last_stripe[64];  // the last 64 bytes accumulated (the final stripe may overlap them)
+} cstlHashFast64State;
+
+void hash_crc32_init(cstlHashCrc32State* state);
+void hash_crc32_update(cstlHashCrc32State* state, void const* data, Ll len);
+UInt32 hash_crc32_final(cstlHashCrc32State* state);
+
+void hash_crc32c_init(cstlHashCrc32State* state);
+void hash_crc32c_update(cstlHashCrc32State* state, void const* data, Ll len);
+UInt32 hash_crc32c_final(cstlHashCrc32State* state);
+
+void hash_crc64_init(cstlHashCrc64State* state);
+void hash_crc64_update(cstlHashCrc64State* state, void const* data, Ll len);
+UInt64 hash_crc64_final(cstlHashCrc64State* state);
+
+// `total_len` is the length of the whole input. Matches `hash_murmur64_seed()` on 64-bit targets
+void hash_murmur64_init(cstlHashMurmur64State* state, UInt64 seed, UInt64 total_len);
+void hash_murmur64_update(cstlHashMurmur64State* state, void const* data, Ll len);
+UInt64 hash_murmur64_final(cstlHashMurmur64State* state);
+
+void hash_fast64_init(cstlHashFast64State* state, UInt64 seed);
+void hash_fast64_update(cstlHashFast64State* state, void const* data, Ll len);
+UInt64 hash_fast64_final(cstlHashFast64State* state);
+
+// Stream the file at `fname` through `hash_fast64`. Returns false if it can't be read
+bool hash_fast64_file(const char* fname, UInt64 seed, UInt64* hash);
+
+// Scalar reference implementations
+UInt32 __hash_crc32c_scalar(void const* data, Ll len);
+UInt64 __hash_fast64_scalar(void const* data, Ll len, UInt64 seed);
+
 #endif // CORETEN_HASH_H
\ No newline at end of file
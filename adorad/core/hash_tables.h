@@ -0,0 +1,1096 @@
+// Auto-generated by tools/scripts/generate_crc_tables.py
+// DO NOT EDIT BY HAND. Re-run the script instead.
+
+#ifndef CORETEN_HASH_TABLES_H
+#define CORETEN_HASH_TABLES_H
+
+/*
+    Slicing-by-8 CRC tables. `TABLE[0]` is the usual bytewise table; `TABLE[k][i]` is the CRC contribution of byte 
+    `i` when it is followed by `k` more bytes.
+*/
+
+// CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+static UInt32 const CORETEN__CRC32_TABLE[8][256] = {
+    {
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+    },
+    {
+        0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+        0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+        0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+        0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+        0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+        0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+        0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+        0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+        0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+        0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+        0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+        0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+        0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+        0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+        0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+        0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+        0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+        0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+        0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 0x271b2d9c, 0x3e001cdd,
+        0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+        0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+        0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+        0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+        0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+        0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+        0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+        0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+        0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x06a0d9d0,
+        0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b,
+        0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+        0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+        0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72,
+    },
+    {
+        0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 0x048d7cb2, 0x054f1685,
+        0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d,
+        0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+        0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+        0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+        0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+        0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+        0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+        0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+        0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+        0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+        0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+        0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+        0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+        0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+        0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+        0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+        0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+        0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+        0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+        0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+        0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+        0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+        0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+        0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+        0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+        0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+        0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+        0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+        0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+        0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+        0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed,
+    },
+    {
+        0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+        0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+        0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+        0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x087a47c9,
+        0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+        0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+        0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+        0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7,
+        0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+        0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+        0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+        0x0eb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+        0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 0x1e4da8df, 0xa6f1cfba,
+        0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+        0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+        0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+        0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+        0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+        0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+        0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+        0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+        0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+        0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+        0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+        0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+        0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+        0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+        0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+        0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+        0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+        0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+        0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1,
+    },
+    {
+        0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+        0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+        0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+        0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+        0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314,
+        0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+        0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+        0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+        0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+        0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+        0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+        0x0863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+        0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+        0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+        0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+        0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 0x46e25eae, 0x7b82771e,
+        0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82,
+        0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+        0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+        0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+        0x70279f96, 0x4d47b626, 0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+        0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+        0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+        0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+        0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+        0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+        0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+        0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 0x36c5c138, 0x0ba5e888,
+        0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+        0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+        0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+        0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c,
+    },
+    {
+        0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+        0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+        0x03d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+        0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+        0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+        0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+        0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+        0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+        0x0f580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+        0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+        0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+        0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+        0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+        0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+        0x0b220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+        0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+        0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460,
+        0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+        0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x006326fb,
+        0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+        0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+        0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+        0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd,
+        0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+        0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0x0ced2e0c,
+        0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+        0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+        0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+        0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a,
+        0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+        0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x089729a1,
+        0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc,
+    },
+    {
+        0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+        0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+        0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+        0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 0x37e1e793, 0x9196ec27,
+        0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712,
+        0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+        0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+        0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+        0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+        0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+        0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+        0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+        0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+        0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+        0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+        0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+        0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+        0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+        0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+        0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+        0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+        0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+        0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+        0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+        0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x09baa105,
+        0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+        0xabc30345, 0x0db408f1, 0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+        0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+        0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+        0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+        0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 0x07ae0fe3, 0xa1d90457,
+        0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30,
+    },
+    {
+        0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 0xc66f0987, 0x0ac50919,
+        0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+        0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+        0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+        0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+        0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+        0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+        0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+        0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+        0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+        0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+        0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+        0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+        0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217,
+        0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+        0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+        0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+        0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+        0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+        0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+        0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+        0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+        0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+        0x0513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+        0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+        0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+        0x061d761c, 0xcab77682, 0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+        0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+        0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+        0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+        0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+        0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6,
+    },
+};
+
+// CRC-32C (Castagnoli, reflected polynomial 0x82F63B78)
+static UInt32 const CORETEN__CRC32C_TABLE[8][256] = {
+    {
+        0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+        0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+        0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+        0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+        0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+        0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+        0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+        0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a, 0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+        0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+        0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+        0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+        0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+        0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+        0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+        0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+        0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+        0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+        0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+        0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+        0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+        0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+        0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+        0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d, 0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+        0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+        0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+        0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+        0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+        0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+        0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+        0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+        0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+        0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+    },
+    {
+        0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc, 0x5d28f9ab, 0x69cf5132, 0x7a6dc945,
+        0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21, 0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd,
+        0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0x0b225918, 0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+        0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92, 0xcb1e630b, 0xd8bcfb7c,
+        0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b, 0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47,
+        0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823, 0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+        0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28, 0x298143b1, 0x3a23dbc6,
+        0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2, 0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e,
+        0xff17c604, 0xecb55e73, 0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+        0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25, 0x2c896460, 0x3f2bfc17, 0x0bcc548e, 0x186eccf9,
+        0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c, 0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0,
+        0x5dc6f43d, 0x4e646c4a, 0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f, 0x27ab3d78,
+        0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f, 0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43,
+        0x1d88e6be, 0x0e2a7ec9, 0x3acdd650, 0x296f4e27, 0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb,
+        0xbf59d487, 0xacfb4cf0, 0x981ce469, 0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+        0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3, 0x7f65ee94, 0x4b82460d, 0x5820de7a,
+        0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260, 0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc,
+        0x66d73941, 0x7575a136, 0x419209af, 0x523091d8, 0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004,
+        0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3, 0xadc95a4a, 0xbe6bc23d,
+        0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059, 0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185,
+        0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162, 0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+        0x195cda43, 0x0afe4234, 0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8, 0x70938b71, 0x63311306,
+        0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3, 0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f,
+        0x26992bc2, 0x353bb3b5, 0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+        0x04d43cfd, 0x1776a48a, 0x23910c13, 0x30339464, 0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+        0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc, 0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600,
+        0x3b11cd7c, 0x28b3550b, 0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+        0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d, 0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781,
+        0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766, 0x35d5be23, 0x26772654, 0x12908ecd, 0x013216ba,
+        0xe64b1c47, 0xf5e98430, 0xc10e2ca9, 0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+        0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2, 0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b,
+        0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f, 0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+    },
+    {
+        0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a, 0x3b9f3664, 0xd1b1f617, 0x74f06469,
+        0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6, 0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2, 0x4ca15aac,
+        0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9, 0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3,
+        0x48f3434f, 0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b, 0x9942b558, 0x3c032726,
+        0xe144fb14, 0x4405696a, 0xae2ba919, 0x0b6a3b67, 0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+        0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2, 0x47cb61cb, 0xe28af3b5, 0x08a433c6, 0xade5a1b8,
+        0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa, 0x40577089, 0xe516e2f7,
+        0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828, 0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32,
+        0xc76580d9, 0x622412a7, 0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+        0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f, 0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+        0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20, 0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a,
+        0x8f96c396, 0x2ad751e8, 0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+        0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe, 0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4,
+        0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b, 0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161,
+        0x56830647, 0xf3c29439, 0x19ec544a, 0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+        0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98, 0x554d0ee6, 0xbf63ce95, 0x1a225ceb,
+        0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730, 0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a,
+        0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5, 0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+        0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad, 0x2a34fcde, 0x8f756ea0,
+        0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f, 0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+        0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24, 0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+        0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6, 0x83834485, 0x26c2d6fb,
+        0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae, 0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4,
+        0x2290cf18, 0x87d15d66, 0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+        0x4c42f79a, 0xe90365e4, 0x032da597, 0xa66c37e9, 0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+        0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c, 0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0x00e3ad36,
+        0x3ce08a10, 0x99a1186e, 0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07, 0x4810ee79,
+        0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6, 0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc,
+        0xad060c8e, 0x08479ef0, 0xe2695e83, 0x4728ccfd, 0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7,
+        0x9557324b, 0x3016a035, 0xda386046, 0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+        0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e, 0xe63b4760, 0x0c158713, 0xa954156d,
+        0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0x0fdb8fb2, 0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+    },
+    {
+        0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3, 0xa6679b4b, 0xc4451272, 0x1900b8ca,
+        0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf, 0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c,
+        0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804, 0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+        0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990, 0xdb65c0a9, 0x06206a11,
+        0xd725148b, 0x0a60be33, 0x6842370a, 0xb5079db2, 0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+        0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54, 0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+        0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd, 0xfa04b7c4, 0x27411d7c,
+        0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69, 0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a,
+        0xaba65fe7, 0x76e3f55f, 0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+        0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538, 0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+        0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3, 0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610,
+        0xb4868d3c, 0x69c32784, 0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+        0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255, 0x07a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6,
+        0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3, 0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040,
+        0x95e7fa51, 0x48a250e9, 0x2a80d9d0, 0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+        0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844, 0xc5c402fc, 0xa7e68bc5, 0x7aa3217d,
+        0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006, 0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5,
+        0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0, 0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213,
+        0xbbc47802, 0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349, 0x7f816a70, 0xa2c4c0c8,
+        0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd, 0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+        0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d, 0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+        0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519, 0xb784ac20, 0x6ac10698,
+        0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0, 0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443,
+        0x9aa50f6f, 0x47e0a5d7, 0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+        0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1, 0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+        0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07, 0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4,
+        0x106227e5, 0xcd278d5d, 0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597, 0x09629f2f,
+        0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a, 0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9,
+        0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a, 0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99,
+        0xd867e1b5, 0x05224b0d, 0x6700c234, 0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+        0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d, 0x6120a825, 0x0302211c, 0xde478ba4,
+        0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1, 0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+    },
+    {
+        0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0, 0xd854d11c, 0x906761e8, 0xa8760e44,
+        0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65, 0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5,
+        0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127, 0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+        0x4a456a42, 0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e, 0xda220baa, 0xe2336406,
+        0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3, 0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+        0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32, 0x3e8a0076, 0x069b6fda, 0x4ea8df2e, 0x76b9b082,
+        0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598, 0x04edb56c, 0x3cfcdac0,
+        0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1, 0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151,
+        0x37516aae, 0x0f400502, 0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+        0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb, 0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+        0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89, 0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539,
+        0x7d1400ec, 0x45056f40, 0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+        0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d, 0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd,
+        0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c, 0x09db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c,
+        0xa3dbbe2a, 0x9bcad186, 0xd3f96172, 0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+        0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b, 0xbee864a7, 0xf6dbd453, 0xcecabbff,
+        0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8, 0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18,
+        0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39, 0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089,
+        0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593, 0x71e7d567, 0x49f6bacb,
+        0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea, 0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+        0x750a600b, 0x4d1b0fa7, 0x0528bf53, 0x3d39d0ff, 0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+        0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86, 0x200a0a72, 0x181b65de,
+        0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c, 0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c,
+        0x3f4f0a49, 0x075e65e5, 0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+        0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06, 0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+        0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497, 0x7cd10ad3, 0x44c0657f, 0x0cf3d58b, 0x34e2ba27,
+        0xd6d1de21, 0xeec0b18d, 0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9, 0x7ea7d065,
+        0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544, 0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4,
+        0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0x0a68ba51, 0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1,
+        0x873c0134, 0xbf2d6e98, 0xf71ede6c, 0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+        0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6, 0x152dba6a, 0x5d1e0a9e, 0x650f6532,
+        0x081e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013, 0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+    },
+    {
+        0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777, 0x5dc55c6e, 0x697997b4, 0x8649fcad,
+        0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5, 0xd2f32f68, 0x3dc34471, 0x097f8fab, 0xe64fe4b2,
+        0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4, 0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+        0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f, 0xc973bf95, 0x2643d48c,
+        0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57, 0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20,
+        0xe5f20e92, 0x0ac2658b, 0x3e7eae51, 0xd14ec548, 0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+        0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add, 0x2c81b107, 0xc3b1da1e,
+        0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576, 0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201,
+        0x0e045beb, 0xe13430f2, 0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+        0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e, 0xdcf77483, 0x33c71f9a, 0x077bd440, 0xe84bbf59,
+        0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f, 0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778,
+        0xae0e73ca, 0x413e18d3, 0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+        0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc, 0x39057a11, 0xd6351108, 0xe289dad2, 0x0db9b1cb,
+        0xebf65579, 0x04c63e60, 0x307af5ba, 0xdf4a9ea3, 0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4,
+        0x4bfc7d58, 0xa4cc1641, 0x9070dd9b, 0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+        0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230, 0x763f3929, 0x4283f2f3, 0xadb399ea,
+        0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c, 0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b,
+        0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413, 0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+        0xdc0487e8, 0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86, 0xb57d105c, 0x5a4d7b45,
+        0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d, 0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+        0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81, 0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+        0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a, 0x90832ef0, 0x7fb345e9,
+        0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf, 0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8,
+        0x39f6897a, 0xd6c6e263, 0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+        0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7, 0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+        0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8, 0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f,
+        0xd200dc03, 0x3d30b71a, 0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+        0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6, 0x00f3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1,
+        0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a, 0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d,
+        0xf7fee2af, 0x18ce89b6, 0x2c72426c, 0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+        0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9, 0x0a3196e0, 0x3e8d5d3a, 0xd1bd3623,
+        0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x034e194b, 0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+    },
+    {
+        0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1, 0xcde3e919, 0x75e69c41, 0x1de5b089,
+        0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b, 0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda,
+        0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe, 0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+        0xd27607f5, 0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec, 0xa7909bb4, 0xcf93b77c,
+        0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5, 0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+        0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6, 0xd696bb3f, 0xbe9597f7, 0x0690e2af, 0x6e93ce67,
+        0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002, 0xd4e6e55a, 0xbce5c992,
+        0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110, 0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1,
+        0x7ab7077a, 0x12b42bb2, 0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63, 0x0f519b3b, 0x6752b7f3,
+        0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71, 0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+        0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884, 0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55,
+        0xa8c1008f, 0xc0c22c47, 0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+        0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f, 0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e,
+        0x09c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc, 0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d,
+        0xdbb77e61, 0xb3b452a9, 0x0bb127f1, 0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+        0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3, 0x58796a2b, 0xe07c1f73, 0x887f33bb,
+        0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac, 0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d,
+        0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x034686ff, 0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+        0x6935f452, 0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b, 0x1cd36813, 0x74d044db,
+        0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59, 0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+        0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811, 0x6dd54898, 0x05d66450, 0xbdd31108, 0xd5d03dc0,
+        0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903, 0xf3feec5b, 0x9bfdc093,
+        0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7, 0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766,
+        0x1a438abc, 0x7240a674, 0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x07a63a35,
+        0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6, 0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+        0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185, 0x6414310c, 0x0c171dc4, 0xb412689c, 0xdc114454,
+        0x1382f328, 0x7b81dfe0, 0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69, 0x0e6743a1,
+        0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23, 0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2,
+        0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0x0a87ff6b, 0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba,
+        0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0, 0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+        0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544, 0xe33a998c, 0x5b3fecd4, 0x333cc01c,
+        0x60f48dc6, 0x08f7a10e, 0xb0f2d456, 0xd8f1f89e, 0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+    },
+    {
+        0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d, 0x6821ff4a, 0xb3657823, 0xfa590504,
+        0x423b04da, 0x0b0779fd, 0xd043fe94, 0x997f83b3, 0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de,
+        0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd, 0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+        0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224, 0x7528754d, 0x3c14086a,
+        0x0d006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0, 0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+        0x4f3b6143, 0x06071c64, 0xdd439b0d, 0x947fe62a, 0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+        0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367, 0x3a13140e, 0x732f6929,
+        0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e, 0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3,
+        0x1a00cb32, 0x533cb615, 0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+        0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881, 0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+        0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef, 0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782,
+        0xdc4dc65c, 0x9571bb7b, 0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+        0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2, 0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf,
+        0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18, 0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75,
+        0x9376a71f, 0xda4ada38, 0x010e5d51, 0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+        0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8, 0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1,
+        0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d, 0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360,
+        0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7, 0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+        0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a, 0x0312e7f3, 0x4a2e9ad4,
+        0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63, 0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e,
+        0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494, 0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+        0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d, 0xc85f8f04, 0x8163f223,
+        0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20, 0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d,
+        0xff4cfe93, 0xb67083b4, 0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x0515fb97,
+        0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f, 0x0f1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+        0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5, 0x4d27dbe1, 0x041ba6c6, 0xdf5f21af, 0x96635c88,
+        0xaa7754e2, 0xe34b29c5, 0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+        0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751, 0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c,
+        0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6, 0x021cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb,
+        0x613a3c15, 0x28064132, 0xf342c65b, 0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+        0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316, 0xcf56ce31, 0x14124958, 0x5d2e347f,
+        0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8, 0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+    },
+};
+
+// CRC-64 (ECMA-182 polynomial 0x42F0E1EBA9EA3693)
+static UInt64 const CORETEN__CRC64_TABLE[8][256] = {
+    {
+        0x0000000000000000ull, 0x42f0e1eba9ea3693ull, 0x85e1c3d753d46d26ull, 0xc711223cfa3e5bb5ull,
+        0x493366450e42ecdfull, 0x0bc387aea7a8da4cull, 0xccd2a5925d9681f9ull, 0x8e224479f47cb76aull,
+        0x9266cc8a1c85d9beull, 0xd0962d61b56fef2dull, 0x17870f5d4f51b498ull, 0x5577eeb6e6bb820bull,
+        0xdb55aacf12c73561ull, 0x99a54b24bb2d03f2ull, 0x5eb4691841135847ull, 0x1c4488f3e8f96ed4ull,
+        0x663d78ff90e185efull, 0x24cd9914390bb37cull, 0xe3dcbb28c335e8c9ull, 0xa12c5ac36adfde5aull,
+        0x2f0e1eba9ea36930ull, 0x6dfeff5137495fa3ull, 0xaaefdd6dcd770416ull, 0xe81f3c86649d3285ull,
+        0xf45bb4758c645c51ull, 0xb6ab559e258e6ac2ull, 0x71ba77a2dfb03177ull, 0x334a9649765a07e4ull,
+        0xbd68d2308226b08eull, 0xff9833db2bcc861dull, 0x388911e7d1f2dda8ull, 0x7a79f00c7818eb3bull,
+        0xcc7af1ff21c30bdeull, 0x8e8a101488293d4dull, 0x499b3228721766f8ull, 0x0b6bd3c3dbfd506bull,
+        0x854997ba2f81e701ull, 0xc7b97651866bd192ull, 0x00a8546d7c558a27ull, 0x4258b586d5bfbcb4ull,
+        0x5e1c3d753d46d260ull, 0x1cecdc9e94ace4f3ull, 0xdbfdfea26e92bf46ull, 0x990d1f49c77889d5ull,
+        0x172f5b3033043ebfull, 0x55dfbadb9aee082cull, 0x92ce98e760d05399ull, 0xd03e790cc93a650aull,
+        0xaa478900b1228e31ull, 0xe8b768eb18c8b8a2ull, 0x2fa64ad7e2f6e317ull, 0x6d56ab3c4b1cd584ull,
+        0xe374ef45bf6062eeull, 0xa1840eae168a547dull, 0x66952c92ecb40fc8ull, 0x2465cd79455e395bull,
+        0x3821458aada7578full, 0x7ad1a461044d611cull, 0xbdc0865dfe733aa9ull, 0xff3067b657990c3aull,
+        0x711223cfa3e5bb50ull, 0x33e2c2240a0f8dc3ull, 0xf4f3e018f031d676ull, 0xb60301f359dbe0e5ull,
+        0xda050215ea6c212full, 0x98f5e3fe438617bcull, 0x5fe4c1c2b9b84c09ull, 0x1d14202910527a9aull,
+        0x93366450e42ecdf0ull, 0xd1c685bb4dc4fb63ull, 0x16d7a787b7faa0d6ull, 0x5427466c1e109645ull,
+        0x4863ce9ff6e9f891ull, 0x0a932f745f03ce02ull, 0xcd820d48a53d95b7ull, 0x8f72eca30cd7a324ull,
+        0x0150a8daf8ab144eull, 0x43a04931514122ddull, 0x84b16b0dab7f7968ull, 0xc6418ae602954ffbull,
+        0xbc387aea7a8da4c0ull, 0xfec89b01d3679253ull, 0x39d9b93d2959c9e6ull, 0x7b2958d680b3ff75ull,
+        0xf50b1caf74cf481full, 0xb7fbfd44dd257e8cull, 0x70eadf78271b2539ull, 0x321a3e938ef113aaull,
+        0x2e5eb66066087d7eull, 0x6cae578bcfe24bedull, 0xabbf75b735dc1058ull, 0xe94f945c9c3626cbull,
+        0x676dd025684a91a1ull, 0x259d31cec1a0a732ull, 0xe28c13f23b9efc87ull, 0xa07cf2199274ca14ull,
+        0x167ff3eacbaf2af1ull, 0x548f120162451c62ull, 0x939e303d987b47d7ull, 0xd16ed1d631917144ull,
+        0x5f4c95afc5edc62eull, 0x1dbc74446c07f0bdull, 0xdaad56789639ab08ull, 0x985db7933fd39d9bull,
+        0x84193f60d72af34full, 0xc6e9de8b7ec0c5dcull, 0x01f8fcb784fe9e69ull, 0x43081d5c2d14a8faull,
+        0xcd2a5925d9681f90ull, 0x8fdab8ce70822903ull, 0x48cb9af28abc72b6ull, 0x0a3b7b1923564425ull,
+        0x70428b155b4eaf1eull, 0x32b26afef2a4998dull, 0xf5a348c2089ac238ull, 0xb753a929a170f4abull,
+        0x3971ed50550c43c1ull, 0x7b810cbbfce67552ull, 0xbc902e8706d82ee7ull, 0xfe60cf6caf321874ull,
+        0xe224479f47cb76a0ull, 0xa0d4a674ee214033ull, 0x67c58448141f1b86ull, 0x253565a3bdf52d15ull,
+        0xab1721da49899a7full, 0xe9e7c031e063acecull, 0x2ef6e20d1a5df759ull, 0x6c0603e6b3b7c1caull,
+        0xf6fae5c07d3274cdull, 0xb40a042bd4d8425eull, 0x731b26172ee619ebull, 0x31ebc7fc870c2f78ull,
+        0xbfc9838573709812ull, 0xfd39626eda9aae81ull, 0x3a28405220a4f534ull, 0x78d8a1b9894ec3a7ull,
+        0x649c294a61b7ad73ull, 0x266cc8a1c85d9be0ull, 0xe17dea9d3263c055ull, 0xa38d0b769b89f6c6ull,
+        0x2daf4f0f6ff541acull, 0x6f5faee4c61f773full, 0xa84e8cd83c212c8aull, 0xeabe6d3395cb1a19ull,
+        0x90c79d3fedd3f122ull, 0xd2377cd44439c7b1ull, 0x15265ee8be079c04ull, 0x57d6bf0317edaa97ull,
+        0xd9f4fb7ae3911dfdull, 0x9b041a914a7b2b6eull, 0x5c1538adb04570dbull, 0x1ee5d94619af4648ull,
+        0x02a151b5f156289cull, 0x4051b05e58bc1e0full, 0x87409262a28245baull, 0xc5b073890b687329ull,
+        0x4b9237f0ff14c443ull, 0x0962d61b56fef2d0ull, 0xce73f427acc0a965ull, 0x8c8315cc052a9ff6ull,
+        0x3a80143f5cf17f13ull, 0x7870f5d4f51b4980ull, 0xbf61d7e80f251235ull, 0xfd913603a6cf24a6ull,
+        0x73b3727a52b393ccull, 0x31439391fb59a55full, 0xf652b1ad0167feeaull, 0xb4a25046a88dc879ull,
+        0xa8e6d8b54074a6adull, 0xea16395ee99e903eull, 0x2d071b6213a0cb8bull, 0x6ff7fa89ba4afd18ull,
+        0xe1d5bef04e364a72ull, 0xa3255f1be7dc7ce1ull, 0x64347d271de22754ull, 0x26c49cccb40811c7ull,
+        0x5cbd6cc0cc10fafcull, 0x1e4d8d2b65facc6full, 0xd95caf179fc497daull, 0x9bac4efc362ea149ull,
+        0x158e0a85c2521623ull, 0x577eeb6e6bb820b0ull, 0x906fc95291867b05ull, 0xd29f28b9386c4d96ull,
+        0xcedba04ad0952342ull, 0x8c2b41a1797f15d1ull, 0x4b3a639d83414e64ull, 0x09ca82762aab78f7ull,
+        0x87e8c60fded7cf9dull, 0xc51827e4773df90eull, 0x020905d88d03a2bbull, 0x40f9e43324e99428ull,
+        0x2cffe7d5975e55e2ull, 0x6e0f063e3eb46371ull, 0xa91e2402c48a38c4ull, 0xebeec5e96d600e57ull,
+        0x65cc8190991cb93dull, 0x273c607b30f68faeull, 0xe02d4247cac8d41bull, 0xa2dda3ac6322e288ull,
+        0xbe992b5f8bdb8c5cull, 0xfc69cab42231bacfull, 0x3b78e888d80fe17aull, 0x7988096371e5d7e9ull,
+        0xf7aa4d1a85996083ull, 0xb55aacf12c735610ull, 0x724b8ecdd64d0da5ull, 0x30bb6f267fa73b36ull,
+        0x4ac29f2a07bfd00dull, 0x08327ec1ae55e69eull, 0xcf235cfd546bbd2bull, 0x8dd3bd16fd818bb8ull,
+        0x03f1f96f09fd3cd2ull, 0x41011884a0170a41ull, 0x86103ab85a2951f4ull, 0xc4e0db53f3c36767ull,
+        0xd8a453a01b3a09b3ull, 0x9a54b24bb2d03f20ull, 0x5d45907748ee6495ull, 0x1fb5719ce1045206ull,
+        0x919735e51578e56cull, 0xd367d40ebc92d3ffull, 0x1476f63246ac884aull, 0x568617d9ef46bed9ull,
+        0xe085162ab69d5e3cull, 0xa275f7c11f7768afull, 0x6564d5fde549331aull, 0x279434164ca30589ull,
+        0xa9b6706fb8dfb2e3ull, 0xeb46918411358470ull, 0x2c57b3b8eb0bdfc5ull, 0x6ea7525342e1e956ull,
+        0x72e3daa0aa188782ull, 0x30133b4b03f2b111ull, 0xf7021977f9cceaa4ull, 0xb5f2f89c5026dc37ull,
+        0x3bd0bce5a45a6b5dull, 0x79205d0e0db05dceull, 0xbe317f32f78e067bull, 0xfcc19ed95e6430e8ull,
+        0x86b86ed5267cdbd3ull, 0xc4488f3e8f96ed40ull, 0x0359ad0275a8b6f5ull, 0x41a94ce9dc428066ull,
+        0xcf8b0890283e370cull, 0x8d7be97b81d4019full, 0x4a6acb477bea5a2aull, 0x089a2aacd2006cb9ull,
+        0x14dea25f3af9026dull, 0x562e43b4931334feull, 0x913f6188692d6f4bull, 0xd3cf8063c0c759d8ull,
+        0x5dedc41a34bbeeb2ull, 0x1f1d25f19d51d821ull, 0xd80c07cd676f8394ull, 0x9afce626ce85b507ull,
+    },
+    {
+        0x0000000000000000ull, 0x57944fe2fc4440a1ull, 0x002db5aeab065e4aull, 0x57b9fa4c57421eebull,
+        0x56cf24bfaa48fc35ull, 0x015b6b5d560cbc94ull, 0x56e29111014ea27full, 0x0176def3fd0ae2deull,
+        0x029b6314071f2762ull, 0x550f2cf6fb5b67c3ull, 0x02b6d6baac197928ull, 0x55229958505d3989ull,
+        0x545447abad57db57ull, 0x03c0084951139bf6ull, 0x5479f2050651851dull, 0x03edbde7fa15c5bcull,
+        0xfca7a3a1a1f4d16dull, 0xab33ec435db091ccull, 0xfc8a160f0af28f27ull, 0xab1e59edf6b6cf86ull,
+        0xaa68871e0bbc2d58ull, 0xfdfcc8fcf7f86df9ull, 0xaa4532b0a0ba7312ull, 0xfdd17d525cfe33b3ull,
+        0xfe3cc0b5a6ebf60full, 0xa9a88f575aafb6aeull, 0xfe11751b0deda845ull, 0xa9853af9f1a9e8e4ull,
+        0xa8f3e40a0ca30a3aull, 0xff67abe8f0e74a9bull, 0xa8de51a4a7a55470ull, 0xff4a1e465be114d1ull,
+        0x14ba8cc3b98d4b41ull, 0x432ec32145c90be0ull, 0x1497396d128b150bull, 0x4303768feecf55aaull,
+        0x4275a87c13c5b774ull, 0x15e1e79eef81f7d5ull, 0x42581dd2b8c3e93eull, 0x15cc52304487a99full,
+        0x1621efd7be926c23ull, 0x41b5a03542d62c82ull, 0x160c5a7915943269ull, 0x4198159be9d072c8ull,
+        0x40eecb6814da9016ull, 0x177a848ae89ed0b7ull, 0x40c37ec6bfdcce5cull, 0x1757312443988efdull,
+        0xe81d2f6218799a2cull, 0xbf896080e43dda8dull, 0xe8309accb37fc466ull, 0xbfa4d52e4f3b84c7ull,
+        0xbed20bddb2316619ull, 0xe946443f4e7526b8ull, 0xbeffbe7319373853ull, 0xe96bf191e57378f2ull,
+        0xea864c761f66bd4eull, 0xbd120394e322fdefull, 0xeaabf9d8b460e304ull, 0xbd3fb63a4824a3a5ull,
+        0xbc4968c9b52e417bull, 0xebdd272b496a01daull, 0xbc64dd671e281f31ull, 0xebf09285e26c5f90ull,
+        0xd0e47c0edcd0092bull, 0x877033ec2094498aull, 0xd0c9c9a077d65761ull, 0x875d86428b9217c0ull,
+        0x862b58b17698f51eull, 0xd1bf17538adcb5bfull, 0x8606ed1fdd9eab54ull, 0xd192a2fd21daebf5ull,
+        0xd27f1f1adbcf2e49ull, 0x85eb50f8278b6ee8ull, 0xd252aab470c97003ull, 0x85c6e5568c8d30a2ull,
+        0x84b03ba57187d27cull, 0xd32474478dc392ddull, 0x849d8e0bda818c36ull, 0xd309c1e926c5cc97ull,
+        0x2c43dfaf7d24d846ull, 0x7bd7904d816098e7ull, 0x2c6e6a01d622860cull, 0x7bfa25e32a66c6adull,
+        0x7a8cfb10d76c2473ull, 0x2d18b4f22b2864d2ull, 0x7aa14ebe7c6a7a39ull, 0x2d35015c802e3a98ull,
+        0x2ed8bcbb7a3bff24ull, 0x794cf359867fbf85ull, 0x2ef50915d13da16eull, 0x796146f72d79e1cfull,
+        0x78179804d0730311ull, 0x2f83d7e62c3743b0ull, 0x783a2daa7b755d5bull, 0x2fae624887311dfaull,
+        0xc45ef0cd655d426aull, 0x93cabf2f991902cbull, 0xc4734563ce5b1c20ull, 0x93e70a81321f5c81ull,
+        0x9291d472cf15be5full, 0xc5059b903351fefeull, 0x92bc61dc6413e015ull, 0xc5282e3e9857a0b4ull,
+        0xc6c593d962426508ull, 0x9151dc3b9e0625a9ull, 0xc6e82677c9443b42ull, 0x917c699535007be3ull,
+        0x900ab766c80a993dull, 0xc79ef884344ed99cull, 0x902702c8630cc777ull, 0xc7b34d2a9f4887d6ull,
+        0x38f9536cc4a99307ull, 0x6f6d1c8e38edd3a6ull, 0x38d4e6c26fafcd4dull, 0x6f40a92093eb8decull,
+        0x6e3677d36ee16f32ull, 0x39a2383192a52f93ull, 0x6e1bc27dc5e73178ull, 0x398f8d9f39a371d9ull,
+        0x3a623078c3b6b465ull, 0x6df67f9a3ff2f4c4ull, 0x3a4f85d668b0ea2full, 0x6ddbca3494f4aa8eull,
+        0x6cad14c769fe4850ull, 0x3b395b2595ba08f1ull, 0x6c80a169c2f8161aull, 0x3b14ee8b3ebc56bbull,
+        0xb5ac5614ec0e6464ull, 0xe23819f6104a24c5ull, 0xb581e3ba47083a2eull, 0xe215ac58bb4c7a8full,
+        0xe36372ab46469851ull, 0xb4f73d49ba02d8f0ull, 0xe34ec705ed40c61bull, 0xb4da88e7110486baull,
+        0xb7373500eb114306ull, 0xe0a37ae2175503a7ull, 0xb71a80ae40171d4cull, 0xe08ecf4cbc535dedull,
+        0xe1f811bf4159bf33ull, 0xb66c5e5dbd1dff92ull, 0xe1d5a411ea5fe179ull, 0xb641ebf3161ba1d8ull,
+        0x490bf5b54dfab509ull, 0x1e9fba57b1bef5a8ull, 0x4926401be6fceb43ull, 0x1eb20ff91ab8abe2ull,
+        0x1fc4d10ae7b2493cull, 0x48509ee81bf6099dull, 0x1fe964a44cb41776ull, 0x487d2b46b0f057d7ull,
+        0x4b9096a14ae5926bull, 0x1c04d943b6a1d2caull, 0x4bbd230fe1e3cc21ull, 0x1c296ced1da78c80ull,
+        0x1d5fb21ee0ad6e5eull, 0x4acbfdfc1ce92effull, 0x1d7207b04bab3014ull, 0x4ae64852b7ef70b5ull,
+        0xa116dad755832f25ull, 0xf6829535a9c76f84ull, 0xa13b6f79fe85716full, 0xf6af209b02c131ceull,
+        0xf7d9fe68ffcbd310ull, 0xa04db18a038f93b1ull, 0xf7f44bc654cd8d5aull, 0xa0600424a889cdfbull,
+        0xa38db9c3529c0847ull, 0xf419f621aed848e6ull, 0xa3a00c6df99a560dull, 0xf434438f05de16acull,
+        0xf5429d7cf8d4f472ull, 0xa2d6d29e0490b4d3ull, 0xf56f28d253d2aa38ull, 0xa2fb6730af96ea99ull,
+        0x5db17976f477fe48ull, 0x0a2536940833bee9ull, 0x5d9cccd85f71a002ull, 0x0a08833aa335e0a3ull,
+        0x0b7e5dc95e3f027dull, 0x5cea122ba27b42dcull, 0x0b53e867f5395c37ull, 0x5cc7a785097d1c96ull,
+        0x5f2a1a62f368d92aull, 0x08be55800f2c998bull, 0x5f07afcc586e8760ull, 0x0893e02ea42ac7c1ull,
+        0x09e53edd5920251full, 0x5e71713fa56465beull, 0x09c88b73f2267b55ull, 0x5e5cc4910e623bf4ull,
+        0x65482a1a30de6d4full, 0x32dc65f8cc9a2deeull, 0x65659fb49bd83305ull, 0x32f1d056679c73a4ull,
+        0x33870ea59a96917aull, 0x6413414766d2d1dbull, 0x33aabb0b3190cf30ull, 0x643ef4e9cdd48f91ull,
+        0x67d3490e37c14a2dull, 0x304706eccb850a8cull, 0x67fefca09cc71467ull, 0x306ab342608354c6ull,
+        0x311c6db19d89b618ull, 0x6688225361cdf6b9ull, 0x3131d81f368fe852ull, 0x66a597fdcacba8f3ull,
+        0x99ef89bb912abc22ull, 0xce7bc6596d6efc83ull, 0x99c23c153a2ce268ull, 0xce5673f7c668a2c9ull,
+        0xcf20ad043b624017ull, 0x98b4e2e6c72600b6ull, 0xcf0d18aa90641e5dull, 0x989957486c205efcull,
+        0x9b74eaaf96359b40ull, 0xcce0a54d6a71dbe1ull, 0x9b595f013d33c50aull, 0xcccd10e3c17785abull,
+        0xcdbbce103c7d6775ull, 0x9a2f81f2c03927d4ull, 0xcd967bbe977b393full, 0x9a02345c6b3f799eull,
+        0x71f2a6d98953260eull, 0x2666e93b751766afull, 0x71df137722557844ull, 0x264b5c95de1138e5ull,
+        0x273d8266231bda3bull, 0x70a9cd84df5f9a9aull, 0x271037c8881d8471ull, 0x7084782a7459c4d0ull,
+        0x7369c5cd8e4c016cull, 0x24fd8a2f720841cdull, 0x73447063254a5f26ull, 0x24d03f81d90e1f87ull,
+        0x25a6e1722404fd59ull, 0x7232ae90d840bdf8ull, 0x258b54dc8f02a313ull, 0x721f1b3e7346e3b2ull,
+        0x8d55057828a7f763ull, 0xdac14a9ad4e3b7c2ull, 0x8d78b0d683a1a929ull, 0xdaecff347fe5e988ull,
+        0xdb9a21c782ef0b56ull, 0x8c0e6e257eab4bf7ull, 0xdbb7946929e9551cull, 0x8c23db8bd5ad15bdull,
+        0x8fce666c2fb8d001ull, 0xd85a298ed3fc90a0ull, 0x8fe3d3c284be8e4bull, 0xd8779c2078faceeaull,
+        0xd90142d385f02c34ull, 0x8e950d3179b46c95ull, 0xd92cf77d2ef6727eull, 0x8eb8b89fd2b232dfull,
+    },
+    {
+        0x0000000000000000ull, 0x7827619b17e70dc0ull, 0xcd8220fd0b9693e9ull, 0xb5a541661c719e29ull,
+        0xa1d2c18aa9201c81ull, 0xd9f5a011bec71141ull, 0x6c50e177a2b68f68ull, 0x147780ecb55182a8ull,
+        0x939cab5e8c7c58f0ull, 0xebbbcac59b9b5530ull, 0x5e1e8ba387eacb19ull, 0x2639ea38900dc6d9ull,
+        0x324e6ad4255c4471ull, 0x4a690b4f32bb49b1ull, 0xffcc4a292ecad798ull, 0x87eb2bb2392dda58ull,
+        0x8f261f6dd123ddd2ull, 0xf7017ef6c6c4d012ull, 0x42a43f90dab54e3bull, 0x3a835e0bcd5243fbull,
+        0x2ef4dee77803c153ull, 0x56d3bf7c6fe4cc93ull, 0xe376fe1a739552baull, 0x9b519f8164725f7aull,
+        0x1cbab4335d5f8522ull, 0x649dd5a84ab888e2ull, 0xd13894ce56c916cbull, 0xa91ff555412e1b0bull,
+        0xbd6875b9f47f99a3ull, 0xc54f1422e3989463ull, 0x70ea5544ffe90a4aull, 0x08cd34dfe80e078aull,
+        0x98e15972803f9af7ull, 0xe0c638e997d89737ull, 0x5563798f8ba9091eull, 0x2d4418149c4e04deull,
+        0x393398f8291f8676ull, 0x4114f9633ef88bb6ull, 0xf4b1b8052289159full, 0x8c96d99e356e185full,
+        0x0b7df22c0c43c207ull, 0x735a93b71ba4cfc7ull, 0xc6ffd2d107d551eeull, 0xbed8b34a10325c2eull,
+        0xaaaf33a6a563de86ull, 0xd288523db284d346ull, 0x672d135baef54d6full, 0x1f0a72c0b91240afull,
+        0x17c7461f511c4725ull, 0x6fe0278446fb4ae5ull, 0xda4566e25a8ad4ccull, 0xa26207794d6dd90cull,
+        0xb6158795f83c5ba4ull, 0xce32e60eefdb5664ull, 0x7b97a768f3aac84dull, 0x03b0c6f3e44dc58dull,
+        0x845bed41dd601fd5ull, 0xfc7c8cdaca871215ull, 0x49d9cdbcd6f68c3cull, 0x31feac27c11181fcull,
+        0x25892ccb74400354ull, 0x5dae4d5063a70e94ull, 0xe80b0c367fd690bdull, 0x902c6dad68319d7dull,
+        0x99ddfb35c9a459dcull, 0xe1fa9aaede43541cull, 0x545fdbc8c232ca35ull, 0x2c78ba53d5d5c7f5ull,
+        0x380f3abf6084455dull, 0x40285b247763489dull, 0xf58d1a426b12d6b4ull, 0x8daa7bd97cf5db74ull,
+        0x0a41506b45d8012cull, 0x726631f0523f0cecull, 0xc7c370964e4e92c5ull, 0xbfe4110d59a99f05ull,
+        0xab9391e1ecf81dadull, 0xd3b4f07afb1f106dull, 0x6611b11ce76e8e44ull, 0x1e36d087f0898384ull,
+        0x16fbe4581887840eull, 0x6edc85c30f6089ceull, 0xdb79c4a5131117e7ull, 0xa35ea53e04f61a27ull,
+        0xb72925d2b1a7988full, 0xcf0e4449a640954full, 0x7aab052fba310b66ull, 0x028c64b4add606a6ull,
+        0x85674f0694fbdcfeull, 0xfd402e9d831cd13eull, 0x48e56ffb9f6d4f17ull, 0x30c20e60888a42d7ull,
+        0x24b58e8c3ddbc07full, 0x5c92ef172a3ccdbfull, 0xe937ae71364d5396ull, 0x9110cfea21aa5e56ull,
+        0x013ca247499bc32bull, 0x791bc3dc5e7cceebull, 0xccbe82ba420d50c2ull, 0xb499e32155ea5d02ull,
+        0xa0ee63cde0bbdfaaull, 0xd8c90256f75cd26aull, 0x6d6c4330eb2d4c43ull, 0x154b22abfcca4183ull,
+        0x92a00919c5e79bdbull, 0xea876882d200961bull, 0x5f2229e4ce710832ull, 0x2705487fd99605f2ull,
+        0x3372c8936cc7875aull, 0x4b55a9087b208a9aull, 0xfef0e86e675114b3ull, 0x86d789f570b61973ull,
+        0x8e1abd2a98b81ef9ull, 0xf63ddcb18f5f1339ull, 0x43989dd7932e8d10ull, 0x3bbffc4c84c980d0ull,
+        0x2fc87ca031980278ull, 0x57ef1d3b267f0fb8ull, 0xe24a5c5d3a0e9191ull, 0x9a6d3dc62de99c51ull,
+        0x1d86167414c44609ull, 0x65a177ef03234bc9ull, 0xd00436891f52d5e0ull, 0xa823571208b5d820ull,
+        0xbc54d7febde45a88ull, 0xc473b665aa035748ull, 0x71d6f703b672c961ull, 0x09f19698a195c4a1ull,
+        0x5ff939f9d101c84aull, 0x27de5862c6e6c58aull, 0x927b1904da975ba3ull, 0xea5c789fcd705663ull,
+        0xfe2bf8737821d4cbull, 0x860c99e86fc6d90bull, 0x33a9d88e73b74722ull, 0x4b8eb91564504ae2ull,
+        0xcc6592a75d7d90baull, 0xb442f33c4a9a9d7aull, 0x01e7b25a56eb0353ull, 0x79c0d3c1410c0e93ull,
+        0x6db7532df45d8c3bull, 0x159032b6e3ba81fbull, 0xa03573d0ffcb1fd2ull, 0xd812124be82c1212ull,
+        0xd0df269400221598ull, 0xa8f8470f17c51858ull, 0x1d5d06690bb48671ull, 0x657a67f21c538bb1ull,
+        0x710de71ea9020919ull, 0x092a8685bee504d9ull, 0xbc8fc7e3a2949af0ull, 0xc4a8a678b5739730ull,
+        0x43438dca8c5e4d68ull, 0x3b64ec519bb940a8ull, 0x8ec1ad3787c8de81ull, 0xf6e6ccac902fd341ull,
+        0xe2914c40257e51e9ull, 0x9ab62ddb32995c29ull, 0x2f136cbd2ee8c200ull, 0x57340d26390fcfc0ull,
+        0xc718608b513e52bdull, 0xbf3f011046d95f7dull, 0x0a9a40765aa8c154ull, 0x72bd21ed4d4fcc94ull,
+        0x66caa101f81e4e3cull, 0x1eedc09aeff943fcull, 0xab4881fcf388ddd5ull, 0xd36fe067e46fd015ull,
+        0x5484cbd5dd420a4dull, 0x2ca3aa4ecaa5078dull, 0x9906eb28d6d499a4ull, 0xe1218ab3c1339464ull,
+        0xf5560a5f746216ccull, 0x8d716bc463851b0cull, 0x38d42aa27ff48525ull, 0x40f34b39681388e5ull,
+        0x483e7fe6801d8f6full, 0x30191e7d97fa82afull, 0x85bc5f1b8b8b1c86ull, 0xfd9b3e809c6c1146ull,
+        0xe9ecbe6c293d93eeull, 0x91cbdff73eda9e2eull, 0x246e9e9122ab0007ull, 0x5c49ff0a354c0dc7ull,
+        0xdba2d4b80c61d79full, 0xa385b5231b86da5full, 0x1620f44507f74476ull, 0x6e0795de101049b6ull,
+        0x7a701532a541cb1eull, 0x025774a9b2a6c6deull, 0xb7f235cfaed758f7ull, 0xcfd55454b9305537ull,
+        0xc624c2cc18a59196ull, 0xbe03a3570f429c56ull, 0x0ba6e2311333027full, 0x738183aa04d40fbfull,
+        0x67f60346b1858d17ull, 0x1fd162dda66280d7ull, 0xaa7423bbba131efeull, 0xd2534220adf4133eull,
+        0x55b8699294d9c966ull, 0x2d9f0809833ec4a6ull, 0x983a496f9f4f5a8full, 0xe01d28f488a8574full,
+        0xf46aa8183df9d5e7ull, 0x8c4dc9832a1ed827ull, 0x39e888e5366f460eull, 0x41cfe97e21884bceull,
+        0x4902dda1c9864c44ull, 0x3125bc3ade614184ull, 0x8480fd5cc210dfadull, 0xfca79cc7d5f7d26dull,
+        0xe8d01c2b60a650c5ull, 0x90f77db077415d05ull, 0x25523cd66b30c32cull, 0x5d755d4d7cd7ceecull,
+        0xda9e76ff45fa14b4ull, 0xa2b91764521d1974ull, 0x171c56024e6c875dull, 0x6f3b3799598b8a9dull,
+        0x7b4cb775ecda0835ull, 0x036bd6eefb3d05f5ull, 0xb6ce9788e74c9bdcull, 0xcee9f613f0ab961cull,
+        0x5ec59bbe989a0b61ull, 0x26e2fa258f7d06a1ull, 0x9347bb43930c9888ull, 0xeb60dad884eb9548ull,
+        0xff175a3431ba17e0ull, 0x87303baf265d1a20ull, 0x32957ac93a2c8409ull, 0x4ab21b522dcb89c9ull,
+        0xcd5930e014e65391ull, 0xb57e517b03015e51ull, 0x00db101d1f70c078ull, 0x78fc71860897cdb8ull,
+        0x6c8bf16abdc64f10ull, 0x14ac90f1aa2142d0ull, 0xa109d197b650dcf9ull, 0xd92eb00ca1b7d139ull,
+        0xd1e384d349b9d6b3ull, 0xa9c4e5485e5edb73ull, 0x1c61a42e422f455aull, 0x6446c5b555c8489aull,
+        0x70314559e099ca32ull, 0x081624c2f77ec7f2ull, 0xbdb365a4eb0f59dbull, 0xc594043ffce8541bull,
+        0x427f2f8dc5c58e43ull, 0x3a584e16d2228383ull, 0x8ffd0f70ce531daaull, 0xf7da6eebd9b4106aull,
+        0xe3adee076ce592c2ull, 0x9b8a8f9c7b029f02ull, 0x2e2fcefa6773012bull, 0x5608af6170940cebull,
+    },
+    {
+        0x0000000000000000ull, 0x2c87c0b40c49b2efull, 0x30deb96bfef92782ull, 0x1c5979dff2b0956dull,
+        0xb4abd6ea5e716242ull, 0x982c165e5238d0adull, 0x84756f81a08845c0ull, 0xa8f2af35acc1f72full,
+        0x862bf27e78f0a78bull, 0xaaac32ca74b91564ull, 0xb6f54b1586098009ull, 0x9a728ba18a4032e6ull,
+        0x328024942681c5c9ull, 0x1e07e4202ac87726ull, 0x025e9dffd878e24bull, 0x2ed95d4bd43150a4ull,
+        0xcfac7ae239ba9ef6ull, 0xe32bba5635f32c19ull, 0xff72c389c743b974ull, 0xd3f5033dcb0a0b9bull,
+        0x7b07ac0867cbfcb4ull, 0x57806cbc6b824e5bull, 0x4bd915639932db36ull, 0x675ed5d7957b69d9ull,
+        0x4987889c414a397dull, 0x650048284d038b92ull, 0x795931f7bfb31effull, 0x55def143b3faac10ull,
+        0xfd2c5e761f3b5b3full, 0xd1ab9ec21372e9d0ull, 0xcdf2e71de1c27cbdull, 0xe17527a9ed8bce52ull,
+        0x0802cbf5a0805323ull, 0x24850b41acc9e1ccull, 0x38dc729e5e7974a1ull, 0x145bb22a5230c64eull,
+        0xbca91d1ffef13161ull, 0x902eddabf2b8838eull, 0x8c77a474000816e3ull, 0xa0f064c00c41a40cull,
+        0x8e29398bd870f4a8ull, 0xa2aef93fd4394647ull, 0xbef780e02689d32aull, 0x927040542ac061c5ull,
+        0x3a82ef61860196eaull, 0x16052fd58a482405ull, 0x0a5c560a78f8b168ull, 0x26db96be74b10387ull,
+        0xc7aeb117993acdd5ull, 0xeb2971a395737f3aull, 0xf770087c67c3ea57ull, 0xdbf7c8c86b8a58b8ull,
+        0x730567fdc74baf97ull, 0x5f82a749cb021d78ull, 0x43dbde9639b28815ull, 0x6f5c1e2235fb3afaull,
+        0x41854369e1ca6a5eull, 0x6d0283dded83d8b1ull, 0x715bfa021f334ddcull, 0x5ddc3ab6137aff33ull,
+        0xf52e9583bfbb081cull, 0xd9a95537b3f2baf3ull, 0xc5f02ce841422f9eull, 0xe977ec5c4d0b9d71ull,
+        0x910ee81e20b14135ull, 0xbd8928aa2cf8f3daull, 0xa1d05175de4866b7ull, 0x8d5791c1d201d458ull,
+        0x25a53ef47ec02377ull, 0x0922fe4072899198ull, 0x157b879f803904f5ull, 0x39fc472b8c70b61aull,
+        0x17251a605841e6beull, 0x3ba2dad454085451ull, 0x27fba30ba6b8c13cull, 0x0b7c63bfaaf173d3ull,
+        0xa38ecc8a063084fcull, 0x8f090c3e0a793613ull, 0x935075e1f8c9a37eull, 0xbfd7b555f4801191ull,
+        0x5ea292fc190bdfc3ull, 0x7225524815426d2cull, 0x6e7c2b97e7f2f841ull, 0x42fbeb23ebbb4aaeull,
+        0xea094416477abd81ull, 0xc68e84a24b330f6eull, 0xdad7fd7db9839a03ull, 0xf6503dc9b5ca28ecull,
+        0xd889608261fb7848ull, 0xf40ea0366db2caa7ull, 0xe857d9e99f025fcaull, 0xc4d0195d934bed25ull,
+        0x6c22b6683f8a1a0aull, 0x40a576dc33c3a8e5ull, 0x5cfc0f03c1733d88ull, 0x707bcfb7cd3a8f67ull,
+        0x990c23eb80311216ull, 0xb58be35f8c78a0f9ull, 0xa9d29a807ec83594ull, 0x85555a347281877bull,
+        0x2da7f501de407054ull, 0x012035b5d209c2bbull, 0x1d794c6a20b957d6ull, 0x31fe8cde2cf0e539ull,
+        0x1f27d195f8c1b59dull, 0x33a01121f4880772ull, 0x2ff968fe0638921full, 0x037ea84a0a7120f0ull,
+        0xab8c077fa6b0d7dfull, 0x870bc7cbaaf96530ull, 0x9b52be145849f05dull, 0xb7d57ea0540042b2ull,
+        0x56a05909b98b8ce0ull, 0x7a2799bdb5c23e0full, 0x667ee0624772ab62ull, 0x4af920d64b3b198dull,
+        0xe20b8fe3e7faeea2ull, 0xce8c4f57ebb35c4dull, 0xd2d536881903c920ull, 0xfe52f63c154a7bcfull,
+        0xd08bab77c17b2b6bull, 0xfc0c6bc3cd329984ull, 0xe055121c3f820ce9ull, 0xccd2d2a833cbbe06ull,
+        0x64207d9d9f0a4929ull, 0x48a7bd299343fbc6ull, 0x54fec4f661f36eabull, 0x787904426dbadc44ull,
+        0xcdddf4715cec947full, 0xe15a34c550a52690ull, 0xfd034d1aa215b3fdull, 0xd1848daeae5c0112ull,
+        0x7976229b029df63dull, 0x55f1e22f0ed444d2ull, 0x49a89bf0fc64d1bfull, 0x652f5b44f02d6350ull,
+        0x4bf6060f241c33f4ull, 0x6771c6bb2855811bull, 0x7b28bf64dae51476ull, 0x57af7fd0d6aca699ull,
+        0xff5dd0e57a6d51b6ull, 0xd3da10517624e359ull, 0xcf83698e84947634ull, 0xe304a93a88ddc4dbull,
+        0x02718e9365560a89ull, 0x2ef64e27691fb866ull, 0x32af37f89baf2d0bull, 0x1e28f74c97e69fe4ull,
+        0xb6da58793b2768cbull, 0x9a5d98cd376eda24ull, 0x8604e112c5de4f49ull, 0xaa8321a6c997fda6ull,
+        0x845a7ced1da6ad02ull, 0xa8ddbc5911ef1fedull, 0xb484c586e35f8a80ull, 0x98030532ef16386full,
+        0x30f1aa0743d7cf40ull, 0x1c766ab34f9e7dafull, 0x002f136cbd2ee8c2ull, 0x2ca8d3d8b1675a2dull,
+        0xc5df3f84fc6cc75cull, 0xe958ff30f02575b3ull, 0xf50186ef0295e0deull, 0xd986465b0edc5231ull,
+        0x7174e96ea21da51eull, 0x5df329daae5417f1ull, 0x41aa50055ce4829cull, 0x6d2d90b150ad3073ull,
+        0x43f4cdfa849c60d7ull, 0x6f730d4e88d5d238ull, 0x732a74917a654755ull, 0x5fadb425762cf5baull,
+        0xf75f1b10daed0295ull, 0xdbd8dba4d6a4b07aull, 0xc781a27b24142517ull, 0xeb0662cf285d97f8ull,
+        0x0a734566c5d659aaull, 0x26f485d2c99feb45ull, 0x3aadfc0d3b2f7e28ull, 0x162a3cb93766ccc7ull,
+        0xbed8938c9ba73be8ull, 0x925f533897ee8907ull, 0x8e062ae7655e1c6aull, 0xa281ea536917ae85ull,
+        0x8c58b718bd26fe21ull, 0xa0df77acb16f4cceull, 0xbc860e7343dfd9a3ull, 0x9001cec74f966b4cull,
+        0x38f361f2e3579c63ull, 0x1474a146ef1e2e8cull, 0x082dd8991daebbe1ull, 0x24aa182d11e7090eull,
+        0x5cd31c6f7c5dd54aull, 0x7054dcdb701467a5ull, 0x6c0da50482a4f2c8ull, 0x408a65b08eed4027ull,
+        0xe878ca85222cb708ull, 0xc4ff0a312e6505e7ull, 0xd8a673eedcd5908aull, 0xf421b35ad09c2265ull,
+        0xdaf8ee1104ad72c1ull, 0xf67f2ea508e4c02eull, 0xea26577afa545543ull, 0xc6a197cef61de7acull,
+        0x6e5338fb5adc1083ull, 0x42d4f84f5695a26cull, 0x5e8d8190a4253701ull, 0x720a4124a86c85eeull,
+        0x937f668d45e74bbcull, 0xbff8a63949aef953ull, 0xa3a1dfe6bb1e6c3eull, 0x8f261f52b757ded1ull,
+        0x27d4b0671b9629feull, 0x0b5370d317df9b11ull, 0x170a090ce56f0e7cull, 0x3b8dc9b8e926bc93ull,
+        0x155494f33d17ec37ull, 0x39d35447315e5ed8ull, 0x258a2d98c3eecbb5ull, 0x090ded2ccfa7795aull,
+        0xa1ff421963668e75ull, 0x8d7882ad6f2f3c9aull, 0x9121fb729d9fa9f7ull, 0xbda63bc691d61b18ull,
+        0x54d1d79adcdd8669ull, 0x7856172ed0943486ull, 0x640f6ef12224a1ebull, 0x4888ae452e6d1304ull,
+        0xe07a017082ace42bull, 0xccfdc1c48ee556c4ull, 0xd0a4b81b7c55c3a9ull, 0xfc2378af701c7146ull,
+        0xd2fa25e4a42d21e2ull, 0xfe7de550a864930dull, 0xe2249c8f5ad40660ull, 0xcea35c3b569db48full,
+        0x6651f30efa5c43a0ull, 0x4ad633baf615f14full, 0x568f4a6504a56422ull, 0x7a088ad108ecd6cdull,
+        0x9b7dad78e567189full, 0xb7fa6dcce92eaa70ull, 0xaba314131b9e3f1dull, 0x8724d4a717d78df2ull,
+        0x2fd67b92bb167addull, 0x0351bb26b75fc832ull, 0x1f08c2f945ef5d5full, 0x338f024d49a6efb0ull,
+        0x1d565f069d97bf14ull, 0x31d19fb291de0dfbull, 0x2d88e66d636e9896ull, 0x010f26d96f272a79ull,
+        0xa9fd89ecc3e6dd56ull, 0x857a4958cfaf6fb9ull, 0x992330873d1ffad4ull, 0xb5a4f0333156483bull,
+    },
+    {
+        0x0000000000000000ull, 0xfced1919ea68795aull, 0x732bf8ae4518e0ccull, 0x8fc6e1b7af709996ull,
+        0x5f506a1453e63d6bull, 0xa3bd730db98e4431ull, 0x2c7b92ba16fedda7ull, 0xd0968ba3fc96a4fdull,
+        0xa30b2084e5f10661ull, 0x5fe6399d0f997f3bull, 0xd020d82aa0e9e6adull, 0x2ccdc1334a819ff7ull,
+        0xfc5b4a90b6173b0aull, 0x00b653895c7f4250ull, 0x8f70b23ef30fdbc6ull, 0x739dab271967a29cull,
+        0x4aa5673d99d3e0b4ull, 0xb6487e2473bb99eeull, 0x398e9f93dccb0078ull, 0xc563868a36a37922ull,
+        0x15f50d29ca35dddfull, 0xe9181430205da485ull, 0x66def5878f2d3d13ull, 0x9a33ec9e65454449ull,
+        0xe9ae47b97c22e6d5ull, 0x15435ea0964a9f8full, 0x9a85bf17393a0619ull, 0x6668a60ed3527f43ull,
+        0xb6fe2dad2fc4dbbeull, 0x4a1334b4c5aca2e4ull, 0xc5d5d5036adc3b72ull, 0x3938cc1a80b44228ull,
+        0x0b63d1082e5dd038ull, 0xf78ec811c435a962ull, 0x784829a66b4530f4ull, 0x84a530bf812d49aeull,
+        0x5433bb1c7dbbed53ull, 0xa8dea20597d39409ull, 0x271843b238a30d9full, 0xdbf55aabd2cb74c5ull,
+        0xa868f18ccbacd659ull, 0x5485e89521c4af03ull, 0xdb4309228eb43695ull, 0x27ae103b64dc4fcfull,
+        0xf7389b98984aeb32ull, 0x0bd5828172229268ull, 0x84136336dd520bfeull, 0x78fe7a2f373a72a4ull,
+        0x41c6b635b78e308cull, 0xbd2baf2c5de649d6ull, 0x32ed4e9bf296d040ull, 0xce00578218fea91aull,
+        0x1e96dc21e4680de7ull, 0xe27bc5380e0074bdull, 0x6dbd248fa170ed2bull, 0x91503d964b189471ull,
+        0xe2cd96b1527f36edull, 0x1e208fa8b8174fb7ull, 0x91e66e1f1767d621ull, 0x6d0b7706fd0faf7bull,
+        0xbd9dfca501990b86ull, 0x4170e5bcebf172dcull, 0xceb6040b4481eb4aull, 0x325b1d12aee99210ull,
+        0xa115004608aae53cull, 0x5df8195fe2c29c66ull, 0xd23ef8e84db205f0ull, 0x2ed3e1f1a7da7caaull,
+        0xfe456a525b4cd857ull, 0x02a8734bb124a10dull, 0x8d6e92fc1e54389bull, 0x71838be5f43c41c1ull,
+        0x021e20c2ed5be35dull, 0xfef339db07339a07ull, 0x7135d86ca8430391ull, 0x8dd8c175422b7acbull,
+        0x5d4e4ad6bebdde36ull, 0xa1a353cf54d5a76cull, 0x2e65b278fba53efaull, 0xd288ab6111cd47a0ull,
+        0xebb0677b91790588ull, 0x175d7e627b117cd2ull, 0x989b9fd5d461e544ull, 0x647686cc3e099c1eull,
+        0xb4e00d6fc29f38e3ull, 0x480d147628f741b9ull, 0xc7cbf5c18787d82full, 0x3b26ecd86defa175ull,
+        0x48bb47ff748803e9ull, 0xb4565ee69ee07ab3ull, 0x3b90bf513190e325ull, 0xc77da648dbf89a7full,
+        0x17eb2deb276e3e82ull, 0xeb0634f2cd0647d8ull, 0x64c0d5456276de4eull, 0x982dcc5c881ea714ull,
+        0xaa76d14e26f73504ull, 0x569bc857cc9f4c5eull, 0xd95d29e063efd5c8ull, 0x25b030f98987ac92ull,
+        0xf526bb5a7511086full, 0x09cba2439f797135ull, 0x860d43f43009e8a3ull, 0x7ae05aedda6191f9ull,
+        0x097df1cac3063365ull, 0xf590e8d3296e4a3full, 0x7a560964861ed3a9ull, 0x86bb107d6c76aaf3ull,
+        0x562d9bde90e00e0eull, 0xaac082c77a887754ull, 0x25066370d5f8eec2ull, 0xd9eb7a693f909798ull,
+        0xe0d3b673bf24d5b0ull, 0x1c3eaf6a554caceaull, 0x93f84eddfa3c357cull, 0x6f1557c410544c26ull,
+        0xbf83dc67ecc2e8dbull, 0x436ec57e06aa9181ull, 0xcca824c9a9da0817ull, 0x30453dd043b2714dull,
+        0x43d896f75ad5d3d1ull, 0xbf358feeb0bdaa8bull, 0x30f36e591fcd331dull, 0xcc1e7740f5a54a47ull,
+        0x1c88fce30933eebaull, 0xe065e5fae35b97e0ull, 0x6fa3044d4c2b0e76ull, 0x934e1d54a643772cull,
+        0x6ccbde12c2eb2d5eull, 0x9026c70b28835404ull, 0x1fe026bc87f3cd92ull, 0xe30d3fa56d9bb4c8ull,
+        0x339bb406910d1035ull, 0xcf76ad1f7b65696full, 0x40b04ca8d415f0f9ull, 0xbc5d55b13e7d89a3ull,
+        0xcfc0fe96271a2b3full, 0x332de78fcd725265ull, 0xbceb06386202cbf3ull, 0x40061f21886ab2a9ull,
+        0x9090948274fc1654ull, 0x6c7d8d9b9e946f0eull, 0xe3bb6c2c31e4f698ull, 0x1f567535db8c8fc2ull,
+        0x266eb92f5b38cdeaull, 0xda83a036b150b4b0ull, 0x554541811e202d26ull, 0xa9a85898f448547cull,
+        0x793ed33b08def081ull, 0x85d3ca22e2b689dbull, 0x0a152b954dc6104dull, 0xf6f8328ca7ae6917ull,
+        0x856599abbec9cb8bull, 0x798880b254a1b2d1ull, 0xf64e6105fbd12b47ull, 0x0aa3781c11b9521dull,
+        0xda35f3bfed2ff6e0ull, 0x26d8eaa607478fbaull, 0xa91e0b11a837162cull, 0x55f31208425f6f76ull,
+        0x67a80f1aecb6fd66ull, 0x9b45160306de843cull, 0x1483f7b4a9ae1daaull, 0xe86eeead43c664f0ull,
+        0x38f8650ebf50c00dull, 0xc4157c175538b957ull, 0x4bd39da0fa4820c1ull, 0xb73e84b91020599bull,
+        0xc4a32f9e0947fb07ull, 0x384e3687e32f825dull, 0xb788d7304c5f1bcbull, 0x4b65ce29a6376291ull,
+        0x9bf3458a5aa1c66cull, 0x671e5c93b0c9bf36ull, 0xe8d8bd241fb926a0ull, 0x1435a43df5d15ffaull,
+        0x2d0d682775651dd2ull, 0xd1e0713e9f0d6488ull, 0x5e269089307dfd1eull, 0xa2cb8990da158444ull,
+        0x725d0233268320b9ull, 0x8eb01b2acceb59e3ull, 0x0176fa9d639bc075ull, 0xfd9be38489f3b92full,
+        0x8e0648a390941bb3ull, 0x72eb51ba7afc62e9ull, 0xfd2db00dd58cfb7full, 0x01c0a9143fe48225ull,
+        0xd15622b7c37226d8ull, 0x2dbb3bae291a5f82ull, 0xa27dda19866ac614ull, 0x5e90c3006c02bf4eull,
+        0xcddede54ca41c862ull, 0x3133c74d2029b138ull, 0xbef526fa8f5928aeull, 0x42183fe3653151f4ull,
+        0x928eb44099a7f509ull, 0x6e63ad5973cf8c53ull, 0xe1a54ceedcbf15c5ull, 0x1d4855f736d76c9full,
+        0x6ed5fed02fb0ce03ull, 0x9238e7c9c5d8b759ull, 0x1dfe067e6aa82ecfull, 0xe1131f6780c05795ull,
+        0x318594c47c56f368ull, 0xcd688ddd963e8a32ull, 0x42ae6c6a394e13a4ull, 0xbe437573d3266afeull,
+        0x877bb969539228d6ull, 0x7b96a070b9fa518cull, 0xf45041c7168ac81aull, 0x08bd58defce2b140ull,
+        0xd82bd37d007415bdull, 0x24c6ca64ea1c6ce7ull, 0xab002bd3456cf571ull, 0x57ed32caaf048c2bull,
+        0x247099edb6632eb7ull, 0xd89d80f45c0b57edull, 0x575b6143f37bce7bull, 0xabb6785a1913b721ull,
+        0x7b20f3f9e58513dcull, 0x87cdeae00fed6a86ull, 0x080b0b57a09df310ull, 0xf4e6124e4af58a4aull,
+        0xc6bd0f5ce41c185aull, 0x3a5016450e746100ull, 0xb596f7f2a104f896ull, 0x497beeeb4b6c81ccull,
+        0x99ed6548b7fa2531ull, 0x65007c515d925c6bull, 0xeac69de6f2e2c5fdull, 0x162b84ff188abca7ull,
+        0x65b62fd801ed1e3bull, 0x995b36c1eb856761ull, 0x169dd77644f5fef7ull, 0xea70ce6fae9d87adull,
+        0x3ae645cc520b2350ull, 0xc60b5cd5b8635a0aull, 0x49cdbd621713c39cull, 0xb520a47bfd7bbac6ull,
+        0x8c1868617dcff8eeull, 0x70f5717897a781b4ull, 0xff3390cf38d71822ull, 0x03de89d6d2bf6178ull,
+        0xd34802752e29c585ull, 0x2fa51b6cc441bcdfull, 0xa063fadb6b312549ull, 0x5c8ee3c281595c13ull,
+        0x2f1348e5983efe8full, 0xd3fe51fc725687d5ull, 0x5c38b04bdd261e43ull, 0xa0d5a952374e6719ull,
+        0x704322f1cbd8c3e4ull, 0x8cae3be821b0babeull, 0x0368da5f8ec02328ull, 0xff85c34664a85a72ull,
+    },
+    {
+        0x0000000000000000ull, 0xab4398ae2c367821ull, 0xf7d966e22bdc7863ull, 0x5c9afe4c07ea0042ull,
+        0x43574d3639474ec7ull, 0xe814d598157136e6ull, 0xb48e2bd4129b36a4ull, 0x1fcdb37a3ead4e85ull,
+        0x542c1921e6a0ed64ull, 0xff6f818fca969545ull, 0xa3f57fc3cd7c9507ull, 0x08b6e76de14aed26ull,
+        0x177b5417dfe7a3a3ull, 0xbc38ccb9f3d1db82ull, 0xe0a232f5f43bdbc0ull, 0x4be1aa5bd80da3e1ull,
+        0x15c4afe2ffcbc5c3ull, 0xbe87374cd3fdbde2ull, 0xe21dc900d417bda0ull, 0x495e51aef821c581ull,
+        0x5693e2d4c68c8b04ull, 0xfdd07a7aeabaf325ull, 0xa14a8436ed50f367ull, 0x0a091c98c1668b46ull,
+        0x41e8b6c3196b28a7ull, 0xeaab2e6d355d5086ull, 0xb631d02132b750c4ull, 0x1d72488f1e8128e5ull,
+        0x02bffbf5202c6660ull, 0xa9fc635b0c1a1e41ull, 0xf5669d170bf01e03ull, 0x5e2505b927c66622ull,
+        0x382a265ba5890a5full, 0x9369bef589bf727eull, 0xcff340b98e55723cull, 0x64b0d817a2630a1dull,
+        0x7b7d6b6d9cce4498ull, 0xd03ef3c3b0f83cb9ull, 0x8ca40d8fb7123cfbull, 0x27e795219b2444daull,
+        0x6c063f7a4329e73bull, 0xc745a7d46f1f9f1aull, 0x9bdf599868f59f58ull, 0x309cc13644c3e779ull,
+        0x2f51724c7a6ea9fcull, 0x8412eae25658d1ddull, 0xd88814ae51b2d19full, 0x73cb8c007d84a9beull,
+        0x2dee89b95a42cf9cull, 0x86ad11177674b7bdull, 0xda37ef5b719eb7ffull, 0x717477f55da8cfdeull,
+        0x6eb9c48f6305815bull, 0xc5fa5c214f33f97aull, 0x9960a26d48d9f938ull, 0x32233ac364ef8119ull,
+        0x79c29098bce222f8ull, 0xd281083690d45ad9ull, 0x8e1bf67a973e5a9bull, 0x25586ed4bb0822baull,
+        0x3a95ddae85a56c3full, 0x91d64500a993141eull, 0xcd4cbb4cae79145cull, 0x660f23e2824f6c7dull,
+        0x71b336cfe5ed11b5ull, 0xdaf0ae61c9db6994ull, 0x866a502dce3169d6ull, 0x2d29c883e20711f7ull,
+        0x32e47bf9dcaa5f72ull, 0x99a7e357f09c2753ull, 0xc53d1d1bf7762711ull, 0x6e7e85b5db405f30ull,
+        0x259f2fee034dfcd1ull, 0x8edcb7402f7b84f0ull, 0xd246490c289184b2ull, 0x7905d1a204a7fc93ull,
+        0x66c862d83a0ab216ull, 0xcd8bfa76163cca37ull, 0x9111043a11d6ca75ull, 0x3a529c943de0b254ull,
+        0x6477992d1a26d476ull, 0xcf3401833610ac57ull, 0x93aeffcf31faac15ull, 0x38ed67611dccd434ull,
+        0x2720d41b23619ab1ull, 0x8c634cb50f57e290ull, 0xd0f9b2f908bde2d2ull, 0x7bba2a57248b9af3ull,
+        0x305b800cfc863912ull, 0x9b1818a2d0b04133ull, 0xc782e6eed75a4171ull, 0x6cc17e40fb6c3950ull,
+        0x730ccd3ac5c177d5ull, 0xd84f5594e9f70ff4ull, 0x84d5abd8ee1d0fb6ull, 0x2f963376c22b7797ull,
+        0x4999109440641beaull, 0xe2da883a6c5263cbull, 0xbe4076766bb86389ull, 0x1503eed8478e1ba8ull,
+        0x0ace5da27923552dull, 0xa18dc50c55152d0cull, 0xfd173b4052ff2d4eull, 0x5654a3ee7ec9556full,
+        0x1db509b5a6c4f68eull, 0xb6f6911b8af28eafull, 0xea6c6f578d188eedull, 0x412ff7f9a12ef6ccull,
+        0x5ee244839f83b849ull, 0xf5a1dc2db3b5c068ull, 0xa93b2261b45fc02aull, 0x0278bacf9869b80bull,
+        0x5c5dbf76bfafde29ull, 0xf71e27d89399a608ull, 0xab84d9949473a64aull, 0x00c7413ab845de6bull,
+        0x1f0af24086e890eeull, 0xb4496aeeaadee8cfull, 0xe8d394a2ad34e88dull, 0x43900c0c810290acull,
+        0x0871a657590f334dull, 0xa3323ef975394b6cull, 0xffa8c0b572d34b2eull, 0x54eb581b5ee5330full,
+        0x4b26eb6160487d8aull, 0xe06573cf4c7e05abull, 0xbcff8d834b9405e9ull, 0x17bc152d67a27dc8ull,
+        0xe2e0d82c295c17aaull, 0x49a34082056a6f8bull, 0x1539bece02806fc9ull, 0xbe7a26602eb617e8ull,
+        0xa1b7951a101b596dull, 0x0af40db43c2d214cull, 0x566ef3f83bc7210eull, 0xfd2d6b5617f1592full,
+        0xb6ccc10dcffcfaceull, 0x1d8f59a3e3ca82efull, 0x4115a7efe42082adull, 0xea563f41c816fa8cull,
+        0xf59b8c3bf6bbb409ull, 0x5ed81495da8dcc28ull, 0x0242ead9dd67cc6aull, 0xa9017277f151b44bull,
+        0xf72477ced697d269ull, 0x5c67ef60faa1aa48ull, 0x00fd112cfd4baa0aull, 0xabbe8982d17dd22bull,
+        0xb4733af8efd09caeull, 0x1f30a256c3e6e48full, 0x43aa5c1ac40ce4cdull, 0xe8e9c4b4e83a9cecull,
+        0xa3086eef30373f0dull, 0x084bf6411c01472cull, 0x54d1080d1beb476eull, 0xff9290a337dd3f4full,
+        0xe05f23d9097071caull, 0x4b1cbb77254609ebull, 0x1786453b22ac09a9ull, 0xbcc5dd950e9a7188ull,
+        0xdacafe778cd51df5ull, 0x718966d9a0e365d4ull, 0x2d139895a7096596ull, 0x8650003b8b3f1db7ull,
+        0x999db341b5925332ull, 0x32de2bef99a42b13ull, 0x6e44d5a39e4e2b51ull, 0xc5074d0db2785370ull,
+        0x8ee6e7566a75f091ull, 0x25a57ff8464388b0ull, 0x793f81b441a988f2ull, 0xd27c191a6d9ff0d3ull,
+        0xcdb1aa605332be56ull, 0x66f232ce7f04c677ull, 0x3a68cc8278eec635ull, 0x912b542c54d8be14ull,
+        0xcf0e5195731ed836ull, 0x644dc93b5f28a017ull, 0x38d7377758c2a055ull, 0x9394afd974f4d874ull,
+        0x8c591ca34a5996f1ull, 0x271a840d666feed0ull, 0x7b807a416185ee92ull, 0xd0c3e2ef4db396b3ull,
+        0x9b2248b495be3552ull, 0x3061d01ab9884d73ull, 0x6cfb2e56be624d31ull, 0xc7b8b6f892543510ull,
+        0xd8750582acf97b95ull, 0x73369d2c80cf03b4ull, 0x2fac6360872503f6ull, 0x84effbceab137bd7ull,
+        0x9353eee3ccb1061full, 0x3810764de0877e3eull, 0x648a8801e76d7e7cull, 0xcfc910afcb5b065dull,
+        0xd004a3d5f5f648d8ull, 0x7b473b7bd9c030f9ull, 0x27ddc537de2a30bbull, 0x8c9e5d99f21c489aull,
+        0xc77ff7c22a11eb7bull, 0x6c3c6f6c0627935aull, 0x30a6912001cd9318ull, 0x9be5098e2dfbeb39ull,
+        0x8428baf41356a5bcull, 0x2f6b225a3f60dd9dull, 0x73f1dc16388adddfull, 0xd8b244b814bca5feull,
+        0x86974101337ac3dcull, 0x2dd4d9af1f4cbbfdull, 0x714e27e318a6bbbfull, 0xda0dbf4d3490c39eull,
+        0xc5c00c370a3d8d1bull, 0x6e839499260bf53aull, 0x32196ad521e1f578ull, 0x995af27b0dd78d59ull,
+        0xd2bb5820d5da2eb8ull, 0x79f8c08ef9ec5699ull, 0x25623ec2fe0656dbull, 0x8e21a66cd2302efaull,
+        0x91ec1516ec9d607full, 0x3aaf8db8c0ab185eull, 0x663573f4c741181cull, 0xcd76eb5aeb77603dull,
+        0xab79c8b869380c40ull, 0x003a5016450e7461ull, 0x5ca0ae5a42e47423ull, 0xf7e336f46ed20c02ull,
+        0xe82e858e507f4287ull, 0x436d1d207c493aa6ull, 0x1ff7e36c7ba33ae4ull, 0xb4b47bc2579542c5ull,
+        0xff55d1998f98e124ull, 0x54164937a3ae9905ull, 0x088cb77ba4449947ull, 0xa3cf2fd58872e166ull,
+        0xbc029cafb6dfafe3ull, 0x174104019ae9d7c2ull, 0x4bdbfa4d9d03d780ull, 0xe09862e3b135afa1ull,
+        0xbebd675a96f3c983ull, 0x15fefff4bac5b1a2ull, 0x496401b8bd2fb1e0ull, 0xe22799169119c9c1ull,
+        0xfdea2a6cafb48744ull, 0x56a9b2c28382ff65ull, 0x0a334c8e8468ff27ull, 0xa170d420a85e8706ull,
+        0xea917e7b705324e7ull, 0x41d2e6d55c655cc6ull, 0x1d4818995b8f5c84ull, 0xb60b803777b924a5ull,
+        0xa9c6334d49146a20ull, 0x0285abe365221201ull, 0x5e1f55af62c81243ull, 0xf55ccd014efe6a62ull,
+    },
+    {
+        0x0000000000000000ull, 0x8e21538c26050b35ull, 0xd19908b0d3baad3cull, 0x5fb85b3cf5bfa609ull,
+        0xa29ef4e1551ba5c6ull, 0x2cbfa76d731eaef3ull, 0x7307fc5186a108faull, 0xfd26afdda0a403cfull,
+        0x5f18b9b6e40b66c3ull, 0xd139ea3ac20e6df6ull, 0x8e81b10637b1cbffull, 0x00a0e28a11b4c0caull,
+        0xfd864d57b110c305ull, 0x73a71edb9715c830ull, 0x2c1f45e762aa6e39ull, 0xa23e166b44af650cull,
+        0xebfb01468f9fc592ull, 0x65da52caa99acea7ull, 0x3a6209f65c2568aeull, 0xb4435a7a7a20639bull,
+        0x4965f5a7da846054ull, 0xc744a62bfc816b61ull, 0x98fcfd17093ecd68ull, 0x16ddae9b2f3bc65dull,
+        0xb4e3b8f06b94a351ull, 0x3ac2eb7c4d91a864ull, 0x657ab040b82e0e6dull, 0xeb5be3cc9e2b0558ull,
+        0x167d4c113e8f0697ull, 0x985c1f9d188a0da2ull, 0xc7e444a1ed35ababull, 0x49c5172dcb30a09eull,
+        0xa044d83fc9d1431eull, 0x2e658bb3efd4482bull, 0x71ddd08f1a6bee22ull, 0xfffc83033c6ee517ull,
+        0x02da2cde9ccae6d8ull, 0x8cfb7f52bacfededull, 0xd343246e4f704be4ull, 0x5d6277e2697540d1ull,
+        0xff5c61892dda25ddull, 0x717d32050bdf2ee8ull, 0x2ec56939fe6088e1ull, 0xa0e43ab5d86583d4ull,
+        0x5dc2956878c1801bull, 0xd3e3c6e45ec48b2eull, 0x8c5b9dd8ab7b2d27ull, 0x027ace548d7e2612ull,
+        0x4bbfd979464e868cull, 0xc59e8af5604b8db9ull, 0x9a26d1c995f42bb0ull, 0x14078245b3f12085ull,
+        0xe9212d981355234aull, 0x67007e143550287full, 0x38b82528c0ef8e76ull, 0xb69976a4e6ea8543ull,
+        0x14a760cfa245e04full, 0x9a8633438440eb7aull, 0xc53e687f71ff4d73ull, 0x4b1f3bf357fa4646ull,
+        0xb639942ef75e4589ull, 0x3818c7a2d15b4ebcull, 0x67a09c9e24e4e8b5ull, 0xe981cf1202e1e380ull,
+        0x570f5858a45dcda1ull, 0xd92e0bd48258c694ull, 0x869650e877e7609dull, 0x08b7036451e26ba8ull,
+        0xf591acb9f1466867ull, 0x7bb0ff35d7436352ull, 0x2408a40922fcc55bull, 0xaa29f78504f9ce6eull,
+        0x0817e1ee4056ab62ull, 0x8636b2626653a057ull, 0xd98ee95e93ec065eull, 0x57afbad2b5e90d6bull,
+        0xaa89150f154d0ea4ull, 0x24a8468333480591ull, 0x7b101dbfc6f7a398ull, 0xf5314e33e0f2a8adull,
+        0xbcf4591e2bc20833ull, 0x32d50a920dc70306ull, 0x6d6d51aef878a50full, 0xe34c0222de7dae3aull,
+        0x1e6aadff7ed9adf5ull, 0x904bfe7358dca6c0ull, 0xcff3a54fad6300c9ull, 0x41d2f6c38b660bfcull,
+        0xe3ece0a8cfc96ef0ull, 0x6dcdb324e9cc65c5ull, 0x3275e8181c73c3ccull, 0xbc54bb943a76c8f9ull,
+        0x417214499ad2cb36ull, 0xcf5347c5bcd7c003ull, 0x90eb1cf94968660aull, 0x1eca4f756f6d6d3full,
+        0xf74b80676d8c8ebfull, 0x796ad3eb4b89858aull, 0x26d288d7be362383ull, 0xa8f3db5b983328b6ull,
+        0x55d5748638972b79ull, 0xdbf4270a1e92204cull, 0x844c7c36eb2d8645ull, 0x0a6d2fbacd288d70ull,
+        0xa85339d18987e87cull, 0x26726a5daf82e349ull, 0x79ca31615a3d4540ull, 0xf7eb62ed7c384e75ull,
+        0x0acdcd30dc9c4dbaull, 0x84ec9ebcfa99468full, 0xdb54c5800f26e086ull, 0x5575960c2923ebb3ull,
+        0x1cb08121e2134b2dull, 0x9291d2adc4164018ull, 0xcd29899131a9e611ull, 0x4308da1d17aced24ull,
+        0xbe2e75c0b708eeebull, 0x300f264c910de5deull, 0x6fb77d7064b243d7ull, 0xe1962efc42b748e2ull,
+        0x43a8389706182deeull, 0xcd896b1b201d26dbull, 0x92313027d5a280d2ull, 0x1c1063abf3a78be7ull,
+        0xe136cc7653038828ull, 0x6f179ffa7506831dull, 0x30afc4c680b92514ull, 0xbe8e974aa6bc2e21ull,
+        0x2de5fbba3f89979cull, 0xa3c4a836198c9ca9ull, 0xfc7cf30aec333aa0ull, 0x725da086ca363195ull,
+        0x8f7b0f5b6a92325aull, 0x015a5cd74c97396full, 0x5ee207ebb9289f66ull, 0xd0c354679f2d9453ull,
+        0x72fd420cdb82f15full, 0xfcdc1180fd87fa6aull, 0xa3644abc08385c63ull, 0x2d4519302e3d5756ull,
+        0xd063b6ed8e995499ull, 0x5e42e561a89c5facull, 0x01fabe5d5d23f9a5ull, 0x8fdbedd17b26f290ull,
+        0xc61efafcb016520eull, 0x483fa9709613593bull, 0x1787f24c63acff32ull, 0x99a6a1c045a9f407ull,
+        0x64800e1de50df7c8ull, 0xeaa15d91c308fcfdull, 0xb51906ad36b75af4ull, 0x3b38552110b251c1ull,
+        0x9906434a541d34cdull, 0x172710c672183ff8ull, 0x489f4bfa87a799f1ull, 0xc6be1876a1a292c4ull,
+        0x3b98b7ab0106910bull, 0xb5b9e42727039a3eull, 0xea01bf1bd2bc3c37ull, 0x6420ec97f4b93702ull,
+        0x8da12385f658d482ull, 0x03807009d05ddfb7ull, 0x5c382b3525e279beull, 0xd21978b903e7728bull,
+        0x2f3fd764a3437144ull, 0xa11e84e885467a71ull, 0xfea6dfd470f9dc78ull, 0x70878c5856fcd74dull,
+        0xd2b99a331253b241ull, 0x5c98c9bf3456b974ull, 0x03209283c1e91f7dull, 0x8d01c10fe7ec1448ull,
+        0x70276ed247481787ull, 0xfe063d5e614d1cb2ull, 0xa1be666294f2babbull, 0x2f9f35eeb2f7b18eull,
+        0x665a22c379c71110ull, 0xe87b714f5fc21a25ull, 0xb7c32a73aa7dbc2cull, 0x39e279ff8c78b719ull,
+        0xc4c4d6222cdcb4d6ull, 0x4ae585ae0ad9bfe3ull, 0x155dde92ff6619eaull, 0x9b7c8d1ed96312dfull,
+        0x39429b759dcc77d3ull, 0xb763c8f9bbc97ce6ull, 0xe8db93c54e76daefull, 0x66fac0496873d1daull,
+        0x9bdc6f94c8d7d215ull, 0x15fd3c18eed2d920ull, 0x4a4567241b6d7f29ull, 0xc46434a83d68741cull,
+        0x7aeaa3e29bd45a3dull, 0xf4cbf06ebdd15108ull, 0xab73ab52486ef701ull, 0x2552f8de6e6bfc34ull,
+        0xd8745703cecffffbull, 0x5655048fe8caf4ceull, 0x09ed5fb31d7552c7ull, 0x87cc0c3f3b7059f2ull,
+        0x25f21a547fdf3cfeull, 0xabd349d859da37cbull, 0xf46b12e4ac6591c2ull, 0x7a4a41688a609af7ull,
+        0x876ceeb52ac49938ull, 0x094dbd390cc1920dull, 0x56f5e605f97e3404ull, 0xd8d4b589df7b3f31ull,
+        0x9111a2a4144b9fafull, 0x1f30f128324e949aull, 0x4088aa14c7f13293ull, 0xcea9f998e1f439a6ull,
+        0x338f564541503a69ull, 0xbdae05c96755315cull, 0xe2165ef592ea9755ull, 0x6c370d79b4ef9c60ull,
+        0xce091b12f040f96cull, 0x4028489ed645f259ull, 0x1f9013a223fa5450ull, 0x91b1402e05ff5f65ull,
+        0x6c97eff3a55b5caaull, 0xe2b6bc7f835e579full, 0xbd0ee74376e1f196ull, 0x332fb4cf50e4faa3ull,
+        0xdaae7bdd52051923ull, 0x548f285174001216ull, 0x0b37736d81bfb41full, 0x851620e1a7babf2aull,
+        0x78308f3c071ebce5ull, 0xf611dcb0211bb7d0ull, 0xa9a9878cd4a411d9ull, 0x2788d400f2a11aecull,
+        0x85b6c26bb60e7fe0ull, 0x0b9791e7900b74d5ull, 0x542fcadb65b4d2dcull, 0xda0e995743b1d9e9ull,
+        0x2728368ae315da26ull, 0xa9096506c510d113ull, 0xf6b13e3a30af771aull, 0x78906db616aa7c2full,
+        0x31557a9bdd9adcb1ull, 0xbf742917fb9fd784ull, 0xe0cc722b0e20718dull, 0x6eed21a728257ab8ull,
+        0x93cb8e7a88817977ull, 0x1deaddf6ae847242ull, 0x425286ca5b3bd44bull, 0xcc73d5467d3edf7eull,
+        0x6e4dc32d3991ba72ull, 0xe06c90a11f94b147ull, 0xbfd4cb9dea2b174eull, 0x31f59811cc2e1c7bull,
+        0xccd337cc6c8a1fb4ull, 0x42f264404a8f1481ull, 0x1d4a3f7cbf30b288ull, 0x936b6cf09935b9bdull,
+    },
+    {
+        0x0000000000000000ull, 0xa10a2ffd9aac5176ull, 0x71c3bac7133601fdull, 0xd0c9953a899a508bull,
+        0xe08fdcb32b9dcfbeull, 0x4185f34eb1319ec8ull, 0x914c667438abce43ull, 0x30464989a2079f35ull,
+        0xebb1dd50db840531ull, 0x4abbf2ad41285447ull, 0x9a726797c8b204ccull, 0x3b78486a521e55baull,
+        0x0b3e01e3f019ca8full, 0xaa342e1e6ab59bf9ull, 0x7afdbb24e32fcb72ull, 0xdbf794d979839a04ull,
+        0x15cda5e9f88803c1ull, 0xb4c78a14622452b7ull, 0x640e1f2eebbe023cull, 0xc50430d37112534aull,
+        0xf542795ad315cc7full, 0x544856a749b99d09ull, 0x8481c39dc023cd82ull, 0x258bec605a8f9cf4ull,
+        0xfe7c78b9230c06f0ull, 0x5f765744b9a05786ull, 0x8fbfc27e303a070dull, 0x2eb5ed83aa96567bull,
+        0x1ef3a40a0891c94eull, 0xbff98bf7923d9838ull, 0x6f301ecd1ba7c8b3ull, 0xce3a3130810b99c5ull,
+        0x3829553fee3b0cebull, 0x99237ac274975d9dull, 0x49eaeff8fd0d0d16ull, 0xe8e0c00567a15c60ull,
+        0xd8a6898cc5a6c355ull, 0x79aca6715f0a9223ull, 0xa965334bd690c2a8ull, 0x086f1cb64c3c93deull,
+        0xd398886f35bf09daull, 0x7292a792af1358acull, 0xa25b32a826890827ull, 0x03511d55bc255951ull,
+        0x331754dc1e22c664ull, 0x921d7b21848e9712ull, 0x42d4ee1b0d14c799ull, 0xe3dec1e697b896efull,
+        0x2de4f0d616b30f2aull, 0x8ceedf2b8c1f5e5cull, 0x5c274a1105850ed7ull, 0xfd2d65ec9f295fa1ull,
+        0xcd6b2c653d2ec094ull, 0x6c610398a78291e2ull, 0xbca896a22e18c169ull, 0x1da2b95fb4b4901full,
+        0xc6552d86cd370a1bull, 0x675f027b579b5b6dull, 0xb7969741de010be6ull, 0x169cb8bc44ad5a90ull,
+        0x26daf135e6aac5a5ull, 0x87d0dec87c0694d3ull, 0x57194bf2f59cc458ull, 0xf613640f6f30952eull,
+        0x7827fa8cadbf144dull, 0xd92dd5713713453bull, 0x09e4404bbe8915b0ull, 0xa8ee6fb6242544c6ull,
+        0x98a8263f8622dbf3ull, 0x39a209c21c8e8a85ull, 0xe96b9cf89514da0eull, 0x4861b3050fb88b78ull,
+        0x939627dc763b117cull, 0x329c0821ec97400aull, 0xe2559d1b650d1081ull, 0x435fb2e6ffa141f7ull,
+        0x7319fb6f5da6dec2ull, 0xd213d492c70a8fb4ull, 0x02da41a84e90df3full, 0xa3d06e55d43c8e49ull,
+        0x6dea5f655537178cull, 0xcce07098cf9b46faull, 0x1c29e5a246011671ull, 0xbd23ca5fdcad4707ull,
+        0x8d6583d67eaad832ull, 0x2c6fac2be4068944ull, 0xfca639116d9cd9cfull, 0x5dac16ecf73088b9ull,
+        0x865b82358eb312bdull, 0x2751adc8141f43cbull, 0xf79838f29d851340ull, 0x5692170f07294236ull,
+        0x66d45e86a52edd03ull, 0xc7de717b3f828c75ull, 0x1717e441b618dcfeull, 0xb61dcbbc2cb48d88ull,
+        0x400eafb3438418a6ull, 0xe104804ed92849d0ull, 0x31cd157450b2195bull, 0x90c73a89ca1e482dull,
+        0xa08173006819d718ull, 0x018b5cfdf2b5866eull, 0xd142c9c77b2fd6e5ull, 0x7048e63ae1838793ull,
+        0xabbf72e398001d97ull, 0x0ab55d1e02ac4ce1ull, 0xda7cc8248b361c6aull, 0x7b76e7d9119a4d1cull,
+        0x4b30ae50b39dd229ull, 0xea3a81ad2931835full, 0x3af31497a0abd3d4ull, 0x9bf93b6a3a0782a2ull,
+        0x55c30a5abb0c1b67ull, 0xf4c925a721a04a11ull, 0x2400b09da83a1a9aull, 0x850a9f6032964becull,
+        0xb54cd6e99091d4d9ull, 0x1446f9140a3d85afull, 0xc48f6c2e83a7d524ull, 0x658543d3190b8452ull,
+        0xbe72d70a60881e56ull, 0x1f78f8f7fa244f20ull, 0xcfb16dcd73be1fabull, 0x6ebb4230e9124eddull,
+        0x5efd0bb94b15d1e8ull, 0xfff72444d1b9809eull, 0x2f3eb17e5823d015ull, 0x8e349e83c28f8163ull,
+        0x4bbfd20b452b4dd4ull, 0xeab5fdf6df871ca2ull, 0x3a7c68cc561d4c29ull, 0x9b764731ccb11d5full,
+        0xab300eb86eb6826aull, 0x0a3a2145f41ad31cull, 0xdaf3b47f7d808397ull, 0x7bf99b82e72cd2e1ull,
+        0xa00e0f5b9eaf48e5ull, 0x010420a604031993ull, 0xd1cdb59c8d994918ull, 0x70c79a611735186eull,
+        0x4081d3e8b532875bull, 0xe18bfc152f9ed62dull, 0x3142692fa60486a6ull, 0x904846d23ca8d7d0ull,
+        0x5e7277e2bda34e15ull, 0xff78581f270f1f63ull, 0x2fb1cd25ae954fe8ull, 0x8ebbe2d834391e9eull,
+        0xbefdab51963e81abull, 0x1ff784ac0c92d0ddull, 0xcf3e119685088056ull, 0x6e343e6b1fa4d120ull,
+        0xb5c3aab266274b24ull, 0x14c9854ffc8b1a52ull, 0xc400107575114ad9ull, 0x650a3f88efbd1bafull,
+        0x554c76014dba849aull, 0xf44659fcd716d5ecull, 0x248fccc65e8c8567ull, 0x8585e33bc420d411ull,
+        0x73968734ab10413full, 0xd29ca8c931bc1049ull, 0x02553df3b82640c2ull, 0xa35f120e228a11b4ull,
+        0x93195b87808d8e81ull, 0x3213747a1a21dff7ull, 0xe2dae14093bb8f7cull, 0x43d0cebd0917de0aull,
+        0x98275a647094440eull, 0x392d7599ea381578ull, 0xe9e4e0a363a245f3ull, 0x48eecf5ef90e1485ull,
+        0x78a886d75b098bb0ull, 0xd9a2a92ac1a5dac6ull, 0x096b3c10483f8a4dull, 0xa86113edd293db3bull,
+        0x665b22dd539842feull, 0xc7510d20c9341388ull, 0x1798981a40ae4303ull, 0xb692b7e7da021275ull,
+        0x86d4fe6e78058d40ull, 0x27ded193e2a9dc36ull, 0xf71744a96b338cbdull, 0x561d6b54f19fddcbull,
+        0x8deaff8d881c47cfull, 0x2ce0d07012b016b9ull, 0xfc29454a9b2a4632ull, 0x5d236ab701861744ull,
+        0x6d65233ea3818871ull, 0xcc6f0cc3392dd907ull, 0x1ca699f9b0b7898cull, 0xbdacb6042a1bd8faull,
+        0x33982887e8945999ull, 0x9292077a723808efull, 0x425b9240fba25864ull, 0xe351bdbd610e0912ull,
+        0xd317f434c3099627ull, 0x721ddbc959a5c751ull, 0xa2d44ef3d03f97daull, 0x03de610e4a93c6acull,
+        0xd829f5d733105ca8ull, 0x7923da2aa9bc0ddeull, 0xa9ea4f1020265d55ull, 0x08e060edba8a0c23ull,
+        0x38a62964188d9316ull, 0x99ac06998221c260ull, 0x496593a30bbb92ebull, 0xe86fbc5e9117c39dull,
+        0x26558d6e101c5a58ull, 0x875fa2938ab00b2eull, 0x579637a9032a5ba5ull, 0xf69c185499860ad3ull,
+        0xc6da51dd3b8195e6ull, 0x67d07e20a12dc490ull, 0xb719eb1a28b7941bull, 0x1613c4e7b21bc56dull,
+        0xcde4503ecb985f69ull, 0x6cee7fc351340e1full, 0xbc27eaf9d8ae5e94ull, 0x1d2dc50442020fe2ull,
+        0x2d6b8c8de00590d7ull, 0x8c61a3707aa9c1a1ull, 0x5ca8364af333912aull, 0xfda219b7699fc05cull,
+        0x0bb17db806af5572ull, 0xaabb52459c030404ull, 0x7a72c77f1599548full, 0xdb78e8828f3505f9ull,
+        0xeb3ea10b2d329accull, 0x4a348ef6b79ecbbaull, 0x9afd1bcc3e049b31ull, 0x3bf73431a4a8ca47ull,
+        0xe000a0e8dd2b5043ull, 0x410a8f1547870135ull, 0x91c31a2fce1d51beull, 0x30c935d254b100c8ull,
+        0x008f7c5bf6b69ffdull, 0xa18553a66c1ace8bull, 0x714cc69ce5809e00ull, 0xd046e9617f2ccf76ull,
+        0x1e7cd851fe2756b3ull, 0xbf76f7ac648b07c5ull, 0x6fbf6296ed11574eull, 0xceb54d6b77bd0638ull,
+        0xfef304e2d5ba990dull, 0x5ff92b1f4f16c87bull, 0x8f30be25c68c98f0ull, 0x2e3a91d85c20c986ull,
+        0xf5cd050125a35382ull, 0x54c72afcbf0f02f4ull, 0x840ebfc63695527full, 0x2504903bac390309ull,
+        0x1542d9b20e3e9c3cull, 0xb448f64f9492cd4aull, 0x648163751d089dc1ull, 0xc58b4c8887a4ccb7ull,
+    },
+};
+
+#endif // CORETEN_HASH_TABLES_H
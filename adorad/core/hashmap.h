@@ -0,0 +1,116 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_HASHMAP_H
+#define CORETEN_HASHMAP_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/compilers.h>
+#include <adorad/core/memory.h>
+
+/*
+    Hash maps
+
+    `cstlHashMap` is an open-addressing hash map in the style of Swiss tables. Keys and values are stored inline in 
+    a single slot array (no per-entry allocation), and a parallel array holds one control byte per slot: either 
+    `HASHMAP_CTRL_EMPTY` or the low 7 bits of the key's hash. Lookups scan the control bytes 
+    `HASHMAP_GROUP_WIDTH` at a time (with SSE2 where available), so most misses and hits compare a single key.
+
+    The capacity is always a power of two (a mask, not a modulo, picks the home slot) and the map grows once it 
+    is 7/8 full. Probing is linear, which lets `hashmap_remove()` shift later entries back into the hole instead of 
+    leaving a tombstone - so lookups never slow down after many removals.
+
+    Keys are compared as raw bytes by default; pass `hashmap_str_hash`/`hashmap_str_eq` for `char*` keys (or your 
+    own functions for anything else). Pointers into the map (`hashmap_get()` etc) are invalidated by inserts and 
+    removals.
+
+        cstlHashMap* map = hashmap_new(UInt32, double, 0);
+        UInt32 key = 42;
+        double value = 3.14;
+        hashmap_put(map, &key, &value);
+        double* found = cast(double*)hashmap_get(map, &key);
+
+        for(UInt64 it = hashmap_begin(map); it != hashmap_end(map); it = hashmap_next(map, it))
+            printf("%u -> %f\n", *cast(UInt32*)hashmap_key_at(map, it), *cast(double*)hashmap_value_at(map, it));
+*/
+#define HASHMAP_GROUP_WIDTH     16
+#define HASHMAP_MIN_CAPACITY    HASHMAP_GROUP_WIDTH
+#define HASHMAP_CTRL_EMPTY      cast(Int8)-128
+
+// Hashes `key_size` bytes at `key`
+typedef UInt64 (*cstlHashFn)(const void* key, UInt64 key_size);
+// Are the keys at `a` and `b` equal?
+typedef bool (*cstlHashEqFn)(const void* a, const void* b, UInt64 key_size);
+
+typedef struct cstlHashMap {
+    Int8* ctrl;             // `capacity + HASHMAP_GROUP_WIDTH` control bytes (the first group is mirrored at the end)
+    Byte* slots;            // `capacity` slots of `slot_size` bytes: the key, then the value
+    UInt64 size;            // number of entries
+    UInt64 capacity;        // number of slots (a power of two)
+    UInt64 growth_left;     // inserts left before the map must grow
+    UInt64 key_size;
+    UInt64 value_size;
+    UInt64 value_offset;    // offset of the value in a slot
+    UInt64 slot_size;
+    cstlHashFn hash;
+    cstlHashEqFn eq;
+    cstlAllocator* allocator;   // null for the default allocator
+} cstlHashMap;
+
+#define hashmap_new(K, V, capacity)     _hashmap_new_in(null, sizeof(K), sizeof(V), (capacity), null, null)
+// Like `hashmap_new()`, but allocating from `allocator`
+#define hashmap_new_in(allocator, K, V, capacity)   \
+    _hashmap_new_in((allocator), sizeof(K), sizeof(V), (capacity), null, null)
+// A map keyed by null-terminated strings (`char*`). Only the pointers are stored - the strings must outlive the map
+#define hashmap_new_str(V, capacity)    \
+    _hashmap_new_in(null, sizeof(char*), sizeof(V), (capacity), hashmap_str_hash, hashmap_str_eq)
+
+// `capacity` is the number of entries the map can hold before it first grows. 
+// A null `hash`/`eq` hashes/compares the raw key bytes
+cstlHashMap* _hashmap_new_in(cstlAllocator* allocator, UInt64 key_size, UInt64 value_size, UInt64 capacity, 
+                             cstlHashFn hash, cstlHashEqFn eq);
+void hashmap_free(cstlHashMap* map);
+// Remove every entry (keeping the capacity)
+void hashmap_clear(cstlHashMap* map);
+// Make room for at least `n` entries without growing
+void hashmap_reserve(cstlHashMap* map, UInt64 n);
+UInt64 hashmap_size(cstlHashMap* map);
+
+// Pointer to the value for `key` (null if not found)
+void* hashmap_get(cstlHashMap* map, const void* key);
+bool hashmap_contains(cstlHashMap* map, const void* key);
+// Insert or overwrite `key` with `value` (which may be null for a zeroed value). Returns a pointer to the value
+void* hashmap_put(cstlHashMap* map, const void* key, const void* value);
+// Pointer to the value for `key`, inserting a zeroed one if it isn't in the map. `*inserted` (if non-null) tells 
+// which happened
+void* hashmap_get_or_insert(cstlHashMap* map, const void* key, bool* inserted);
+// Remove `key`. Returns false if it wasn't in the map
+bool hashmap_remove(cstlHashMap* map, const void* key);
+
+// Iteration. Iterators are slot indices; `hashmap_end()` is one past the last slot
+UInt64 hashmap_begin(cstlHashMap* map);
+UInt64 hashmap_next(cstlHashMap* map, UInt64 it);
+#define hashmap_end(map)            ((map)->capacity)
+#define hashmap_key_at(map, it)     cast(void*)((map)->slots + (it) * (map)->slot_size)
+#define hashmap_value_at(map, it)   cast(void*)((map)->slots + (it) * (map)->slot_size + (map)->value_offset)
+
+// The default hash (over raw bytes), and the hash/equality functions for `char*` keys
+UInt64 hashmap_hash_bytes(const void* key, UInt64 key_size);
+UInt64 hashmap_str_hash(const void* key, UInt64 key_size);
+bool hashmap_str_eq(const void* a, const void* b, UInt64 key_size);
+
+#endif // CORETEN_HASHMAP_H
@@ -23,8 +23,12 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #endif
 
 #if defined(CORETEN_OS_UNIX)
-    #define _GNU_SOURCE
-    #define _LARGEFILE64_SOURCE
+    #ifndef _GNU_SOURCE
+        #define _GNU_SOURCE
+    #endif // _GNU_SOURCE
+    #ifndef _LARGEFILE64_SOURCE
+        #define _LARGEFILE64_SOURCE
+    #endif // _LARGEFILE64_SOURCE
 #endif
 
 // TODO(jasmcaus): How many of these headers do I really need?
@@ -14,15 +14,164 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #ifndef CORETEN_IO_H
 #define CORETEN_IO_H
 
+#include <stdarg.h>
+#include <stdio.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/memory.h>
+
 typedef struct File {
     char* full_path;
     char* basename;
     int fileid;
 
     char* contents;
+    UInt64 length;      // bytes in `contents` (which is also null-terminated)
+    int error;          // 0, or the `errno` of the failed open/read (`contents` is then null)
 } File;
 
 char* readFile(const char* fname);
+// Like `readFile()`, but the contents (`length + 1` bytes, null-terminated) are allocated from `allocator`.
+// `length` may be null
+char* readFile_in(cstlAllocator* allocator, const char* fname, UInt64* length);
 bool file_exists(const char* path);
 
+/*
+    Batch file loading
+
+    `cstlFileLoader` reads many files at once and hands each one back as soon as its contents have arrived, so 
+    work on one file (lexing, say) overlaps the reads of the others:
+
+        cstlFileLoader* loader = file_loader_new(allocator, 0, FileLoaderBackendAuto);
+        for(UInt64 i = 0; i < npaths; i++)
+            file_loader_add(loader, paths[i]);
+
+        File* file;
+        while((file = file_loader_next(loader)) != null) {
+            if(file->error)
+                ...
+            Lexer* lexer = lexer_init(allocator, file->contents, file->full_path);
+            ...
+        }
+        file_loader_free(loader);
+
+    At most `depth` files are open (and being read) at a time. On Linux, the reads are submitted in one batch 
+    through io_uring; where it's unavailable (older kernels, seccomp), they're `pread()` by tasks on the shared 
+    thread pool (see `thread_pool_shared()`) instead. Everything else (including a process where no pool worker could 
+    be started) falls back to plain synchronous reads.
+
+    Files are opened and their buffers allocated on the calling thread, so `allocator` needn't be thread-safe. 
+    Failing to open or read a file is not fatal: it comes back with `error` set.
+*/
+#define FILE_LOADER_DEFAULT_DEPTH   64
+
+typedef enum cstlFileLoaderBackend {
+    FileLoaderBackendAuto,      // io_uring if available, then threads, then synchronous
+    FileLoaderBackendIoUring,
+    FileLoaderBackendThreads,
+    FileLoaderBackendSync,
+} cstlFileLoaderBackend;
+
+typedef struct cstlFileLoader {
+    cstlAllocator* allocator;   // `File`s, their paths and contents are allocated here
+    File** files;               // in `file_loader_add()` order
+    UInt64 nfiles;
+    UInt64 capacity;
+    UInt64 next_open;           // index (in `files`) of the next file to open
+    UInt64 in_flight;           // files opened but not returned yet
+    UInt32 depth;
+    cstlFileLoaderBackend backend;
+    void* impl;                 // backend state
+} cstlFileLoader;
+
+// A `depth` of 0 uses `FILE_LOADER_DEFAULT_DEPTH`. If `backend` isn't available, the next one in line is used
+cstlFileLoader* file_loader_new(cstlAllocator* allocator, UInt32 depth, cstlFileLoaderBackend backend);
+// Queue `path` (which is copied). Returns its `fileid`, which counts up from 0
+int file_loader_add(cstlFileLoader* loader, const char* path);
+// The next loaded file (in completion order), waiting for one if needed. Returns null once every queued file has 
+// been returned. The `File` stays valid until `file_loader_free()`
+File* file_loader_next(cstlFileLoader* loader);
+// Free the loader along with every `File` it returned
+void file_loader_free(cstlFileLoader* loader);
+
+/*
+    Buffered output
+
+    `cstlWriter` collects output in a large user-space buffer and hands it to its sink in big blocks, so emitting 
+    millions of small pieces (tokens, lines of generated code) costs a handful of syscalls instead of one per piece. 
+    Integers are formatted by hand, without going through `printf()`.
+
+        cstlWriter* out = writer_new_file(allocator, stdout, 0);
+        writer_str(out, "TOKEN(");
+        writer_u64(out, line);
+        writer_printf(out, ", %s)\n", name);
+        writer_free(out);       // flushes
+
+    Sinks:
+        writer_new_file()       a `FILE*` (flushing also flushes the `FILE*`, so the output interleaves properly 
+                                with `printf()` as long as the writer is flushed first)
+        writer_new_fd()         a file descriptor, written to directly with `write()`
+        writer_new_memory()     a growable in-memory string (never flushed; see `writer_data()`)
+
+    `writer_init_file()` sets up a writer over a caller-provided buffer (on the stack, say), for short-lived output 
+    like a single diagnostic.
+
+    Write errors are sticky: once one happens, further output is dropped and `writer_flush()` returns false.
+*/
+#define WRITER_DEFAULT_BUFFER_SIZE      KB_TO_BYTES(64)
+
+typedef enum cstlWriterSink {
+    WriterSinkFile,
+    WriterSinkFd,
+    WriterSinkMemory,
+} cstlWriterSink;
+
+typedef struct cstlWriter {
+    cstlAllocator* allocator;
+    char* buffer;
+    UInt64 used;
+    UInt64 capacity;
+    cstlWriterSink sink;
+    FILE* file;             // WriterSinkFile
+    int fd;                 // WriterSinkFd
+    bool owns_buffer;       // false for `writer_init_file()`
+    bool error;
+} cstlWriter;
+
+// A `buffer_size` of 0 uses `WRITER_DEFAULT_BUFFER_SIZE`
+cstlWriter* writer_new_file(cstlAllocator* allocator, FILE* file, UInt64 buffer_size);
+cstlWriter* writer_new_fd(cstlAllocator* allocator, int fd, UInt64 buffer_size);
+cstlWriter* writer_new_memory(cstlAllocator* allocator, UInt64 capacity);
+// A writer over `size` bytes at `buffer`, which must outlive it. Flush it when done (there's nothing to free)
+void writer_init_file(cstlWriter* writer, FILE* file, char* buffer, UInt64 size);
+// Flush and free the writer
+void writer_free(cstlWriter* writer);
+// Hand everything buffered to the sink. Returns false if any write (so far) failed
+bool writer_flush(cstlWriter* writer);
+
+void writer_write(cstlWriter* writer, const char* data, UInt64 n);
+void writer_str(cstlWriter* writer, const char* str);
+// `n` copies of `ch` (indentation, say)
+void writer_repeat(cstlWriter* writer, char ch, UInt64 n);
+void writer_u64(cstlWriter* writer, UInt64 value);
+void writer_i64(cstlWriter* writer, Int64 value);
+// Lowercase hex, without a prefix
+void writer_hex64(cstlWriter* writer, UInt64 value);
+void ATTRIBUTE_PRINTF(2, 3) writer_printf(cstlWriter* writer, const char* fmt, ...);
+void writer_vprintf(cstlWriter* writer, const char* fmt, va_list args);
+
+// Everything written to a memory writer (null-terminated). Valid until the next write
+const char* writer_data(cstlWriter* writer);
+// Bytes buffered (for a memory writer, bytes written)
+#define writer_length(writer)   ((writer)->used)
+
+// Make room for at least `n` more bytes (flushing or growing the buffer)
+void __writer_make_room(cstlWriter* writer, UInt64 n);
+
+static inline void writer_char(cstlWriter* writer, char ch) {
+    if(CORETEN_UNLIKELY(writer->used == writer->capacity))
+        __writer_make_room(writer, 1);
+    writer->buffer[writer->used++] = ch;
+}
+
 #endif // CORETEN_IO_H
\ No newline at end of file
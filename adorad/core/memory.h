@@ -14,6 +14,10 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #ifndef CORETEN_MEMORY_H
 #define CORETEN_MEMORY_H
 
+#include <stdio.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+
 #ifndef KB_TO_BYTES
     #define KB_TO_BYTES(x)               (x) * (Int64)(1024)
     #define MB_TO_BYTES(x)    KB_TO_BYTES(x) * (Int64)(1024)
@@ -25,4 +29,225 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #define CORETEN_HIGHS           CORETEN_ONES * (UInt8_MAX/2+1)
 #define CORETEN_HAS_ZERO(x)     (x)-CORETEN_ONES & ~(x) & CORETEN_HIGHS
 
+/*
+    Allocators
+
+    A `cstlAllocator` is a small vtable that every CSTL container can take in place of the hardwired 
+    `malloc()`/`realloc()`/`free()`. Passing `null` wherever an allocator is expected picks the default (heap) 
+    allocator.
+
+    Deallocation is sized: callers pass back the size they asked for, which lets arenas, pools and trackers work 
+    without storing a header in front of every allocation.
+
+    Available implementations:
+        cstl_default_allocator()    the C heap
+        arena_allocator(arena)      bump allocation from a `cstlArena` (`free` only reclaims the latest allocation)
+        pool_allocator(pool)        fixed-size blocks from a `cstlPool` (larger requests go to the pool's parent)
+        tracking_allocator(t)       forwards to a parent allocator, counting bytes and calls (with an optional limit)
+*/
+// Alignment of memory handed out by `malloc()` (and the default allocator)
+#define CORETEN_DEFAULT_ALIGN               16
+
+typedef struct cstlAllocator cstlAllocator;
+struct cstlAllocator {
+    // Allocate `size` zeroed bytes aligned to `align`
+    void* (*alloc)(void* user_data, UInt64 size, UInt64 align);
+    // Resize `ptr` from `old_size` to `new_size` bytes. Bytes past `old_size` are left uninitialized
+    void* (*realloc)(void* user_data, void* ptr, UInt64 old_size, UInt64 new_size, UInt64 align);
+    // Release `ptr` (of `size` bytes)
+    void (*free)(void* user_data, void* ptr, UInt64 size);
+    void* user_data;
+};
+
+cstlAllocator* cstl_default_allocator();
+// Allocate `size` zeroed bytes from `allocator`
+void* cstl_alloc(cstlAllocator* allocator, UInt64 size);
+void* cstl_alloc_aligned(cstlAllocator* allocator, UInt64 size, UInt64 align);
+void* cstl_realloc(cstlAllocator* allocator, void* ptr, UInt64 old_size, UInt64 new_size);
+void cstl_free(cstlAllocator* allocator, void* ptr, UInt64 size);
+
+// Allocate a (zeroed) object of type `T` from `allocator`
+#define cstl_new_obj(allocator, T)  cast(T*)cstl_alloc_aligned((allocator), sizeof(T), _Alignof(T))
+#define cstl_free_obj(allocator, ptr)   cstl_free((allocator), (ptr), sizeof(*(ptr)))
+
+/*
+    Arena (bump) allocator
+
+    An arena hands out memory from large chunks by bumping a pointer, and releases everything it handed out in one 
+    go (`arena_free()`). This suits data that lives exactly as long as some unit of work - for example, every token, 
+    location and AST node of a single compilation unit.
+
+    Individual allocations cannot be freed, but the arena can be rolled back to an earlier state:
+        cstlArenaMark mark = arena_mark(arena);
+        ... // temporary allocations
+        arena_reset_to(arena, mark);
+
+    Allocations are zero-initialized (like `calloc()`), and aligned to `CORETEN_ARENA_DEFAULT_ALIGN` unless 
+    requested otherwise. Requests larger than the chunk size get a chunk of their own.
+*/
+#define CORETEN_ARENA_DEFAULT_CHUNK_SIZE    KB_TO_BYTES(64)
+#define CORETEN_ARENA_DEFAULT_ALIGN         16
+
+typedef struct cstlArenaChunk cstlArenaChunk;
+struct cstlArenaChunk {
+    cstlArenaChunk* prev;   // previously allocated chunk (null for the first one)
+    UInt64 size;            // usable bytes in `data`
+    UInt64 used;            // bytes handed out so far
+    _Alignas(CORETEN_ARENA_DEFAULT_ALIGN) Byte data[];
+};
+
+typedef struct cstlArena {
+    cstlAllocator allocator;    // see `arena_allocator()`
+    cstlArenaChunk* head;   // chunk currently being allocated from
+    UInt64 chunk_size;      // default size of a new chunk
+    UInt64 total_used;      // bytes handed out over all chunks (including alignment padding)
+    UInt64 total_reserved;  // bytes reserved over all chunks
+} cstlArena;
+
+// A saved arena state (see `arena_mark()`)
+typedef struct cstlArenaMark {
+    cstlArenaChunk* chunk;
+    UInt64 used;
+    UInt64 total_used;
+} cstlArenaMark;
+
+// Create a new arena. A `chunk_size` of 0 picks `CORETEN_ARENA_DEFAULT_CHUNK_SIZE`
+cstlArena* arena_new(UInt64 chunk_size);
+// Release the arena, along with everything allocated from it
+void arena_free(cstlArena* arena);
+// Allocate `size` zeroed bytes from the arena
+void* arena_alloc(cstlArena* arena, UInt64 size);
+// Allocate `size` zeroed bytes aligned to `align` (a power of 2)
+void* arena_alloc_aligned(cstlArena* arena, UInt64 size, UInt64 align);
+// Copy the first `n` bytes of `str` into the arena (null-terminated)
+char* arena_strndup(cstlArena* arena, const char* str, UInt64 n);
+// Save the current state of the arena
+cstlArenaMark arena_mark(cstlArena* arena);
+// Release everything allocated since `mark` was taken
+void arena_reset_to(cstlArena* arena, cstlArenaMark mark);
+// Release everything allocated from the arena (keeping the first chunk around for reuse)
+void arena_reset(cstlArena* arena);
+
+// Allocate a (zeroed) object of type `T` from `arena`
+#define arena_new_obj(arena, T)     cast(T*)arena_alloc_aligned((arena), sizeof(T), _Alignof(T))
+// The `cstlAllocator` interface of `arena`
+#define arena_allocator(arena)      (&(arena)->allocator)
+
+/*
+    Pool allocator
+
+    A pool hands out blocks of one fixed size, and keeps released blocks on a free list for reuse. Blocks are carved 
+    out of chunks of `blocks_per_chunk` blocks, which are only returned to the parent allocator by `pool_free()`.
+*/
+typedef struct cstlPool {
+    cstlAllocator allocator;    // see `pool_allocator()`
+    cstlAllocator* parent;      // chunks (and oversized requests) come from here
+    UInt64 block_size;
+    UInt64 blocks_per_chunk;
+    void* free_list;            // released blocks (each one stores a pointer to the next)
+    void* chunks;               // allocated chunks (each one stores a pointer to the previous one)
+    UInt64 nblocks;             // blocks currently handed out
+} cstlPool;
+
+// Create a new pool of `block_size`-byte blocks. `parent` may be null (the default allocator)
+cstlPool* pool_new(cstlAllocator* parent, UInt64 block_size, UInt64 blocks_per_chunk);
+// Release the pool, along with every block allocated from it
+void pool_free(cstlPool* pool);
+// Allocate a zeroed block
+void* pool_alloc(cstlPool* pool);
+// Return a block to the pool
+void pool_release(cstlPool* pool, void* block);
+
+// The `cstlAllocator` interface of `pool`
+#define pool_allocator(pool)        (&(pool)->allocator)
+
+/*
+    Tracking allocator
+
+    Forwards every request to `parent`, keeping count of what goes through it. If `limit` is non-zero, exceeding 
+    it (in live bytes) is a fatal error - which makes it easy to cap the memory of a single compiler phase.
+
+    Activity is also broken down by phase (see `tracking_allocator_set_phase()`), with a histogram of allocation 
+    sizes for each. Until a phase is set, everything is counted under "other".
+*/
+#define CORETEN_TRACKING_MAX_PHASES         16
+#define CORETEN_TRACKING_HISTOGRAM_BUCKETS  16
+
+typedef struct cstlTrackingPhase {
+    const char* name;
+    UInt64 nallocs;
+    UInt64 nreallocs;
+    UInt64 nfrees;
+    UInt64 bytes_total;         // bytes allocated during this phase
+    UInt64 bytes_peak;          // maximum live bytes (of the whole tracker) during this phase
+    UInt64 histogram[CORETEN_TRACKING_HISTOGRAM_BUCKETS];  // allocation sizes (see `tracking_size_bucket()`)
+} cstlTrackingPhase;
+
+typedef struct cstlTrackingAllocator {
+    cstlAllocator allocator;    // see `tracking_allocator()`
+    cstlAllocator* parent;
+    UInt64 limit;               // maximum live bytes (0 for no limit)
+    UInt64 bytes_live;          // bytes currently allocated
+    UInt64 bytes_peak;          // maximum of `bytes_live`
+    UInt64 bytes_total;         // bytes allocated over the lifetime of the tracker
+    UInt64 nallocs;
+    UInt64 nreallocs;
+    UInt64 nfrees;
+    cstlTrackingPhase phases[CORETEN_TRACKING_MAX_PHASES];
+    UInt32 nphases;
+    UInt32 phase;               // index of the current phase in `phases`
+} cstlTrackingAllocator;
+
+cstlTrackingAllocator* tracking_allocator_new(cstlAllocator* parent, UInt64 limit);
+void tracking_allocator_free(cstlTrackingAllocator* tracker);
+// Count everything from now on under the phase `name` (added if it's new). `name` must outlive `tracker`
+void tracking_allocator_set_phase(cstlTrackingAllocator* tracker, const char* name);
+// Forget every live allocation, for when `parent` has released them in bulk (`arena_reset()`, say)
+void tracking_allocator_release_all(cstlTrackingAllocator* tracker);
+// Print the totals, a per-phase breakdown and the size histogram to `out`
+void tracking_allocator_report(cstlTrackingAllocator* tracker, FILE* out);
+// Histogram bucket of a `size`-byte allocation. Bucket 0 holds sizes up to 16 bytes, bucket `i` holds sizes in 
+// (8 << i, 16 << i], and the last bucket holds everything larger
+UInt32 tracking_size_bucket(UInt64 size);
+
+// The `cstlAllocator` interface of `tracker`
+#define tracking_allocator(tracker) (&(tracker)->allocator)
+
+/*
+    Slab allocator
+
+    A process-wide allocator for small objects that are allocated (and freed) individually, in large numbers.
+    Requests up to `CORETEN_SLAB_MAX_SIZE` bytes are rounded up to one of a few size classes; every class carves its 
+    blocks out of `CORETEN_SLAB_PAGE_SIZE`-byte pages and keeps freed blocks on a free list, so churn never 
+    fragments the heap. Larger requests go straight to the default allocator.
+
+    Each thread keeps a small cache of free blocks per size class. Allocating and freeing only touch this cache; the 
+    shared (locked) free lists are used to refill or drain it in batches of `CORETEN_SLAB_BATCH` blocks. 
+    A thread should call `slab_thread_flush()` before it exits, so its cached blocks can be reused by others.
+
+    Pages are never returned to the system.
+*/
+#define CORETEN_SLAB_MAX_SIZE       512
+#define CORETEN_SLAB_NUM_CLASSES    14
+#define CORETEN_SLAB_PAGE_SIZE      KB_TO_BYTES(64)
+// Maximum number of blocks (per size class) in a thread cache
+#define CORETEN_SLAB_CACHE_SIZE     64
+// Number of blocks moved between a thread cache and the shared free list at a time
+#define CORETEN_SLAB_BATCH          (CORETEN_SLAB_CACHE_SIZE / 2)
+
+// The `cstlAllocator` interface of the slab allocator
+cstlAllocator* slab_allocator();
+// Allocate `size` zeroed bytes
+void* slab_alloc(UInt64 size);
+// Free `ptr` (of `size` bytes)
+void slab_release(void* ptr, UInt64 size);
+// Return the calling thread's cached blocks to the shared free lists
+void slab_thread_flush();
+// Size class of a `size`-byte request (`size` must be at most `CORETEN_SLAB_MAX_SIZE`)
+UInt32 slab_size_class(UInt64 size);
+// Block size of size class `cls`
+UInt64 slab_class_size(UInt32 cls);
+// Bytes reserved (in pages) by the slab allocator so far
+UInt64 slab_reserved_bytes();
+
 #endif // CORETEN_MEMORY_H
\ No newline at end of file
@@ -145,6 +145,17 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
     #define CORETEN_LOCALPERSIST static // Local Persisting Variables  
 #endif 
 
+// Thread-local variables
+#ifndef CORETEN_THREAD_LOCAL
+    #if defined(_MSC_VER)
+        #define CORETEN_THREAD_LOCAL    __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+        #define CORETEN_THREAD_LOCAL    _Thread_local
+    #else
+        #define CORETEN_THREAD_LOCAL    __thread
+    #endif // _MSC_VER
+#endif // CORETEN_THREAD_LOCAL
+
 // Get the type of `val`
 #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
     #define CORETEN_TYPEOF(val)                                 \
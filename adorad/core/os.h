@@ -15,6 +15,7 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #define CORETEN_OS_H
 
 #include <adorad/core/buffer.h>
+#include <adorad/core/memory.h>
 
 #if defined(CORETEN_OS_POSIX)
     #define _XOPEN_SOURCE 700
@@ -33,6 +34,54 @@ bool os_is_sep(char ch);
 bool os_path_is_abs(cstlBuffer* path);
 bool os_path_is_rel(cstlBuffer* path);
 bool os_path_is_root(cstlBuffer* path);
+// Whether `path` names an existing directory
+bool os_is_dir(const char* path);
+
+/*
+    Directory walking
+
+    `os_walk_dir()` lists every file under a directory, recursively. Directories are read in parallel on the shared 
+    thread pool (see `thread_pool_shared()`) - each directory is a task that reads it (with `getdents64()` on Linux, 
+    so a whole batch of entries comes back per syscall) and submits a task for each of its subdirectories.
+
+        const char* include[] = {"*.ad"};
+        const char* ignore[] = {"build", "_*"};
+        cstlDirWalkOptions options = {include, 1, ignore, 2};
+        cstlDirWalk* walk = os_walk_dir(allocator, "src", &options);
+        for(UInt64 i = 0; i < walk->npaths; i++)
+            file_loader_add(loader, walk->paths[i]);
+        os_walk_free(walk);
+
+    `include` patterns select files by basename (all files if there are none); `ignore` patterns skip files and 
+    whole directories by basename. Hidden entries (starting with '.') are skipped unless asked for. Symlinks to 
+    files are listed; symlinks to directories are not followed. The paths come back sorted, so the output doesn't 
+    depend on thread timing.
+*/
+typedef struct cstlDirWalkOptions {
+    const char* const* include;     // glob patterns (see `os_glob_match()`)
+    UInt32 ninclude;
+    const char* const* ignore;
+    UInt32 nignore;
+    UInt32 nthreads;                // 1 walks on the calling thread only; anything else uses the shared pool, if it has 
+                                    // any workers
+    bool include_hidden;
+} cstlDirWalkOptions;
+
+typedef struct cstlDirWalk {
+    cstlAllocator* allocator;
+    char** paths;                   // `root` joined with the path of each file, sorted
+    UInt64 npaths;
+    UInt64 ndirs;                   // directories read (including `root`)
+    int error;                      // `errno` if `root` couldn't be read
+    char* strings;                  // storage for `paths`
+    UInt64 strings_size;
+} cstlDirWalk;
+
+// `options` may be null (every non-hidden file)
+cstlDirWalk* os_walk_dir(cstlAllocator* allocator, const char* root, const cstlDirWalkOptions* options);
+void os_walk_free(cstlDirWalk* walk);
+// Does `name` match the glob `pattern`? Supports `*`, `?` and classes (`[abc]`, `[a-z]`, `[!0-9]`)
+bool os_glob_match(const char* pattern, const char* name);
 
 #ifndef CORETEN_OS_FUNC_ALIASES
     #define CORETEN_OS_FUNC_ALIASES
@@ -0,0 +1,84 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_PERF_H
+#define CORETEN_PERF_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+
+/*
+    Hardware Performance Counters
+
+    Counts CPU events (cycles, retired instructions, branch misses, L1d and last-level cache misses) for the 
+    calling thread, in user space only, with Linux's `perf_event_open()`:
+
+        cstlPerfCounters* counters = perf_counters_new(true);
+        cstlPerfSample sample;
+        perf_counters_start(counters);
+        lexer_lex(lexer);
+        perf_counters_stop(counters, &sample);
+        if(sample.valid & PERF_EVENT_BIT(PerfInstructions))
+            ...
+
+    The events are opened as one group, so they are counted over exactly the same instructions. If the PMU has to 
+    multiplex them with other users, the counts are scaled up by (time enabled / time running).
+
+    Counters are often not available: `kernel.perf_event_paranoid` may forbid them, containers and VMs may not 
+    expose a PMU, and other platforms have no equivalent. None of that is an error - events that can't be opened 
+    are left out of `valid` (`perf_counters_error()` says why), and the wall time is always measured.
+*/
+
+typedef enum cstlPerfEvent {
+    PerfCycles = 0,
+    PerfInstructions,
+    PerfBranchMisses,
+    PerfL1DMisses,          // L1 data cache read misses
+    PerfLLCMisses,          // last-level cache misses
+    PerfEventCount
+} cstlPerfEvent;
+
+#define PERF_EVENT_BIT(event)   (cast(UInt32)1 << (event))
+
+typedef struct cstlPerfSample {
+    UInt64 wall_ns;
+    UInt64 values[PerfEventCount];
+    UInt32 valid;           // bitmask (`PERF_EVENT_BIT()`) of the events that were counted
+} cstlPerfSample;
+
+typedef struct cstlPerfCounters {
+    int fds[PerfEventCount];    // -1 for events that could not be opened
+    int leader;                 // the group leader's fd (-1 if nothing was opened)
+    UInt32 opened;              // bitmask of the events that were opened
+    UInt64 start_ns;
+    char error[160];            // why some (or all) events are missing; empty if none are
+} cstlPerfCounters;
+
+// Open the counters for the calling thread. Never fails; with `enable == false` only the wall time is measured
+cstlPerfCounters* perf_counters_new(bool enable);
+void perf_counters_free(cstlPerfCounters* counters);
+// Was at least one event opened?
+bool perf_counters_available(cstlPerfCounters* counters);
+// Why events are missing (an empty string if they are all there)
+const char* perf_counters_error(cstlPerfCounters* counters);
+
+// Zero the counters and start counting
+void perf_counters_start(cstlPerfCounters* counters);
+// Stop counting and read the counts since `perf_counters_start()` into `sample`
+void perf_counters_stop(cstlPerfCounters* counters, cstlPerfSample* sample);
+
+// Short name of `event` ("cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses")
+const char* perf_event_name(cstlPerfEvent event);
+
+#endif // CORETEN_PERF_H
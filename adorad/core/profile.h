@@ -0,0 +1,79 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_PROFILE_H
+#define CORETEN_PROFILE_H
+
+#include <stdio.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/clock.h>
+
+/*
+    Profiler
+
+    Records nested spans ("read", "lex", "parse", ...) on every thread, and writes them out as a Chrome trace 
+    (load it in chrome://tracing or https://ui.perfetto.dev) or as a summary table of where the time went.
+
+        profile_enable(true);
+        PROFILE_SCOPE("lex", fname) {
+            lexer_lex(lexer);
+        }
+        ...
+        profile_write_chrome_trace(file);
+        profile_write_summary(stdout);
+
+    Spans can also be opened and closed by hand with `profile_begin()`/`profile_end()` (which must pair up on each 
+    thread). While the profiler is disabled, both are a single branch.
+
+    Each thread appends its spans to its own buffer, so recording takes no locks. Span names must be string 
+    literals (or otherwise outlive the profiler); `detail` (a file name, say) is copied. Writing the results while 
+    other threads are still recording is not supported.
+*/
+#define PROFILE_MAX_DEPTH   64
+
+typedef struct cstlProfileSpan {
+    const char* name;
+    const char* detail;     // null if there is none
+    UInt64 start_ns;
+    UInt64 end_ns;
+    UInt64 child_ns;        // time spent in nested spans
+    UInt32 depth;
+} cstlProfileSpan;
+
+extern bool __profile_enabled;
+
+void profile_enable(bool enable);
+// Discard everything recorded so far
+void profile_reset();
+
+void __profile_begin(const char* name, const char* detail);
+void __profile_end();
+#define profile_begin(name, detail)     (__profile_enabled ? __profile_begin((name), (detail)) : (void)0)
+#define profile_end()                   (__profile_enabled ? __profile_end() : (void)0)
+
+// Profile the statement (or block) that follows. Leaving it early (`break`, `return`) leaves the span open
+#define __PROFILE_SCOPE_VAR         CORETEN_CONCATENATE(__profile_scope_, __LINE__)
+#define PROFILE_SCOPE(name, detail) \
+    for(int __PROFILE_SCOPE_VAR = (profile_begin((name), (detail)), 0); !__PROFILE_SCOPE_VAR;   \
+        __PROFILE_SCOPE_VAR = 1, profile_end())
+
+// Number of spans recorded (over all threads)
+UInt64 profile_span_count();
+// Write every span as Chrome trace-event JSON ("X" events, timestamps in microseconds)
+void profile_write_chrome_trace(FILE* out);
+// Write a table of the total, self (excluding nested spans) and average time per span name, heaviest first
+void profile_write_summary(FILE* out);
+
+#endif // CORETEN_PROFILE_H
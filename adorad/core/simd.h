@@ -0,0 +1,142 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef CORETEN_SIMD_H
+#define CORETEN_SIMD_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/cpu.h>
+#include <adorad/core/compilers.h>
+
+#if defined(CORETEN_COMPILER_MSVC)
+    #include <intrin.h>
+#endif // CORETEN_COMPILER_MSVC
+
+/*
+    SIMD string kernels.
+
+    Every kernel has a portable scalar fallback (`__simd_*_scalar`) that gives byte-for-byte identical results.
+    On x86 every vector variant (SSE2, SSSE3, AVX2, AVX-512BW) is compiled in regardless of `-march`, and the 
+    fastest one `cpu_features()` allows is picked on the first call (and again after `cpu_set_features_mask()`).
+    NEON is used when the compiler targets it. Anywhere else, the public kernels forward to the scalar versions.
+
+    The UTF-8 validator needs a byte shuffle, so the full vector path runs on SSSE3/AVX2 and AArch64; plain SSE2 
+    only skips over ASCII runs before falling back to the scalar validator.
+
+    The `CORETEN_SIMD_*` macros below only describe what the compiler targets (for code that wants to use the 
+    intrinsics inline, like the hashmap's group probes).
+
+    Only ASCII is handled by the case-conversion kernels; bytes >= 0x80 are passed through untouched (this mirrors
+    `char_to_lower()` and `char_to_upper()`).
+*/
+
+#if defined(__AVX2__)
+    #define CORETEN_SIMD_AVX2   1
+#endif // __AVX2__
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CORETEN_SIMD_SSE2   1
+#endif // __SSE2__
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define CORETEN_SIMD_NEON   1
+#endif // __ARM_NEON
+
+// Width (in bytes) of the widest vector register used by the kernels
+#if defined(CORETEN_SIMD_AVX2)
+    #define CORETEN_SIMD_WIDTH  32
+#elif defined(CORETEN_SIMD_SSE2) || defined(CORETEN_SIMD_NEON)
+    #define CORETEN_SIMD_WIDTH  16
+#else
+    #define CORETEN_SIMD_WIDTH  8
+#endif // CORETEN_SIMD_AVX2
+
+// `simd_strlen()` reads whole aligned blocks, which may run past the terminator (but never into another page).
+// AddressSanitizer flags this, so the kernel opts out of instrumentation
+#if defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define __SIMD_NO_ASAN  __attribute__((no_sanitize_address))
+    #endif // __has_feature(address_sanitizer)
+#endif // __has_feature
+#if !defined(__SIMD_NO_ASAN) && defined(__SANITIZE_ADDRESS__)
+    #define __SIMD_NO_ASAN  __attribute__((no_sanitize_address))
+#endif // __SANITIZE_ADDRESS__
+#if !defined(__SIMD_NO_ASAN)
+    #define __SIMD_NO_ASAN
+#endif // __SIMD_NO_ASAN
+
+// Length of a null-terminated string
+UInt64 simd_strlen(const char* str);
+// Pointer to the first occurence of `ch` in the first `n` bytes of `str` (null if not found)
+const char* simd_memchr(const char* str, char ch, UInt64 n);
+// Are the first `n` bytes of `s1` and `s2` equal?
+bool simd_memeq(const char* s1, const char* s2, UInt64 n);
+// Compare the first `n` bytes of `s1` and `s2` (as unsigned chars).
+// Returns <0, 0 or >0 like `memcmp()`
+int simd_memcmp(const char* s1, const char* s2, UInt64 n);
+// Like `simd_memcmp()`, but ASCII letters compare equal regardless of case
+int simd_memcmp_nocase(const char* s1, const char* s2, UInt64 n);
+// Write the lowercase/uppercase version of the first `n` bytes of `src` to `dest`. `dest` may alias `src`
+void simd_tolower(char* dest, const char* src, UInt64 n);
+void simd_toupper(char* dest, const char* src, UInt64 n);
+// Are the first `n` bytes of `str` well-formed UTF-8 (RFC 3629)?
+// Overlong encodings, surrogates and codepoints beyond U+10FFFF are rejected
+bool simd_utf8_validate(const char* str, UInt64 n);
+// Number of codepoints in the first `n` bytes of `str` (assumes valid UTF-8)
+UInt64 simd_utf8_count(const char* str, UInt64 n);
+
+// Scalar reference implementations
+UInt64 __simd_strlen_scalar(const char* str);
+const char* __simd_memchr_scalar(const char* str, char ch, UInt64 n);
+bool __simd_memeq_scalar(const char* s1, const char* s2, UInt64 n);
+int __simd_memcmp_scalar(const char* s1, const char* s2, UInt64 n);
+int __simd_memcmp_nocase_scalar(const char* s1, const char* s2, UInt64 n);
+void __simd_tolower_scalar(char* dest, const char* src, UInt64 n);
+void __simd_toupper_scalar(char* dest, const char* src, UInt64 n);
+bool __simd_utf8_validate_scalar(const char* str, UInt64 n);
+UInt64 __simd_utf8_count_scalar(const char* str, UInt64 n);
+
+// Index of the lowest set bit in `x` (`x` must be non-zero)
+static inline UInt32 __simd_ctz32(UInt32 x) {
+#if defined(CORETEN_COMPILER_MSVC)
+    unsigned long idx;
+    _BitScanForward(&idx, x);
+    return cast(UInt32)idx;
+#else
+    return cast(UInt32)__builtin_ctz(x);
+#endif // CORETEN_COMPILER_MSVC
+}
+
+static inline UInt32 __simd_ctz64(UInt64 x) {
+#if defined(CORETEN_COMPILER_MSVC)
+    unsigned long idx;
+    _BitScanForward64(&idx, x);
+    return cast(UInt32)idx;
+#else
+    return cast(UInt32)__builtin_ctzll(x);
+#endif // CORETEN_COMPILER_MSVC
+}
+
+// Number of set bits in `x`
+static inline UInt32 __simd_popcount64(UInt64 x) {
+#if defined(CORETEN_COMPILER_MSVC) && defined(_M_X64)
+    return cast(UInt32)__popcnt64(x);
+#elif defined(CORETEN_COMPILER_MSVC)
+    return cast(UInt32)(__popcnt(cast(UInt32)x) + __popcnt(cast(UInt32)(x >> 32)));
+#else
+    return cast(UInt32)__builtin_popcountll(x);
+#endif // CORETEN_COMPILER_MSVC
+}
+
+#endif // CORETEN_SIMD_H
@@ -0,0 +1,214 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+// No include guard: this file is included several times by cstl.c (see "simd.c")
+
+/*
+    SIMD kernel template
+
+    Defines the vectorized kernels of simd.h for one instruction set. Before including this, cstl.c defines:
+        __SIMD_ISA              Suffix of the kernels' names (`__simd_strlen_avx2`, ...)
+        __SIMD_TARGET           Attribute that lets the kernels use the instruction set (see `CORETEN_TARGET()`)
+        __SIMD_VEC              The vector type
+        __SIMD_LOADU/LOADA      Unaligned/aligned loads
+        __SIMD_STOREU           Unaligned store
+        __SIMD_SPLAT(c)         Broadcast a byte to every lane
+        __SIMD_EQMASK(a, b)     Bitmask (as UInt64) of the lanes where `a == b`, `__SIMD_BPB` bits per lane
+        __SIMD_LEADMASK(v)      `__SIMD_EQMASK`-style mask of the lanes that are not UTF-8 continuation bytes
+        __SIMD_FULLMASK         The mask with every lane set
+        __SIMD_CASE_FLIP(v, c)  Flip the 0x20 bit of every byte of `v` in the range [c, c+26)
+        __SIMD_ANY_HIGHBIT(v)   Does any byte of `v` have its top bit set?
+
+    Instruction sets with a byte shuffle also define `__SIMD_HAS_LOOKUP` and the few extra operations the UTF-8 
+    validator needs (`__SIMD_AND`, `__SIMD_OR`, `__SIMD_XOR`, `__SIMD_SUBS_U8`, `__SIMD_SHR4`, `__SIMD_TABLE16`, 
+    `__SIMD_LOOKUP16`, `__SIMD_PREV` and `__SIMD_ANY`).
+
+    Every one of these is undefined at the end, ready for the next instruction set.
+*/
+
+#define __SIMD_KERNEL(name)     CORETEN_CONCATENATE(name, __SIMD_ISA)
+#define __SIMD_BYTES            cast(UInt64)sizeof(__SIMD_VEC)
+
+static __SIMD_NO_ASAN __SIMD_TARGET UInt64 __SIMD_KERNEL(__simd_strlen_)(const char* str) {
+    // Aligned loads never straddle a page boundary, so reading past the terminator is safe
+    const __SIMD_VEC zero = __SIMD_SPLAT(0);
+    const char* p = cast(const char*)(cast(UIntptr)str & ~(cast(UIntptr)__SIMD_BYTES - 1));
+    UInt64 mask = __SIMD_EQMASK(__SIMD_LOADA(p), zero) >> ((str - p) * __SIMD_BPB);
+    if(mask)
+        return __simd_ctz64(mask) / __SIMD_BPB;
+
+    for(;;) {
+        p += __SIMD_BYTES;
+        mask = __SIMD_EQMASK(__SIMD_LOADA(p), zero);
+        if(mask)
+            return cast(UInt64)(p - str) + __simd_ctz64(mask) / __SIMD_BPB;
+    }
+}
+
+static __SIMD_TARGET const char* __SIMD_KERNEL(__simd_memchr_)(const char* str, char ch, UInt64 n) {
+    UInt64 i = 0;
+    const __SIMD_VEC needle = __SIMD_SPLAT(ch);
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES) {
+        UInt64 mask = __SIMD_EQMASK(__SIMD_LOADU(str + i), needle);
+        if(mask)
+            return str + i + __simd_ctz64(mask) / __SIMD_BPB;
+    }
+    return __simd_memchr_scalar(str + i, ch, n - i);
+}
+
+static __SIMD_TARGET bool __SIMD_KERNEL(__simd_memeq_)(const char* s1, const char* s2, UInt64 n) {
+    UInt64 i = 0;
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES) {
+        if(__SIMD_EQMASK(__SIMD_LOADU(s1 + i), __SIMD_LOADU(s2 + i)) != __SIMD_FULLMASK)
+            return false;
+    }
+    return __simd_memeq_scalar(s1 + i, s2 + i, n - i);
+}
+
+static __SIMD_TARGET int __SIMD_KERNEL(__simd_memcmp_)(const char* s1, const char* s2, UInt64 n) {
+    UInt64 i = 0;
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES) {
+        UInt64 mask = __SIMD_EQMASK(__SIMD_LOADU(s1 + i), __SIMD_LOADU(s2 + i)) ^ __SIMD_FULLMASK;
+        if(mask) {
+            UInt64 idx = i + __simd_ctz64(mask) / __SIMD_BPB;
+            return cast(int)cast(unsigned char)s1[idx] - cast(int)cast(unsigned char)s2[idx];
+        }
+    }
+    return __simd_memcmp_scalar(s1 + i, s2 + i, n - i);
+}
+
+static __SIMD_TARGET int __SIMD_KERNEL(__simd_memcmp_nocase_)(const char* s1, const char* s2, UInt64 n) {
+    UInt64 i = 0;
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES) {
+        __SIMD_VEC a = __SIMD_CASE_FLIP(__SIMD_LOADU(s1 + i), 'A');
+        __SIMD_VEC b = __SIMD_CASE_FLIP(__SIMD_LOADU(s2 + i), 'A');
+        UInt64 mask = __SIMD_EQMASK(a, b) ^ __SIMD_FULLMASK;
+        if(mask) {
+            i += __simd_ctz64(mask) / __SIMD_BPB;
+            return __simd_memcmp_nocase_scalar(s1 + i, s2 + i, 1);
+        }
+    }
+    return __simd_memcmp_nocase_scalar(s1 + i, s2 + i, n - i);
+}
+
+static __SIMD_TARGET void __SIMD_KERNEL(__simd_tolower_)(char* dest, const char* src, UInt64 n) {
+    UInt64 i = 0;
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES)
+        __SIMD_STOREU(dest + i, __SIMD_CASE_FLIP(__SIMD_LOADU(src + i), 'A'));
+    __simd_tolower_scalar(dest + i, src + i, n - i);
+}
+
+static __SIMD_TARGET void __SIMD_KERNEL(__simd_toupper_)(char* dest, const char* src, UInt64 n) {
+    UInt64 i = 0;
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES)
+        __SIMD_STOREU(dest + i, __SIMD_CASE_FLIP(__SIMD_LOADU(src + i), 'a'));
+    __simd_toupper_scalar(dest + i, src + i, n - i);
+}
+
+#if defined(__SIMD_HAS_LOOKUP)
+// Returns a non-zero vector if `input` (preceded by `prev_input`) contains an invalid sequence
+static inline __SIMD_TARGET __SIMD_VEC __SIMD_KERNEL(__simd_utf8_check_block_)(__SIMD_VEC input, 
+                                                                               __SIMD_VEC prev_input) {
+    const __SIMD_VEC byte1_high = __SIMD_TABLE16(__utf8_byte1_high);
+    const __SIMD_VEC byte1_low  = __SIMD_TABLE16(__utf8_byte1_low);
+    const __SIMD_VEC byte2_high = __SIMD_TABLE16(__utf8_byte2_high);
+
+    __SIMD_VEC prev1 = __SIMD_PREV(input, prev_input, 1);
+    __SIMD_VEC special = __SIMD_AND(
+        __SIMD_AND(
+            __SIMD_LOOKUP16(byte1_high, __SIMD_SHR4(prev1)),
+            __SIMD_LOOKUP16(byte1_low, __SIMD_AND(prev1, __SIMD_SPLAT(0x0F)))
+        ),
+        __SIMD_LOOKUP16(byte2_high, __SIMD_SHR4(input))
+    );
+
+    // The high bit is set wherever a byte sits 2 positions after a 3/4-byte lead or 3 positions after a 4-byte lead
+    __SIMD_VEC is_third  = __SIMD_SUBS_U8(__SIMD_PREV(input, prev_input, 2), __SIMD_SPLAT(0xE0 - 0x80));
+    __SIMD_VEC is_fourth = __SIMD_SUBS_U8(__SIMD_PREV(input, prev_input, 3), __SIMD_SPLAT(0xF0 - 0x80));
+    __SIMD_VEC must23_80 = __SIMD_AND(__SIMD_OR(is_third, is_fourth), __SIMD_SPLAT(0x80));
+    return __SIMD_XOR(must23_80, special);
+}
+
+static __SIMD_TARGET bool __SIMD_KERNEL(__simd_utf8_validate_)(const char* str, UInt64 n) {
+    UInt64 i = 0;
+    const __SIMD_VEC zero = __SIMD_SPLAT(0);
+    const __SIMD_VEC incomplete_max = __SIMD_LOADU(__utf8_incomplete_max + 32 - __SIMD_BYTES);
+    __SIMD_VEC error = zero;
+    __SIMD_VEC prev_input = zero;
+    __SIMD_VEC prev_incomplete = zero;
+
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES) {
+        __SIMD_VEC input = __SIMD_LOADU(str + i);
+        if(CORETEN_LIKELY(!__SIMD_ANY_HIGHBIT(input))) {
+            // Pure ASCII: only a sequence left open by the previous block can be an error
+            error = __SIMD_OR(error, prev_incomplete);
+            prev_incomplete = zero;
+        } else {
+            error = __SIMD_OR(error, __SIMD_KERNEL(__simd_utf8_check_block_)(input, prev_input));
+            prev_incomplete = __SIMD_SUBS_U8(input, incomplete_max);
+        }
+        prev_input = input;
+    }
+
+    // The tail is zero-padded (zeros are ASCII, so any sequence still open at the end is flagged). This always 
+    // runs, even if the tail is empty
+    char tail[32] = {0};
+    memcpy(tail, str + i, n - i);
+    error = __SIMD_OR(error, __SIMD_KERNEL(__simd_utf8_check_block_)(__SIMD_LOADU(tail), prev_input));
+    return !__SIMD_ANY(error);
+}
+#else
+static __SIMD_TARGET bool __SIMD_KERNEL(__simd_utf8_validate_)(const char* str, UInt64 n) {
+    // Without a byte shuffle, only the ASCII runs are vectorized
+    UInt64 i = 0;
+    while(i + __SIMD_BYTES <= n && !__SIMD_ANY_HIGHBIT(__SIMD_LOADU(str + i)))
+        i += __SIMD_BYTES;
+    return __simd_utf8_validate_scalar(str + i, n - i);
+}
+#endif // __SIMD_HAS_LOOKUP
+
+static __SIMD_TARGET UInt64 __SIMD_KERNEL(__simd_utf8_count_)(const char* str, UInt64 n) {
+    UInt64 count = 0;
+    UInt64 i = 0;
+    for(; i + __SIMD_BYTES <= n; i += __SIMD_BYTES)
+        count += __simd_popcount64(__SIMD_LEADMASK(__SIMD_LOADU(str + i)));
+    count /= __SIMD_BPB;
+    return count + __simd_utf8_count_scalar(str + i, n - i);
+}
+
+#undef __SIMD_KERNEL
+#undef __SIMD_BYTES
+#undef __SIMD_ISA
+#undef __SIMD_TARGET
+#undef __SIMD_VEC
+#undef __SIMD_LOADU
+#undef __SIMD_LOADA
+#undef __SIMD_STOREU
+#undef __SIMD_SPLAT
+#undef __SIMD_EQMASK
+#undef __SIMD_LEADMASK
+#undef __SIMD_BPB
+#undef __SIMD_FULLMASK
+#undef __SIMD_CASE_FLIP
+#undef __SIMD_ANY_HIGHBIT
+#undef __SIMD_HAS_LOOKUP
+#undef __SIMD_AND
+#undef __SIMD_OR
+#undef __SIMD_XOR
+#undef __SIMD_SUBS_U8
+#undef __SIMD_SHR4
+#undef __SIMD_TABLE16
+#undef __SIMD_LOOKUP16
+#undef __SIMD_PREV
+#undef __SIMD_ANY
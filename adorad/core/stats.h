@@ -0,0 +1,78 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_STATS_H
+#define CORETEN_STATS_H
+
+#include <stdio.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+
+/*
+    Counters
+
+    A registry of named event counters (tokens lexed, vector regrows, hash map probes, cache hits, ...) that is 
+    cheap enough to leave on in release builds:
+
+        STATS_INC(StatsVectorRegrows);
+        STATS_ADD(StatsLexBytes, length);
+        ...
+        stats_write_table(stdout);
+
+    Every thread counts into its own thread-local array, so `STATS_ADD()` compiles down to a single add. Threads 
+    merge their counts into the global totals with `stats_thread_flush()` - a worker must call it before it exits 
+    (or its counts are lost). The reporting functions flush the calling thread first.
+
+    Counter ids are plain integers below `STATS_MAX_COUNTERS`. The ids used by Coreten are listed below; other 
+    modules take theirs from `StatsCoreCount` onwards, and name them with `stats_register()`. Counters without a 
+    name are never reported.
+*/
+#define STATS_MAX_COUNTERS  512
+
+typedef enum StatsCounter {
+    StatsVectorRegrows = 0,     // vector reallocations (including small vectors spilling to the heap)
+    StatsSegVecChunks,          // chunks allocated by segmented vectors
+    StatsArenaChunks,           // chunks allocated by arenas
+    StatsHashMapLookups,
+    StatsHashMapProbes,         // groups of control bytes scanned by lookups
+    StatsHashMapResizes,
+    StatsVfsStatHits,
+    StatsVfsStatMisses,
+    StatsVfsReadHits,
+    StatsVfsReadMisses,
+    StatsFileLoaderFiles,
+    StatsFileLoaderBytes,
+    StatsCoreCount
+} StatsCounter;
+
+extern CORETEN_THREAD_LOCAL UInt64 __stats_local[STATS_MAX_COUNTERS];
+
+#define STATS_ADD(counter, n)   ((void)(__stats_local[(counter)] += cast(UInt64)(n)))
+#define STATS_INC(counter)      STATS_ADD((counter), 1)
+
+// Name `counter` (the name is copied). Names are dotted paths ("lex.tokens") - the table is sorted by them
+void stats_register(UInt32 counter, const char* name);
+// Merge the calling thread's counts into the global totals
+void stats_thread_flush();
+// Current total of `counter` (including the calling thread's unflushed counts)
+UInt64 stats_get(UInt32 counter);
+// Zero every counter (names are kept). Other threads' unflushed counts are not affected
+void stats_reset();
+
+// Write every named, non-zero counter as an aligned table
+void stats_write_table(FILE* out);
+// Write every named, non-zero counter as a flat JSON object (`{"lex.tokens": 1024, ...}`)
+void stats_write_json(FILE* out);
+
+#endif // CORETEN_STATS_H
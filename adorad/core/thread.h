@@ -0,0 +1,234 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_THREAD_H
+#define CORETEN_THREAD_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/os_defs.h>
+#include <adorad/core/cpu.h>
+#include <adorad/core/atomic.h>
+
+#if !defined(CORETEN_OS_WINDOWS)
+    #include <pthread.h>
+#endif // CORETEN_OS_WINDOWS
+
+/*
+    Threads & Synchronization
+
+    Portable wrappers over pthreads (and Win32), plus a few primitives built on atomics:
+        * `cstlThread`:     create/join, and the number of CPUs to size pools with
+        * `cstlTlsKey`:     thread-local slots created at runtime (for fixed variables, `CORETEN_THREAD_LOCAL` is 
+                            cheaper)
+        * `cstlMutex`, `cstlCondVar`: the OS mutex and condition variable
+        * `cstlOnce`:       run an initializer exactly once (`CSTL_ONCE_INIT`)
+        * `futex_*()`:      block until a 32-bit cell changes (Linux futexes, `WaitOnAddress()` on Windows; elsewhere 
+                            this just yields)
+        * `cstlLock`:       a one-word lock on top of the futex: uncontended acquire/release are a single atomic 
+                            operation each, and waiters sleep instead of spinning. Zero-initialized (`CSTL_LOCK_INIT`) 
+                            means unlocked, so it needs no setup or teardown
+        * `cstlWorkDeque`:  a Chase-Lev work-stealing deque
+        * `cstlThreadPool`: a fixed set of workers, each with its own deque, that steal from each other
+        * `cstlTaskGroup`:  a subset of a pool's tasks that can be waited on by itself
+
+    Thread pool:
+        cstlThreadPool* pool = thread_pool_new(0);
+        for(UInt64 i = 0; i < nfiles; i++)
+            thread_pool_submit(pool, lex_file, &files[i]);
+        thread_pool_wait(pool);
+        thread_pool_free(pool);
+
+    A task submitted from one of the pool's workers goes onto that worker's deque (last in, first out, so nested 
+    work stays cache-hot); other submissions go through a shared queue. Idle workers steal the oldest task from 
+    the others. `thread_pool_wait()` runs tasks on the calling thread while it waits.
+
+    Core's own parallel work (the directory walker, the file loader) runs on one process-wide pool, 
+    `thread_pool_shared()`, instead of starting threads of its own. Since `thread_pool_wait()` on a shared pool would 
+    wait for everybody's tasks, each user submits through a task group and waits for just that:
+        cstlTaskGroup group;
+        task_group_init(&group, thread_pool_shared());
+        for(UInt64 i = 0; i < ndirs; i++)
+            task_group_submit(&group, read_dir, dirs[i]);
+        task_group_wait(&group);
+*/
+
+// Threads
+typedef int (*cstlThreadFunc)(void* arg);
+
+typedef struct cstlThread {
+#if defined(CORETEN_OS_WINDOWS)
+    void* handle;
+#else
+    pthread_t handle;
+#endif // CORETEN_OS_WINDOWS
+} cstlThread;
+
+// Start `func(arg)` on a new thread. Returns false if the thread could not be created
+bool thread_create(cstlThread* thread, cstlThreadFunc func, void* arg);
+// Wait for `thread` to finish, and return what its function returned
+int thread_join(cstlThread* thread);
+void thread_yield();
+void thread_sleep_ns(UInt64 ns);
+// The OS id of the calling thread
+UInt64 thread_id();
+// The number of online CPUs (at least 1)
+UInt32 thread_hardware_concurrency();
+
+// Thread-local storage
+typedef struct cstlTlsKey {
+#if defined(CORETEN_OS_WINDOWS)
+    UInt32 index;
+#else
+    pthread_key_t key;
+#endif // CORETEN_OS_WINDOWS
+} cstlTlsKey;
+
+// Create a slot (null on every thread). `destructor` (which may be null) is called with a thread's non-null value 
+// when that thread exits
+bool tls_create(cstlTlsKey* key, void (*destructor)(void*));
+void tls_delete(cstlTlsKey* key);
+void* tls_get(cstlTlsKey* key);
+void tls_set(cstlTlsKey* key, void* value);
+
+// Mutexes and condition variables
+typedef struct cstlMutex {
+#if defined(CORETEN_OS_WINDOWS)
+    void* srwlock;
+#else
+    pthread_mutex_t mutex;
+#endif // CORETEN_OS_WINDOWS
+} cstlMutex;
+
+typedef struct cstlCondVar {
+#if defined(CORETEN_OS_WINDOWS)
+    void* cond;
+#else
+    pthread_cond_t cond;
+#endif // CORETEN_OS_WINDOWS
+} cstlCondVar;
+
+void mutex_init(cstlMutex* mutex);
+void mutex_destroy(cstlMutex* mutex);
+void mutex_lock(cstlMutex* mutex);
+bool mutex_try_lock(cstlMutex* mutex);
+void mutex_unlock(cstlMutex* mutex);
+
+void condvar_init(cstlCondVar* cond);
+void condvar_destroy(cstlCondVar* cond);
+// Unlock `mutex`, wait to be woken (possibly spuriously) and lock it again
+void condvar_wait(cstlCondVar* cond, cstlMutex* mutex);
+// Like `condvar_wait()`, but give up after `timeout_ns`. Returns false on a timeout
+bool condvar_wait_for(cstlCondVar* cond, cstlMutex* mutex, UInt64 timeout_ns);
+void condvar_signal(cstlCondVar* cond);
+void condvar_broadcast(cstlCondVar* cond);
+
+// One-time initialization
+typedef struct cstlOnce {
+    cstlAtomic32 state;
+} cstlOnce;
+
+#define CSTL_ONCE_INIT  {{0}}
+
+// Call `func(arg)` if no call through `once` has happened yet. Every caller returns after it has finished
+void once_call(cstlOnce* once, void (*func)(void*), void* arg);
+
+// Futexes
+// Sleep while `cell` holds `expected`. Wakeups may be spurious, so callers re-check in a loop
+void futex_wait(cstlAtomic32* cell, Int32 expected);
+void futex_wake_one(cstlAtomic32* cell);
+void futex_wake_all(cstlAtomic32* cell);
+
+// Lock: 0 = unlocked, 1 = locked, 2 = locked and there may be sleepers
+typedef struct cstlLock {
+    cstlAtomic32 state;
+} cstlLock;
+
+#define CSTL_LOCK_INIT  {{0}}
+
+void __lock_acquire_slow(cstlLock* lock);
+
+static inline bool lock_try_acquire(cstlLock* lock) {
+    Int32 expected = 0;
+    return atomic32_cas(&lock->state, &expected, 1, MemoryOrderAcquire, MemoryOrderRelaxed);
+}
+
+static inline void lock_acquire(cstlLock* lock) {
+    if(CORETEN_UNLIKELY(!lock_try_acquire(lock)))
+        __lock_acquire_slow(lock);
+}
+
+static inline void lock_release(cstlLock* lock) {
+    if(CORETEN_UNLIKELY(atomic32_exchange(&lock->state, 0, MemoryOrderRelease) == 2))
+        futex_wake_one(&lock->state);
+}
+
+// Work-stealing deque: the owner pushes and pops at the bottom, any thread may steal from the top.
+// Items are non-null pointers. The buffer grows as needed; old buffers are kept (thieves may still be reading 
+// them) until `work_deque_free()`
+typedef struct cstlWorkDeque {
+    cstlAtomic64 top;
+    // Thieves hammer `top`, the owner `bottom`: keep them on separate cache lines
+    char __pad[CORETEN_CACHE_LINE_SIZE - sizeof(cstlAtomic64)];
+    cstlAtomic64 bottom;
+    cstlAtomicPtr buffer;   // the current buffer, which links to the ones it replaced
+} cstlWorkDeque;
+
+// `capacity` is rounded up to a power of two (0 picks a default)
+void work_deque_init(cstlWorkDeque* deque, UInt64 capacity);
+void work_deque_free(cstlWorkDeque* deque);
+// Owner only
+void work_deque_push(cstlWorkDeque* deque, void* item);
+// Owner only. The most recently pushed item, or null if the deque is empty
+void* work_deque_pop(cstlWorkDeque* deque);
+// Any thread. The oldest item, or null if the deque is empty or another thread got there first
+void* work_deque_steal(cstlWorkDeque* deque);
+// Number of items (only a snapshot while other threads use the deque)
+UInt64 work_deque_size(cstlWorkDeque* deque);
+
+// Thread pool
+typedef void (*cstlTaskFunc)(void* arg);
+typedef struct cstlThreadPool cstlThreadPool;
+
+// Start `nthreads` workers (0 starts one per CPU). If some of them can't be started, the pool runs with the ones 
+// that could (see `thread_pool_size()`); if none can, this returns null
+cstlThreadPool* thread_pool_new(UInt32 nthreads);
+// Wait for the pending tasks, then stop the workers
+void thread_pool_free(cstlThreadPool* pool);
+// Number of running workers
+UInt32 thread_pool_size(cstlThreadPool* pool);
+// Queue `func(arg)`. Safe to call from any thread, including from inside a task
+void thread_pool_submit(cstlThreadPool* pool, cstlTaskFunc func, void* arg);
+// Run tasks until every task submitted so far (and every task those submit) has finished
+void thread_pool_wait(cstlThreadPool* pool);
+// The index of the calling thread among `pool`'s workers, or -1 if it isn't one of them
+Int32 thread_pool_worker_index(cstlThreadPool* pool);
+// The process-wide pool, started on first use with one worker per CPU. It's never freed. Null if no worker could be 
+// started, in which case callers should do the work on their own thread
+cstlThreadPool* thread_pool_shared();
+
+// Task groups
+typedef struct cstlTaskGroup {
+    cstlThreadPool* pool;
+    cstlAtomic32 pending;   // tasks that haven't finished (also the futex `task_group_wait()` sleeps on)
+} cstlTaskGroup;
+
+void task_group_init(cstlTaskGroup* group, cstlThreadPool* pool);
+// Queue `func(arg)` on the group's pool, as part of the group
+void task_group_submit(cstlTaskGroup* group, cstlTaskFunc func, void* arg);
+// Run tasks until every task in the group (including those its tasks add to it) has finished. The group needs no 
+// teardown: it can be released as soon as this returns
+void task_group_wait(cstlTaskGroup* group);
+
+#endif // CORETEN_THREAD_H
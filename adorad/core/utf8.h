@@ -45,11 +45,24 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
         4. https://github.com/lemire/fastvalidate-utf-8
 */
 
+// A breadcrumb (byte offset) is recorded every `CORETEN_UTF8_BREADCRUMB_STRIDE` codepoints, so finding the n'th 
+// codepoint never needs to walk more than `CORETEN_UTF8_BREADCRUMB_STRIDE - 1` codepoints
+#define CORETEN_UTF8_BREADCRUMB_STRIDE      64
+
 #define uBuff  cstlUTF8Str
 typedef struct cstlUTF8Str {
     Byte* data;    // actual UTF8 data
     UInt64 len;    // no. of UTF8 characters
     UInt64 nbytes; // no. of bytes used by the string
+    UInt64 cap;    // no. of bytes allocated for `data` (excluding the null terminator)
+
+    // Sparse index: `crumbs[i]` is the byte offset of codepoint `i * CORETEN_UTF8_BREADCRUMB_STRIDE`
+    // This is built lazily on the first random access, and kept up to date on append afterwards.
+    UInt64* crumbs;
+    UInt64 ncrumbs;
+    UInt64 crumbs_cap;
+
+    cstlAllocator* allocator;   // null for the heap
 } cstlUTF8Str;
 
 // Is UTF-8 codepoint valid?
@@ -58,19 +71,17 @@ static inline char* utf8_encode(Rune value);
 static inline Ll utf8_encode_nbytes(Rune value);
 static inline Ll utf8_decode_nbytes(Rune byte);
 
-/*
-    WIP
-*/
-static cstlUTF8Str* ubuff_new(Rune* data);
-static cstlUTF8Str* ubuff_set(cstlUTF8Str* ubuff, Rune* data);
-void __grow_ubuff(cstlUTF8Str* ubuff, int grow_by);
-void __push_byte(cstlUTF8Str* ubuff, Byte byte);
-void __push_ascii_char(cstlUTF8Str* ubuff, Byte byte);
+cstlUTF8Str* ubuff_new(const char* data);
+cstlUTF8Str* ubuff_new_in(cstlAllocator* allocator, const char* data);
+void ubuff_free(cstlUTF8Str* ubuff);
+void ubuff_set(cstlUTF8Str* ubuff, const char* data);
+void ubuff_append(cstlUTF8Str* ubuff, const char* data);
 void ubuff_push_char(cstlUTF8Str* ubuff, Rune ch);
-static UInt64 ubuff_len(cstlUTF8Str* ubuff);
-static UInt64 ubuff_nbytes(cstlUTF8Str* ubuff);
-static Byte ubuff_byte_offset_at(cstlUTF8Str* ubuff, Int64 n);
-static Byte ubuff_at(cstlUTF8Str* ubuff, Int64 n);
+UInt64 ubuff_len(cstlUTF8Str* ubuff);
+UInt64 ubuff_nbytes(cstlUTF8Str* ubuff);
+UInt64 ubuff_byte_offset(cstlUTF8Str* ubuff, UInt64 n);
+Rune ubuff_at(cstlUTF8Str* ubuff, UInt64 n);
+cstlUTF8Str* ubuff_slice(cstlUTF8Str* ubuff, UInt64 begin, UInt64 end);
 
 // Unicode categories
 typedef enum {
@@ -183,4 +194,14 @@ typedef enum {
     UTF8_BOUNDCLASS_E_ZWG = 20, /* UTF8_BOUNDCLASS_EXTENDED_PICTOGRAPHIC + ZWJ */
 } cstlUTF8Boundclass;
 
+// Unicode properties, looked up in the compressed tables generated by `tools/scripts/generate_utf8_tables.py`
+cstlUTF8Category utf8_category(Rune ch);
+cstlUTF8BidiClass utf8_bidi_class(Rune ch);
+cstlUTF8Boundclass utf8_boundclass(Rune ch);
+// Can `ch` start/continue an identifier?
+// This is the category-based approximation of XID_Start/XID_Continue: letters, letter numbers and `_` start an 
+// identifier; marks, decimal digits and connector punctuation may also continue one
+bool utf8_is_identifier_start(Rune ch);
+bool utf8_is_identifier_continue(Rune ch);
+
 #endif // CORETEN_UTF8_H
\ No newline at end of file
@@ -0,0 +1,1055 @@
+// Auto-generated by tools/scripts/generate_utf8_tables.py
+// DO NOT EDIT BY HAND. Re-run the script instead.
+
+#ifndef CORETEN_UTF8_TABLES_H
+#define CORETEN_UTF8_TABLES_H
+
+/*
+    Compressed Unicode property tables (19442 bytes in total).
+    Derived from the utf8proc tables in `utf8_data.h` and `utf8_properties.h`.
+
+    Lookup:
+        mid_block  = utf8_trie_top[cp >> (UTF8_TRIE_LEAF_SHIFT + UTF8_TRIE_MID_SHIFT)]
+        leaf_block = utf8_trie_mid[(mid_block << UTF8_TRIE_MID_SHIFT) + ((cp >> UTF8_TRIE_LEAF_SHIFT) & UTF8_TRIE_MID_MASK)]
+        record     = utf8_trie_records[utf8_trie_leaf[(leaf_block << UTF8_TRIE_LEAF_SHIFT) + (cp & UTF8_TRIE_LEAF_MASK)]]
+
+    Each record packs (category | bidi_class << 5 | boundclass << 10).
+*/
+
+#define UTF8_TRIE_LEAF_SHIFT    4
+#define UTF8_TRIE_MID_SHIFT     5
+#define UTF8_TRIE_LEAF_MASK     ((1 << UTF8_TRIE_LEAF_SHIFT) - 1)
+#define UTF8_TRIE_MID_MASK      ((1 << UTF8_TRIE_MID_SHIFT) - 1)
+
+static const UInt16 utf8_trie_records[105] = {
+    1024, 1057, 1058, 1059, 1060, 1061, 1063, 1065, 1066, 1067, 1074, 1075, 1077, 1078, 1085, 1153,
+    1154, 1156, 1157, 1161, 1163, 1165, 1170, 1174, 1188, 1189, 1202, 1203, 1204, 1205, 1206, 1321,
+    1323, 1357, 1363, 1394, 1395, 1396, 1398, 1417, 1419, 1426, 1458, 1459, 1463, 1623, 1636, 1642,
+    1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1653, 1654, 2586, 3610, 4155, 4156, 4187,
+    4219, 4251, 4283, 4315, 4347, 4379, 4602, 4603, 4633, 4634, 4666, 4696, 4698, 4731, 4763, 4795,
+    4827, 4859, 5156, 5158, 5159, 5574, 5576, 5627, 6181, 7205, 8229, 9253, 10277, 11318, 12325, 12327,
+    13349, 13371, 13499, 13723, 14843, 15990, 17013, 18038, 19062,
+};
+
+static const UInt8 utf8_trie_top[2176] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 28,
+    29, 26, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 34, 35, 36,
+    37, 38, 39, 40, 34, 35, 36, 37, 38, 39, 40, 41, 42, 42, 42, 42,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    26, 64, 65, 63, 63, 63, 63, 63, 26, 26, 66, 63, 63, 63, 63, 63,
+    63, 63, 26, 67, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 26, 68, 63, 69, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 70, 26, 71, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 72, 63, 63, 63, 63, 63, 73, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 74, 75, 76, 77, 78, 79, 63, 63,
+    80, 63, 63, 63, 81, 63, 63, 82, 83, 84, 85, 86, 87, 63, 63, 63,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 88, 26, 26, 26, 26, 26, 26, 26, 89, 90, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 91, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 26, 92, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    93, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 94,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 94,
+};
+
+static const UInt16 utf8_trie_mid[3040] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 16, 16, 17, 18, 16, 16, 19, 20, 21, 22, 23, 24, 25, 16, 26,
+    16, 16, 16, 27, 28, 14, 14, 14, 14, 29, 14, 30, 31, 32, 33, 34,
+    35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39, 14, 40, 41, 16, 42,
+    12, 12, 12, 14, 14, 14, 16, 16, 43, 16, 16, 16, 44, 16, 16, 16,
+    16, 16, 16, 45, 12, 46, 47, 14, 48, 49, 35, 50, 51, 52, 53, 54,
+    55, 56, 57, 57, 58, 35, 59, 60, 57, 57, 57, 57, 57, 61, 62, 63,
+    64, 65, 57, 35, 66, 57, 57, 57, 57, 57, 67, 68, 69, 52, 70, 71,
+    52, 72, 73, 74, 52, 75, 76, 76, 76, 76, 57, 77, 76, 78, 79, 35,
+    80, 81, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+    95, 88, 89, 96, 97, 98, 99, 100, 101, 102, 89, 103, 104, 105, 93, 106,
+    107, 88, 89, 108, 109, 110, 93, 111, 112, 113, 114, 115, 116, 117, 99, 118,
+    119, 120, 89, 121, 122, 123, 93, 124, 125, 120, 89, 126, 127, 128, 93, 129,
+    130, 120, 81, 131, 132, 133, 93, 134, 135, 136, 81, 137, 138, 139, 99, 140,
+    141, 81, 81, 142, 143, 144, 76, 76, 145, 146, 147, 148, 149, 150, 76, 76,
+    151, 152, 153, 154, 155, 81, 156, 157, 158, 159, 35, 160, 161, 162, 76, 76,
+    81, 81, 163, 164, 165, 166, 167, 168, 169, 170, 12, 12, 171, 81, 81, 172,
+    173, 173, 173, 173, 173, 173, 174, 174, 174, 174, 175, 176, 176, 176, 176, 176,
+    81, 81, 81, 81, 177, 178, 81, 81, 177, 81, 81, 179, 180, 181, 81, 81,
+    81, 180, 81, 81, 81, 182, 183, 184, 81, 185, 12, 12, 12, 12, 12, 186,
+    187, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 188, 81, 189, 190, 81, 81, 81, 81, 191, 192,
+    193, 194, 81, 195, 81, 196, 193, 197, 81, 81, 81, 198, 199, 200, 201, 202,
+    203, 201, 81, 81, 204, 81, 81, 205, 206, 81, 207, 81, 81, 81, 81, 208,
+    81, 209, 210, 211, 212, 81, 213, 214, 81, 81, 215, 81, 216, 217, 218, 218,
+    81, 219, 81, 81, 81, 220, 221, 222, 201, 201, 223, 224, 76, 76, 76, 76,
+    225, 81, 81, 226, 227, 165, 228, 229, 230, 81, 231, 232, 81, 81, 233, 234,
+    81, 81, 235, 236, 237, 232, 81, 238, 239, 76, 76, 76, 240, 241, 242, 243,
+    14, 14, 244, 245, 245, 245, 246, 247, 14, 248, 245, 245, 35, 35, 35, 249,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 250, 16, 16, 16, 16, 16, 16,
+    251, 252, 251, 251, 252, 253, 251, 254, 255, 255, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 76, 273, 274, 275,
+    276, 277, 278, 279, 280, 281, 282, 282, 283, 284, 285, 218, 286, 287, 218, 288,
+    289, 290, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289,
+    291, 218, 292, 293, 294, 294, 294, 295, 218, 296, 289, 297, 218, 298, 299, 300,
+    218, 218, 301, 76, 302, 76, 281, 281, 303, 304, 294, 294, 294, 294, 305, 281,
+    218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 306, 307, 218, 218, 308,
+    218, 309, 218, 218, 218, 218, 310, 218, 218, 218, 311, 218, 218, 218, 218, 312,
+    313, 218, 218, 218, 218, 218, 314, 315, 281, 316, 218, 218, 317, 289, 318, 289,
+    294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+    289, 289, 289, 289, 289, 289, 289, 289, 319, 320, 289, 289, 289, 321, 289, 322,
+    289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289,
+    218, 218, 218, 289, 323, 218, 218, 324, 218, 325, 218, 326, 327, 328, 329, 76,
+    12, 12, 330, 14, 14, 331, 332, 333, 16, 16, 16, 16, 16, 16, 334, 335,
+    14, 14, 336, 81, 81, 81, 337, 338, 81, 339, 340, 340, 340, 340, 35, 35,
+    341, 342, 343, 344, 345, 76, 76, 76, 218, 346, 218, 218, 218, 218, 218, 347,
+    218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 348, 76, 349,
+    350, 351, 352, 353, 141, 81, 81, 81, 81, 354, 187, 81, 81, 81, 81, 355,
+    356, 81, 213, 141, 81, 81, 81, 81, 209, 357, 81, 358, 218, 218, 347, 81,
+    294, 359, 360, 294, 361, 362, 294, 363, 360, 294, 294, 364, 365, 294, 294, 366,
+    294, 294, 294, 294, 294, 294, 294, 367, 294, 294, 294, 294, 294, 368, 294, 369,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 208, 218, 218, 218, 218,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 208, 76, 76,
+    81, 370, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 156, 218, 218, 218, 301, 81, 81, 238,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    371, 81, 372, 76, 16, 16, 373, 374, 16, 375, 81, 81, 81, 81, 376, 377,
+    34, 378, 379, 380, 16, 16, 16, 381, 382, 383, 384, 385, 76, 76, 76, 386,
+    387, 81, 388, 389, 81, 81, 81, 390, 391, 81, 81, 392, 393, 201, 35, 394,
+    232, 81, 395, 81, 396, 397, 173, 398, 80, 81, 81, 399, 400, 401, 402, 403,
+    81, 81, 404, 405, 406, 407, 81, 408, 81, 81, 81, 409, 410, 411, 412, 413,
+    414, 415, 340, 14, 14, 416, 417, 14, 14, 14, 14, 14, 81, 81, 418, 201,
+    419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420,
+    421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422,
+    421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423,
+    421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419,
+    420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421,
+    422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421,
+    423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421,
+    419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420,
+    421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422,
+    421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423,
+    421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419,
+    420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421,
+    422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421,
+    423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421,
+    419, 420, 421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 423, 421, 419, 420,
+    421, 422, 421, 423, 421, 419, 420, 421, 422, 421, 424, 174, 425, 176, 176, 426,
+    427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427,
+    427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427,
+    428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+    428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+    428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 213, 81, 81, 81, 81, 81, 81, 216, 76, 76,
+    429, 430, 431, 432, 433, 57, 57, 57, 57, 57, 57, 434, 435, 436, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 437, 76, 57, 57, 57, 57, 438, 57, 57, 439, 76, 76, 440,
+    35, 441, 35, 442, 443, 444, 445, 446, 57, 57, 57, 57, 57, 57, 57, 447,
+    448, 3, 4, 5, 6, 449, 450, 451, 81, 452, 81, 209, 453, 454, 455, 456,
+    457, 81, 181, 458, 213, 213, 76, 76, 81, 81, 81, 81, 81, 81, 81, 358,
+    459, 460, 460, 461, 462, 462, 462, 463, 464, 349, 465, 76, 76, 294, 294, 466,
+    76, 76, 76, 76, 76, 76, 76, 76, 81, 156, 81, 81, 81, 105, 467, 468,
+    81, 81, 469, 81, 470, 81, 81, 471, 81, 472, 81, 81, 473, 474, 76, 76,
+    12, 12, 475, 14, 14, 81, 81, 81, 81, 213, 201, 12, 12, 476, 14, 477,
+    81, 81, 205, 81, 81, 81, 478, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 339, 81, 208, 205, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    479, 52, 52, 480, 52, 481, 52, 482, 52, 483, 484, 76, 76, 76, 52, 485,
+    52, 486, 52, 487, 76, 76, 76, 76, 52, 52, 52, 488, 489, 490, 489, 489,
+    491, 492, 52, 493, 494, 495, 52, 496, 52, 497, 76, 76, 498, 52, 499, 500,
+    52, 52, 52, 501, 52, 502, 52, 503, 52, 504, 505, 76, 76, 76, 76, 76,
+    52, 52, 52, 52, 506, 76, 76, 76, 507, 507, 507, 508, 509, 509, 509, 510,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 511, 512, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    513, 81, 81, 514, 515, 516, 517, 518, 230, 81, 81, 519, 520, 81, 521, 201,
+    522, 81, 523, 524, 525, 81, 81, 526, 230, 81, 81, 527, 528, 529, 530, 531,
+    81, 102, 532, 533, 76, 76, 76, 76, 534, 535, 536, 81, 81, 537, 538, 201,
+    539, 88, 89, 540, 541, 542, 543, 544, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 81, 545, 546, 547, 76, 76, 81, 81, 81, 548, 549, 201, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 81, 81, 550, 551, 552, 553, 76, 76,
+    81, 81, 81, 554, 555, 201, 556, 76, 81, 81, 557, 558, 201, 76, 76, 76,
+    81, 559, 560, 561, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 12, 12, 14, 14, 153, 562,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 81, 81, 81, 521,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    89, 81, 563, 564, 565, 153, 184, 566, 81, 567, 568, 569, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 216, 76, 76, 76, 76, 76, 76,
+    282, 282, 282, 282, 282, 282, 570, 571, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 572, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 209, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 81, 81, 339, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 81, 521, 81, 209, 401, 76, 76, 76, 76, 76, 76, 81, 213, 573,
+    81, 81, 81, 574, 575, 576, 577, 578, 81, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 81, 81, 214, 579, 580, 581, 518, 582, 76, 76, 76, 76, 583, 76,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 156, 76,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 584,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    585, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 81, 81, 81, 81, 81, 358, 156, 521, 586, 587, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 588,
+    294, 294, 589, 294, 294, 294, 590, 591, 592, 294, 593, 294, 294, 294, 594, 76,
+    218, 218, 218, 218, 595, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    218, 218, 218, 218, 218, 301, 460, 596, 76, 76, 76, 76, 76, 76, 76, 76,
+    12, 597, 14, 598, 599, 600, 251, 12, 601, 602, 603, 604, 605, 12, 597, 14,
+    606, 607, 14, 608, 609, 610, 611, 12, 612, 14, 12, 597, 14, 598, 599, 14,
+    251, 12, 601, 611, 12, 612, 14, 12, 597, 14, 613, 12, 614, 615, 616, 617,
+    14, 618, 12, 619, 620, 621, 622, 14, 623, 12, 624, 14, 625, 626, 626, 626,
+    294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+    294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+    35, 35, 35, 627, 35, 35, 628, 629, 630, 631, 49, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    632, 633, 634, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 635, 636, 76, 76,
+    507, 507, 637, 509, 638, 639, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    640, 57, 641, 642, 643, 644, 645, 646, 647, 648, 649, 648, 76, 76, 76, 650,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    218, 218, 349, 218, 218, 218, 218, 218, 218, 347, 300, 651, 651, 651, 218, 348,
+    652, 294, 366, 294, 294, 294, 653, 294, 294, 294, 654, 76, 76, 76, 655, 656,
+    657, 294, 294, 658, 594, 659, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    218, 218, 218, 218, 218, 218, 218, 218, 660, 218, 218, 218, 661, 218, 218, 662,
+    218, 218, 218, 218, 663, 664, 665, 666, 667, 218, 668, 218, 218, 218, 218, 218,
+    218, 218, 218, 218, 218, 218, 218, 669, 218, 670, 218, 218, 218, 218, 671, 218,
+    218, 218, 218, 218, 672, 218, 218, 218, 218, 218, 673, 674, 664, 675, 676, 301,
+    218, 218, 218, 218, 218, 218, 218, 347, 218, 218, 218, 218, 218, 677, 76, 76,
+    349, 218, 218, 218, 678, 185, 218, 218, 678, 218, 679, 76, 76, 76, 76, 76,
+    76, 680, 681, 682, 349, 300, 76, 76, 218, 328, 76, 76, 465, 76, 76, 76,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 339, 76, 76,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 214, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 213, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 585, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    81, 213, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    683, 76, 684, 684, 684, 684, 684, 684, 76, 76, 76, 76, 76, 76, 76, 76,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 76,
+    428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+    428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 685,
+};
+
+static const UInt8 utf8_trie_leaf[10976] = {
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 74, 60, 74, 76, 59, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 73, 73, 73, 74,
+    45, 55, 55, 35, 37, 35, 55, 55, 51, 52, 55, 34, 42, 33, 42, 42,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 42, 55, 56, 56, 56, 55,
+    55, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 51, 55, 52, 57, 49,
+    57, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 51, 56, 52, 56, 70,
+    70, 70, 70, 70, 70, 73, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    44, 55, 37, 37, 37, 37, 58, 55, 57, 58, 5, 53, 56, 71, 58, 57,
+    38, 36, 32, 32, 57, 2, 55, 55, 57, 32, 5, 54, 48, 48, 48, 55,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 56, 1, 1, 1, 1, 1, 1, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 56, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 1, 2, 2,
+    2, 1, 1, 2, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 1, 1,
+    1, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1,
+    1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 2, 1, 2, 1, 1,
+    2, 1, 1, 1, 2, 1, 2, 1, 1, 2, 2, 5, 1, 2, 2, 2,
+    5, 5, 5, 5, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2,
+    2, 1, 3, 2, 1, 2, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 1, 1, 2,
+    2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 46, 46, 4, 4, 4, 4, 4,
+    4, 4, 57, 57, 57, 57, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    4, 4, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    4, 4, 4, 4, 4, 57, 57, 57, 57, 57, 57, 57, 46, 57, 4, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    1, 2, 1, 2, 46, 57, 1, 2, 0, 0, 4, 2, 2, 2, 55, 1,
+    0, 0, 0, 0, 57, 57, 1, 55, 1, 1, 1, 0, 1, 0, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+    2, 2, 1, 1, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 2, 2, 1, 2, 56, 1, 2, 1, 1, 2, 2, 1, 1, 1,
+    1, 2, 13, 85, 85, 85, 85, 85, 86, 86, 1, 2, 1, 2, 1, 2,
+    1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 4, 10, 10, 10, 10, 10, 10,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 0, 10, 50, 0, 0, 58, 58, 37,
+    0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 21, 85,
+    22, 85, 85, 22, 85, 85, 22, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    18, 18, 18, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    99, 99, 99, 99, 99, 99, 56, 56, 27, 35, 35, 28, 42, 26, 58, 58,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 26, 66, 0, 26, 26,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 85, 85, 85, 85, 85,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 35, 41, 41, 26, 25, 25,
+    85, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 26, 25, 85, 85, 85, 85, 85, 85, 85, 99, 58, 85,
+    85, 85, 85, 85, 85, 24, 24, 85, 85, 58, 85, 85, 85, 85, 25, 25,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 25, 25, 25, 30, 30, 25,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 98,
+    25, 85, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 17, 17, 58, 55, 55, 55, 17, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 85, 85, 85, 85, 17, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 17, 85, 85, 85, 17, 85, 85, 85, 85, 85, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 85, 85, 85, 0, 0, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    25, 25, 25, 25, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0,
+    0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 99, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 95, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 85, 95, 85, 5, 95, 95,
+    95, 85, 85, 85, 85, 85, 85, 85, 85, 95, 95, 95, 95, 85, 95, 95,
+    5, 85, 85, 85, 85, 85, 85, 85, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 85, 85, 10, 10, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    10, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 85, 95, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 0, 0, 0, 5, 5, 5, 5, 0, 0, 85, 5, 84, 95,
+    95, 85, 85, 85, 85, 0, 0, 95, 95, 0, 0, 95, 95, 85, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 5, 5, 0, 5,
+    5, 5, 85, 85, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    5, 5, 37, 37, 9, 9, 9, 9, 9, 9, 13, 37, 0, 0, 0, 0,
+    0, 85, 85, 95, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5,
+    5, 0, 5, 5, 0, 5, 5, 0, 5, 5, 0, 0, 85, 0, 95, 95,
+    95, 85, 85, 0, 0, 0, 0, 85, 85, 0, 0, 85, 85, 85, 0, 0,
+    0, 85, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    85, 85, 5, 5, 5, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 85, 85, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 85, 5, 95, 95,
+    95, 85, 85, 85, 85, 85, 0, 85, 85, 95, 0, 95, 95, 85, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 37, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+    0, 85, 95, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 85, 5, 84, 85,
+    95, 85, 85, 85, 85, 0, 0, 95, 95, 0, 0, 95, 95, 85, 0, 0,
+    0, 0, 0, 0, 0, 0, 85, 84, 0, 0, 0, 0, 5, 5, 0, 5,
+    13, 5, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 85, 5, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 0, 0, 0, 5, 5, 0, 5, 0, 5, 5,
+    0, 0, 0, 5, 5, 0, 0, 0, 5, 5, 5, 0, 0, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 84, 95,
+    85, 95, 95, 0, 0, 0, 95, 95, 95, 0, 95, 95, 95, 85, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 58, 58, 58, 58, 58, 58, 37, 58, 0, 0, 0, 0, 0,
+    85, 95, 95, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5, 85, 85,
+    85, 95, 95, 95, 95, 0, 85, 85, 85, 0, 85, 85, 85, 85, 0, 0,
+    0, 0, 0, 0, 0, 85, 85, 0, 5, 5, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 48, 48, 48, 48, 13,
+    5, 85, 95, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 85, 5, 95, 83,
+    95, 95, 84, 95, 95, 0, 83, 95, 95, 0, 95, 95, 85, 85, 0, 0,
+    0, 0, 0, 0, 0, 84, 84, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+    0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 85, 95, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 84, 95,
+    95, 85, 85, 85, 85, 0, 95, 95, 95, 0, 95, 95, 95, 85, 96, 13,
+    0, 0, 0, 0, 5, 5, 5, 84, 9, 9, 9, 9, 9, 9, 9, 5,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 13, 5, 5, 5, 5, 5, 5,
+    0, 0, 95, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 85, 0, 0, 0, 0, 84,
+    95, 95, 85, 85, 85, 0, 85, 0, 95, 95, 95, 95, 95, 95, 95, 84,
+    0, 0, 95, 95, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 85, 5, 94, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 37,
+    5, 5, 5, 5, 5, 5, 4, 85, 85, 85, 85, 85, 85, 85, 85, 10,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 10, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 0, 0, 5, 5, 0, 5, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 5, 5, 0, 5, 0, 5, 0, 0, 5, 5, 0, 5, 5, 5,
+    5, 85, 5, 94, 85, 85, 85, 85, 85, 85, 0, 85, 85, 5, 0, 0,
+    5, 5, 5, 5, 5, 0, 4, 0, 85, 85, 85, 85, 85, 85, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 5, 5, 5, 5,
+    5, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 13, 10, 13, 13, 13, 85, 85, 13, 13, 13, 13, 13, 13,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 13, 85, 13, 85, 13, 85, 51, 52, 51, 52, 95, 95,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 95,
+    85, 85, 85, 85, 85, 10, 85, 85, 5, 5, 5, 5, 5, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 0, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 13, 13,
+    13, 13, 13, 13, 13, 13, 85, 13, 13, 13, 13, 13, 13, 0, 13, 13,
+    10, 10, 10, 10, 10, 13, 13, 13, 13, 10, 10, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 85, 85, 85,
+    85, 95, 85, 85, 85, 85, 85, 85, 6, 85, 85, 95, 95, 85, 85, 5,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 10, 10, 10, 10, 10,
+    5, 5, 5, 5, 5, 5, 95, 95, 85, 85, 5, 5, 5, 5, 85, 85,
+    85, 5, 6, 6, 6, 5, 5, 6, 6, 6, 6, 6, 6, 6, 5, 5,
+    5, 85, 85, 85, 85, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 85, 6, 95, 85, 85, 6, 6, 6, 6, 6, 6, 85, 5, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 85, 13, 13,
+    1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 4, 5, 5, 5,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 0, 0,
+    5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 85, 85, 85,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+    50, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 5,
+    45, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 51, 52, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 10, 8, 8,
+    8, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 5, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 85, 85, 85, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 85, 85, 95, 85, 85, 85, 85, 85, 85, 85, 95, 95,
+    95, 95, 95, 95, 95, 95, 85, 95, 95, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 10, 10, 10, 4, 10, 10, 10, 37, 5, 85, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 0, 0, 0, 0, 0,
+    55, 55, 55, 55, 55, 55, 50, 55, 55, 55, 55, 85, 85, 85, 71, 0,
+    5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 85, 85, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 85, 5, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    85, 85, 85, 95, 95, 95, 95, 85, 85, 95, 95, 95, 0, 0, 0, 0,
+    95, 95, 85, 95, 95, 95, 95, 95, 95, 85, 85, 85, 0, 0, 0, 0,
+    58, 0, 0, 0, 55, 55, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 0, 0, 0, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    5, 5, 5, 5, 5, 5, 5, 85, 85, 95, 95, 85, 0, 0, 10, 10,
+    5, 5, 5, 5, 5, 95, 85, 95, 85, 85, 85, 85, 85, 85, 85, 0,
+    85, 6, 85, 6, 6, 85, 85, 85, 85, 85, 85, 85, 85, 95, 95, 95,
+    95, 95, 95, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 85,
+    10, 10, 10, 10, 10, 10, 10, 4, 10, 10, 10, 10, 10, 10, 0, 0,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 86, 0,
+    85, 85, 85, 85, 95, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 85, 95, 85, 85, 85, 85, 85, 95, 85, 95, 95, 95,
+    95, 95, 85, 95, 95, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    10, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0,
+    85, 85, 95, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 95, 85, 85, 85, 85, 95, 95, 85, 85, 95, 85, 85, 85, 5, 5,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 85, 95, 85, 85, 95, 95, 95, 85, 95, 85,
+    85, 85, 95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10,
+    5, 5, 5, 5, 95, 95, 95, 95, 95, 95, 95, 95, 85, 85, 85, 85,
+    85, 85, 85, 85, 95, 95, 85, 85, 0, 0, 0, 10, 10, 10, 10, 10,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 10, 10,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 10, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 95, 85, 85, 85, 85, 85, 85, 85, 5, 5, 5, 5, 85, 5, 5,
+    5, 5, 95, 95, 85, 5, 5, 0, 85, 85, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4,
+    85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85,
+    1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1, 0, 1, 0, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 57, 2, 57,
+    57, 57, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 57, 57, 57,
+    2, 2, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 0, 57, 57, 57,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 57, 57, 57,
+    0, 0, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 57, 57, 0,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 71, 87, 100, 61, 65,
+    50, 50, 50, 50, 50, 50, 55, 55, 53, 54, 51, 53, 53, 54, 51, 53,
+    55, 55, 55, 55, 55, 55, 55, 55, 75, 72, 63, 67, 69, 64, 68, 44,
+    35, 35, 35, 35, 35, 55, 55, 55, 55, 53, 54, 55, 55, 55, 55, 49,
+    49, 55, 55, 55, 43, 51, 52, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 56, 55, 49, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 45,
+    71, 71, 71, 71, 71, 0, 78, 79, 80, 81, 71, 71, 71, 71, 71, 71,
+    32, 4, 0, 0, 32, 32, 32, 32, 32, 32, 34, 34, 56, 51, 52, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 56, 51, 52, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 86, 86, 86,
+    86, 85, 86, 86, 86, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 1, 58, 58, 58, 58, 1, 58, 58, 2, 1, 1, 1, 2, 2,
+    1, 1, 1, 2, 58, 1, 58, 58, 56, 1, 1, 1, 1, 1, 58, 58,
+    58, 58, 58, 58, 1, 58, 1, 58, 1, 58, 1, 1, 1, 1, 38, 2,
+    1, 1, 1, 1, 2, 5, 5, 5, 5, 2, 58, 58, 2, 2, 1, 1,
+    56, 56, 56, 56, 56, 1, 2, 2, 2, 2, 58, 56, 58, 58, 2, 13,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 1, 2, 8, 8, 8, 8, 48, 58, 58, 0, 0, 0, 0,
+    56, 56, 56, 56, 56, 58, 58, 58, 58, 58, 56, 56, 58, 58, 58, 58,
+    56, 58, 58, 56, 58, 58, 56, 58, 58, 58, 58, 58, 58, 58, 56, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 56, 56,
+    58, 58, 56, 58, 56, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 34, 36, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    58, 58, 58, 58, 58, 58, 58, 58, 51, 52, 51, 52, 58, 58, 58, 58,
+    56, 56, 58, 58, 58, 58, 58, 58, 58, 51, 52, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 58, 56, 58, 58, 58,
+    58, 58, 58, 58, 58, 13, 58, 58, 58, 58, 58, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 56, 56, 56, 56,
+    56, 56, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0,
+    58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0,
+    48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 48, 48, 48, 48, 48, 48,
+    58, 58, 58, 58, 58, 58, 58, 56, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 56, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 56, 56, 56, 56, 56, 56, 56, 56,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 101, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 56,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 13, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 101, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 101, 101, 101, 101, 58, 58,
+    58, 58, 58, 58, 103, 58, 58, 58, 51, 52, 51, 52, 51, 52, 51, 52,
+    51, 52, 51, 52, 51, 52, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    56, 56, 56, 56, 56, 51, 52, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 51, 52, 51, 52, 51, 52, 51, 52, 51, 52,
+    56, 56, 56, 51, 52, 51, 52, 51, 52, 51, 52, 51, 52, 51, 52, 51,
+    52, 51, 52, 51, 52, 51, 52, 51, 52, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 51, 52, 51, 52, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 51, 52, 56, 56,
+    56, 56, 56, 56, 56, 58, 58, 56, 56, 56, 56, 56, 56, 58, 58, 58,
+    58, 58, 58, 58, 0, 0, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 0, 0, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 58, 58, 58, 58, 58, 58,
+    58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    1, 2, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1,
+    1, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 4, 4, 1, 1,
+    1, 2, 1, 2, 2, 58, 58, 58, 58, 58, 58, 1, 2, 1, 2, 85,
+    85, 85, 1, 2, 0, 0, 0, 0, 0, 55, 55, 55, 55, 48, 55, 55,
+    2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 4,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    55, 55, 53, 54, 53, 54, 55, 55, 55, 53, 54, 55, 53, 54, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 50, 55, 55, 50, 55, 53, 54, 55, 55,
+    53, 54, 51, 52, 51, 52, 51, 52, 51, 52, 55, 55, 55, 55, 55, 46,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 50, 50, 55, 55, 55, 55,
+    50, 55, 51, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0,
+    45, 55, 55, 55, 58, 4, 5, 8, 51, 52, 51, 52, 51, 52, 51, 52,
+    51, 52, 58, 58, 51, 52, 51, 52, 51, 52, 51, 52, 50, 51, 52, 52,
+    58, 8, 8, 8, 8, 8, 8, 8, 8, 8, 85, 85, 85, 85, 84, 84,
+    50, 4, 4, 4, 4, 4, 58, 58, 8, 8, 8, 4, 5, 55, 58, 58,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 85, 85, 57, 57, 4, 4, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 55, 4, 4, 4, 5,
+    0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    13, 13, 9, 9, 9, 9, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 58, 58, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 9, 9, 9, 9, 9, 9, 9, 9,
+    58, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 58, 58, 58, 13,
+    13, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 58, 58, 58, 58,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0,
+    13, 13, 13, 13, 13, 13, 13, 58, 58, 58, 58, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 58, 58,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 58,
+    5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 55, 55, 55,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 5, 0, 0, 0, 0,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 85,
+    86, 86, 86, 55, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 55, 46,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 4, 4, 85, 85,
+    5, 5, 5, 5, 5, 5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    85, 85, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    57, 57, 57, 57, 57, 57, 57, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    57, 57, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    4, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 46, 12, 12, 1, 2, 1, 2, 5,
+    1, 2, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5, 4, 4, 2, 5, 5, 5, 5, 5,
+    5, 5, 85, 5, 5, 5, 85, 5, 5, 5, 5, 85, 5, 5, 5, 5,
+    5, 5, 5, 95, 95, 85, 85, 95, 58, 58, 58, 58, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 13, 13, 37, 38, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 55, 55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0,
+    95, 95, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10,
+    85, 85, 5, 5, 5, 5, 5, 5, 10, 10, 10, 5, 10, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 85, 85, 85, 85, 85, 85, 85, 85, 10, 10,
+    5, 5, 5, 5, 5, 5, 5, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 0, 0, 0,
+    5, 5, 5, 85, 95, 95, 85, 85, 85, 85, 95, 95, 85, 95, 95, 95,
+    95, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 4,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 10, 10,
+    5, 5, 5, 5, 5, 85, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 5, 5, 5, 5, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 85, 85, 85, 85, 85, 85, 95,
+    95, 85, 85, 95, 95, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 85, 5, 5, 5, 5, 5, 5, 5, 5, 85, 95, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 10, 10, 10, 10,
+    4, 5, 5, 5, 5, 5, 5, 13, 13, 13, 5, 6, 85, 6, 5, 5,
+    85, 5, 85, 85, 85, 5, 5, 85, 85, 5, 5, 5, 5, 5, 85, 85,
+    5, 85, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 4, 10, 10,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 95, 85, 85, 95, 95,
+    10, 10, 5, 4, 4, 95, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 0,
+    0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 12, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 95, 95, 85, 95, 95, 85, 95, 95, 10, 95, 85, 0, 0,
+    91, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 91, 92, 92, 92,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 92, 92, 92, 91, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 91, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    89, 89, 89, 89, 89, 89, 89, 0, 0, 0, 0, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 0, 0, 0, 0,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 18, 85, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 34, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 0, 18, 0,
+    18, 18, 0, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    25, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 52, 51,
+    0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 58, 0, 0,
+    55, 55, 55, 55, 55, 55, 55, 51, 52, 55, 0, 0, 0, 0, 0, 0,
+    55, 50, 50, 49, 49, 51, 52, 51, 52, 51, 52, 51, 52, 51, 52, 51,
+    52, 51, 52, 51, 52, 55, 55, 51, 52, 55, 55, 55, 55, 49, 49, 49,
+    42, 55, 42, 0, 55, 42, 55, 55, 50, 51, 52, 51, 52, 51, 52, 35,
+    55, 55, 34, 33, 56, 56, 56, 0, 55, 37, 35, 55, 0, 0, 0, 0,
+    25, 25, 25, 25, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 71,
+    0, 55, 55, 35, 37, 35, 55, 55, 51, 52, 55, 34, 42, 33, 42, 42,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 51, 56, 52, 56, 51,
+    52, 55, 51, 52, 55, 55, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 82, 82,
+    0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5,
+    0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 0, 0, 0,
+    37, 37, 56, 57, 58, 37, 37, 0, 58, 56, 56, 56, 56, 58, 58, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 77, 77, 58, 58, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 5,
+    10, 55, 10, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 0, 0, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    47, 47, 47, 47, 47, 48, 48, 48, 48, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 48, 48, 58, 13, 13, 0,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 85, 0, 0,
+    85, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0,
+    9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 8, 5, 5, 5, 5, 5, 5, 5, 5, 8, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 10,
+    5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    10, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+    5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    18, 18, 18, 18, 18, 18, 0, 0, 18, 0, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 0, 18, 18, 0, 0, 0, 18, 0, 0, 18,
+    18, 18, 18, 18, 18, 18, 0, 22, 20, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 18, 18, 18, 18, 18, 23, 23, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 18, 0, 18, 18, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20,
+    18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 0, 0, 0, 55,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 22,
+    18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 20, 20, 18, 18,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    18, 85, 85, 85, 0, 85, 85, 0, 0, 0, 0, 0, 85, 85, 85, 85,
+    18, 18, 18, 18, 0, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 0, 0, 0, 0, 85, 85, 85, 0, 0, 0, 0, 85,
+    20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 22,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20,
+    18, 18, 18, 18, 18, 18, 18, 18, 23, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 85, 85, 0, 0, 0, 0, 20, 20, 20, 20, 20,
+    22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 0, 0, 0, 55, 55, 55, 55, 55, 55, 55,
+    18, 18, 18, 18, 18, 18, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 18, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0,
+    95, 85, 95, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 10, 10, 10, 10, 10, 10, 10, 0, 0,
+    0, 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+    95, 95, 95, 85, 85, 85, 85, 95, 95, 85, 85, 10, 10, 97, 10, 10,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 85, 85, 85, 85, 85, 95, 85, 85, 85,
+    85, 85, 85, 85, 85, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 85, 10, 10, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 95, 95, 95, 85, 85, 85, 85, 85, 85, 85, 85, 85, 95,
+    95, 5, 96, 96, 5, 10, 10, 10, 10, 10, 85, 85, 85, 10, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 10, 5, 10, 10, 10,
+    0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 95, 95, 95, 85,
+    85, 85, 95, 95, 85, 95, 85, 85, 10, 10, 10, 10, 10, 10, 85, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 85,
+    95, 95, 95, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0,
+    85, 85, 95, 95, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 85, 5, 84, 95,
+    85, 95, 95, 95, 95, 0, 0, 95, 95, 0, 0, 95, 95, 95, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 5, 5, 5,
+    5, 5, 95, 95, 0, 0, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0,
+    85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 95, 95, 95, 85, 85, 85, 85, 85, 85, 85, 85,
+    95, 95, 85, 85, 85, 95, 85, 5, 5, 5, 5, 10, 10, 10, 10, 10,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 10, 0, 10, 0, 0,
+    84, 95, 95, 85, 85, 85, 85, 85, 85, 95, 85, 95, 95, 84, 95, 85,
+    85, 95, 85, 85, 5, 5, 10, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 84,
+    95, 95, 85, 85, 85, 85, 0, 0, 95, 95, 95, 95, 85, 85, 95, 85,
+    85, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 85, 85, 0, 0,
+    95, 95, 95, 85, 85, 85, 85, 85, 85, 85, 85, 95, 95, 85, 95, 85,
+    85, 10, 10, 10, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 85, 95, 85, 95, 95,
+    85, 85, 85, 85, 85, 85, 95, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 85, 85, 85,
+    95, 95, 85, 85, 85, 85, 95, 85, 85, 85, 85, 85, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 10, 10, 10, 13,
+    9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 95,
+    85, 85, 85, 85, 85, 85, 85, 0, 85, 85, 85, 85, 85, 85, 95, 83,
+    5, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 0, 95, 85, 85, 85, 85, 85, 85,
+    85, 95, 85, 85, 95, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0,
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 85, 85, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 85, 85, 85, 85, 10, 10, 10, 10, 10, 13, 13, 13, 13,
+    4, 4, 4, 4, 10, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 9, 9, 9, 9, 9,
+    9, 9, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 5, 5, 5,
+    5, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 0,
+    85, 85, 85, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 13, 85, 85, 10,
+    71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 0, 0, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 84, 95, 85, 85, 85, 13, 13, 13, 95, 84, 84,
+    84, 84, 84, 71, 71, 71, 71, 71, 71, 71, 71, 85, 85, 85, 85, 85,
+    85, 85, 85, 13, 13, 85, 85, 85, 85, 85, 85, 85, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 85, 85, 85, 85, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 85, 85, 85, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 1, 1,
+    0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2,
+    2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 0, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 11, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 56, 2, 2, 2, 2,
+    2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 11, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 56, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 11, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 56,
+    2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 11,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 56, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 11, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 56, 2, 2, 2, 2, 2, 2, 1, 2, 0, 0, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    85, 85, 85, 85, 85, 85, 85, 13, 13, 13, 13, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 13, 13, 13,
+    13, 13, 13, 13, 13, 85, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 85, 13, 13, 10, 10, 10, 10, 10, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 0, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 85, 85, 85, 85, 85,
+    85, 85, 0, 85, 85, 0, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 22, 22,
+    25, 25, 25, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    0, 25, 25, 0, 25, 0, 0, 25, 0, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 0, 25, 25, 25, 25, 0, 25, 0, 25, 0, 0, 0, 0,
+    0, 0, 25, 0, 0, 0, 0, 25, 0, 25, 0, 25, 0, 25, 25, 25,
+    0, 25, 25, 0, 25, 0, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25,
+    0, 25, 25, 0, 25, 0, 0, 25, 25, 25, 25, 0, 25, 25, 25, 25,
+    25, 25, 25, 0, 25, 25, 25, 25, 0, 25, 25, 25, 25, 0, 25, 0,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0,
+    0, 25, 25, 25, 0, 25, 25, 25, 25, 25, 0, 25, 25, 25, 25, 25,
+    56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 58, 58, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0,
+    13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 101, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 101, 101, 58, 58, 58, 58, 58, 101, 101, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 102, 102, 102, 102, 102,
+    58, 58, 101, 101, 58, 58, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 104, 104, 104, 104, 58, 58, 58, 58, 101, 58,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 58, 58, 58, 101, 58, 58, 58,
+    58, 101, 101, 101, 58, 101, 101, 101, 58, 58, 58, 103, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 101, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 101, 58, 58, 58, 58, 101, 58, 58, 58, 58, 58,
+    101, 58, 58, 58, 58, 101, 101, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 103, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 101, 101, 101, 58, 58, 58, 101, 101, 101, 101, 101,
+    58, 58, 58, 101, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 101, 101, 101, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0,
+    58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 101, 101, 101, 101, 101, 101, 101, 0,
+    58, 58, 58, 58, 58, 58, 101, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 58, 58, 101, 101, 101, 0,
+    0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+};
+
+#endif // CORETEN_UTF8_TABLES_H
@@ -14,18 +14,32 @@ Copyright (c) 2021 Jason Dsouza <@jasmcaus>
 #ifndef CORETEN_VECTOR_H
 #define CORETEN_VECTOR_H
 
+#include <stdlib.h>
+#include <string.h>
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/compilers.h>
+#include <adorad/core/memory.h>
+
+#if defined(CORETEN_COMPILER_MSVC)
+    #include <intrin.h>
+#endif // CORETEN_COMPILER_MSVC
+
 // We require this to be a large number, much more than what you might eventually use for more projects.
 // This is because CSTL is of great use and importance in the Adorad Programming Language (which requires
 // these many tokens during lexing/tokenization). Having a large number reduces the number of `realloc`s.
 #define VEC_INIT_ALLOC_CAP      4096
 #define VECTOR_AT_MACRO(v, i)   ((void *)((char *) (v)->internal.data + (i) * (v)->internal.objsize))
 #define vec_new(obj, nelem)     _vec_new(sizeof(obj), (nelem))
+// Like `vec_new()`, but allocating from `allocator`
+#define vec_new_in(allocator, obj, nelem)   _vec_new_in((allocator), sizeof(obj), (nelem))
 
 typedef struct {
     void** data;      // pointer to the underlying memory
     UInt64 size;      // number of elements currently in `vec`
     UInt64 capacity;  // allocated memory capacity (no. of elements)
     UInt64 objsize;   // size of each element in bytes
+    cstlAllocator* allocator;   // null for the default allocator
 } cstlVectorInternal;
 
 // The actual `cstlVector` struct
@@ -36,6 +50,7 @@ struct cstlVector {
 };
 
 cstlVector* _vec_new(UInt64 objsize, UInt64 capacity);
+cstlVector* _vec_new_in(cstlAllocator* allocator, UInt64 objsize, UInt64 capacity);
 bool __vec_grow(cstlVector* vec, UInt64 capacity);
 void vec_free(cstlVector* vec);
 void* vec_at(cstlVector* vec, UInt64 elem);
@@ -47,5 +62,236 @@ UInt64 vec_cap(cstlVector* vec);
 bool vec_clear(cstlVector* vec);
 bool vec_push(cstlVector* vec, const void* data);
 bool vec_pop(cstlVector* vec);
+bool vec_reserve(cstlVector* vec, UInt64 capacity);
+bool vec_push_n(cstlVector* vec, const void* data, UInt64 n);
+bool vec_extend(cstlVector* vec, cstlVector* other);
+bool vec_shrink_to_fit(cstlVector* vec);
+
+/*
+    Typed vectors
+
+    `VEC(T)` is a vector holding elements of type `T` directly. Unlike `cstlVector`, the element size is known at 
+    compile time, so `tvec_push()` and `tvec_at()` expand to plain (inlined) loads and stores - only growing the 
+    vector calls out to `__tvec_grow()`.
+
+    Since every `VEC(T)` expands to a distinct anonymous struct, name the type once and reuse it:
+        typedef VEC(Token) TokenList;
+
+        TokenList toks;
+        tvec_init(&toks);
+        tvec_push(&toks, tok);
+        Token* first = tvec_at(&toks, 0);
+        tvec_free(&toks);
+
+    `tvec_init_in()` makes the vector allocate from the given `cstlAllocator` (`tvec_init()` uses the default one).
+*/
+#define VEC(T)                  struct { T* data; UInt64 size; UInt64 capacity; cstlAllocator* allocator; }
+
+#define tvec_init(v)            tvec_init_in((v), null)
+#define tvec_init_in(v, a)      ((v)->data = null, (v)->size = 0, (v)->capacity = 0, (v)->allocator = (a))
+// Release the elements (the vector keeps its allocator, and may be reused)
+#define tvec_free(v)                                                                                \
+    (cstl_free((v)->allocator, (v)->data, (v)->capacity * sizeof(*(v)->data)),                        \
+     (v)->data = null, (v)->size = 0, (v)->capacity = 0)
+#define tvec_size(v)            ((v)->size)
+#define tvec_cap(v)             ((v)->capacity)
+#define tvec_is_empty(v)        ((v)->size == 0)
+#define tvec_clear(v)           ((v)->size = 0)
+// Pointer to element `i` (unchecked)
+#define tvec_at(v, i)           ((v)->data + (i))
+#define tvec_begin(v)           ((v)->data)
+#define tvec_end(v)             ((v)->data + (v)->size)
+#define tvec_last(v)            ((v)->data + (v)->size - 1)
+// Remove the last element and return it (by value)
+#define tvec_pop(v)             ((v)->data[--(v)->size])
+// Ensure there is room for at least `n` elements (allocating exactly `n` if it has to grow)
+#define tvec_reserve(v, n)                                                                          \
+    (CORETEN_LIKELY(cast(UInt64)(n) <= (v)->capacity) ? (void)0 :                                     \
+        (void)((v)->data = __tvec_realloc((v)->allocator, (v)->data, &(v)->capacity, sizeof(*(v)->data), (n))))
+// Ensure there is room for at least `n` elements (growing geometrically, for repeated appends)
+#define __tvec_ensure(v, n)                                                                         \
+    (CORETEN_LIKELY(cast(UInt64)(n) <= (v)->capacity) ? (void)0 :                                     \
+        (void)((v)->data = __tvec_grow((v)->allocator, (v)->data, &(v)->capacity, sizeof(*(v)->data), (n))))
+// Append `x` (by value)
+#define tvec_push(v, x)         (__tvec_ensure((v), (v)->size + 1), (void)((v)->data[(v)->size++] = (x)))
+// Append `n` elements from the array `src`
+#define tvec_push_n(v, src, n)                                                                      \
+    (__tvec_ensure((v), (v)->size + (n)),                                                             \
+     memcpy((v)->data + (v)->size, (src), (n) * sizeof(*(v)->data)), (void)((v)->size += (n)))
+// Append all elements of `other` (a vector of the same type)
+#define tvec_extend(v, other)   tvec_push_n((v), (other)->data, (other)->size)
+// Release any unused capacity
+#define tvec_shrink_to_fit(v)                                                                       \
+    ((v)->size == (v)->capacity ? (void)0 :                                                           \
+        (void)((v)->data = __tvec_realloc((v)->allocator, (v)->data, &(v)->capacity, sizeof(*(v)->data), (v)->size)))
+
+// Reallocate `data` to hold exactly `capacity` elements. Updates `*cap` and returns the new pointer
+void* __tvec_realloc(cstlAllocator* allocator, void* data, UInt64* cap, UInt64 objsize, UInt64 capacity);
+// Like `__tvec_realloc()`, but grows geometrically (to at least `capacity` elements)
+void* __tvec_grow(cstlAllocator* allocator, void* data, UInt64* cap, UInt64 objsize, UInt64 capacity);
+
+/*
+    Small vectors
+
+    `SMALLVEC(T, N)` stores its first `N` elements inline, and only moves them to the heap once it overflows. This 
+    suits short lists that are created very often (function arguments, block statements, etc.), most of which never 
+    need an allocation at all.
+
+    The inline buffer is used whenever `heap` is null, so a small vector may be freely copied (or returned by value) 
+    and a zeroed one (from `calloc()`) is a valid, empty vector:
+        typedef SMALLVEC(AstNode*, 4) AstNodeList;
+
+        AstNodeList list;
+        svec_init(&list);
+        svec_push(&list, node);
+        AstNode* first = *svec_at(&list, 0);
+        svec_free(&list);
+*/
+#define SMALLVEC(T, N)                                                                              \
+    struct { T* heap; UInt64 size; UInt64 capacity; cstlAllocator* allocator; T inline_data[N]; }
+
+#define svec_inline_cap(v)      (sizeof((v)->inline_data) / sizeof((v)->inline_data[0]))
+#define svec_init(v)            svec_init_in((v), null)
+#define svec_init_in(v, a)                                                                          \
+    ((v)->heap = null, (v)->size = 0, (v)->capacity = svec_inline_cap(v), (v)->allocator = (a))
+// Release the elements (the vector keeps its allocator, and may be reused)
+#define svec_free(v)                                                                                \
+    ((v)->heap ? cstl_free((v)->allocator, (v)->heap, (v)->capacity * sizeof((v)->inline_data[0])) : (void)0,   \
+     (v)->heap = null, (v)->size = 0, (v)->capacity = svec_inline_cap(v))
+#define svec_size(v)            ((v)->size)
+#define svec_cap(v)             ((v)->capacity)
+#define svec_is_empty(v)        ((v)->size == 0)
+// Are the elements still stored inline?
+#define svec_is_inline(v)       ((v)->heap == null)
+#define svec_clear(v)           ((v)->size = 0)
+#define svec_data(v)            ((v)->heap != null ? (v)->heap : (v)->inline_data)
+// Pointer to element `i` (unchecked)
+#define svec_at(v, i)           (svec_data(v) + (i))
+#define svec_begin(v)           svec_data(v)
+#define svec_end(v)             (svec_data(v) + (v)->size)
+#define svec_last(v)            (svec_data(v) + (v)->size - 1)
+// Remove the last element and return it (by value)
+#define svec_pop(v)             (svec_data(v)[--(v)->size])
+// Ensure there is room for at least `n` elements
+#define svec_reserve(v, n)                                                                          \
+    (CORETEN_LIKELY(cast(UInt64)(n) <= (v)->capacity) ? (void)0 :                                     \
+        (void)((v)->heap = __svec_grow((v)->allocator, (v)->heap, (v)->inline_data, (v)->size,       \
+                                       &(v)->capacity, sizeof((v)->inline_data[0]), svec_inline_cap(v), (n))))
+// Append `x` (by value)
+#define svec_push(v, x)         (svec_reserve((v), (v)->size + 1), (void)(svec_data(v)[(v)->size++] = (x)))
+
+// Grow a small vector to hold at least `capacity` elements. While `heap` is null, `inline_cap` elements fit in 
+// `inline_data`; past that, the elements are moved to a new heap buffer (which is returned).
+void* __svec_grow(cstlAllocator* allocator, void* heap, const void* inline_data, UInt64 size, UInt64* cap, 
+                  UInt64 objsize, UInt64 inline_cap, UInt64 capacity);
+
+/*
+    Segmented vectors
+
+    `SEGVEC(T)` stores its elements in a fixed table of chunks, where every chunk is twice as large as the one before 
+    it. Growing the vector only ever allocates a new chunk - existing elements are never copied or moved, so 
+    pointers to elements stay valid for the lifetime of the vector (even while another thread keeps appending to 
+    it, provided the readers only look at elements they know have been written).
+
+    With a first chunk of `2^s` elements, element `i` lives in chunk `k = log2(i + 2^s) - s`, at offset 
+    `(i + 2^s) - 2^(s + k)`, so indexing is a single bit scan plus a shift and a mask.
+    Reserving space in an empty vector sizes the first chunk to fit (rounded up to a power of 2), so a good size hint
+    keeps everything in a single chunk.
+
+        typedef SEGVEC(Token) TokenList;
+
+        TokenList toks;
+        segvec_init(&toks);
+        segvec_push(&toks, tok);
+        Token* first = segvec_at(&toks, 0);
+        segvec_free(&toks);
+
+    To walk every element without indexing, iterate over the chunks:
+        for(UInt32 k = 0; k < segvec_nchunks(&toks); k++)
+            for(Token* t = segvec_chunk_begin(&toks, k); t < segvec_chunk_end(&toks, k); t++)
+                ...
+*/
+// Enough chunks to hold far more elements than can ever be allocated
+#define CORETEN_SEGVEC_MAX_CHUNKS       48
+// Size of the first chunk (as a power of 2) if none is hinted with `segvec_reserve()`
+#define CORETEN_SEGVEC_DEFAULT_SHIFT    6
+#define CORETEN_SEGVEC_MAX_SHIFT        32
+
+#define SEGVEC(T)                                                                                   \
+    struct {                                                                                        \
+        T* chunks[CORETEN_SEGVEC_MAX_CHUNKS];                                                       \
+        UInt64 size;                                                                                \
+        UInt64 capacity;                                                                            \
+        UInt32 nchunks;                                                                             \
+        UInt32 shift;                                                                               \
+        cstlAllocator* allocator;                                                                   \
+    }
+
+#define segvec_init(v)          segvec_init_in((v), null)
+#define segvec_init_in(v, a)                                                                        \
+    (memset((v)->chunks, 0, sizeof((v)->chunks)), (v)->size = 0, (v)->capacity = 0, (v)->nchunks = 0,  \
+     (v)->shift = CORETEN_SEGVEC_DEFAULT_SHIFT, (v)->allocator = (a))
+// Release every chunk (the vector keeps its allocator, and may be reused)
+#define segvec_free(v)                                                                              \
+    (__segvec_free((v)->allocator, cast(void**)(v)->chunks, (v)->nchunks, (v)->shift, sizeof(*(v)->chunks[0])), \
+     segvec_init_in((v), (v)->allocator))
+#define segvec_size(v)          ((v)->size)
+#define segvec_cap(v)           ((v)->capacity)
+#define segvec_is_empty(v)      ((v)->size == 0)
+// Chunks are kept around for reuse
+#define segvec_clear(v)         ((v)->size = 0)
+// Pointer to element `i` (unchecked). `i` is evaluated twice
+#define segvec_at(v, i)                                                                             \
+    ((v)->chunks[__segvec_chunk((i), (v)->shift)] + __segvec_offset((i), (v)->shift))
+#define segvec_last(v)          segvec_at((v), (v)->size - 1)
+// Ensure there is room for at least `n` elements
+#define segvec_reserve(v, n)                                                                        \
+    (CORETEN_LIKELY(cast(UInt64)(n) <= (v)->capacity) ? (void)0 :                                     \
+        __segvec_reserve((v)->allocator, cast(void**)(v)->chunks, &(v)->nchunks, &(v)->shift,         \
+                         &(v)->capacity, sizeof(*(v)->chunks[0]), (n)))
+// Append `x` (by value)
+#define segvec_push(v, x)                                                                           \
+    (segvec_reserve((v), (v)->size + 1), (void)(*segvec_at((v), (v)->size) = (x)), (void)((v)->size++))
+
+// Chunk-wise iteration
+#define segvec_nchunks(v)       ((v)->nchunks)
+#define segvec_chunk_begin(v, k)    ((v)->chunks[(k)])
+#define segvec_chunk_end(v, k)      ((v)->chunks[(k)] + __segvec_chunk_used((v)->size, (v)->shift, (k)))
+
+// floor(log2(x)) for a non-zero `x`
+static inline UInt32 __segvec_log2(UInt64 x) {
+#if defined(CORETEN_COMPILER_MSVC)
+    unsigned long idx;
+    _BitScanReverse64(&idx, x);
+    return cast(UInt32)idx;
+#else
+    return cast(UInt32)(63 - __builtin_clzll(x));
+#endif // CORETEN_COMPILER_MSVC
+}
+
+// Chunk holding element `i`
+static inline UInt32 __segvec_chunk(UInt64 i, UInt32 shift) {
+    return __segvec_log2(i + (cast(UInt64)1 << shift)) - shift;
+}
+
+// Position of element `i` within its chunk
+static inline UInt64 __segvec_offset(UInt64 i, UInt32 shift) {
+    UInt64 j = i + (cast(UInt64)1 << shift);
+    return j - (cast(UInt64)1 << __segvec_log2(j));
+}
+
+// Number of elements (out of `size`) stored in chunk `k`
+static inline UInt64 __segvec_chunk_used(UInt64 size, UInt32 shift, UInt32 k) {
+    UInt64 first = ((cast(UInt64)1 << k) - 1) << shift;
+    UInt64 len = cast(UInt64)1 << (shift + k);
+    if(size <= first)
+        return 0;
+    return size - first < len ? size - first : len;
+}
+
+// Allocate chunks until there is room for at least `capacity` elements
+void __segvec_reserve(cstlAllocator* allocator, void** chunks, UInt32* nchunks, UInt32* shift, UInt64* cap, 
+                      UInt64 objsize, UInt64 capacity);
+void __segvec_free(cstlAllocator* allocator, void** chunks, UInt32 nchunks, UInt32 shift, UInt64 objsize);
 
 #endif // CORETEN_VECTOR_H
@@ -0,0 +1,132 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021 Jason Dsouza <@jasmcaus>
+*/
+
+
+#ifndef CORETEN_VFS_H
+#define CORETEN_VFS_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/hashmap.h>
+
+/*
+    Virtual file system
+
+    `cstlVfs` sits between the compiler and the disk. Every path handed to it is canonicalized and interned, so 
+    it's identified by a small integer (`cstlVfsPath`) from then on: two spellings of the same path 
+    ("src/./a.ad", "src//b/../a.ad") get the same id, comparing paths is comparing ids, and the dirname/basename
+    of a path never allocate.
+
+        cstlVfs* vfs = vfs_new(allocator);
+        cstlVfsPath dir = vfs_intern(vfs, "lib/std");
+        cstlVfsPath mod = vfs_join(vfs, dir, "io.ad");
+        if(vfs_is_file(vfs, mod)) {
+            UInt64 length;
+            const char* source = vfs_read(vfs, mod, &length);
+            ...
+        }
+
+    Canonicalization is purely lexical: relative paths are resolved against the working directory at the time of
+    `vfs_new()`, "." and empty components are dropped and ".." removes the previous component. Symlinks are not 
+    followed.
+
+    The results of `stat()` (and the contents returned by `vfs_read()`) are cached per path until they're 
+    invalidated with `vfs_invalidate()` or `vfs_invalidate_all()` - the latter is O(1), so it's cheap to call 
+    whenever the files on disk may have changed (at the start of every build, for instance).
+
+    An overlay replaces a file's contents with an in-memory buffer (an editor's unsaved changes, say). The file 
+    then exists as far as the VFS is concerned, whether or not it's on disk, and is never read from disk.
+
+    A `cstlVfs` is not thread-safe.
+*/
+typedef UInt32 cstlVfsPath;
+
+// Never returned for a valid path
+#define VFS_INVALID_PATH    cast(cstlVfsPath)0
+
+typedef struct cstlVfsStat {
+    bool exists;
+    bool is_dir;
+    UInt64 size;            // in bytes
+    Int64 mtime;            // last modification (seconds since the epoch). 0 for overlays
+} cstlVfsStat;
+
+typedef struct cstlVfsEntry {
+    char* path;             // canonical (interned, null-terminated)
+    UInt32 length;
+    UInt32 basename;        // offset of the basename in `path`
+    cstlVfsPath dirname;    // VFS_INVALID_PATH until first asked for
+    UInt32 generation;      // `stat` and `contents` are valid if this matches the VFS's generation
+    cstlVfsStat stat;
+    bool has_stat;
+    char* contents;         // cached file contents (not for overlays). Null until read
+    UInt64 contents_length;
+    char* overlay;          // in-memory contents (null-terminated), if the path has an overlay
+    UInt64 overlay_length;
+} cstlVfsEntry;
+
+typedef struct cstlVfs {
+    cstlAllocator* allocator;
+    cstlArena* strings;     // interned paths
+    cstlHashMap* ids;       // canonical path (char*) -> cstlVfsPath
+    cstlVfsEntry* entries;  // indexed by cstlVfsPath (entry 0 is unused)
+    UInt32 nentries;
+    UInt32 capacity;
+    UInt32 generation;
+    char* cwd;              // canonical working directory
+    UInt64 cwd_length;
+    char* scratch;          // canonicalization buffer
+    UInt64 scratch_capacity;
+    UInt64 nsyscalls;       // `stat()`s and reads that went to the disk
+} cstlVfs;
+
+cstlVfs* vfs_new(cstlAllocator* allocator);
+void vfs_free(cstlVfs* vfs);
+
+// Intern (the canonical form of) `path`
+cstlVfsPath vfs_intern(cstlVfs* vfs, const char* path);
+cstlVfsPath vfs_intern_n(cstlVfs* vfs, const char* path, UInt64 length);
+// Intern `name` (a relative path) joined onto the directory `dir`. An absolute `name` ignores `dir`
+cstlVfsPath vfs_join(cstlVfs* vfs, cstlVfsPath dir, const char* name);
+// The parent directory of `path` (the root is its own parent)
+cstlVfsPath vfs_dirname(cstlVfs* vfs, cstlVfsPath path);
+
+// The canonical path. Valid until `vfs_free()`
+const char* vfs_path(cstlVfs* vfs, cstlVfsPath path);
+UInt64 vfs_path_length(cstlVfs* vfs, cstlVfsPath path);
+// The last component of `path` (a suffix of `vfs_path()`, so it doesn't allocate)
+const char* vfs_basename(cstlVfs* vfs, cstlVfsPath path);
+// The extension of the basename, including the '.' ("" if it has none)
+const char* vfs_extname(cstlVfs* vfs, cstlVfsPath path);
+
+// Cached `stat()`. Overlays count as regular files
+cstlVfsStat vfs_stat(cstlVfs* vfs, cstlVfsPath path);
+bool vfs_exists(cstlVfs* vfs, cstlVfsPath path);
+bool vfs_is_file(cstlVfs* vfs, cstlVfsPath path);
+bool vfs_is_dir(cstlVfs* vfs, cstlVfsPath path);
+// Forget the cached stat and contents of `path`
+void vfs_invalidate(cstlVfs* vfs, cstlVfsPath path);
+// Forget every cached stat and contents
+void vfs_invalidate_all(cstlVfs* vfs);
+
+// The (null-terminated) contents of `path`: its overlay if it has one, otherwise the file on disk (read once and 
+// cached). Returns null if the file can't be read. Valid until the path is invalidated or its overlay changes
+const char* vfs_read(cstlVfs* vfs, cstlVfsPath path, UInt64* length);
+// Replace the contents of `path` with a copy of the first `length` bytes of `contents`
+void vfs_set_overlay(cstlVfs* vfs, cstlVfsPath path, const char* contents, UInt64 length);
+// Go back to the file on disk
+void vfs_remove_overlay(cstlVfs* vfs, cstlVfsPath path);
+bool vfs_has_overlay(cstlVfs* vfs, cstlVfsPath path);
+
+#endif // CORETEN_VFS_H
@@ -1,29 +1,211 @@
 #include <adorad/adorad.h>
 
+// The benchmarked results end up here, so the compiler can't drop the work
+static volatile UInt64 bench_sink = 0;
+
+// Run every phase over `file` `runs` times. Each run lexes into a fresh arena, so allocation costs are included
+static void bench_file(cstlBench* bench, int runs, File* file) {
+    UInt64 length = file->length;
+    printf("Benchmarking %s...\n", file->full_path);
+    for(int run = 0; run < runs; run++) {
+        UInt64 hash = 0;
+        BENCH_SCOPE(bench, "hash_fast64", length, 0) {
+            hash = hash_fast64(file->contents, cast(Ll)length);
+        }
+        bool valid = false;
+        BENCH_SCOPE(bench, "utf8_validate", length, 0) {
+            valid = simd_utf8_validate(file->contents, length);
+        }
+        bench_sink += hash + valid;
+
+        cstlArena* arena = arena_new(0);
+        Lexer* lexer = lexer_init(arena_allocator(arena), file->contents, file->full_path);
+        BENCH_SCOPE(bench, "lex", length, segvec_size(lexer->toklist)) {
+            lexer_lex(lexer);
+        }
+        // The parser doesn't build a tree yet, so this is its setup plus one pass over the token stream
+        UInt64 nidentifiers = 0;
+        BENCH_SCOPE(bench, "parse", length, segvec_size(lexer->toklist)) {
+            Parser* parser = parser_init(lexer);
+            for(UInt64 i = 0; i < parser->num_tokens; i++)
+                nidentifiers += segvec_at(parser->toklist, i)->kind == IDENTIFIER;
+        }
+        lexer_free(lexer);
+        arena_free(arena);
+        bench_sink += nidentifiers;
+    }
+}
+
 int main(int argc, const char* const argv[]) {
+    // `--mem-stats` routes the allocations of each compilation unit through a tracking allocator and prints a 
+    // per-phase report at the end.
+    // `-ftime-trace[=file]` profiles each phase, writing a Chrome trace (to adorad-trace.json by default) and 
+    // printing a summary at the end.
+    // `--stats[=json]` prints the event counters (tokens by kind, AST nodes, vector regrows, ...) at the end.
+    // `--bench[=runs]` lexes and walks every source `runs` times (5 by default) instead of dumping the tokens, and 
+    // reports the time and hardware counters (IPC, cycles per byte and per token, cache misses, ...) per phase.
+    // Any other arguments are source files or directories to lex (by default, test/LexerDemo.ad)
+    bool mem_stats = false;
+    const char* trace_file = null;
+    bool stats = false;
+    bool stats_json = false;
+    int bench_runs = 0;
+    int nsources = 0;
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--mem-stats") == 0)
+            mem_stats = true;
+        else if(strcmp(argv[i], "-ftime-trace") == 0)
+            trace_file = "adorad-trace.json";
+        else if(strncmp(argv[i], "-ftime-trace=", 13) == 0)
+            trace_file = argv[i] + 13;
+        else if(strcmp(argv[i], "--stats") == 0)
+            stats = true;
+        else if(strcmp(argv[i], "--stats=json") == 0)
+            stats = stats_json = true;
+        else if(strcmp(argv[i], "--bench") == 0)
+            bench_runs = 5;
+        else if(strncmp(argv[i], "--bench=", 8) == 0)
+            bench_runs = atoi(argv[i] + 8) > 0 ? atoi(argv[i] + 8) : 1;
+        else
+            nsources++;
+    }
+    profile_enable(trace_file != null);
+    if(stats) {
+        lexer_register_stats();
+        ast_register_stats();
+    }
+
+    // The driver's own data (the loader and the files it reads, the output buffer) lives in `arena` for the whole 
+    // run. Everything a compilation unit allocates (tokens, the parser, AST nodes) comes from `unit`, which is reset 
+    // after each file, so memory use doesn't grow with the number of files
+    cstlArena* arena = arena_new(0);
+    cstlAllocator* allocator = arena_allocator(arena);
+    cstlArena* unit = arena_new(0);
+    cstlAllocator* unit_allocator = arena_allocator(unit);
+    cstlTrackingAllocator* tracker = null;
+    if(mem_stats) {
+        tracker = tracking_allocator_new(unit_allocator, 0);
+        unit_allocator = tracking_allocator(tracker);
+    }
+
+    // The sources are read in the background; each one is lexed as soon as it has arrived
+    cstlFileLoader* loader = file_loader_new(allocator, 0, FileLoaderBackendAuto);
+    // Directories are searched (in parallel) for .ad files
+    const char* include[] = {"*.ad"};
+    cstlDirWalkOptions walk_options = {include, 1, null, 0, 0, false};
+    profile_begin("discover", null);
+    for(int i = 1; i < argc; i++) {
+        if(argv[i][0] == '-')
+            continue;
+        if(!os_is_dir(argv[i])) {
+            file_loader_add(loader, argv[i]);
+            continue;
+        }
+        cstlDirWalk* walk = os_walk_dir(allocator, argv[i], &walk_options);
+        for(UInt64 j = 0; j < walk->npaths; j++)
+            file_loader_add(loader, walk->paths[j]);
+        os_walk_free(walk);
+    }
     // The CWD for this executable is in ".../build/bin"
-	char* buffer = readFile("../../test/LexerDemo.ad");
-	Lexer* lexer = lexer_init(buffer, "test/LexerDemo.ad"); 
-
-    clock_t st, end;
-    printf("Lexing beginning...\n");
-    st = now();
-    int count = 0;
-    lexer_lex(lexer);
-    end = now();
-    printf("Lexing finished...\n");
-    double total = duration(st, end);
-
-    printf("\033[1;32m\nTokens Vector: \033[0m\n");
-    for(UInt64 i=0; i < vec_size(lexer->toklist); i++) {
-        Token* tok = vec_at(lexer->toklist, i);
-        printf("TOKEN(%s, \"%s\")\n", token_to_buff(tok->kind)->data, tok->value->data);
-    } 
-    printf("\nTotal time = %lfs\n", total);
-
-    printf("Number of tokens = %d\n", vec_size(lexer->toklist));
-    printf("Total allocated memory (in bytes) = %d\n", lexer->toklist->internal.objsize * vec_size(lexer->toklist));
+    if(nsources == 0)
+        file_loader_add(loader, "../../test/LexerDemo.ad");
+    profile_end();
+
+    // Token dumps go through a buffered writer: one `printf()` per token is syscall-bound on large inputs
+    cstlWriter* out = writer_new_file(allocator, stdout, 0);
+    cstlBench* bench = bench_runs > 0 ? bench_new(true) : null;
+    if(bench)
+        bench_set_unit(bench, "tok");
+    UInt64 total_ns = 0;
+    UInt64 ntokens = 0;
+    UInt64 allocated = 0;
+    for(;;) {
+        profile_begin("read", null);
+        File* file = file_loader_next(loader);
+        profile_end();
+        if(!file)
+            break;
+        if(file->error) {
+            cstlColouredPrintf(CORETEN_COLOUR_ERROR, "Could not read %s: %s\n", file->full_path, strerror(file->error));
+            continue;
+        }
+        if(bench) {
+            bench_file(bench, bench_runs, file);
+            continue;
+        }
+        if(tracker)
+            tracking_allocator_set_phase(tracker, "lex");
+        Lexer* lexer = lexer_init(unit_allocator, file->contents, file->full_path);
+
+        printf("Lexing %s...\n", file->full_path);
+        TIME_BLOCK_ACCUM(total_ns) {
+            lexer_lex(lexer);
+        }
+        printf("Lexing finished...\n");
+
+        PROFILE_SCOPE("dump", file->full_path) {
+            writer_str(out, "\033[1;32m\nTokens Vector: \033[0m\n");
+            for(UInt64 i=0; i < segvec_size(lexer->toklist); i++) {
+                Token* tok = segvec_at(lexer->toklist, i);
+                writer_str(out, "TOKEN(");
+                writer_str(out, token_to_str(tok->kind));
+                writer_str(out, ", \"");
+                writer_str(out, tok->value->data);
+                writer_str(out, "\")\n");
+            } 
+            writer_flush(out);
+        }
+        ntokens += segvec_size(lexer->toklist);
+
+        // The parser doesn't build a tree yet, so it's only run when something is measuring it
+        if(tracker || trace_file || stats) {
+            if(tracker)
+                tracking_allocator_set_phase(tracker, "parse");
+            parser_init(lexer);
+        }
+        lexer_free(lexer);
+        allocated += unit->total_used;
+        arena_reset(unit);
+        if(tracker)
+            tracking_allocator_release_all(tracker);
+    }
+    if(bench) {
+        printf("\n");
+        bench_write_report(bench, stdout);
+        bench_free(bench);
+    }
+    printf("\nTotal time = %lfs\n", clock_seconds(0, total_ns));
+
+    printf("Number of tokens = %llu\n", cast(unsigned long long)ntokens);
+    printf("Total allocated memory (in bytes) = %llu\n", cast(unsigned long long)(allocated + arena->total_used));
+
+    if(tracker) {
+        printf("\n");
+        tracking_allocator_report(tracker, stdout);
+    }
+    if(trace_file) {
+        FILE* trace = fopen(trace_file, "wb");
+        if(trace) {
+            profile_write_chrome_trace(trace);
+            fclose(trace);
+        } else {
+            cstlColouredPrintf(CORETEN_COLOUR_ERROR, "Could not write %s\n", trace_file);
+        }
+        printf("\n");
+        profile_write_summary(stdout);
+    }
+    if(stats) {
+        printf("\n");
+        if(stats_json)
+            stats_write_json(stdout);
+        else
+            stats_write_table(stdout);
+    }
     
-    lexer_free(lexer);
+    writer_free(out);
+    file_loader_free(loader);
+    tracking_allocator_free(tracker);
+    arena_free(unit);
+    arena_free(arena);
     return 0; 
-}
\ No newline at end of file
+}
@@ -4,18 +4,22 @@ TAU_MAIN()
  
 TEST(Lexer, Init) {
     char* buffer = "0123456789abcdefghijklmnopqrstuvwxyz";
-    Lexer* lexer = lexer_init(buffer, null);
+    cstlArena* arena = arena_new(0);
+    Lexer* lexer = lexer_init(arena_allocator(arena), buffer, null);
 
+    CHECK(lexer->allocator == arena_allocator(arena));
     CHECK_STRNE(lexer->buffer->data, "");
     CHECK_EQ(lexer->buffer->len, strlen(buffer));
-    CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-    CHECK_EQ(vec_size(lexer->toklist), 0);
+    CHECK_GE(segvec_cap(lexer->toklist), TOKENLIST_ESTIMATE_CAPACITY(strlen(buffer)));
+    CHECK_EQ(segvec_nchunks(lexer->toklist), 1);
+    CHECK_EQ(segvec_size(lexer->toklist), 0);
     CHECK_EQ(lexer->offset, 0);
     CHECK_EQ(lexer->loc->line, 1);
     CHECK_EQ(lexer->loc->col, 1);
     CHECK_STREQ(lexer->loc->fname->data, "");
 
-    free(lexer);
+    lexer_free(lexer);
+    arena_free(arena);
 }
 
 // // Without newline in buffer
@@ -26,8 +30,8 @@ TEST(Lexer, Init) {
 //     for(UInt32 i=0; i < strlen(buffer); i++) {
 //         CHECK_STREQ(lexer->buffer->data, buffer);
 //         CHECK_EQ(lexer_advance(lexer), lexer->buffer->data[lexer->offset-1]);
-//         CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//         CHECK_EQ(vec_size(lexer->toklist), 0);
+//         CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//         CHECK_EQ(tvec_size(lexer->toklist), 0);
 //         CHECK_EQ(lexer->offset, i+1);
 //         CHECK_EQ(lexer->loc->col, i+2);
 //         CHECK_EQ(lexer->loc->line, 1);
@@ -42,8 +46,8 @@ TEST(Lexer, Init) {
 //     CHECK_STREQ(lexer->buffer->data, buffer);
 //     CHECK_EQ(lexer_advance(lexer), 'a');
 //     CHECK_EQ(lexer->offset, 1);
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->loc->col, 2);
 //     CHECK_EQ(lexer->loc->line, 1);
 
@@ -51,8 +55,8 @@ TEST(Lexer, Init) {
 //     CHECK_STREQ(lexer->buffer->data, buffer);
 //     CHECK_EQ(lexer_advance(lexer), '\n');
 //     CHECK_EQ(lexer->offset, 2);
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->loc->col, 3);
 //     CHECK_EQ(lexer->loc->line, 1);
 // }
@@ -64,8 +68,8 @@ TEST(Lexer, Init) {
 //     // Go ahead 4 chars
 //     char e = lexer_advancen(lexer, 4); // should be 'e'
 //     CHECK_EQ(e, 'e');
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 4);
 //     CHECK_EQ(lexer->loc->col, 5);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -73,8 +77,8 @@ TEST(Lexer, Init) {
 //     // Go ahead 1 char
 //     char f = lexer_advancen(lexer, 1); // 'f'
 //     CHECK_EQ(f, 'f');
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 5);
 //     CHECK_EQ(lexer->loc->col, 6);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -82,8 +86,8 @@ TEST(Lexer, Init) {
 //     // Go ahead 3 chars
 //     char i = lexer_advancen(lexer, 3); // 'i'
 //     CHECK_EQ(i, 'i');
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 8);
 //     CHECK_EQ(lexer->loc->col, 9);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -91,8 +95,8 @@ TEST(Lexer, Init) {
 //     // Go ahead 7 chars
 //     char p = lexer_advancen(lexer, 7); // 'p'
 //     CHECK_EQ(p, 'p');
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 15);
 //     CHECK_EQ(lexer->loc->col, 16);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -100,8 +104,8 @@ TEST(Lexer, Init) {
 //     // Go ahead 10 chars
 //     char z = lexer_advancen(lexer, 10); // 'z'
 //     CHECK_EQ(z, 'z');
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 25);
 //     CHECK_EQ(lexer->loc->col, 26);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -109,8 +113,8 @@ TEST(Lexer, Init) {
 //     // Go ahead 10 chars
 //     char nine = lexer_advancen(lexer, 10); // '9'
 //     CHECK_EQ(nine, '9');
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 35);
 //     CHECK_EQ(lexer->loc->col, 36);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -119,8 +123,8 @@ TEST(Lexer, Init) {
 //     char eof1 = lexer_advancen(lexer, 1);
 //     CHECK_EQ(eof1, nullchar);
 //     // Options should remain the same
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 35);
 //     CHECK_EQ(lexer->loc->col, 36);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -129,8 +133,8 @@ TEST(Lexer, Init) {
 //     char eof2 = lexer_advancen(lexer, 4);
 //     CHECK_EQ(eof2, nullchar);
 //     // Options should remain the same
-//     CHECK_EQ(vec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
-//     CHECK_EQ(vec_size(lexer->toklist), 0);
+//     CHECK_EQ(tvec_cap(lexer->toklist), TOKENLIST_ALLOC_CAPACITY);
+//     CHECK_EQ(tvec_size(lexer->toklist), 0);
 //     CHECK_EQ(lexer->offset, 35);
 //     CHECK_EQ(lexer->loc->col, 36);
 //     CHECK_EQ(lexer->loc->line, 1);
@@ -225,7 +229,7 @@ TEST(Lexer, Init) {
 // //     // Call lexer_lex()
 // //     lexer_lex(lexer);
 
-// //     CHECK_EQ(vec_size(lexer->toklist), nbin_digits + 1);
+// //     CHECK_EQ(tvec_size(lexer->toklist), nbin_digits + 1);
 // //     CHECK_EQ(lta->cap, nbin_digits);
 
 // //     for(int i = 0; i<nbin_digits; i++) {
@@ -0,0 +1,34 @@
+// Helpers shared by the core tests. Included after AdoradInternalTests.h
+#ifndef ADORAD_TEST_CORE_HELPERS_H
+#define ADORAD_TEST_CORE_HELPERS_H
+
+// Busy-wait for `ns` nanoseconds (sleeping would hand the time to other threads)
+static inline void spin_ns(UInt64 ns) {
+    UInt64 start = clock_now_ns();
+    while(clock_now_ns() - start < ns)
+        ;
+}
+
+// Deterministic pseudo-random bytes (any value, including 0)
+static inline void fill_random(void* data, UInt64 n, UInt32 seed) {
+    UInt8* bytes = cast(UInt8*)data;
+    for(UInt64 i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bytes[i] = cast(UInt8)(seed >> 16);
+    }
+}
+
+// Everything written to `file` so far, null-terminated (free it with `free()`). `length` may be null
+static inline char* read_back(FILE* file, UInt64* length) {
+    fflush(file);
+    fseek(file, 0, SEEK_END);
+    UInt64 size = cast(UInt64)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* data = cast(char*)calloc(size + 1, 1);
+    size = fread(data, 1, size, file);
+    if(length)
+        *length = size;
+    return data;
+}
+
+#endif // ADORAD_TEST_CORE_HELPERS_H
@@ -0,0 +1,103 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include "helpers.h"
+TAU_MAIN()
+
+static UInt64 busy_loop(UInt64 n) {
+    volatile UInt64 sum = 0;
+    for(UInt64 i = 0; i < n; i++)
+        sum += i * i;
+    return sum;
+}
+
+TEST(Perf, counters_or_reason) {
+    cstlPerfCounters* counters = perf_counters_new(true);
+    cstlPerfSample sample;
+    perf_counters_start(counters);
+    busy_loop(1000000);
+    perf_counters_stop(counters, &sample);
+    CHECK_GT(sample.wall_ns, 0);
+    // Either something was counted, or we are told why not
+    if(perf_counters_available(counters)) {
+        CHECK_EQ(sample.valid & ~counters->opened, 0);
+        if(sample.valid & PERF_EVENT_BIT(PerfInstructions))
+            CHECK_GT(sample.values[PerfInstructions], 1000000);
+    } else {
+        CHECK_EQ(sample.valid, 0);
+        CHECK_NE(perf_counters_error(counters)[0], nullchar);
+    }
+    perf_counters_free(counters);
+}
+
+TEST(Perf, disabled) {
+    cstlPerfCounters* counters = perf_counters_new(false);
+    CHECK_FALSE(perf_counters_available(counters));
+    cstlPerfSample sample;
+    perf_counters_start(counters);
+    busy_loop(1000);
+    perf_counters_stop(counters, &sample);
+    CHECK_EQ(sample.valid, 0);
+    CHECK_GT(sample.wall_ns, 0);
+    perf_counters_free(counters);
+    CHECK_STREQ(perf_event_name(PerfLLCMisses), "LLC-misses");
+}
+
+TEST(Bench, regions) {
+    cstlBench* bench = bench_new(true);
+    for(int run = 0; run < 3; run++) {
+        BENCH_SCOPE(bench, "small", 1000, 10) {
+            busy_loop(1000);
+        }
+        UInt64 items = 0;
+        BENCH_SCOPE(bench, "large", 0, items) {
+            busy_loop(100000);
+            items = 50;
+        }
+    }
+    CHECK_NULL(bench_result(bench, "missing"));
+    const cstlBenchResult* small = bench_result(bench, "small");
+    REQUIRE(small != null);
+    CHECK_EQ(small->runs, 3);
+    CHECK_EQ(small->bytes, 3000);
+    CHECK_EQ(small->items, 30);
+    CHECK_LE(small->min_ns * 3, small->total.wall_ns);
+    // Evaluated after the block
+    CHECK_EQ(bench_result(bench, "large")->items, 150);
+    bench_free(bench);
+}
+
+TEST(Bench, report_without_counters) {
+    cstlBench* bench = bench_new(false);
+    bench_set_unit(bench, "tok");
+    BENCH_SCOPE(bench, "lex", 4096, 512) {
+        busy_loop(10000);
+    }
+    FILE* file = tmpfile();
+    REQUIRE(file != null);
+    bench_write_report(bench, file);
+    char* report = read_back(file, null);
+    fclose(file);
+    CHECK(strstr(report, "no hardware counters") != null);
+    CHECK(strstr(report, "ns/tok") != null);
+    CHECK(strstr(report, "lex") != null);
+    CHECK(strstr(report, "IPC") == null);
+    free(report);
+    bench_free(bench);
+}
+
+TEST(Bench, report_with_counters) {
+    cstlBench* bench = bench_new(true);
+    BENCH_SCOPE(bench, "loop", 4096, 0) {
+        busy_loop(100000);
+    }
+    FILE* file = tmpfile();
+    REQUIRE(file != null);
+    bench_write_report(bench, file);
+    char* report = read_back(file, null);
+    fclose(file);
+    CHECK(strstr(report, "loop") != null);
+    // The counter columns are only there when counters could be opened
+    CHECK_EQ(strstr(report, "IPC") != null, perf_counters_available(bench->counters));
+    free(report);
+    bench_free(bench);
+}
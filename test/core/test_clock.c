@@ -0,0 +1,60 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include "helpers.h"
+
+TAU_MAIN()
+
+TEST(Clock, monotonic) {
+    UInt64 prev = clock_now_ns();
+    bool ok = true;
+    for(int i = 0; i < 100000; i++) {
+        UInt64 t = clock_now_ns();
+        ok = ok && t >= prev;
+        prev = t;
+    }
+    CHECK_TRUE(ok);
+
+    UInt64 start = clock_now_ns();
+    spin_ns(2000000);
+    double seconds = clock_seconds(start, clock_now_ns());
+    CHECK_GE(seconds, 0.002);
+    CHECK_LT(seconds, 1.0);
+}
+
+TEST(Clock, now_and_duration) {
+    double start = now();
+    spin_ns(1000000);
+    double elapsed = duration(start, now());
+    CHECK_GE(elapsed, 0.001);
+    CHECK_LT(elapsed, 1.0);
+}
+
+TEST(Clock, cycles) {
+    double rate = clock_cycles_per_ns();
+    CHECK_GT(rate, 0.0);
+    // Calibrated once
+    CHECK_EQ(clock_cycles_per_ns(), rate);
+
+    UInt64 start = clock_cycles();
+    spin_ns(2000000);
+    UInt64 ns = clock_cycles_to_ns(clock_cycles() - start);
+    // Generous bounds: the machine may be busy
+    CHECK_GE(ns, 1000000);
+    CHECK_LT(ns, 1000000000);
+}
+
+TEST(Clock, time_block_accum) {
+    UInt64 total = 0;
+    for(int i = 0; i < 3; i++) {
+        TIME_BLOCK_ACCUM(total) {
+            spin_ns(500000);
+        }
+    }
+    CHECK_GE(total, 1500000);
+
+    int runs = 0;
+    TIME_BLOCK_ACCUM(total) {
+        runs++;
+    }
+    CHECK_EQ(runs, 1);
+}
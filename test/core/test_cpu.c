@@ -0,0 +1,73 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Cpu, detect) {
+    UInt32 features = cpu_features();
+#if defined(CORETEN_CPU_X86) && defined(CORETEN_ARCH_64BIT)
+    // SSE2 is part of the x86-64 baseline
+    CHECK_TRUE(cpu_has(CpuFeatureSSE2));
+#endif // CORETEN_CPU_X86
+    // Anything the compiler was told to target must be there
+#if defined(__AVX2__)
+    CHECK_TRUE(cpu_has(CpuFeatureAVX2 | CpuFeatureAVX));
+#endif // __AVX2__
+#if defined(__SSE4_2__)
+    CHECK_TRUE(cpu_has(CpuFeatureSSE42));
+#endif // __SSE4_2__
+    CHECK_EQ(cpu_features(), features);
+    CHECK_TRUE(cpu_has(0));
+}
+
+TEST(Cpu, mask) {
+    UInt32 features = cpu_features();
+    cpu_set_features_mask(0);
+    CHECK_EQ(cpu_features(), 0);
+    CHECK_FALSE(cpu_has(CpuFeatureSSE2));
+
+    cpu_set_features_mask(CpuFeatureSSE2 | CpuFeatureNEON);
+    CHECK_EQ(cpu_features(), features & (CpuFeatureSSE2 | CpuFeatureNEON));
+
+    cpu_set_features_mask(CpuFeatureAll);
+    CHECK_EQ(cpu_features(), features);
+}
+
+typedef struct Redispatch {
+    cstlAtomic32 stop;
+    bool same_results;
+} Redispatch;
+
+static int call_kernels(void* arg) {
+    Redispatch* state = cast(Redispatch*)arg;
+    char text[300];
+    for(int i = 0; i < 300; i++)
+        text[i] = cast(char)('a' + i % 26);
+    text[299] = nullchar;
+    UInt64 expected = hash_fast64(text, 299);
+    state->same_results = true;
+    while(!atomic32_load(&state->stop, MemoryOrderAcquire)) {
+        state->same_results &= simd_strlen(text) == 299;
+        state->same_results &= simd_utf8_validate(text, 299);
+        state->same_results &= hash_fast64(text, 299) == expected;
+    }
+    return 0;
+}
+
+// Whichever kernel a caller picks up mid-switch, it gives the same answer
+TEST(Cpu, mask_while_in_use) {
+    Redispatch state = {0};
+    cstlThread thread;
+    REQUIRE_TRUE(thread_create(&thread, call_kernels, &state));
+    for(int i = 0; i < 200; i++)
+        cpu_set_features_mask(i % 2 ? CpuFeatureAll : 0);
+    atomic32_store(&state.stop, 1, MemoryOrderRelease);
+    thread_join(&thread);
+    CHECK_TRUE(state.same_results);
+    cpu_set_features_mask(CpuFeatureAll);
+}
+
+TEST(Cpu, feature_name) {
+    CHECK_STREQ(cpu_feature_name(CpuFeatureSSE2), "sse2");
+    CHECK_STREQ(cpu_feature_name(CpuFeatureAVX2), "avx2");
+    CHECK_STREQ(cpu_feature_name(CpuFeatureNEON), "neon");
+}
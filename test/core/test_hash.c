@@ -0,0 +1,166 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include <adorad/core/hash_tables.h>
+#include "helpers.h"
+TAU_MAIN()
+
+TEST(Hash, crc32_check_values) {
+    // The standard "check" values for the 9-byte input "123456789"
+    CHECK_EQ(hash_crc32("123456789", 9), 0xCBF43926);
+    CHECK_EQ(hash_crc32c("123456789", 9), 0xE3069283);
+    CHECK_EQ(__hash_crc32c_scalar("123456789", 9), 0xE3069283);
+    CHECK_EQ(hash_crc32("", 0), 0);
+    CHECK_EQ(hash_crc32c("", 0), 0);
+}
+
+TEST(Hash, crc_slicing_matches_bytewise) {
+    UInt8 data[1031];
+    fill_random(data, sizeof(data), 7);
+
+    // Reference: the bytewise update, built from the first slice of each table
+    for(Ll len = 0; len <= cast(Ll)sizeof(data); len += 13) {
+        UInt32 crc32 = ~0U;
+        UInt32 crc32c = ~0U;
+        UInt64 crc64 = ~0ULL;
+        for(Ll i = 0; i < len; i++) {
+            crc32 = (crc32 >> 8) ^ CORETEN__CRC32_TABLE[0][(crc32 ^ data[i]) & 0xff];
+            crc32c = (crc32c >> 8) ^ CORETEN__CRC32C_TABLE[0][(crc32c ^ data[i]) & 0xff];
+            crc64 = (crc64 >> 8) ^ CORETEN__CRC64_TABLE[0][(crc64 ^ data[i]) & 0xff];
+        }
+        CHECK_EQ(hash_crc32(data, len), ~crc32);
+        CHECK_EQ(hash_crc32c(data, len), ~crc32c);
+        CHECK_EQ(__hash_crc32c_scalar(data, len), ~crc32c);
+        CHECK_EQ(hash_crc64(data, len), ~crc64);
+    }
+    // Unaligned starts
+    for(int offset = 1; offset < 8; offset++)
+        CHECK_EQ(hash_crc32c(data + offset, 500), __hash_crc32c_scalar(data + offset, 500));
+}
+
+TEST(Hash, fast64_simd_matches_scalar) {
+    UInt8 data[5000];
+    fill_random(data, sizeof(data), 42);
+    for(Ll len = 0; len <= cast(Ll)sizeof(data); len += (len < 300 ? 1 : 61)) {
+        CHECK_EQ(hash_fast64(data, len), __hash_fast64_scalar(data, len, 0));
+        CHECK_EQ(hash_fast64_seed(data, len, 0x1234), __hash_fast64_scalar(data, len, 0x1234));
+    }
+}
+
+TEST(Hash, fast64_distribution) {
+    UInt8 data[2048];
+    fill_random(data, sizeof(data), 3);
+
+    // Seeds and lengths change the result
+    CHECK_NE(hash_fast64_seed(data, 100, 1), hash_fast64_seed(data, 100, 2));
+    CHECK_NE(hash_fast64(data, 100), hash_fast64(data, 101));
+    CHECK_NE(hash_fast64("", 0), hash_fast64_seed("", 0, 1));
+
+    // Flipping any single bit flips roughly half of the output bits (short and long paths)
+    Ll lengths[] = { 3, 8, 16, 40, 200, 2048 };
+    for(int l = 0; l < 6; l++) {
+        Ll len = lengths[l];
+        UInt64 base = hash_fast64(data, len);
+        UInt64 total = 0, nflips = 0;
+        for(Ll bit = 0; bit < len * 8; bit += (len > 64 ? 7 : 1)) {
+            data[bit / 8] ^= cast(UInt8)(1 << (bit % 8));
+            UInt64 flipped = base ^ hash_fast64(data, len);
+            data[bit / 8] ^= cast(UInt8)(1 << (bit % 8));
+            CHECK_NE(flipped, 0);
+            total += __simd_popcount64(flipped);
+            nflips++;
+        }
+        double average = cast(double)total / cast(double)nflips;
+        CHECK_GT(average, 24.0);
+        CHECK_LT(average, 40.0);
+    }
+}
+
+// Feed `data` through the streaming states in pieces of `step` bytes. Does every hash match the one-shot one?
+static bool streaming_matches(UInt8 const* data, Ll len, Ll step) {
+    cstlHashCrc32State crc32, crc32c;
+    cstlHashCrc64State crc64;
+    cstlHashMurmur64State murmur;
+    cstlHashFast64State fast;
+    hash_crc32_init(&crc32);
+    hash_crc32c_init(&crc32c);
+    hash_crc64_init(&crc64);
+    hash_murmur64_init(&murmur, 0x9747b28c, cast(UInt64)len);
+    hash_fast64_init(&fast, 99);
+
+    for(Ll i = 0; i < len; i += step) {
+        Ll n = len - i < step ? len - i : step;
+        hash_crc32_update(&crc32, data + i, n);
+        hash_crc32c_update(&crc32c, data + i, n);
+        hash_crc64_update(&crc64, data + i, n);
+        hash_murmur64_update(&murmur, data + i, n);
+        hash_fast64_update(&fast, data + i, n);
+    }
+    return hash_crc32_final(&crc32) == hash_crc32(data, len) && 
+           hash_crc32c_final(&crc32c) == hash_crc32c(data, len) && 
+           hash_crc64_final(&crc64) == hash_crc64(data, len) && 
+           hash_murmur64_final(&murmur) == hash_murmur64(data, len) && 
+           hash_fast64_final(&fast) == hash_fast64_seed(data, len, 99);
+}
+
+TEST(Hash, streaming_matches_one_shot) {
+    static UInt8 data[9000];
+    fill_random(data, sizeof(data), 11);
+    Ll lengths[] = { 0, 1, 7, 8, 63, 64, 255, 256, 257, 300, 320, 1024, 1025, 1088, 4097, 9000 };
+    Ll steps[] = { 1, 3, 64, 100, 256, 257, 1000, 9000 };
+    for(int l = 0; l < 16; l++)
+        for(int s = 0; s < 8; s++)
+            CHECK_TRUE(streaming_matches(data, lengths[l], steps[s]));
+}
+
+TEST(Hash, streaming_final_is_repeatable) {
+    UInt8 data[600];
+    fill_random(data, sizeof(data), 5);
+    cstlHashFast64State state;
+    hash_fast64_init(&state, 0);
+    hash_fast64_update(&state, data, 300);
+    CHECK_EQ(hash_fast64_final(&state), hash_fast64(data, 300));
+    hash_fast64_update(&state, data + 300, 300);
+    CHECK_EQ(hash_fast64_final(&state), hash_fast64(data, 600));
+    CHECK_EQ(hash_fast64_final(&state), hash_fast64(data, 600));
+}
+
+TEST(Hash, every_dispatch_level) {
+    static UInt8 data[3000];
+    fill_random(data, sizeof(data), 17);
+    UInt32 levels[] = { 0, CpuFeatureSSE2, CpuFeatureSSE2 | CpuFeatureSSE42, CpuFeatureCRC32, CpuFeatureAll };
+    for(UInt64 i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+        cpu_set_features_mask(levels[i]);
+        for(Ll len = 0; len <= cast(Ll)sizeof(data); len += 97) {
+            CHECK_EQ(hash_fast64_seed(data, len, 7), __hash_fast64_scalar(data, len, 7));
+            CHECK_EQ(hash_crc32c(data, len), __hash_crc32c_scalar(data, len));
+        }
+        CHECK_TRUE(streaming_matches(data, 2500, 100));
+    }
+    cpu_set_features_mask(CpuFeatureAll);
+}
+
+TEST(Hash, combine) {
+    UInt64 a = hash_fast64("source", 6);
+    UInt64 b = hash_fast64("-O2", 3);
+    CHECK_NE(hash_combine64(a, b), hash_combine64(b, a));
+    CHECK_NE(hash_combine64(a, b), hash_combine64(a, b + 1));
+    CHECK_EQ(hash_combine64(a, b), hash_combine64(a, b));
+}
+
+TEST(Hash, file) {
+    UInt64 hash = 0;
+    CHECK_FALSE(hash_fast64_file("this/file/does/not/exist", 0, &hash));
+
+    // Large enough to take several reads
+    static UInt8 data[200000];
+    fill_random(data, sizeof(data), 17);
+    const char* fname = "test_hash_file.tmp";
+    FILE* file = fopen(fname, "wb");
+    REQUIRE_NOT_NULL(file);
+    fwrite(data, 1, sizeof(data), file);
+    fclose(file);
+
+    CHECK_TRUE(hash_fast64_file(fname, 0, &hash));
+    CHECK_EQ(hash, hash_fast64(data, sizeof(data)));
+    remove(fname);
+}
@@ -0,0 +1,165 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(HashMap, put_and_get) {
+    cstlHashMap* map = hashmap_new(UInt32, double, 0);
+    CHECK_EQ(hashmap_size(map), 0);
+    CHECK_EQ(map->capacity, HASHMAP_MIN_CAPACITY);
+
+    UInt32 key = 42;
+    double value = 3.5;
+    CHECK_NULL(hashmap_get(map, &key));
+    hashmap_put(map, &key, &value);
+    CHECK_EQ(hashmap_size(map), 1);
+    REQUIRE_NOT_NULL(hashmap_get(map, &key));
+    CHECK_EQ(*cast(double*)hashmap_get(map, &key), 3.5);
+
+    // Overwriting doesn't add an entry
+    value = -1.0;
+    hashmap_put(map, &key, &value);
+    CHECK_EQ(hashmap_size(map), 1);
+    CHECK_EQ(*cast(double*)hashmap_get(map, &key), -1.0);
+
+    UInt32 other = 43;
+    CHECK_FALSE(hashmap_contains(map, &other));
+    hashmap_free(map);
+}
+
+TEST(HashMap, grows) {
+    cstlHashMap* map = hashmap_new(UInt64, UInt64, 0);
+    for(UInt64 i = 0; i < 10000; i++) {
+        UInt64 value = i * 3;
+        hashmap_put(map, &i, &value);
+    }
+    CHECK_EQ(hashmap_size(map), 10000);
+    CHECK_EQ(map->capacity & (map->capacity - 1), 0);
+    for(UInt64 i = 0; i < 10000; i++) {
+        UInt64* value = cast(UInt64*)hashmap_get(map, &i);
+        REQUIRE_NOT_NULL(value);
+        CHECK_EQ(*value, i * 3);
+    }
+    UInt64 missing = 10000;
+    CHECK_NULL(hashmap_get(map, &missing));
+    hashmap_free(map);
+}
+
+TEST(HashMap, reserve) {
+    cstlHashMap* map = hashmap_new(UInt32, UInt32, 1000);
+    UInt64 capacity = map->capacity;
+    for(UInt32 i = 0; i < 1000; i++)
+        hashmap_put(map, &i, &i);
+    CHECK_EQ(map->capacity, capacity);
+
+    hashmap_reserve(map, 100);
+    CHECK_EQ(map->capacity, capacity);
+    hashmap_reserve(map, 5000);
+    CHECK_GT(map->capacity, capacity);
+    for(UInt32 i = 0; i < 1000; i++)
+        CHECK_EQ(*cast(UInt32*)hashmap_get(map, &i), i);
+    hashmap_free(map);
+}
+
+TEST(HashMap, remove) {
+    cstlHashMap* map = hashmap_new(UInt32, UInt32, 0);
+    for(UInt32 i = 0; i < 2000; i++)
+        hashmap_put(map, &i, &i);
+
+    // Remove every odd key, then check that the even ones are still reachable
+    for(UInt32 i = 1; i < 2000; i += 2)
+        CHECK_TRUE(hashmap_remove(map, &i));
+    UInt32 key = 1;
+    CHECK_FALSE(hashmap_remove(map, &key));
+    CHECK_EQ(hashmap_size(map), 1000);
+    for(UInt32 i = 0; i < 2000; i++) {
+        if(i % 2 == 0) {
+            REQUIRE_NOT_NULL(hashmap_get(map, &i));
+            CHECK_EQ(*cast(UInt32*)hashmap_get(map, &i), i);
+        } else {
+            CHECK_NULL(hashmap_get(map, &i));
+        }
+    }
+
+    // No tombstones: churning in place never needs to grow the table
+    UInt64 capacity = map->capacity;
+    for(UInt32 round = 0; round < 50; round++) {
+        for(UInt32 i = 1; i < 2000; i += 2)
+            hashmap_put(map, &i, &round);
+        for(UInt32 i = 1; i < 2000; i += 2)
+            hashmap_remove(map, &i);
+    }
+    CHECK_EQ(map->capacity, capacity);
+    CHECK_EQ(map->growth_left, capacity - capacity / 8 - 1000);
+    hashmap_free(map);
+}
+
+TEST(HashMap, iteration) {
+    cstlHashMap* map = hashmap_new(UInt32, UInt32, 0);
+    UInt64 expected = 0;
+    for(UInt32 i = 0; i < 100; i++) {
+        UInt32 value = i * i;
+        hashmap_put(map, &i, &value);
+        expected += i;
+    }
+
+    UInt64 count = 0, sum = 0;
+    for(UInt64 it = hashmap_begin(map); it != hashmap_end(map); it = hashmap_next(map, it)) {
+        UInt32 key = *cast(UInt32*)hashmap_key_at(map, it);
+        CHECK_EQ(*cast(UInt32*)hashmap_value_at(map, it), key * key);
+        sum += key;
+        count++;
+    }
+    CHECK_EQ(count, 100);
+    CHECK_EQ(sum, expected);
+
+    hashmap_clear(map);
+    CHECK_EQ(hashmap_size(map), 0);
+    CHECK_EQ(hashmap_begin(map), hashmap_end(map));
+    hashmap_free(map);
+}
+
+TEST(HashMap, string_keys) {
+    cstlHashMap* map = hashmap_new_str(int, 0);
+    const char* words[] = { "fun", "return", "if", "else", "match", "module" };
+    for(int i = 0; i < 6; i++)
+        hashmap_put(map, &words[i], &i);
+
+    // Keys are compared by contents, not by pointer
+    char buffer[16];
+    strcpy(buffer, "match");
+    char* key = buffer;
+    REQUIRE_NOT_NULL(hashmap_get(map, &key));
+    CHECK_EQ(*cast(int*)hashmap_get(map, &key), 4);
+    key = "while";
+    CHECK_NULL(hashmap_get(map, &key));
+    hashmap_free(map);
+}
+
+TEST(HashMap, get_or_insert) {
+    cstlHashMap* map = hashmap_new_in(null, char, UInt64, 0);
+    const char* text = "hello world";
+    for(const char* p = text; *p; p++) {
+        bool inserted;
+        UInt64* count = cast(UInt64*)hashmap_get_or_insert(map, p, &inserted);
+        if(inserted)
+            CHECK_EQ(*count, 0);
+        (*count)++;
+    }
+    char l = 'l', o = 'o';
+    CHECK_EQ(*cast(UInt64*)hashmap_get(map, &l), 3);
+    CHECK_EQ(*cast(UInt64*)hashmap_get(map, &o), 2);
+    CHECK_EQ(hashmap_size(map), 8);
+    hashmap_free(map);
+}
+
+TEST(HashMap, allocator) {
+    cstlTrackingAllocator* tracker = tracking_allocator_new(null, 0);
+    cstlHashMap* map = hashmap_new_in(tracking_allocator(tracker), UInt64, UInt8, 0);
+    for(UInt64 i = 0; i < 500; i++)
+        hashmap_put(map, &i, null);
+    CHECK_GT(tracker->bytes_live, 0);
+    CHECK_EQ(map->slot_size, 16);
+    hashmap_free(map);
+    CHECK_EQ(tracker->bytes_live, 0);
+    tracking_allocator_free(tracker);
+}
@@ -0,0 +1,224 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#if defined(CORETEN_OS_POSIX)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif // CORETEN_OS_POSIX
+
+TAU_MAIN()
+
+#define NUM_FILES   24
+
+static char fnames[NUM_FILES][64];
+static UInt64 fsizes[NUM_FILES];
+
+static char expected_byte(int fileid, UInt64 i) {
+    return cast(char)('a' + (fileid * 7 + i) % 26);
+}
+
+// Sizes range from empty to large enough to need several reads
+static bool write_files() {
+    for(int i = 0; i < NUM_FILES; i++) {
+        snprintf(fnames[i], sizeof(fnames[i]), "test_io_file_%d.tmp", i);
+        fsizes[i] = i == 0 ? 0 : cast(UInt64)(i * i * 997) % 300000 + cast(UInt64)i;
+        FILE* file = fopen(fnames[i], "wb");
+        if(!file)
+            return false;
+        for(UInt64 j = 0; j < fsizes[i]; j++)
+            fputc(expected_byte(i, j), file);
+        fclose(file);
+    }
+    return true;
+}
+
+static void remove_files() {
+    for(int i = 0; i < NUM_FILES; i++)
+        remove(fnames[i]);
+}
+
+static bool contents_match(File* file) {
+    if(file->length != fsizes[file->fileid] || file->contents[file->length] != nullchar)
+        return false;
+    for(UInt64 j = 0; j < file->length; j++) {
+        if(file->contents[j] != expected_byte(file->fileid, j))
+            return false;
+    }
+    return true;
+}
+
+// Load every file (plus a missing one) through `backend`. Returns the number of files that came back correct
+static int load_all(cstlAllocator* allocator, UInt32 depth, cstlFileLoaderBackend backend) {
+    cstlFileLoader* loader = file_loader_new(allocator, depth, backend);
+    for(int i = 0; i < NUM_FILES; i++) {
+        if(file_loader_add(loader, fnames[i]) != i)
+            return -1;
+    }
+    int missing_id = file_loader_add(loader, "this/file/does/not/exist");
+
+    bool seen[NUM_FILES + 1] = {0};
+    int ok = 0;
+    File* file;
+    while((file = file_loader_next(loader)) != null) {
+        if(seen[file->fileid])
+            return -1;
+        seen[file->fileid] = true;
+        if(file->fileid == missing_id)
+            ok += file->error != 0 && file->contents == null && strcmp(file->basename, "exist") == 0;
+        else
+            ok += file->error == 0 && contents_match(file) && strcmp(file->basename, fnames[file->fileid]) == 0;
+    }
+    // Stays exhausted
+    if(file_loader_next(loader) != null)
+        return -1;
+    file_loader_free(loader);
+    return ok;
+}
+
+TEST(FileLoader, backends) {
+    REQUIRE_TRUE(write_files());
+    CHECK_EQ(load_all(null, 0, FileLoaderBackendAuto), NUM_FILES + 1);
+    CHECK_EQ(load_all(null, 0, FileLoaderBackendIoUring), NUM_FILES + 1);
+    CHECK_EQ(load_all(null, 0, FileLoaderBackendThreads), NUM_FILES + 1);
+    CHECK_EQ(load_all(null, 0, FileLoaderBackendSync), NUM_FILES + 1);
+    remove_files();
+}
+
+TEST(FileLoader, shallow_depth) {
+    // Fewer slots than files: the loader has to recycle them
+    REQUIRE_TRUE(write_files());
+    CHECK_EQ(load_all(null, 1, FileLoaderBackendAuto), NUM_FILES + 1);
+    CHECK_EQ(load_all(null, 3, FileLoaderBackendThreads), NUM_FILES + 1);
+    CHECK_EQ(load_all(null, 3, FileLoaderBackendSync), NUM_FILES + 1);
+    remove_files();
+}
+
+TEST(FileLoader, tracked_allocator) {
+    // Everything allocated by the loader is given back
+    REQUIRE_TRUE(write_files());
+    cstlTrackingAllocator* tracker = tracking_allocator_new(null, 0);
+    cstlAllocator* allocator = tracking_allocator(tracker);
+    CHECK_EQ(load_all(allocator, 8, FileLoaderBackendAuto), NUM_FILES + 1);
+    CHECK_EQ(tracker->bytes_live, 0);
+    tracking_allocator_free(tracker);
+    remove_files();
+}
+
+TEST(FileLoader, free_before_done) {
+    REQUIRE_TRUE(write_files());
+    cstlFileLoader* loader = file_loader_new(null, 4, FileLoaderBackendAuto);
+    for(int i = 0; i < NUM_FILES; i++)
+        file_loader_add(loader, fnames[i]);
+    File* file = file_loader_next(loader);
+    REQUIRE_NOT_NULL(file);
+    CHECK_TRUE(contents_match(file));
+    file_loader_free(loader);
+    remove_files();
+}
+
+TEST(FileLoader, empty) {
+    cstlFileLoader* loader = file_loader_new(null, 0, FileLoaderBackendAuto);
+    CHECK_NULL(file_loader_next(loader));
+    file_loader_free(loader);
+}
+
+TEST(Writer, integers) {
+    cstlWriter* writer = writer_new_memory(null, 0);
+    writer_u64(writer, 0);
+    writer_char(writer, ' ');
+    writer_u64(writer, 7);
+    writer_char(writer, ' ');
+    writer_u64(writer, 42);
+    writer_char(writer, ' ');
+    writer_u64(writer, 18446744073709551615ULL);
+    writer_char(writer, ' ');
+    writer_i64(writer, -1);
+    writer_char(writer, ' ');
+    writer_i64(writer, -9223372036854775807LL - 1);
+    writer_char(writer, ' ');
+    writer_hex64(writer, 0);
+    writer_char(writer, ' ');
+    writer_hex64(writer, 0xDEADBEEF);
+    CHECK_STREQ(writer_data(writer), 
+                "0 7 42 18446744073709551615 -1 -9223372036854775808 0 deadbeef");
+
+    // Every number up to 100000 round-trips
+    bool ok = true;
+    char expected[32];
+    for(UInt64 i = 0; i < 100000; i += 7) {
+        writer->used = 0;
+        writer_u64(writer, i);
+        snprintf(expected, sizeof(expected), "%llu", cast(unsigned long long)i);
+        ok = ok && strcmp(writer_data(writer), expected) == 0;
+    }
+    CHECK_TRUE(ok);
+    writer_free(writer);
+}
+
+TEST(Writer, memory_grows) {
+    cstlWriter* writer = writer_new_memory(null, 4);
+    writer_str(writer, "hello");
+    writer_repeat(writer, '-', 1000);
+    writer_printf(writer, "%s=%d", "x", 12345);
+    CHECK_EQ(writer_length(writer), 5 + 1000 + 7);
+    const char* data = writer_data(writer);
+    CHECK_EQ(strncmp(data, "hello---", 8), 0);
+    CHECK_STREQ(data + 1005, "x=12345");
+    CHECK_TRUE(writer_flush(writer));
+    writer_free(writer);
+}
+
+static bool file_contains(const char* fname, const char* expected, UInt64 n) {
+    UInt64 length = 0;
+    char* contents = readFile_in(null, fname, &length);
+    bool ok = length == n && memcmp(contents, expected, n) == 0;
+    cstl_free(null, contents, length + 1);
+    return ok;
+}
+
+TEST(Writer, file_sinks) {
+    // A buffer much smaller than the output, so it's flushed many times (and large writes bypass it)
+    static char expected[100000];
+    UInt64 n = 0;
+    for(int i = 0; n + 64 < sizeof(expected); i++)
+        n += cast(UInt64)snprintf(expected + n, sizeof(expected) - n, "line %d: %s\n", i, i % 97 ? "x" : "a longer line");
+
+    const char* fname = "test_io_writer.tmp";
+    FILE* file = fopen(fname, "wb");
+    REQUIRE_NOT_NULL(file);
+    cstlWriter* writer = writer_new_file(null, file, 64);
+    for(UInt64 i = 0; i < n; i += 100)
+        writer_write(writer, expected + i, n - i < 100 ? n - i : 100);
+    CHECK_TRUE(writer_flush(writer));
+    writer_free(writer);
+    fclose(file);
+    CHECK_TRUE(file_contains(fname, expected, n));
+
+#if defined(CORETEN_OS_POSIX)
+    int fd = open(fname, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    REQUIRE_GE(fd, 0);
+    writer = writer_new_fd(null, fd, 0);
+    for(UInt64 i = 0; i < n; i += 13)
+        writer_write(writer, expected + i, n - i < 13 ? n - i : 13);
+    writer_free(writer);
+    close(fd);
+    CHECK_TRUE(file_contains(fname, expected, n));
+#endif // CORETEN_OS_POSIX
+    remove(fname);
+}
+
+TEST(Writer, printf_larger_than_buffer) {
+    const char* fname = "test_io_writer_printf.tmp";
+    FILE* file = fopen(fname, "wb");
+    REQUIRE_NOT_NULL(file);
+    char buffer[16];
+    cstlWriter writer;
+    writer_init_file(&writer, file, buffer, sizeof(buffer));
+    writer_str(&writer, "<");
+    writer_printf(&writer, "%s|%d", "a fairly long string that won't fit", 99);
+    writer_str(&writer, ">");
+    CHECK_TRUE(writer_flush(&writer));
+    fclose(file);
+    const char* expected = "<a fairly long string that won't fit|99>";
+    CHECK_TRUE(file_contains(fname, expected, strlen(expected)));
+    remove(fname);
+}
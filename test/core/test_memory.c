@@ -0,0 +1,342 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Arena, alloc) {
+    cstlArena* arena = arena_new(0);
+    CHECK_EQ(arena->chunk_size, CORETEN_ARENA_DEFAULT_CHUNK_SIZE);
+
+    UInt64* a = cast(UInt64*)arena_alloc(arena, 8 * sizeof(UInt64));
+    char* b = cast(char*)arena_alloc_aligned(arena, 3, 1);
+    double* c = arena_new_obj(arena, double);
+    REQUIRE_NOT_NULL(a);
+    REQUIRE_NOT_NULL(b);
+    REQUIRE_NOT_NULL(c);
+
+    // Allocations are zeroed, aligned and don't overlap
+    for(int i = 0; i < 8; i++)
+        CHECK_EQ(a[i], 0);
+    CHECK_EQ(cast(UInt64)(uintptr_t)a % CORETEN_ARENA_DEFAULT_ALIGN, 0);
+    CHECK_EQ(cast(UInt64)(uintptr_t)c % _Alignof(double), 0);
+    CHECK(b >= cast(char*)(a + 8));
+    CHECK(cast(char*)c >= b + 3);
+
+    void* d = arena_alloc_aligned(arena, 10, 256);
+    CHECK_EQ(cast(UInt64)(uintptr_t)d % 256, 0);
+
+    char* s = arena_strndup(arena, "hello world", 5);
+    CHECK_STREQ(s, "hello");
+    arena_free(arena);
+}
+
+TEST(Arena, grows_past_chunk_size) {
+    cstlArena* arena = arena_new(1024);
+    char* first = cast(char*)arena_alloc(arena, 1000);
+    memset(first, 'x', 1000);
+
+    // Doesn't fit in what's left of the first chunk
+    char* second = cast(char*)arena_alloc(arena, 100);
+    // Larger than a whole chunk
+    char* big = cast(char*)arena_alloc(arena, 10000);
+    memset(big, 'y', 10000);
+    CHECK(arena->head->prev != null);
+    CHECK_EQ(first[999], 'x');
+    CHECK_EQ(second[0], 0);
+    CHECK_GE(arena->total_reserved, 1024 + 10000);
+    arena_free(arena);
+}
+
+TEST(Arena, mark_and_reset) {
+    cstlArena* arena = arena_new(256);
+    arena_alloc(arena, 100);
+    UInt64 used = arena->total_used;
+
+    cstlArenaMark mark = arena_mark(arena);
+    for(int i = 0; i < 100; i++)
+        arena_alloc(arena, 64);
+    CHECK_GT(arena->total_used, used);
+    CHECK(arena->head != mark.chunk);
+
+    arena_reset_to(arena, mark);
+    CHECK(arena->head == mark.chunk);
+    CHECK_EQ(arena->total_used, used);
+    CHECK_EQ(arena->total_reserved, 256);
+
+    // Memory handed out after a reset is zeroed again
+    UInt64* p = cast(UInt64*)arena_alloc(arena, 64);
+    CHECK_EQ(p[0], 0);
+
+    arena_reset(arena);
+    CHECK_EQ(arena->total_used, 0);
+    CHECK(arena->head->prev == null);
+    arena_free(arena);
+}
+
+TEST(Arena, buffers) {
+    cstlArena* arena = arena_new(0);
+    Buff* buf = buff_new_in(arena_allocator(arena), "hello world");
+    CHECK_STREQ(buf->data, "hello world");
+    CHECK_EQ(buff_len(buf), 11);
+
+    Buff* slice = buff_slice_in(arena_allocator(arena), buf, 6, 5);
+    CHECK_STREQ(slice->data, "world");
+    CHECK_EQ(buff_len(slice), 5);
+    arena_free(arena);
+}
+
+TEST(Allocator, arena_realloc_in_place) {
+    cstlArena* arena = arena_new(1024);
+    cstlAllocator* allocator = arena_allocator(arena);
+
+    char* p = cast(char*)cstl_alloc(allocator, 16);
+    memcpy(p, "0123456789abcdef", 16);
+    // `p` is the latest allocation, so it grows in place
+    char* q = cast(char*)cstl_realloc(allocator, p, 16, 64);
+    CHECK(p == q);
+    CHECK_EQ(arena->total_used, 64);
+
+    char* r = cast(char*)cstl_alloc(allocator, 8);
+    // `q` is no longer the latest allocation, so it has to move
+    char* s = cast(char*)cstl_realloc(allocator, q, 64, 128);
+    CHECK(s != q);
+    CHECK_EQ(memcmp(s, "0123456789abcdef", 16), 0);
+    CHECK(r != null);
+
+    // Freeing the latest allocation hands the space back
+    UInt64 used = arena->total_used;
+    cstl_free(allocator, s, 128);
+    CHECK_EQ(arena->total_used, used - 128);
+    arena_free(arena);
+}
+
+TEST(Allocator, pool) {
+    cstlPool* pool = pool_new(null, 24, 4);
+    CHECK_EQ(pool->block_size, 32);
+
+    void* blocks[10];
+    for(int i = 0; i < 10; i++) {
+        blocks[i] = pool_alloc(pool);
+        memset(blocks[i], 0xAB, 32);
+    }
+    CHECK_EQ(pool->nblocks, 10);
+    for(int i = 0; i < 10; i++)
+        for(int j = i + 1; j < 10; j++)
+            REQUIRE(blocks[i] != blocks[j]);
+
+    // Released blocks are reused (and zeroed again)
+    pool_release(pool, blocks[3]);
+    UInt64* again = cast(UInt64*)pool_alloc(pool);
+    CHECK(cast(void*)again == blocks[3]);
+    CHECK_EQ(again[0], 0);
+
+    // Requests that don't fit in a block go to the parent allocator
+    cstlAllocator* allocator = pool_allocator(pool);
+    void* big = cstl_alloc(allocator, 1000);
+    CHECK_EQ(pool->nblocks, 10);
+    cstl_free(allocator, big, 1000);
+    pool_free(pool);
+}
+
+TEST(Allocator, tracking) {
+    cstlTrackingAllocator* tracker = tracking_allocator_new(null, 0);
+    cstlAllocator* allocator = tracking_allocator(tracker);
+
+    cstlVector* vec = vec_new_in(allocator, UInt64, 4);
+    CHECK_EQ(tracker->nallocs, 2);
+    CHECK_EQ(tracker->bytes_live, sizeof(cstlVector) + 4 * sizeof(UInt64));
+
+    for(UInt64 i = 0; i < 100; i++)
+        vec_push(vec, &i);
+    CHECK_GT(tracker->nreallocs, 0);
+    CHECK_EQ(tracker->bytes_live, sizeof(cstlVector) + vec_cap(vec) * sizeof(UInt64));
+    CHECK_EQ(*cast(UInt64*)vec_at(vec, 99), 99);
+
+    vec_free(vec);
+    CHECK_EQ(tracker->bytes_live, 0);
+    CHECK_GE(tracker->bytes_peak, 100 * sizeof(UInt64));
+    CHECK_EQ(tracker->nfrees, 2);
+    tracking_allocator_free(tracker);
+}
+
+TEST(Allocator, tracking_release_all) {
+    cstlArena* arena = arena_new(0);
+    cstlTrackingAllocator* tracker = tracking_allocator_new(arena_allocator(arena), 0);
+    cstlAllocator* allocator = tracking_allocator(tracker);
+
+    for(int unit = 0; unit < 3; unit++) {
+        for(int i = 0; i < 10; i++)
+            cstl_alloc(allocator, 1000);
+        CHECK_EQ(tracker->bytes_live, 10000);
+        arena_reset(arena);
+        tracking_allocator_release_all(tracker);
+        CHECK_EQ(tracker->bytes_live, 0);
+    }
+    CHECK_EQ(tracker->bytes_total, 30000);
+    CHECK_EQ(tracker->bytes_peak, 10000);
+    tracking_allocator_free(tracker);
+    arena_free(arena);
+}
+
+TEST(Allocator, containers) {
+    cstlTrackingAllocator* tracker = tracking_allocator_new(null, 0);
+    cstlAllocator* allocator = tracking_allocator(tracker);
+
+    VEC(int) v;
+    tvec_init_in(&v, allocator);
+    for(int i = 0; i < 1000; i++)
+        tvec_push(&v, i);
+    SEGVEC(int) s;
+    segvec_init_in(&s, allocator);
+    for(int i = 0; i < 1000; i++)
+        segvec_push(&s, i);
+    SMALLVEC(int, 2) sv;
+    svec_init_in(&sv, allocator);
+    for(int i = 0; i < 10; i++)
+        svec_push(&sv, i);
+    cstlUTF8Str* str = ubuff_new_in(allocator, "héllo wörld");
+    CHECK_GT(tracker->bytes_live, 0);
+
+    tvec_free(&v);
+    segvec_free(&s);
+    svec_free(&sv);
+    ubuff_free(str);
+    CHECK_EQ(tracker->bytes_live, 0);
+    CHECK_EQ(tracker->nallocs, tracker->nfrees);
+    tracking_allocator_free(tracker);
+}
+
+TEST(Slab, size_classes) {
+    CHECK_EQ(slab_size_class(1), 0);
+    CHECK_EQ(slab_size_class(16), 0);
+    CHECK_EQ(slab_size_class(17), 1);
+    CHECK_EQ(slab_size_class(128), 7);
+    CHECK_EQ(slab_size_class(129), 8);
+    CHECK_EQ(slab_size_class(CORETEN_SLAB_MAX_SIZE), CORETEN_SLAB_NUM_CLASSES - 1);
+    for(UInt64 size = 1; size <= CORETEN_SLAB_MAX_SIZE; size++) {
+        UInt32 cls = slab_size_class(size);
+        CHECK_GE(slab_class_size(cls), size);
+        if(cls > 0)
+            CHECK_LT(slab_class_size(cls - 1), size);
+    }
+}
+
+TEST(Slab, reuse) {
+    void* a = slab_alloc(40);
+    void* b = slab_alloc(40);
+    REQUIRE_NE(a, null);
+    REQUIRE_NE(b, null);
+    CHECK_NE(a, b);
+    CHECK_EQ(cast(UInt64)a % 16, 0);
+    memset(a, 0xAB, 40);
+
+    // Freed blocks are handed out again (zeroed), without touching the heap
+    UInt64 reserved = slab_reserved_bytes();
+    slab_release(a, 40);
+    void* c = slab_alloc(33);
+    CHECK_EQ(c, a);
+    CHECK_EQ((cast(Byte*)c)[0], 0);
+    CHECK_EQ((cast(Byte*)c)[32], 0);
+    CHECK_EQ(slab_reserved_bytes(), reserved);
+
+    slab_release(b, 40);
+    slab_release(c, 33);
+}
+
+TEST(Slab, churn) {
+    cstlAllocator* allocator = slab_allocator();
+    void* ptrs[1000];
+    for(int round = 0; round < 4; round++) {
+        for(int i = 0; i < 1000; i++) {
+            ptrs[i] = cstl_alloc(allocator, 24);
+            *cast(int*)ptrs[i] = i;
+        }
+        for(int i = 0; i < 1000; i++) {
+            CHECK_EQ(*cast(int*)ptrs[i], i);
+            cstl_free(allocator, ptrs[i], 24);
+        }
+    }
+    // Only the first round needed new pages
+    UInt64 reserved = slab_reserved_bytes();
+    for(int i = 0; i < 1000; i++)
+        ptrs[i] = cstl_alloc(allocator, 24);
+    for(int i = 0; i < 1000; i++)
+        cstl_free(allocator, ptrs[i], 24);
+    CHECK_EQ(slab_reserved_bytes(), reserved);
+    slab_thread_flush();
+}
+
+TEST(Slab, realloc_and_large) {
+    cstlAllocator* allocator = slab_allocator();
+    char* p = cast(char*)cstl_alloc(allocator, 20);
+    strcpy(p, "hello");
+    // Same size class: the block stays put
+    CHECK_EQ(cstl_realloc(allocator, p, 20, 30), p);
+    p = cast(char*)cstl_realloc(allocator, p, 30, 300);
+    CHECK_STREQ(p, "hello");
+    p = cast(char*)cstl_realloc(allocator, p, 300, 4096);
+    CHECK_STREQ(p, "hello");
+    p = cast(char*)cstl_realloc(allocator, p, 4096, 8);
+    CHECK_EQ(memcmp(p, "hello", 6), 0);
+    cstl_free(allocator, p, 8);
+
+    void* big = slab_alloc(CORETEN_SLAB_MAX_SIZE + 1);
+    REQUIRE_NE(big, null);
+    slab_release(big, CORETEN_SLAB_MAX_SIZE + 1);
+}
+
+TEST(Slab, ast_nodes) {
+    cstlAllocator* allocator = slab_allocator();
+    AstNode* node = ast_create_node(allocator, AstNodeKindBlock);
+    CHECK_EQ(node->kind, AstNodeKindBlock);
+    ast_free_node(allocator, node);
+    AstNode* again = ast_create_node(allocator, AstNodeKindReturn);
+    CHECK_EQ(again, node);
+    ast_free_node(allocator, again);
+}
+
+TEST(Allocator, tracking_phases) {
+    cstlTrackingAllocator* tracker = tracking_allocator_new(null, 0);
+    cstlAllocator* allocator = tracking_allocator(tracker);
+
+    void* a = cstl_alloc(allocator, 8);
+    tracking_allocator_set_phase(tracker, "lex");
+    void* b = cstl_alloc(allocator, 100);
+    void* c = cstl_alloc(allocator, 5000);
+    tracking_allocator_set_phase(tracker, "parse");
+    b = cstl_realloc(allocator, b, 100, 200);
+    cstl_free(allocator, c, 5000);
+    tracking_allocator_set_phase(tracker, "lex");
+    cstl_free(allocator, a, 8);
+
+    REQUIRE_EQ(tracker->nphases, 3);
+    CHECK_STREQ(tracker->phases[0].name, "other");
+    CHECK_EQ(tracker->phases[0].nallocs, 1);
+    CHECK_EQ(tracker->phases[0].bytes_total, 8);
+
+    cstlTrackingPhase* lex = &tracker->phases[1];
+    CHECK_STREQ(lex->name, "lex");
+    CHECK_EQ(lex->nallocs, 2);
+    CHECK_EQ(lex->nfrees, 1);
+    CHECK_EQ(lex->bytes_total, 5100);
+    CHECK_EQ(lex->bytes_peak, 5108);
+    CHECK_EQ(lex->histogram[tracking_size_bucket(100)], 1);
+    CHECK_EQ(lex->histogram[tracking_size_bucket(5000)], 1);
+
+    cstlTrackingPhase* parse = &tracker->phases[2];
+    CHECK_EQ(parse->nreallocs, 1);
+    CHECK_EQ(parse->nfrees, 1);
+    CHECK_EQ(parse->bytes_total, 200);
+
+    cstl_free(allocator, b, 200);
+    CHECK_EQ(tracker->bytes_live, 0);
+    tracking_allocator_free(tracker);
+}
+
+TEST(Allocator, tracking_size_buckets) {
+    CHECK_EQ(tracking_size_bucket(0), 0);
+    CHECK_EQ(tracking_size_bucket(16), 0);
+    CHECK_EQ(tracking_size_bucket(17), 1);
+    CHECK_EQ(tracking_size_bucket(32), 1);
+    CHECK_EQ(tracking_size_bucket(33), 2);
+    CHECK_EQ(tracking_size_bucket(GB_TO_BYTES(64)), CORETEN_TRACKING_HISTOGRAM_BUCKETS - 1);
+}
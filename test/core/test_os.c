@@ -0,0 +1,152 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+TAU_MAIN()
+
+TEST(Glob, match) {
+    CHECK_TRUE(os_glob_match("*.ad", "main.ad"));
+    CHECK_TRUE(os_glob_match("*.ad", ".ad"));
+    CHECK_FALSE(os_glob_match("*.ad", "main.adx"));
+    CHECK_TRUE(os_glob_match("test_*.ad", "test_lexer.ad"));
+    CHECK_FALSE(os_glob_match("test_*.ad", "lexer_test.ad"));
+    CHECK_TRUE(os_glob_match("*", ""));
+    CHECK_TRUE(os_glob_match("", ""));
+    CHECK_FALSE(os_glob_match("", "a"));
+    CHECK_TRUE(os_glob_match("a*b*c", "aXXbYYbc"));
+    CHECK_FALSE(os_glob_match("a*b*c", "aXXbYYbd"));
+    CHECK_TRUE(os_glob_match("?.c", "x.c"));
+    CHECK_FALSE(os_glob_match("?.c", "xy.c"));
+    CHECK_TRUE(os_glob_match("file[0-9].ad", "file7.ad"));
+    CHECK_FALSE(os_glob_match("file[0-9].ad", "fileA.ad"));
+    CHECK_TRUE(os_glob_match("file[!0-9].ad", "fileA.ad"));
+    CHECK_TRUE(os_glob_match("[abc]", "b"));
+    CHECK_TRUE(os_glob_match("[]]", "]"));
+    CHECK_TRUE(os_glob_match("[", "["));
+    CHECK_TRUE(os_glob_match("**.ad", "x.ad"));
+}
+
+#if defined(CORETEN_OS_POSIX)
+#define WALK_ROOT   "test_os_walk.tmp"
+
+static const char* walk_dirs[] = {
+    WALK_ROOT, WALK_ROOT "/src", WALK_ROOT "/src/compiler", WALK_ROOT "/src/core", WALK_ROOT "/build", 
+    WALK_ROOT "/.git", WALK_ROOT "/empty",
+};
+static const char* walk_files[] = {
+    WALK_ROOT "/README.md", WALK_ROOT "/main.ad", WALK_ROOT "/src/lexer.ad", WALK_ROOT "/src/test_lexer.ad", 
+    WALK_ROOT "/src/compiler/parser.ad", WALK_ROOT "/src/core/mem.ad", WALK_ROOT "/src/core/notes.txt", 
+    WALK_ROOT "/build/out.ad", WALK_ROOT "/.git/config.ad", WALK_ROOT "/.hidden.ad",
+};
+#define NUM_WALK_DIRS   (sizeof(walk_dirs) / sizeof(walk_dirs[0]))
+#define NUM_WALK_FILES  (sizeof(walk_files) / sizeof(walk_files[0]))
+
+static bool make_tree() {
+    for(UInt64 i = 0; i < NUM_WALK_DIRS; i++)
+        mkdir(walk_dirs[i], 0755);
+    for(UInt64 i = 0; i < NUM_WALK_FILES; i++) {
+        FILE* file = fopen(walk_files[i], "wb");
+        if(!file)
+            return false;
+        fclose(file);
+    }
+    return true;
+}
+
+static void remove_tree() {
+    for(UInt64 i = 0; i < NUM_WALK_FILES; i++)
+        remove(walk_files[i]);
+    for(UInt64 i = NUM_WALK_DIRS; i > 0; i--)
+        rmdir(walk_dirs[i - 1]);
+}
+
+TEST(Walk, everything) {
+    REQUIRE_TRUE(make_tree());
+    cstlDirWalk* walk = os_walk_dir(null, WALK_ROOT, null);
+    CHECK_EQ(walk->error, 0);
+    REQUIRE_EQ(walk->npaths, 8);
+    // Sorted, hidden entries skipped
+    CHECK_STREQ(walk->paths[0], WALK_ROOT "/README.md");
+    CHECK_STREQ(walk->paths[1], WALK_ROOT "/build/out.ad");
+    CHECK_STREQ(walk->paths[2], WALK_ROOT "/main.ad");
+    CHECK_STREQ(walk->paths[3], WALK_ROOT "/src/compiler/parser.ad");
+    CHECK_STREQ(walk->paths[7], WALK_ROOT "/src/test_lexer.ad");
+    CHECK_EQ(walk->ndirs, 6);
+    os_walk_free(walk);
+    CHECK_TRUE(os_is_dir(WALK_ROOT "/src"));
+    CHECK_FALSE(os_is_dir(WALK_ROOT "/main.ad"));
+    remove_tree();
+    CHECK_FALSE(os_is_dir(WALK_ROOT));
+}
+
+TEST(Walk, filters) {
+    REQUIRE_TRUE(make_tree());
+    const char* include[] = {"*.ad"};
+    const char* ignore[] = {"build", "test_*"};
+    cstlDirWalkOptions options = {include, 1, ignore, 2, 0, false};
+    cstlDirWalk* walk = os_walk_dir(null, WALK_ROOT "/", &options);
+    REQUIRE_EQ(walk->npaths, 4);
+    CHECK_STREQ(walk->paths[0], WALK_ROOT "/main.ad");
+    CHECK_STREQ(walk->paths[1], WALK_ROOT "/src/compiler/parser.ad");
+    CHECK_STREQ(walk->paths[2], WALK_ROOT "/src/core/mem.ad");
+    CHECK_STREQ(walk->paths[3], WALK_ROOT "/src/lexer.ad");
+    os_walk_free(walk);
+
+    // Test discovery, hidden files included
+    const char* tests[] = {"test_*.ad", ".*.ad"};
+    cstlDirWalkOptions test_options = {tests, 2, null, 0, 1, true};
+    walk = os_walk_dir(null, WALK_ROOT, &test_options);
+    REQUIRE_EQ(walk->npaths, 2);
+    CHECK_STREQ(walk->paths[0], WALK_ROOT "/.hidden.ad");
+    CHECK_STREQ(walk->paths[1], WALK_ROOT "/src/test_lexer.ad");
+    os_walk_free(walk);
+    remove_tree();
+}
+
+TEST(Walk, many_threads_same_result) {
+    // A wider tree, so the threads actually share the work
+    REQUIRE_TRUE(make_tree());
+    char path[128];
+    for(int i = 0; i < 40; i++) {
+        snprintf(path, sizeof(path), WALK_ROOT "/empty/d%d", i);
+        mkdir(path, 0755);
+        snprintf(path, sizeof(path), WALK_ROOT "/empty/d%d/f.ad", i);
+        FILE* file = fopen(path, "wb");
+        REQUIRE_NOT_NULL(file);
+        fclose(file);
+    }
+
+    cstlDirWalkOptions serial = {0};
+    serial.nthreads = 1;
+    cstlDirWalkOptions parallel = {0};
+    parallel.nthreads = 8;
+    cstlDirWalk* a = os_walk_dir(null, WALK_ROOT, &serial);
+    cstlDirWalk* b = os_walk_dir(null, WALK_ROOT, &parallel);
+    REQUIRE_EQ(a->npaths, 48);
+    REQUIRE_EQ(b->npaths, a->npaths);
+    CHECK_EQ(b->ndirs, a->ndirs);
+    bool same = true;
+    for(UInt64 i = 0; i < a->npaths; i++)
+        same = same && strcmp(a->paths[i], b->paths[i]) == 0;
+    CHECK_TRUE(same);
+    os_walk_free(a);
+    os_walk_free(b);
+
+    for(int i = 0; i < 40; i++) {
+        snprintf(path, sizeof(path), WALK_ROOT "/empty/d%d/f.ad", i);
+        remove(path);
+        snprintf(path, sizeof(path), WALK_ROOT "/empty/d%d", i);
+        rmdir(path);
+    }
+    remove_tree();
+}
+#endif // CORETEN_OS_POSIX
+
+TEST(Walk, missing_root) {
+    cstlDirWalk* walk = os_walk_dir(null, "this/dir/does/not/exist", null);
+    CHECK_NE(walk->error, 0);
+    CHECK_EQ(walk->npaths, 0);
+    CHECK_EQ(walk->ndirs, 0);
+    os_walk_free(walk);
+}
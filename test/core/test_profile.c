@@ -0,0 +1,96 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include "helpers.h"
+
+TAU_MAIN()
+
+TEST(Profile, disabled_records_nothing) {
+    profile_reset();
+    profile_enable(false);
+    profile_begin("lex", null);
+    profile_end();
+    PROFILE_SCOPE("parse", null) {
+        spin_ns(1000);
+    }
+    CHECK_EQ(profile_span_count(), 0);
+}
+
+TEST(Profile, nested_spans) {
+    profile_reset();
+    profile_enable(true);
+    PROFILE_SCOPE("build", null) {
+        for(int i = 0; i < 3; i++) {
+            PROFILE_SCOPE("lex", "main.ad") {
+                spin_ns(200000);
+            }
+        }
+        profile_begin("parse", "main.ad");
+        spin_ns(100000);
+        profile_end();
+    }
+    profile_enable(false);
+    CHECK_EQ(profile_span_count(), 5);
+
+    FILE* file = tmpfile();
+    REQUIRE_NOT_NULL(file);
+    profile_write_summary(file);
+    UInt64 length;
+    char* summary = read_back(file, &length);
+    fclose(file);
+
+    // Heaviest first
+    char* build = strstr(summary, "build");
+    char* lex = strstr(summary, "lex");
+    char* parse = strstr(summary, "parse");
+    REQUIRE_NOT_NULL(build);
+    REQUIRE_NOT_NULL(lex);
+    REQUIRE_NOT_NULL(parse);
+    CHECK_LT(build, lex);
+    CHECK_LT(lex, parse);
+    free(summary);
+}
+
+TEST(Profile, chrome_trace) {
+    profile_reset();
+    profile_enable(true);
+    PROFILE_SCOPE("lex", "dir\\\"quoted\".ad") {
+        spin_ns(1000);
+    }
+    profile_enable(false);
+
+    FILE* file = tmpfile();
+    REQUIRE_NOT_NULL(file);
+    profile_write_chrome_trace(file);
+    UInt64 length;
+    char* trace = read_back(file, &length);
+    fclose(file);
+
+    CHECK_EQ(strncmp(trace, "{\"traceEvents\":[", 16), 0);
+    CHECK_NOT_NULL(strstr(trace, "\"name\":\"lex\",\"cat\":\"phase\",\"ph\":\"X\",\"ts\":"));
+    // The detail is escaped
+    CHECK_NOT_NULL(strstr(trace, "\"args\":{\"detail\":\"dir\\\\\\\"quoted\\\".ad\"}"));
+    CHECK_NOT_NULL(strstr(trace, "\"ph\":\"M\""));
+    CHECK_EQ(strcmp(trace + length - 2, "}\n"), 0);
+    free(trace);
+}
+
+static int record_spans(void* arg) {
+    for(int i = 0; i < 100; i++) {
+        PROFILE_SCOPE("worker", null) {
+            PROFILE_SCOPE("inner", null) {}
+        }
+    }
+    return 0;
+}
+
+TEST(Profile, threads) {
+    profile_reset();
+    profile_enable(true);
+    cstlThread threads[4];
+    for(int i = 0; i < 4; i++)
+        REQUIRE_TRUE(thread_create(&threads[i], record_spans, null));
+    for(int i = 0; i < 4; i++)
+        thread_join(&threads[i]);
+    profile_enable(false);
+    CHECK_EQ(profile_span_count(), 4 * 200);
+}
@@ -0,0 +1,296 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include "helpers.h"
+TAU_MAIN()
+
+#define SIMD_TEST_MAXLEN    300
+
+// Like `fill_random()`, but without null bytes (mixed case letters, digits, punctuation and high bytes)
+static void fill_text(char* buff, UInt64 n, UInt32 seed) {
+    fill_random(buff, n, seed);
+    for(UInt64 i = 0; i < n; i++)
+        buff[i] = buff[i] == nullchar ? 'x' : buff[i];
+}
+
+static int sign(int x) {
+    return (x > 0) - (x < 0);
+}
+
+TEST(Simd, strlen) {
+    static char buff[SIMD_TEST_MAXLEN + 64];
+    for(UInt64 align = 0; align < 33; align++) {
+        for(UInt64 len = 0; len < SIMD_TEST_MAXLEN; len++) {
+            char* s = buff + align;
+            fill_text(s, len, cast(UInt32)(len + align));
+            s[len] = nullchar;
+            REQUIRE_EQ(simd_strlen(s), len);
+            REQUIRE_EQ(__simd_strlen_scalar(s), len);
+        }
+    }
+}
+
+TEST(Simd, memchr) {
+    static char buff[SIMD_TEST_MAXLEN + 64];
+    for(UInt64 align = 0; align < 17; align++) {
+        for(UInt64 len = 0; len < SIMD_TEST_MAXLEN; len += 7) {
+            char* s = buff + align;
+            fill_text(s, len, cast(UInt32)len);
+            for(int ch = 0; ch < 256; ch += 51) {
+                const char* expected = cast(const char*)memchr(s, ch, len);
+                REQUIRE(simd_memchr(s, cast(char)ch, len) == expected);
+                REQUIRE(__simd_memchr_scalar(s, cast(char)ch, len) == expected);
+            }
+        }
+    }
+}
+
+TEST(Simd, memeq_and_memcmp) {
+    static char a[SIMD_TEST_MAXLEN + 64];
+    static char b[SIMD_TEST_MAXLEN + 64];
+    for(UInt64 len = 0; len < SIMD_TEST_MAXLEN; len++) {
+        fill_text(a, len, cast(UInt32)len);
+        memcpy(b + 3, a, len);
+        REQUIRE(simd_memeq(a, b + 3, len));
+        REQUIRE_EQ(simd_memcmp(a, b + 3, len), 0);
+
+        // Introduce a single difference at every position
+        for(UInt64 pos = 0; pos < len; pos++) {
+            b[3 + pos] ^= 0x81;
+            int expected = sign(memcmp(a, b + 3, len));
+            REQUIRE_FALSE(simd_memeq(a, b + 3, len));
+            REQUIRE_FALSE(__simd_memeq_scalar(a, b + 3, len));
+            REQUIRE_EQ(sign(simd_memcmp(a, b + 3, len)), expected);
+            REQUIRE_EQ(simd_memcmp(a, b + 3, len), __simd_memcmp_scalar(a, b + 3, len));
+            b[3 + pos] ^= 0x81;
+        }
+    }
+}
+
+TEST(Simd, memcmp_nocase) {
+    static char a[SIMD_TEST_MAXLEN + 64];
+    static char b[SIMD_TEST_MAXLEN + 64];
+    for(UInt64 len = 0; len < SIMD_TEST_MAXLEN; len++) {
+        fill_text(a, len, cast(UInt32)(len * 7));
+        // `b` is `a` with the case of every ASCII letter swapped
+        for(UInt64 i = 0; i < len; i++) {
+            char c = a[i];
+            b[i] = (c >= 'a' && c <= 'z') ? char_to_upper(c) : char_to_lower(c);
+        }
+        REQUIRE_EQ(simd_memcmp_nocase(a, b, len), 0);
+        REQUIRE_EQ(__simd_memcmp_nocase_scalar(a, b, len), 0);
+
+        if(len > 0) {
+            UInt64 pos = len / 2;
+            b[pos] = '@';
+            a[pos] = '`';
+            REQUIRE_EQ(simd_memcmp_nocase(a, b, len), __simd_memcmp_nocase_scalar(a, b, len));
+            REQUIRE_NE(simd_memcmp_nocase(a, b, len), 0);
+        }
+    }
+}
+
+TEST(Simd, case_conversion) {
+    static char src[256 * 2];
+    static char out1[256 * 2];
+    static char out2[256 * 2];
+    // Every possible byte value, including the ones bordering the letter ranges
+    for(int i = 0; i < 256 * 2; i++)
+        src[i] = cast(char)(i & 0xFF);
+
+    for(UInt64 len = 0; len <= sizeof(src); len += 13) {
+        simd_tolower(out1, src, len);
+        __simd_tolower_scalar(out2, src, len);
+        REQUIRE(memcmp(out1, out2, len) == 0);
+
+        simd_toupper(out1, src, len);
+        __simd_toupper_scalar(out2, src, len);
+        REQUIRE(memcmp(out1, out2, len) == 0);
+    }
+    simd_toupper(out1, src, sizeof(src));
+    for(UInt64 i = 0; i < sizeof(src); i++) {
+        CHECK_EQ(out1[i], char_to_upper(src[i]));
+    }
+}
+
+TEST(Simd, buffer_case) {
+    cstlBuffer* buff = buff_new("Hello, World! The Quick BROWN fox jumps over the lazy dog 0123456789");
+    cstlBuffer* lower = buff_tolower(buff);
+    cstlBuffer* upper = buff_toupper(buff);
+    CHECK_STREQ(lower->data, "hello, world! the quick brown fox jumps over the lazy dog 0123456789");
+    CHECK_STREQ(upper->data, "HELLO, WORLD! THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789");
+    CHECK(buff_cmp_nocase(lower, upper));
+    CHECK_FALSE(buff_cmp(lower, upper));
+    CHECK(buff_cmp(buff, buff));
+    // `buff_free()` leaves the data alone: the converted copies (`len + 1` bytes, all ASCII) are ours to release
+    cstl_free(upper->allocator, upper->data, upper->len + 1);
+    cstl_free(lower->allocator, lower->data, lower->len + 1);
+    buff_free(upper);
+    buff_free(lower);
+    buff_free(buff);
+}
+
+// Encodes `cp` as UTF-8 into `out`, returning the number of bytes written
+static UInt64 encode_utf8(UInt32 cp, char* out) {
+    if(cp < 0x80) {
+        out[0] = cast(char)cp;
+        return 1;
+    } else if(cp < 0x800) {
+        out[0] = cast(char)(0xC0 | (cp >> 6));
+        out[1] = cast(char)(0x80 | (cp & 0x3F));
+        return 2;
+    } else if(cp < 0x10000) {
+        out[0] = cast(char)(0xE0 | (cp >> 12));
+        out[1] = cast(char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = cast(char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = cast(char)(0xF0 | (cp >> 18));
+    out[1] = cast(char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = cast(char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = cast(char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// Fills `buff` with valid UTF-8 of at most `cap` bytes. Returns the number of bytes used; `*ncodepoints` is set to
+// the number of codepoints written
+static UInt64 fill_utf8(char* buff, UInt64 cap, UInt32 seed, UInt64* ncodepoints) {
+    static const UInt32 ranges[] = { 0x80, 0x800, 0x10000, 0x110000 };
+    UInt64 n = 0;
+    *ncodepoints = 0;
+    for(;;) {
+        seed = seed * 1103515245u + 12345u;
+        UInt32 cp = (seed >> 8) % ranges[(seed >> 4) & 3];
+        if(cp == 0 || (cp >= 0xD800 && cp <= 0xDFFF))
+            cp = 'a';
+        char tmp[4];
+        UInt64 len = encode_utf8(cp, tmp);
+        if(n + len > cap)
+            return n;
+        memcpy(buff + n, tmp, len);
+        n += len;
+        (*ncodepoints)++;
+    }
+}
+
+TEST(Simd, utf8_valid) {
+    static char buff[SIMD_TEST_MAXLEN + 64];
+    for(UInt64 cap = 0; cap < SIMD_TEST_MAXLEN; cap++) {
+        UInt64 ncodepoints;
+        UInt64 n = fill_utf8(buff + 1, cap, cast(UInt32)cap, &ncodepoints);
+        REQUIRE(simd_utf8_validate(buff + 1, n));
+        REQUIRE(__simd_utf8_validate_scalar(buff + 1, n));
+        REQUIRE_EQ(simd_utf8_count(buff + 1, n), ncodepoints);
+        REQUIRE_EQ(__simd_utf8_count_scalar(buff + 1, n), ncodepoints);
+    }
+}
+
+TEST(Simd, utf8_mutated) {
+    static char buff[SIMD_TEST_MAXLEN + 64];
+    static const UInt8 junk[] = { 0x80, 0xBF, 0xC0, 0xC1, 0xC2, 0xE0, 0xED, 0xEF, 0xF0, 0xF4, 0xF5, 0xFF, 0x00 };
+    for(UInt64 cap = 1; cap < SIMD_TEST_MAXLEN; cap += 3) {
+        UInt64 ncodepoints;
+        UInt64 n = fill_utf8(buff, cap, cast(UInt32)(cap * 31), &ncodepoints);
+        for(UInt64 pos = 0; pos < n; pos++) {
+            char saved = buff[pos];
+            for(UInt64 j = 0; j < sizeof(junk); j++) {
+                buff[pos] = cast(char)junk[j];
+                REQUIRE_EQ(simd_utf8_validate(buff, n), __simd_utf8_validate_scalar(buff, n));
+                REQUIRE_EQ(simd_utf8_count(buff, n), __simd_utf8_count_scalar(buff, n));
+            }
+            buff[pos] = saved;
+        }
+    }
+}
+
+TEST(Simd, utf8_edge_cases) {
+    // Each case is placed at the very end of a long ASCII run, so both the block and the tail paths see it
+    static const char* valid[] = {
+        "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF"
+    };
+    static const char* invalid[] = {
+        "\x80", "\xC0\x80", "\xC1\xBF", "\xC2", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xE1\x80", "\xF0\x8F\xBF\xBF", 
+        "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF1\x80\x80", "\xFF", "\xC2\xC2\x80"
+    };
+    char buff[128];
+    for(UInt64 prefix = 0; prefix < 70; prefix++) {
+        memset(buff, 'a', prefix);
+        for(UInt64 i = 0; i < sizeof(valid) / sizeof(valid[0]); i++) {
+            UInt64 n = strlen(valid[i]);
+            memcpy(buff + prefix, valid[i], n);
+            REQUIRE(simd_utf8_validate(buff, prefix + n));
+            REQUIRE(__simd_utf8_validate_scalar(buff, prefix + n));
+            REQUIRE_EQ(simd_utf8_count(buff, prefix + n), prefix + 1);
+        }
+        for(UInt64 i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+            UInt64 n = strlen(invalid[i]);
+            memcpy(buff + prefix, invalid[i], n);
+            REQUIRE_FALSE(simd_utf8_validate(buff, prefix + n));
+            REQUIRE_FALSE(__simd_utf8_validate_scalar(buff, prefix + n));
+        }
+    }
+}
+
+TEST(Simd, utf8_buffer) {
+    cstlBuffer* buff = buff_new(null);
+    buff->is_utf8 = true;
+    buff_set(buff, "h\xC3\xA9llo, w\xC3\xB6rld \xE2\x82\xAC \xF0\x9F\x98\x80");
+    CHECK_EQ(buff->len, 16);
+    buff_free(buff);
+}
+
+// Every public kernel against its scalar reference, on whatever kernels are currently dispatched
+static bool kernels_match_scalar() {
+    static char a[SIMD_TEST_MAXLEN + 64];
+    static char b[SIMD_TEST_MAXLEN + 64];
+    static char lower[SIMD_TEST_MAXLEN + 64];
+    static char expected[SIMD_TEST_MAXLEN + 64];
+    for(UInt64 len = 0; len < SIMD_TEST_MAXLEN; len += 3) {
+        fill_text(a + 1, len, cast(UInt32)len);
+        a[1 + len] = nullchar;
+        memcpy(b, a + 1, len);
+        if(len > 0)
+            b[len / 2] ^= 0x20;
+        if(simd_strlen(a + 1) != len)
+            return false;
+        if(simd_memchr(a + 1, a[1 + len / 2], len) != __simd_memchr_scalar(a + 1, a[1 + len / 2], len))
+            return false;
+        if(simd_memeq(a + 1, b, len) != __simd_memeq_scalar(a + 1, b, len))
+            return false;
+        if(sign(simd_memcmp(a + 1, b, len)) != sign(__simd_memcmp_scalar(a + 1, b, len)))
+            return false;
+        if(sign(simd_memcmp_nocase(a + 1, b, len)) != sign(__simd_memcmp_nocase_scalar(a + 1, b, len)))
+            return false;
+        simd_tolower(lower, a + 1, len);
+        __simd_tolower_scalar(expected, a + 1, len);
+        if(memcmp(lower, expected, len) != 0)
+            return false;
+        simd_toupper(lower, a + 1, len);
+        __simd_toupper_scalar(expected, a + 1, len);
+        if(memcmp(lower, expected, len) != 0)
+            return false;
+
+        UInt64 ncodepoints;
+        UInt64 n = fill_utf8(b, len, cast(UInt32)len, &ncodepoints);
+        if(!simd_utf8_validate(b, n) || simd_utf8_count(b, n) != ncodepoints)
+            return false;
+        if(simd_utf8_validate(a + 1, len) != __simd_utf8_validate_scalar(a + 1, len))
+            return false;
+    }
+    return true;
+}
+
+TEST(Simd, every_dispatch_level) {
+    UInt32 levels[] = {
+        0, 
+        CpuFeatureSSE2, 
+        CpuFeatureSSE2 | CpuFeatureSSSE3, 
+        CpuFeatureSSE2 | CpuFeatureSSSE3 | CpuFeatureAVX | CpuFeatureAVX2, 
+        CpuFeatureNEON, 
+        CpuFeatureAll
+    };
+    for(UInt64 i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+        cpu_set_features_mask(levels[i]);
+        CHECK_TRUE(kernels_match_scalar());
+    }
+    cpu_set_features_mask(CpuFeatureAll);
+}
@@ -0,0 +1,114 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include "helpers.h"
+
+TAU_MAIN()
+
+// Counter ids above the compiler's, free for the tests
+#define TEST_COUNTER_A  (STATS_MAX_COUNTERS - 1)
+#define TEST_COUNTER_B  (STATS_MAX_COUNTERS - 2)
+
+typedef VEC(int) IntVec;
+
+TEST(Stats, add_and_reset) {
+    stats_reset();
+    CHECK_EQ(stats_get(TEST_COUNTER_A), 0);
+    STATS_INC(TEST_COUNTER_A);
+    STATS_ADD(TEST_COUNTER_A, 41);
+    CHECK_EQ(stats_get(TEST_COUNTER_A), 42);
+    stats_thread_flush();
+    CHECK_EQ(stats_get(TEST_COUNTER_A), 42);
+    STATS_INC(TEST_COUNTER_A);
+    CHECK_EQ(stats_get(TEST_COUNTER_A), 43);
+    stats_reset();
+    CHECK_EQ(stats_get(TEST_COUNTER_A), 0);
+}
+
+TEST(Stats, core_counters) {
+    stats_reset();
+    IntVec v;
+    tvec_init(&v);
+    for(int i = 0; i < 1000; i++)
+        tvec_push(&v, i);
+    tvec_free(&v);
+    CHECK_GT(stats_get(StatsVectorRegrows), 5);
+    CHECK_LT(stats_get(StatsVectorRegrows), 100);
+
+    cstlHashMap* map = hashmap_new_str(int, 0);
+    const char* keys[] = {"lex", "parse", "check"};
+    for(int i = 0; i < 3; i++)
+        hashmap_put(map, &keys[i], &i);
+    UInt64 lookups = stats_get(StatsHashMapLookups);
+    const char* key = "parse";
+    CHECK_EQ(*cast(int*)hashmap_get(map, &key), 1);
+    CHECK_EQ(stats_get(StatsHashMapLookups), lookups + 1);
+    CHECK_GE(stats_get(StatsHashMapProbes), stats_get(StatsHashMapLookups));
+    hashmap_free(map);
+}
+
+TEST(Stats, lexer_counters) {
+    stats_reset();
+    char source[] = "x = y + z\n";
+    cstlArena* arena = arena_new(0);
+    Lexer* lexer = lexer_init(arena_allocator(arena), source, "stats.ad");
+    lexer_lex(lexer);
+    CHECK_EQ(stats_get(StatsLexFiles), 1);
+    CHECK_EQ(stats_get(StatsLexBytes), strlen(source));
+    CHECK_EQ(stats_get(StatsLexTokens), segvec_size(lexer->toklist));
+    CHECK_EQ(stats_get(StatsLexTokensByKind + IDENTIFIER), 3);
+    CHECK_EQ(stats_get(StatsLexTokensByKind + TOK_EOF), 1);
+    arena_free(arena);
+}
+
+TEST(Stats, write_table_and_json) {
+    stats_reset();
+    stats_register(TEST_COUNTER_A, "test.zeta");
+    stats_register(TEST_COUNTER_B, "test.alpha");
+    STATS_ADD(TEST_COUNTER_A, 7);
+    STATS_ADD(TEST_COUNTER_B, 12345);
+
+    FILE* file = tmpfile();
+    REQUIRE(file != null);
+    stats_write_table(file);
+    char* table = read_back(file, null);
+    fclose(file);
+    const char* alpha = strstr(table, "test.alpha");
+    const char* zeta = strstr(table, "test.zeta");
+    REQUIRE(alpha != null);
+    REQUIRE(zeta != null);
+    // Sorted by name
+    CHECK(alpha < zeta);
+    CHECK(strstr(alpha, "12345") != null);
+    free(table);
+
+    file = tmpfile();
+    REQUIRE(file != null);
+    stats_write_json(file);
+    char* json = read_back(file, null);
+    fclose(file);
+    CHECK_EQ(json[0], '{');
+    CHECK(strstr(json, "\"test.alpha\": 12345") != null);
+    CHECK(strstr(json, "\"test.zeta\": 7") != null);
+    // Unnamed and zero counters are left out
+    CHECK(strstr(json, "\"vfs.read_hits\"") == null);
+    free(json);
+    stats_reset();
+}
+
+static int count_events(void* arg) {
+    for(int i = 0; i < 10000; i++)
+        STATS_INC(TEST_COUNTER_A);
+    stats_thread_flush();
+    return 0;
+}
+
+TEST(Stats, threads) {
+    stats_reset();
+    cstlThread threads[4];
+    for(int i = 0; i < 4; i++)
+        REQUIRE_TRUE(thread_create(&threads[i], count_events, null));
+    for(int i = 0; i < 4; i++)
+        thread_join(&threads[i]);
+    CHECK_EQ(stats_get(TEST_COUNTER_A), 4 * 10000);
+    stats_reset();
+}
@@ -0,0 +1,375 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+#define NTHREADS    4
+
+TEST(Atomic, operations) {
+    cstlAtomic64 a = {0};
+    CHECK_EQ(atomic64_fetch_add(&a, 5, MemoryOrderRelaxed), 0);
+    CHECK_EQ(atomic64_fetch_sub(&a, 2, MemoryOrderRelaxed), 5);
+    CHECK_EQ(atomic64_load(&a, MemoryOrderAcquire), 3);
+    CHECK_EQ(atomic64_exchange(&a, 10, MemoryOrderAcqRel), 3);
+    Int64 expected = 7;
+    CHECK_FALSE(atomic64_cas(&a, &expected, 8, MemoryOrderSeqCst, MemoryOrderRelaxed));
+    CHECK_EQ(expected, 10);
+    CHECK_TRUE(atomic64_cas(&a, &expected, 8, MemoryOrderSeqCst, MemoryOrderRelaxed));
+    CHECK_EQ(atomic64_load(&a, MemoryOrderRelaxed), 8);
+
+    cstlAtomic32 b = {0};
+    atomic32_store(&b, 0x0F, MemoryOrderRelease);
+    CHECK_EQ(atomic32_fetch_or(&b, 0xF0, MemoryOrderRelaxed), 0x0F);
+    CHECK_EQ(atomic32_fetch_and(&b, 0x3C, MemoryOrderRelaxed), 0xFF);
+    CHECK_EQ(atomic32_load(&b, MemoryOrderRelaxed), 0x3C);
+
+    int x = 0;
+    cstlAtomicPtr p = {0};
+    CHECK_NULL(atomicptr_exchange(&p, &x, MemoryOrderAcqRel));
+    CHECK(atomicptr_load(&p, MemoryOrderAcquire) == &x);
+}
+
+typedef struct Shared {
+    cstlLock lock;
+    cstlMutex mutex;
+    UInt64 locked_count;
+    UInt64 mutex_count;
+    cstlAtomic64 atomic_count;
+} Shared;
+
+static int hammer(void* arg) {
+    Shared* shared = cast(Shared*)arg;
+    for(int i = 0; i < 20000; i++) {
+        lock_acquire(&shared->lock);
+        shared->locked_count++;
+        lock_release(&shared->lock);
+        mutex_lock(&shared->mutex);
+        shared->mutex_count++;
+        mutex_unlock(&shared->mutex);
+        atomic64_fetch_add(&shared->atomic_count, 1, MemoryOrderRelaxed);
+    }
+    return 7;
+}
+
+TEST(Thread, locks) {
+    Shared shared = {.lock = CSTL_LOCK_INIT};
+    mutex_init(&shared.mutex);
+    cstlThread threads[NTHREADS];
+    for(int i = 0; i < NTHREADS; i++)
+        REQUIRE(thread_create(&threads[i], hammer, &shared));
+    for(int i = 0; i < NTHREADS; i++)
+        CHECK_EQ(thread_join(&threads[i]), 7);
+    CHECK_EQ(shared.locked_count, NTHREADS * 20000);
+    CHECK_EQ(shared.mutex_count, NTHREADS * 20000);
+    CHECK_EQ(atomic64_load(&shared.atomic_count, MemoryOrderRelaxed), NTHREADS * 20000);
+    mutex_destroy(&shared.mutex);
+
+    CHECK_TRUE(lock_try_acquire(&shared.lock));
+    CHECK_FALSE(lock_try_acquire(&shared.lock));
+    lock_release(&shared.lock);
+    CHECK_GE(thread_hardware_concurrency(), 1);
+}
+
+typedef struct Mailbox {
+    cstlMutex mutex;
+    cstlCondVar cond;
+    int value;
+} Mailbox;
+
+static int post(void* arg) {
+    Mailbox* box = cast(Mailbox*)arg;
+    thread_sleep_ns(1000000);
+    mutex_lock(&box->mutex);
+    box->value = 42;
+    condvar_signal(&box->cond);
+    mutex_unlock(&box->mutex);
+    return 0;
+}
+
+TEST(Thread, condvar) {
+    Mailbox box = {0};
+    mutex_init(&box.mutex);
+    condvar_init(&box.cond);
+
+    mutex_lock(&box.mutex);
+    CHECK_FALSE(condvar_wait_for(&box.cond, &box.mutex, 1000000));
+    cstlThread thread;
+    REQUIRE(thread_create(&thread, post, &box));
+    while(box.value == 0)
+        condvar_wait(&box.cond, &box.mutex);
+    mutex_unlock(&box.mutex);
+    thread_join(&thread);
+    CHECK_EQ(box.value, 42);
+
+    condvar_destroy(&box.cond);
+    mutex_destroy(&box.mutex);
+}
+
+static cstlOnce once = CSTL_ONCE_INIT;
+static cstlAtomic32 once_calls = {0};
+
+static void init_once(void* arg) {
+    thread_sleep_ns(1000000);
+    atomic32_fetch_add(&once_calls, 1, MemoryOrderRelaxed);
+}
+
+static int call_once(void* arg) {
+    once_call(&once, init_once, null);
+    // Every caller returns after the initializer has finished
+    return atomic32_load(&once_calls, MemoryOrderRelaxed);
+}
+
+TEST(Thread, once) {
+    cstlThread threads[NTHREADS];
+    for(int i = 0; i < NTHREADS; i++)
+        REQUIRE(thread_create(&threads[i], call_once, null));
+    for(int i = 0; i < NTHREADS; i++)
+        CHECK_EQ(thread_join(&threads[i]), 1);
+    once_call(&once, init_once, null);
+    CHECK_EQ(atomic32_load(&once_calls, MemoryOrderRelaxed), 1);
+}
+
+static cstlTlsKey tls_key;
+static cstlAtomic32 tls_destroyed = {0};
+
+static void tls_destructor(void* value) {
+    atomic32_fetch_add(&tls_destroyed, 1, MemoryOrderRelaxed);
+}
+
+static int use_tls(void* arg) {
+    if(tls_get(&tls_key) != null)
+        return 1;
+    tls_set(&tls_key, arg);
+    return tls_get(&tls_key) == arg ? 0 : 1;
+}
+
+TEST(Thread, tls) {
+    REQUIRE(tls_create(&tls_key, tls_destructor));
+    int values[NTHREADS];
+    cstlThread threads[NTHREADS];
+    for(int i = 0; i < NTHREADS; i++)
+        REQUIRE(thread_create(&threads[i], use_tls, &values[i]));
+    for(int i = 0; i < NTHREADS; i++)
+        CHECK_EQ(thread_join(&threads[i]), 0);
+    CHECK_EQ(atomic32_load(&tls_destroyed, MemoryOrderRelaxed), NTHREADS);
+    CHECK_NULL(tls_get(&tls_key));
+    tls_delete(&tls_key);
+}
+
+TEST(WorkDeque, owner) {
+    cstlWorkDeque deque;
+    work_deque_init(&deque, 4);
+    static int items[1000];
+    for(int i = 0; i < 1000; i++)
+        work_deque_push(&deque, &items[i]);
+    CHECK_EQ(work_deque_size(&deque), 1000);
+    // Thieves take the oldest, the owner the newest
+    CHECK(work_deque_steal(&deque) == &items[0]);
+    CHECK(work_deque_pop(&deque) == &items[999]);
+    for(int i = 998; i >= 1; i--)
+        REQUIRE(work_deque_pop(&deque) == &items[i]);
+    CHECK_NULL(work_deque_pop(&deque));
+    CHECK_NULL(work_deque_steal(&deque));
+    work_deque_free(&deque);
+}
+
+#define DEQUE_ITEMS     200000
+
+typedef struct StealState {
+    cstlWorkDeque deque;
+    cstlAtomic32 done;
+    UInt8* seen;
+    cstlAtomic64 stolen;
+} StealState;
+
+static int thief(void* arg) {
+    StealState* state = cast(StealState*)arg;
+    for(;;) {
+        UInt8* item = cast(UInt8*)work_deque_steal(&state->deque);
+        if(item) {
+            (*item)++;
+            atomic64_fetch_add(&state->stolen, 1, MemoryOrderRelaxed);
+        } else if(atomic32_load(&state->done, MemoryOrderAcquire)) {
+            if(work_deque_size(&state->deque) == 0)
+                return 0;
+        }
+    }
+}
+
+TEST(WorkDeque, concurrent_steal) {
+    StealState state;
+    work_deque_init(&state.deque, 0);
+    atomic32_store(&state.done, 0, MemoryOrderRelaxed);
+    atomic64_store(&state.stolen, 0, MemoryOrderRelaxed);
+    state.seen = cast(UInt8*)calloc(DEQUE_ITEMS, 1);
+
+    cstlThread threads[NTHREADS - 1];
+    for(int i = 0; i < NTHREADS - 1; i++)
+        REQUIRE(thread_create(&threads[i], thief, &state));
+    // The owner pushes everything (growing the buffer under the thieves' feet) and pops now and then
+    Int64 popped = 0;
+    for(int i = 0; i < DEQUE_ITEMS; i++) {
+        work_deque_push(&state.deque, &state.seen[i]);
+        if(i % 3 == 0) {
+            UInt8* item = cast(UInt8*)work_deque_pop(&state.deque);
+            if(item) {
+                (*item)++;
+                popped++;
+            }
+        }
+    }
+    UInt8* item;
+    while((item = cast(UInt8*)work_deque_pop(&state.deque)) != null) {
+        (*item)++;
+        popped++;
+    }
+    atomic32_store(&state.done, 1, MemoryOrderRelease);
+    for(int i = 0; i < NTHREADS - 1; i++)
+        thread_join(&threads[i]);
+
+    // Every item was taken exactly once
+    bool once_each = true;
+    for(int i = 0; i < DEQUE_ITEMS; i++)
+        once_each &= state.seen[i] == 1;
+    CHECK_TRUE(once_each);
+    CHECK_EQ(popped + atomic64_load(&state.stolen, MemoryOrderRelaxed), DEQUE_ITEMS);
+    free(state.seen);
+    work_deque_free(&state.deque);
+}
+
+typedef struct Tree {
+    cstlThreadPool* pool;
+    cstlAtomic64 nodes;
+    UInt32 depth;
+} Tree;
+
+typedef struct TreeNode {
+    Tree* tree;
+    UInt32 depth;
+} TreeNode;
+
+// Each node submits two children from inside the pool, so most of the work goes through the workers' deques
+static void visit(void* arg) {
+    TreeNode* node = cast(TreeNode*)arg;
+    atomic64_fetch_add(&node->tree->nodes, 1, MemoryOrderRelaxed);
+    if(node->depth < node->tree->depth) {
+        for(int i = 0; i < 2; i++) {
+            TreeNode* child = cast(TreeNode*)malloc(sizeof(TreeNode));
+            child->tree = node->tree;
+            child->depth = node->depth + 1;
+            thread_pool_submit(node->tree->pool, visit, child);
+        }
+    }
+    free(node);
+}
+
+static void count(void* arg) {
+    atomic64_fetch_add(cast(cstlAtomic64*)arg, 1, MemoryOrderRelaxed);
+}
+
+TEST(ThreadPool, flat_and_nested) {
+    cstlThreadPool* pool = thread_pool_new(NTHREADS);
+    CHECK_EQ(thread_pool_size(pool), NTHREADS);
+    CHECK_EQ(thread_pool_worker_index(pool), -1);
+
+    cstlAtomic64 counter = {0};
+    for(int i = 0; i < 10000; i++)
+        thread_pool_submit(pool, count, &counter);
+    thread_pool_wait(pool);
+    CHECK_EQ(atomic64_load(&counter, MemoryOrderRelaxed), 10000);
+
+    Tree tree = {pool, {0}, 14};
+    TreeNode* root = cast(TreeNode*)malloc(sizeof(TreeNode));
+    root->tree = &tree;
+    root->depth = 0;
+    thread_pool_submit(pool, visit, root);
+    thread_pool_wait(pool);
+    CHECK_EQ(atomic64_load(&tree.nodes, MemoryOrderRelaxed), (1 << 15) - 1);
+
+    // Idle workers go to sleep, and wake up for new work
+    thread_sleep_ns(20000000);
+    thread_pool_submit(pool, count, &counter);
+    thread_pool_wait(pool);
+    CHECK_EQ(atomic64_load(&counter, MemoryOrderRelaxed), 10001);
+    thread_pool_free(pool);
+}
+
+typedef struct WorkerSlot {
+    cstlThreadPool* pool;
+    Int32 index;
+} WorkerSlot;
+
+static void record_worker(void* arg) {
+    WorkerSlot* slot = cast(WorkerSlot*)arg;
+    slot->index = thread_pool_worker_index(slot->pool);
+}
+
+TEST(ThreadPool, worker_index_and_free_waits) {
+    cstlThreadPool* pool = thread_pool_new(NTHREADS);
+    WorkerSlot slots[100];
+    for(int i = 0; i < 100; i++) {
+        slots[i].pool = pool;
+        slots[i].index = -2;
+        thread_pool_submit(pool, record_worker, &slots[i]);
+    }
+    // Frees only once the pending tasks have run. Tasks run on the workers, or (with index -1) on the thread 
+    // waiting for them
+    thread_pool_free(pool);
+    bool in_range = true;
+    for(int i = 0; i < 100; i++)
+        in_range &= slots[i].index >= -1 && slots[i].index < NTHREADS;
+    CHECK_TRUE(in_range);
+}
+
+typedef struct GroupTree {
+    cstlTaskGroup* group;
+    cstlAtomic64 nodes;
+    UInt32 depth;
+} GroupTree;
+
+typedef struct GroupNode {
+    GroupTree* tree;
+    UInt32 depth;
+} GroupNode;
+
+static void visit_group(void* arg) {
+    GroupNode* node = cast(GroupNode*)arg;
+    atomic64_fetch_add(&node->tree->nodes, 1, MemoryOrderRelaxed);
+    if(node->depth < node->tree->depth) {
+        for(int i = 0; i < 2; i++) {
+            GroupNode* child = cast(GroupNode*)malloc(sizeof(GroupNode));
+            child->tree = node->tree;
+            child->depth = node->depth + 1;
+            task_group_submit(node->tree->group, visit_group, child);
+        }
+    }
+    free(node);
+}
+
+TEST(TaskGroup, shared_pool) {
+    cstlThreadPool* pool = thread_pool_shared();
+    CHECK_TRUE(pool == thread_pool_shared());
+    CHECK_TRUE(thread_pool_size(pool) >= 1);
+
+    // Two groups share the pool; each wait only covers (and returns once) its own tasks have run
+    cstlTaskGroup flat, nested;
+    task_group_init(&flat, pool);
+    task_group_init(&nested, pool);
+    cstlAtomic64 counter = {0};
+    GroupTree tree = {&nested, {0}, 12};
+    GroupNode* root = cast(GroupNode*)malloc(sizeof(GroupNode));
+    root->tree = &tree;
+    root->depth = 0;
+    task_group_submit(&nested, visit_group, root);
+    for(int i = 0; i < 10000; i++)
+        task_group_submit(&flat, count, &counter);
+
+    task_group_wait(&flat);
+    CHECK_EQ(atomic64_load(&counter, MemoryOrderRelaxed), 10000);
+    task_group_wait(&nested);
+    CHECK_EQ(atomic64_load(&tree.nodes, MemoryOrderRelaxed), (1 << 13) - 1);
+
+    // A group can be waited on again after more work is added
+    task_group_submit(&flat, count, &counter);
+    task_group_wait(&flat);
+    CHECK_EQ(atomic64_load(&counter, MemoryOrderRelaxed), 10001);
+}
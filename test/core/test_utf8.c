@@ -0,0 +1,105 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+// Deterministic codepoint generator covering all four encoding lengths (no surrogates, no null)
+static Rune next_codepoint(UInt32* seed) {
+    static const UInt32 ranges[] = { 0x80, 0x800, 0x10000, 0x110000 };
+    *seed = *seed * 1103515245u + 12345u;
+    Rune cp = (*seed >> 8) % ranges[(*seed >> 4) & 3];
+    if(cp == 0 || (cp >= 0xD800 && cp <= 0xDFFF))
+        cp = 'a';
+    return cp;
+}
+
+TEST(UTF8, ubuff_new) {
+    cstlUTF8Str* ubuff = ubuff_new("h\xC3\xA9llo \xE2\x82\xAC \xF0\x9F\x98\x80");
+    CHECK_EQ(ubuff_len(ubuff), 9);
+    CHECK_EQ(ubuff_nbytes(ubuff), 15);
+    CHECK_EQ(ubuff_at(ubuff, 0), 'h');
+    CHECK_EQ(ubuff_at(ubuff, 1), 0xE9);
+    CHECK_EQ(ubuff_at(ubuff, 6), 0x20AC);
+    CHECK_EQ(ubuff_at(ubuff, 8), 0x1F600);
+    CHECK_EQ(ubuff_byte_offset(ubuff, 9), 15);
+    ubuff_free(ubuff);
+}
+
+TEST(UTF8, ubuff_at_after_push) {
+    static Rune expected[5000];
+    cstlUTF8Str* ubuff = ubuff_new(null);
+    UInt32 seed = 42;
+
+    for(UInt64 i = 0; i < 5000; i++) {
+        expected[i] = next_codepoint(&seed);
+        ubuff_push_char(ubuff, expected[i]);
+
+        // Random access every so often, so that the index is built early and then kept up to date by the pushes
+        if(i % 97 == 0)
+            REQUIRE_EQ(ubuff_at(ubuff, i / 2), expected[i / 2]);
+    }
+    REQUIRE_EQ(ubuff_len(ubuff), 5000);
+    for(UInt64 i = 0; i < 5000; i++)
+        REQUIRE_EQ(ubuff_at(ubuff, i), expected[i]);
+
+    ubuff_free(ubuff);
+}
+
+TEST(UTF8, ubuff_append_and_slice) {
+    cstlUTF8Str* ubuff = ubuff_new(null);
+    for(int i = 0; i < 100; i++)
+        ubuff_append(ubuff, "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+    REQUIRE_EQ(ubuff_len(ubuff), 400);
+    REQUIRE_EQ(ubuff_nbytes(ubuff), 1000);
+    CHECK_EQ(ubuff_at(ubuff, 399), 0x1F600);
+    CHECK_EQ(ubuff_at(ubuff, 200), 'a');
+    CHECK_EQ(ubuff_byte_offset(ubuff, 200), 500);
+
+    cstlUTF8Str* slice = ubuff_slice(ubuff, 129, 135);
+    CHECK_EQ(ubuff_len(slice), 6);
+    CHECK_STREQ(cast(char*)slice->data, "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" "a\xC3\xA9\xE2\x82\xAC");
+
+    // Re-assigning the data drops the (now stale) index
+    ubuff_set(ubuff, "xyz");
+    CHECK_EQ(ubuff_len(ubuff), 3);
+    CHECK_EQ(ubuff_at(ubuff, 2), 'z');
+
+    ubuff_free(slice);
+    ubuff_free(ubuff);
+}
+
+TEST(UTF8, category) {
+    CHECK_EQ(utf8_category('A'), UTF8_CATEGORY_LU);
+    CHECK_EQ(utf8_category('z'), UTF8_CATEGORY_LL);
+    CHECK_EQ(utf8_category('7'), UTF8_CATEGORY_ND);
+    CHECK_EQ(utf8_category(' '), UTF8_CATEGORY_ZS);
+    CHECK_EQ(utf8_category(0xE9), UTF8_CATEGORY_LL);        // é
+    CHECK_EQ(utf8_category(0x3B1), UTF8_CATEGORY_LL);       // α
+    CHECK_EQ(utf8_category(0x4E2D), UTF8_CATEGORY_LO);      // 中
+    CHECK_EQ(utf8_category(0x0301), UTF8_CATEGORY_MN);      // combining acute accent
+    CHECK_EQ(utf8_category(0x20AC), UTF8_CATEGORY_SC);      // €
+    CHECK_EQ(utf8_category(0x1F600), UTF8_CATEGORY_SO);     // 😀
+    CHECK_EQ(utf8_category(0xD800), UTF8_CATEGORY_CS);
+    CHECK_EQ(utf8_category(0xE000), UTF8_CATEGORY_CO);
+    CHECK_EQ(utf8_category(0x10FFFF), UTF8_CATEGORY_CN);
+    CHECK_EQ(utf8_category(0x110000), UTF8_CATEGORY_CN);
+
+    CHECK_EQ(utf8_bidi_class('a'), UTF8_BIDI_CLASS_L);
+    CHECK_EQ(utf8_bidi_class(0x627), UTF8_BIDI_CLASS_AL);   // Arabic alef
+    CHECK_EQ(utf8_boundclass('\n'), UTF8_BOUNDCLASS_LF);
+    CHECK_EQ(utf8_boundclass('\r'), UTF8_BOUNDCLASS_CR);
+}
+
+TEST(UTF8, identifiers) {
+    CHECK(utf8_is_identifier_start('_'));
+    CHECK(utf8_is_identifier_start(0x3B1));
+    CHECK(utf8_is_identifier_start(0x4E2D));
+    CHECK_FALSE(utf8_is_identifier_start('1'));
+    CHECK_FALSE(utf8_is_identifier_start(0x0301));
+    CHECK_FALSE(utf8_is_identifier_start(0x20AC));
+
+    CHECK(utf8_is_identifier_continue('1'));
+    CHECK(utf8_is_identifier_continue(0x0301));
+    CHECK(utf8_is_identifier_continue(0x0661));             // Arabic-Indic digit one
+    CHECK_FALSE(utf8_is_identifier_continue('-'));
+    CHECK_FALSE(utf8_is_identifier_continue(0x1F600));
+}
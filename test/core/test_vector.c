@@ -0,0 +1,228 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+typedef struct {
+    UInt64 a;
+    char b;
+} Pair;
+
+typedef VEC(Pair) PairVec;
+typedef VEC(int) IntVec;
+
+TEST(TypedVector, init) {
+    IntVec v;
+    tvec_init(&v);
+    CHECK_EQ(tvec_size(&v), 0);
+    CHECK_EQ(tvec_cap(&v), 0);
+    CHECK(tvec_is_empty(&v));
+    CHECK(tvec_begin(&v) == null);
+    tvec_free(&v);
+}
+
+TEST(TypedVector, push_and_at) {
+    PairVec v;
+    tvec_init(&v);
+    for(UInt64 i = 0; i < 100000; i++) {
+        Pair p = { i * 3, cast(char)(i & 0x7F) };
+        tvec_push(&v, p);
+    }
+    REQUIRE_EQ(tvec_size(&v), 100000);
+    REQUIRE_GE(tvec_cap(&v), 100000);
+    for(UInt64 i = 0; i < 100000; i++) {
+        REQUIRE_EQ(tvec_at(&v, i)->a, i * 3);
+        REQUIRE_EQ(tvec_at(&v, i)->b, cast(char)(i & 0x7F));
+    }
+    CHECK_EQ(tvec_last(&v)->a, 99999 * 3);
+    CHECK(tvec_end(&v) == tvec_begin(&v) + 100000);
+    tvec_free(&v);
+    CHECK_EQ(tvec_size(&v), 0);
+}
+
+TEST(TypedVector, reserve_and_pop) {
+    IntVec v;
+    tvec_init(&v);
+    tvec_reserve(&v, 1000);
+    CHECK_EQ(tvec_cap(&v), 1000);
+    int* data = tvec_begin(&v);
+
+    // Pushing within the reserved capacity must not reallocate
+    for(int i = 0; i < 1000; i++)
+        tvec_push(&v, i);
+    CHECK(tvec_begin(&v) == data);
+    CHECK_EQ(tvec_cap(&v), 1000);
+
+    CHECK_EQ(tvec_pop(&v), 999);
+    CHECK_EQ(tvec_pop(&v), 998);
+    CHECK_EQ(tvec_size(&v), 998);
+
+    tvec_clear(&v);
+    CHECK(tvec_is_empty(&v));
+    CHECK_EQ(tvec_cap(&v), 1000);
+    tvec_free(&v);
+}
+
+TEST(TypedVector, push_n_and_extend) {
+    int src[300];
+    for(int i = 0; i < 300; i++)
+        src[i] = i;
+
+    IntVec v, w;
+    tvec_init(&v);
+    tvec_init(&w);
+    tvec_push_n(&v, src, 100);
+    tvec_push_n(&v, src + 100, 200);
+    REQUIRE_EQ(tvec_size(&v), 300);
+    for(int i = 0; i < 300; i++)
+        REQUIRE_EQ(*tvec_at(&v, i), i);
+
+    tvec_push(&w, -1);
+    tvec_extend(&w, &v);
+    REQUIRE_EQ(tvec_size(&w), 301);
+    CHECK_EQ(*tvec_at(&w, 0), -1);
+    CHECK_EQ(*tvec_at(&w, 300), 299);
+
+    tvec_shrink_to_fit(&w);
+    CHECK_EQ(tvec_cap(&w), 301);
+    CHECK_EQ(*tvec_at(&w, 150), 149);
+    tvec_clear(&w);
+    tvec_shrink_to_fit(&w);
+    CHECK_EQ(tvec_cap(&w), 0);
+    CHECK(tvec_begin(&w) == null);
+
+    tvec_free(&v);
+    tvec_free(&w);
+}
+
+TEST(Vector, bulk) {
+    UInt64 src[64];
+    for(UInt64 i = 0; i < 64; i++)
+        src[i] = i * i;
+
+    cstlVector* v = vec_new(UInt64, 1);
+    REQUIRE(vec_reserve(v, 500));
+    CHECK_EQ(vec_cap(v), 500);
+    REQUIRE(vec_push_n(v, src, 64));
+    CHECK_EQ(vec_size(v), 64);
+    CHECK_EQ(vec_cap(v), 500);
+    CHECK_EQ(*cast(UInt64*)vec_at(v, 63), 63 * 63);
+
+    cstlVector* w = vec_new(UInt64, 1);
+    REQUIRE(vec_extend(w, v));
+    REQUIRE(vec_extend(w, v));
+    REQUIRE_EQ(vec_size(w), 128);
+    CHECK_EQ(*cast(UInt64*)vec_at(w, 64), 0);
+    CHECK_EQ(*cast(UInt64*)vec_at(w, 127), 63 * 63);
+
+    REQUIRE(vec_shrink_to_fit(v));
+    CHECK_EQ(vec_cap(v), 64);
+    CHECK_EQ(*cast(UInt64*)vec_at(v, 10), 100);
+
+    vec_free(v);
+    vec_free(w);
+}
+
+typedef SMALLVEC(int, 4) IntSmallVec;
+
+TEST(SmallVector, inline_then_spill) {
+    IntSmallVec v;
+    svec_init(&v);
+    CHECK_EQ(svec_size(&v), 0);
+    CHECK_EQ(svec_cap(&v), 4);
+
+    for(int i = 0; i < 4; i++)
+        svec_push(&v, i * 10);
+    CHECK(svec_is_inline(&v));
+    CHECK(svec_begin(&v) == v.inline_data);
+    CHECK_EQ(*svec_last(&v), 30);
+
+    for(int i = 4; i < 1000; i++)
+        svec_push(&v, i * 10);
+    REQUIRE_FALSE(svec_is_inline(&v));
+    REQUIRE_EQ(svec_size(&v), 1000);
+    REQUIRE_GE(svec_cap(&v), 1000);
+    for(int i = 0; i < 1000; i++)
+        REQUIRE_EQ(*svec_at(&v, i), i * 10);
+
+    CHECK_EQ(svec_pop(&v), 9990);
+    svec_free(&v);
+    CHECK(svec_is_inline(&v));
+    CHECK_EQ(svec_size(&v), 0);
+}
+
+TEST(SmallVector, zeroed_and_copied) {
+    // A zeroed small vector must be usable without `svec_init()`
+    IntSmallVec v;
+    memset(&v, 0, sizeof(v));
+    svec_push(&v, 7);
+    svec_push(&v, 8);
+    CHECK(svec_is_inline(&v));
+    CHECK_EQ(svec_cap(&v), 4);
+
+    // Copying by value keeps the inline elements valid
+    IntSmallVec w = v;
+    svec_push(&w, 9);
+    CHECK_EQ(svec_size(&w), 3);
+    CHECK_EQ(*svec_at(&w, 0), 7);
+    CHECK_EQ(*svec_at(&w, 2), 9);
+    CHECK_EQ(svec_size(&v), 2);
+    svec_free(&w);
+}
+
+typedef SEGVEC(Pair) PairSegVec;
+
+TEST(SegmentedVector, stable_addresses) {
+    PairSegVec v;
+    segvec_init(&v);
+    CHECK_EQ(segvec_size(&v), 0);
+    CHECK_EQ(segvec_nchunks(&v), 0);
+
+    Pair* first = null;
+    for(UInt64 i = 0; i < 100000; i++) {
+        Pair p = { i * 3, cast(char)(i & 0x7F) };
+        segvec_push(&v, p);
+        if(i == 0)
+            first = segvec_at(&v, 0);
+    }
+    REQUIRE_EQ(segvec_size(&v), 100000);
+    REQUIRE_GE(segvec_cap(&v), 100000);
+    // Growing never moves existing elements
+    CHECK(first == segvec_at(&v, 0));
+    CHECK_EQ(first->a, 0);
+
+    for(UInt64 i = 0; i < 100000; i++) {
+        REQUIRE_EQ(segvec_at(&v, i)->a, i * 3);
+        REQUIRE_EQ(segvec_at(&v, i)->b, cast(char)(i & 0x7F));
+    }
+    CHECK_EQ(segvec_last(&v)->a, 99999 * 3);
+
+    // Chunk-wise iteration visits every element once, in order
+    UInt64 n = 0;
+    for(UInt32 k = 0; k < segvec_nchunks(&v); k++)
+        for(Pair* p = segvec_chunk_begin(&v, k); p < segvec_chunk_end(&v, k); p++)
+            REQUIRE_EQ(p->a, (n++) * 3);
+    CHECK_EQ(n, 100000);
+
+    segvec_free(&v);
+    CHECK_EQ(segvec_size(&v), 0);
+    CHECK_EQ(segvec_nchunks(&v), 0);
+}
+
+TEST(SegmentedVector, reserve_hint) {
+    PairSegVec v;
+    segvec_init(&v);
+    segvec_reserve(&v, 1000);
+    CHECK_EQ(segvec_nchunks(&v), 1);
+    CHECK_EQ(segvec_cap(&v), 1024);
+
+    for(UInt64 i = 0; i < 1025; i++) {
+        Pair p = { i, 0 };
+        segvec_push(&v, p);
+    }
+    CHECK_EQ(segvec_nchunks(&v), 2);
+    CHECK_EQ(segvec_cap(&v), 1024 + 2048);
+    CHECK_EQ(segvec_at(&v, 1023)->a, 1023);
+    CHECK_EQ(segvec_at(&v, 1024)->a, 1024);
+    CHECK(segvec_at(&v, 1024) == segvec_chunk_begin(&v, 1));
+    segvec_free(&v);
+}
@@ -0,0 +1,167 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+
+TAU_MAIN()
+
+static bool write_file(const char* fname, const char* contents) {
+    FILE* file = fopen(fname, "wb");
+    if(!file)
+        return false;
+    fputs(contents, file);
+    fclose(file);
+    return true;
+}
+
+TEST(Vfs, canonical_paths) {
+    cstlVfs* vfs = vfs_new(null);
+    cstlVfsPath a = vfs_intern(vfs, "/usr/lib/adorad");
+    CHECK_STREQ(vfs_path(vfs, a), "/usr/lib/adorad");
+    CHECK_EQ(vfs_intern(vfs, "/usr//lib/./adorad/"), a);
+    CHECK_EQ(vfs_intern(vfs, "/usr/share/../lib/adorad"), a);
+    CHECK_EQ(vfs_intern(vfs, "/../../usr/lib/adorad"), a);
+    CHECK_NE(vfs_intern(vfs, "/usr/lib"), a);
+    CHECK_EQ(vfs_path_length(vfs, a), strlen("/usr/lib/adorad"));
+
+    cstlVfsPath root = vfs_intern(vfs, "/");
+    CHECK_STREQ(vfs_path(vfs, root), "/");
+    CHECK_EQ(vfs_intern(vfs, "/a/.."), root);
+    CHECK_EQ(vfs_intern(vfs, "//"), root);
+    vfs_free(vfs);
+}
+
+TEST(Vfs, relative_paths) {
+    cstlVfs* vfs = vfs_new(null);
+    cstlVfsPath cwd = vfs_intern(vfs, ".");
+    CHECK_EQ(vfs_intern(vfs, ""), cwd);
+    CHECK_EQ(vfs_intern(vfs, "x/.."), cwd);
+
+    cstlVfsPath file = vfs_intern(vfs, "src/main.ad");
+    CHECK_EQ(vfs_join(vfs, cwd, "src/main.ad"), file);
+    CHECK_EQ(vfs_join(vfs, vfs_intern(vfs, "src"), "main.ad"), file);
+    CHECK_EQ(vfs_join(vfs, vfs_intern(vfs, "other"), "../src/main.ad"), file);
+    CHECK_EQ(vfs_join(vfs, file, "/usr"), vfs_intern(vfs, "/usr"));
+    vfs_free(vfs);
+}
+
+TEST(Vfs, dirname_basename) {
+    cstlVfs* vfs = vfs_new(null);
+    cstlVfsPath file = vfs_intern(vfs, "/home/user/lib.tar.ad");
+    CHECK_STREQ(vfs_basename(vfs, file), "lib.tar.ad");
+    CHECK_STREQ(vfs_extname(vfs, file), ".ad");
+
+    cstlVfsPath dir = vfs_dirname(vfs, file);
+    CHECK_STREQ(vfs_path(vfs, dir), "/home/user");
+    CHECK_EQ(dir, vfs_intern(vfs, "/home/user"));
+    CHECK_STREQ(vfs_basename(vfs, dir), "user");
+    CHECK_STREQ(vfs_extname(vfs, dir), "");
+
+    cstlVfsPath home = vfs_dirname(vfs, dir);
+    cstlVfsPath root = vfs_dirname(vfs, home);
+    CHECK_STREQ(vfs_path(vfs, root), "/");
+    CHECK_EQ(vfs_dirname(vfs, root), root);
+    CHECK_STREQ(vfs_basename(vfs, root), "");
+    vfs_free(vfs);
+}
+
+TEST(Vfs, stat_cache) {
+    const char* fname = "test_vfs_stat.tmp";
+    remove(fname);
+    cstlVfs* vfs = vfs_new(null);
+    cstlVfsPath path = vfs_intern(vfs, fname);
+    CHECK_FALSE(vfs_exists(vfs, path));
+
+    // Cached: the new file isn't seen until the path is invalidated
+    REQUIRE_TRUE(write_file(fname, "hello"));
+    UInt64 nsyscalls = vfs->nsyscalls;
+    CHECK_FALSE(vfs_exists(vfs, path));
+    CHECK_EQ(vfs->nsyscalls, nsyscalls);
+
+    vfs_invalidate(vfs, path);
+    CHECK_TRUE(vfs_is_file(vfs, path));
+    CHECK_FALSE(vfs_is_dir(vfs, path));
+    CHECK_EQ(vfs_stat(vfs, path).size, 5);
+    CHECK_TRUE(vfs_is_dir(vfs, vfs_dirname(vfs, path)));
+
+    remove(fname);
+    CHECK_TRUE(vfs_exists(vfs, path));
+    vfs_invalidate_all(vfs);
+    CHECK_FALSE(vfs_exists(vfs, path));
+    vfs_free(vfs);
+}
+
+TEST(Vfs, read) {
+    const char* fname = "test_vfs_read.tmp";
+    REQUIRE_TRUE(write_file(fname, "let x = 1"));
+    cstlVfs* vfs = vfs_new(null);
+    cstlVfsPath path = vfs_intern(vfs, fname);
+
+    UInt64 length = 0;
+    const char* contents = vfs_read(vfs, path, &length);
+    REQUIRE_NOT_NULL(contents);
+    CHECK_STREQ(contents, "let x = 1");
+    CHECK_EQ(length, 9);
+
+    // Served from the cache
+    UInt64 nsyscalls = vfs->nsyscalls;
+    CHECK_EQ(vfs_read(vfs, path, null), contents);
+    CHECK_EQ(vfs->nsyscalls, nsyscalls);
+
+    REQUIRE_TRUE(write_file(fname, "let y"));
+    vfs_invalidate_all(vfs);
+    CHECK_STREQ(vfs_read(vfs, path, &length), "let y");
+    CHECK_EQ(length, 5);
+
+    remove(fname);
+    CHECK_NULL(vfs_read(vfs, vfs_intern(vfs, "this/file/does/not/exist"), null));
+    vfs_free(vfs);
+}
+
+TEST(Vfs, overlays) {
+    const char* fname = "test_vfs_overlay.tmp";
+    REQUIRE_TRUE(write_file(fname, "on disk"));
+    cstlVfs* vfs = vfs_new(null);
+    cstlVfsPath path = vfs_intern(vfs, fname);
+    CHECK_STREQ(vfs_read(vfs, path, null), "on disk");
+
+    UInt64 nsyscalls = vfs->nsyscalls;
+    vfs_set_overlay(vfs, path, "unsaved buffer", 14);
+    CHECK_TRUE(vfs_has_overlay(vfs, path));
+    UInt64 length = 0;
+    CHECK_STREQ(vfs_read(vfs, path, &length), "unsaved buffer");
+    CHECK_EQ(length, 14);
+    CHECK_EQ(vfs_stat(vfs, path).size, 14);
+
+    vfs_remove_overlay(vfs, path);
+    CHECK_FALSE(vfs_has_overlay(vfs, path));
+    CHECK_STREQ(vfs_read(vfs, path, null), "on disk");
+    CHECK_EQ(vfs->nsyscalls, nsyscalls);
+    remove(fname);
+
+    // A file that only exists in memory
+    cstlVfsPath ghost = vfs_intern(vfs, "no/such/dir/ghost.ad");
+    CHECK_FALSE(vfs_exists(vfs, ghost));
+    vfs_set_overlay(vfs, ghost, "", 0);
+    CHECK_TRUE(vfs_is_file(vfs, ghost));
+    CHECK_STREQ(vfs_read(vfs, ghost, null), "");
+    vfs_free(vfs);
+}
+
+TEST(Vfs, many_paths) {
+    // Entries move as the table grows; ids and paths must stay stable
+    cstlVfs* vfs = vfs_new(null);
+    char path[64];
+    for(int i = 0; i < 1000; i++) {
+        snprintf(path, sizeof(path), "/dir%d/file%d.ad", i % 10, i);
+        CHECK_EQ(vfs_intern(vfs, path), cast(cstlVfsPath)(i + 1));
+    }
+    // Directories are only interned once `vfs_dirname()` asks for them
+    CHECK_EQ(vfs->nentries, 1001);
+    for(int i = 0; i < 1000; i++) {
+        snprintf(path, sizeof(path), "/dir%d/file%d.ad", i % 10, i);
+        cstlVfsPath id = vfs_intern(vfs, path);
+        CHECK_STREQ(vfs_path(vfs, id), path);
+        snprintf(path, sizeof(path), "/dir%d", i % 10);
+        CHECK_STREQ(vfs_path(vfs, vfs_dirname(vfs, id)), path);
+    }
+    vfs_free(vfs);
+}
@@ -0,0 +1,130 @@
+# Generates the slicing-by-8 CRC tables used by `hash_crc32()`, `hash_crc32c()` and `hash_crc64()`
+# The output is:
+#   adorad/core/hash_tables.h
+#
+# Usage (from the root):
+#   python tools/scripts/generate_crc_tables.py
+#
+# All three CRCs are updated a byte at a time as
+#       crc = (crc >> 8) ^ table[0][(crc ^ byte) & 0xFF]
+# Slicing-by-8 folds eight of these steps into eight independent lookups, using
+#       table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF]
+# so the sliced and bytewise versions give identical results.
+
+import os
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+OUTFILE = os.path.join(ROOT, 'adorad', 'core', 'hash_tables.h')
+
+NUM_SLICES = 8
+
+CRC32_POLY  = 0xEDB88320            # IEEE 802.3 (reflected)
+CRC32C_POLY = 0x82F63B78            # Castagnoli (reflected)
+CRC64_POLY  = 0x42F0E1EBA9EA3693    # ECMA-182 (the original `hash_crc64()` table is built MSB-first)
+
+
+def reflected_table(poly):
+    table = []
+    for i in range(256):
+        crc = i
+        for _ in range(8):
+            crc = (crc >> 1) ^ poly if crc & 1 else crc >> 1
+        table.append(crc)
+    return table
+
+
+def msb_first_table(poly, bits):
+    top = 1 << (bits - 1)
+    mask = (1 << bits) - 1
+    table = []
+    for i in range(256):
+        crc = i << (bits - 8)
+        for _ in range(8):
+            crc = ((crc << 1) ^ poly) & mask if crc & top else (crc << 1) & mask
+        table.append(crc)
+    return table
+
+
+def slices(table):
+    out = [table]
+    for _ in range(1, NUM_SLICES):
+        prev = out[-1]
+        out.append([(prev[i] >> 8) ^ table[prev[i] & 0xFF] for i in range(256)])
+    return out
+
+
+def format_tables(tables, bits):
+    width = bits // 4
+    suffix = 'ull' if bits == 64 else ''
+    per_line = 4 if bits == 64 else 8
+    blocks = []
+    for table in tables:
+        lines = []
+        for i in range(0, 256, per_line):
+            lines.append('        ' + ', '.join('0x%0*x%s' % (width, v, suffix) for v in table[i:i + per_line]) + ',')
+        blocks.append('    {\n' + '\n'.join(lines) + '\n    },')
+    return '\n'.join(blocks)
+
+
+def update_file(file, content):
+    try:
+        with open(file, 'r') as fobj:
+            if fobj.read() == content:
+                return False
+    except (OSError, ValueError):
+        pass
+
+    with open(file, 'w') as fobj:
+        fobj.write(content)
+    return True
+
+
+hash_tables_h_template = """\
+// Auto-generated by tools/scripts/generate_crc_tables.py
+// DO NOT EDIT BY HAND. Re-run the script instead.
+
+#ifndef CORETEN_HASH_TABLES_H
+#define CORETEN_HASH_TABLES_H
+
+/*
+    Slicing-by-%d CRC tables. `TABLE[0]` is the usual bytewise table; `TABLE[k][i]` is the CRC contribution of byte 
+    `i` when it is followed by `k` more bytes.
+*/
+
+// CRC-32 (IEEE 802.3, reflected polynomial 0x%08X)
+static UInt32 const CORETEN__CRC32_TABLE[%d][256] = {
+%s
+};
+
+// CRC-32C (Castagnoli, reflected polynomial 0x%08X)
+static UInt32 const CORETEN__CRC32C_TABLE[%d][256] = {
+%s
+};
+
+// CRC-64 (ECMA-182 polynomial 0x%016X)
+static UInt64 const CORETEN__CRC64_TABLE[%d][256] = {
+%s
+};
+
+#endif // CORETEN_HASH_TABLES_H
+"""
+
+
+def main():
+    crc32 = slices(reflected_table(CRC32_POLY))
+    crc32c = slices(reflected_table(CRC32C_POLY))
+    crc64 = slices(msb_first_table(CRC64_POLY, 64))
+
+    content = hash_tables_h_template % (
+        NUM_SLICES,
+        CRC32_POLY, NUM_SLICES, format_tables(crc32, 32),
+        CRC32C_POLY, NUM_SLICES, format_tables(crc32c, 32),
+        CRC64_POLY, NUM_SLICES, format_tables(crc64, 64),
+    )
+    if update_file(OUTFILE, content):
+        print("%s regenerated" % os.path.relpath(OUTFILE, ROOT))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,197 @@
+# Generates the compressed Unicode property tables used by `utf8_category()` and friends
+# The input files (relative to the root) are:
+#   1. adorad/core/utf8_data.h          (utf8proc's stage1/stage2 tables)
+#   2. adorad/core/utf8_properties.h    (utf8proc's property records)
+#   3. adorad/core/utf8.h               (the category/bidi/boundclass enums)
+# and the output is:
+#   adorad/core/utf8_tables.h
+#
+# Usage (from the root):
+#   python tools/scripts/generate_utf8_tables.py
+#
+# The flat utf8proc tables map every codepoint to a ~20-byte record. We only keep the category, bidi class and
+# boundclass, pack them into 15 bits, and store the codepoint -> record mapping as a three-stage trie:
+#       top[cp >> (LEAF_SHIFT + MID_SHIFT)]  ->  a block number in `mid`
+#       mid[...]                             ->  a block number in `leaf`
+#       leaf[...]                            ->  an index into `records`
+# Identical blocks are stored once at every level, which is what makes the tables small.
+
+import os
+import re
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+UTF8_DATA_H       = os.path.join(ROOT, 'adorad', 'core', 'utf8_data.h')
+UTF8_PROPERTIES_H = os.path.join(ROOT, 'adorad', 'core', 'utf8_properties.h')
+UTF8_H            = os.path.join(ROOT, 'adorad', 'core', 'utf8.h')
+OUTFILE           = os.path.join(ROOT, 'adorad', 'core', 'utf8_tables.h')
+
+MAX_CODEPOINT = 0x110000
+
+# Field positions in a utf8proc property record
+FIELD_CATEGORY   = 0
+FIELD_BIDI_CLASS = 2
+FIELD_BOUNDCLASS = 16
+
+
+def load_array(source, name):
+    match = re.search(r'%s\[\]\s*=\s*\{(.*?)\};' % name, source, re.S)
+    return [int(x) for x in re.findall(r'\d+', match.group(1))]
+
+
+def load_enums(path):
+    with open(path) as fp:
+        return {m.group(1): int(m.group(2)) for m in re.finditer(r'(UTF8_[A-Z0-9_]+)\s*=\s*(\d+)', fp.read())}
+
+
+def load_properties(path, enums):
+    def value(token):
+        return int(token) if token.isdigit() else enums[token]
+
+    records = []
+    with open(path) as fp:
+        for line in fp:
+            line = line.strip()
+            if not line.startswith('{'):
+                continue
+            fields = [f.strip() for f in line.strip('{},').split(',')]
+            records.append(
+                value(fields[FIELD_CATEGORY]) |
+                (value(fields[FIELD_BIDI_CLASS]) << 5) |
+                (value(fields[FIELD_BOUNDCLASS]) << 10)
+            )
+    return records
+
+
+def dedup_blocks(seq, block_size):
+    """Split `seq` into blocks, storing identical blocks once. Returns (flattened unique blocks, block index list)"""
+    blocks = {}
+    flat = []
+    index = []
+    for i in range(0, len(seq), block_size):
+        block = tuple(seq[i:i + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            flat.extend(block)
+        index.append(blocks[block])
+    return flat, index
+
+
+def ctype_for(values):
+    return 'UInt8' if max(values) < 256 else 'UInt16'
+
+
+def build_trie(packed):
+    records = sorted(set(packed))
+    record_index = {v: i for i, v in enumerate(records)}
+    leaf_values = [record_index[v] for v in packed]
+
+    # Pick the block sizes that give the smallest tables
+    best = None
+    for leaf_shift in range(3, 9):
+        leaf, mid_values = dedup_blocks(leaf_values, 1 << leaf_shift)
+        for mid_shift in range(2, 9):
+            mid, top = dedup_blocks(mid_values, 1 << mid_shift)
+            # `mid` stores leaf block numbers, `top` stores mid block numbers
+            size = sum(len(t) * (1 if ctype_for(t) == 'UInt8' else 2) for t in (top, mid, leaf))
+            if best is None or size < best[0]:
+                best = (size, leaf_shift, mid_shift, top, mid, leaf)
+
+    size, leaf_shift, mid_shift, top, mid, leaf = best
+    return records, leaf_shift, mid_shift, top, mid, leaf, size + 2 * len(records)
+
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def update_file(file, content):
+    try:
+        with open(file, 'r') as fobj:
+            if fobj.read() == content:
+                return False
+    except (OSError, ValueError):
+        pass
+
+    with open(file, 'w') as fobj:
+        fobj.write(content)
+    return True
+
+
+utf8_tables_h_template = """\
+// Auto-generated by tools/scripts/generate_utf8_tables.py
+// DO NOT EDIT BY HAND. Re-run the script instead.
+
+#ifndef CORETEN_UTF8_TABLES_H
+#define CORETEN_UTF8_TABLES_H
+
+/*
+    Compressed Unicode property tables (%d bytes in total).
+    Derived from the utf8proc tables in `utf8_data.h` and `utf8_properties.h`.
+
+    Lookup:
+        mid_block  = utf8_trie_top[cp >> (UTF8_TRIE_LEAF_SHIFT + UTF8_TRIE_MID_SHIFT)]
+        leaf_block = utf8_trie_mid[(mid_block << UTF8_TRIE_MID_SHIFT) + ((cp >> UTF8_TRIE_LEAF_SHIFT) & UTF8_TRIE_MID_MASK)]
+        record     = utf8_trie_records[utf8_trie_leaf[(leaf_block << UTF8_TRIE_LEAF_SHIFT) + (cp & UTF8_TRIE_LEAF_MASK)]]
+
+    Each record packs (category | bidi_class << 5 | boundclass << 10).
+*/
+
+#define UTF8_TRIE_LEAF_SHIFT    %d
+#define UTF8_TRIE_MID_SHIFT     %d
+#define UTF8_TRIE_LEAF_MASK     ((1 << UTF8_TRIE_LEAF_SHIFT) - 1)
+#define UTF8_TRIE_MID_MASK      ((1 << UTF8_TRIE_MID_SHIFT) - 1)
+
+static const UInt16 utf8_trie_records[%d] = {
+%s
+};
+
+static const %s utf8_trie_top[%d] = {
+%s
+};
+
+static const %s utf8_trie_mid[%d] = {
+%s
+};
+
+static const %s utf8_trie_leaf[%d] = {
+%s
+};
+
+#endif // CORETEN_UTF8_TABLES_H
+"""
+
+
+def main():
+    with open(UTF8_DATA_H) as fp:
+        data = fp.read()
+    stage1 = load_array(data, 'utf8_stage1table')
+    stage2 = load_array(data, 'utf8_stage2table')
+    properties = load_properties(UTF8_PROPERTIES_H, load_enums(UTF8_H))
+
+    packed = [properties[stage2[stage1[cp >> 8] + (cp & 0xFF)]] for cp in range(MAX_CODEPOINT)]
+    records, leaf_shift, mid_shift, top, mid, leaf, size = build_trie(packed)
+
+    # Sanity check: the trie must reproduce every codepoint
+    for cp in range(MAX_CODEPOINT):
+        mid_block = top[cp >> (leaf_shift + mid_shift)]
+        leaf_block = mid[(mid_block << mid_shift) + ((cp >> leaf_shift) & ((1 << mid_shift) - 1))]
+        assert records[leaf[(leaf_block << leaf_shift) + (cp & ((1 << leaf_shift) - 1))]] == packed[cp], hex(cp)
+
+    content = utf8_tables_h_template % (
+        size,
+        leaf_shift, mid_shift,
+        len(records), format_array(records),
+        ctype_for(top), len(top), format_array(top),
+        ctype_for(mid), len(mid), format_array(mid),
+        ctype_for(leaf), len(leaf), format_array(leaf),
+    )
+    if update_file(OUTFILE, content):
+        print("%s regenerated (%d bytes of tables)" % (os.path.relpath(OUTFILE, ROOT), size))
+
+
+if __name__ == '__main__':
+    sys.exit(main())